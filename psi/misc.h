@@ -21,10 +21,11 @@
     #define PSI_PTRCAST(type, x)    ((type)x)
 #endif // __cplusplus
 
-// printf format-string specifiers for psi_i64 and psi_u64 respectively
+// printf format-string specifiers for psi_i64 and psi_u64 (in decimal and in hex) respectively
 #if defined(_MSC_VER) && (_MSC_VER < 1920)
     #define PSI_PRId64 "I64d"
     #define PSI_PRIu64 "I64u"
+    #define PSI_PRIx64 "I64x"
 #else
     // Avoid spurious trailing ‘%’ in format error
 	// See: https://stackoverflow.com/questions/8132399/how-to-printf-uint64-t-fails-with-spurious-trailing-in-format
@@ -33,6 +34,7 @@
 
     #define PSI_PRId64 PRId64
     #define PSI_PRIu64 PRIu64
+    #define PSI_PRIx64 PRIx64
 #endif
 
 #ifndef PSI_IS_SIGNED
@@ -12,6 +12,12 @@
 #ifndef PSI_H_
 #define PSI_H_
 
+// The parallel runner needs POSIX/BSD interfaces (`fork`, `mmap`, `pread`, ...), which glibc hides under a strict
+// `-std=c11`. This only takes effect if `psi.h` is included before any system header.
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE) && !defined(_GNU_SOURCE) && !defined(_POSIX_C_SOURCE)
+    #define _DEFAULT_SOURCE
+#endif // _WIN32
+
 #include <psi/types.h>
 #include <psi/misc.h>
 
@@ -21,16 +27,24 @@ PSI_DISABLE_DEBUG_WARNINGS
 #include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
+#include <math.h>
 
 #if defined(unix) || defined(__unix__) || defined(__unix) || defined(__APPLE__)
     #define PSI_UNIX_   1
     #include <errno.h>
+    #include <dirent.h>
     #include <libgen.h>
     #include <unistd.h>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/mman.h>
+    #include <sys/resource.h>
+    #include <sys/stat.h>
     #include <sys/types.h>
     #include <sys/wait.h>
     #include <signal.h>
     #include <time.h>
+    #include <pthread.h>
 
     #if defined(CLOCK_PROCESS_CPUTIME_ID) && defined(CLOCK_MONOTONIC)
         #define PSI_HAS_POSIX_TIMER_    1
@@ -57,6 +71,15 @@ PSI_DISABLE_DEBUG_WARNINGS
     #endif // __has_include(<valgrind.h>)
 #endif // __has_include
 
+// The sampling profiler (`--profile=<dir>`): SIGPROF, and a stack walker that's safe to call from its handler
+#if defined(PSI_UNIX_) && defined(__has_include)
+    #if __has_include(<execinfo.h>)
+        #define PSI_HAS_PROFILER_   1
+        #include <execinfo.h>
+        #include <sys/time.h>
+    #endif // __has_include(<execinfo.h>)
+#endif // PSI_UNIX_
+
 #ifdef __cplusplus
     #define PSI_C_FUNC   extern "C"
     #define PSI_EXTERN   extern "C"
@@ -98,56 +121,330 @@ PSI_DISABLE_DEBUG_WARNINGS
     #define PSI_UNUSED   __attribute__((unused))
 #endif // _MSC_VER
 
+// `__thread` works the same from C and C++, so both languages can share the same thread-local state
+#if defined(_MSC_VER)
+    #define PSI_THREAD_LOCAL    __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define PSI_THREAD_LOCAL    __thread
+#elif defined(__cplusplus)
+    #define PSI_THREAD_LOCAL    thread_local
+#else
+    #define PSI_THREAD_LOCAL    _Thread_local
+#endif // _MSC_VER
+
+// Atomic operations on the counters shared between runner threads (and forked workers, which only exist on Unix)
+#if defined(_MSC_VER)
+    #define PSI_ATOMIC_FETCH_ADD(ptr, val)                                                                        \
+        (sizeof(*(ptr)) == 8                                                                                      \
+            ? PSI_CAST(psi_u64, InterlockedExchangeAdd64(PSI_PTRCAST(volatile LONG64*, (ptr)), PSI_CAST(LONG64, val))) \
+            : PSI_CAST(psi_u64, InterlockedExchangeAdd(PSI_PTRCAST(volatile LONG*, (ptr)), PSI_CAST(LONG, val))))
+    // Only used on the 64-bit words of the work scheduler
+    #define PSI_ATOMIC_LOAD(ptr)            PSI_ATOMIC_FETCH_ADD(ptr, 0)
+    #define PSI_ATOMIC_STORE(ptr, val)                                                                            \
+        InterlockedExchange64(PSI_PTRCAST(volatile LONG64*, (ptr)), PSI_CAST(LONG64, val))
+    #define PSI_ATOMIC_CAS(ptr, expected, desired)                                                                \
+        (InterlockedCompareExchange64(PSI_PTRCAST(volatile LONG64*, (ptr)), PSI_CAST(LONG64, desired),            \
+                                      PSI_CAST(LONG64, expected)) == PSI_CAST(LONG64, expected))
+#else
+    #define PSI_ATOMIC_FETCH_ADD(ptr, val)  __atomic_fetch_add((ptr), (val), __ATOMIC_SEQ_CST)
+    #define PSI_ATOMIC_LOAD(ptr)            __atomic_load_n((ptr), __ATOMIC_SEQ_CST)
+    #define PSI_ATOMIC_STORE(ptr, val)      __atomic_store_n((ptr), (val), __ATOMIC_SEQ_CST)
+    #define PSI_ATOMIC_CAS(ptr, expected, desired)  __sync_bool_compare_and_swap((ptr), (expected), (desired))
+#endif // _MSC_VER
+
+#ifdef _MSC_VER
+    #define PSI_SNPRINTF(BUFFER, N, ...)   _snprintf_s(BUFFER, N, N, __VA_ARGS__)
+#else
+    #define PSI_SNPRINTF(...)              snprintf(__VA_ARGS__)
+#endif // _MSC_VER
+
+// How many performance counters `--perf-counters` can count at once
+#define PSI_MAX_PERF_COUNTERS_  8
+// How many failed assertions of a test `--trace` marks on its timeline
+#define PSI_MAX_TRACE_FAILURES_ 8
+
 #ifndef PSI_NO_TESTING
 
+// How many fields of a `TEST_P` row are split out. The rest stay in the last one.
+#define PSI_MAX_PARAM_FIELDS_   16
+
+// A run of characters inside a `TEST_P` data file. Not NUL-terminated.
+typedef struct psiFieldStruct {
+    const char* data;
+    psi_ull size;
+} psiFieldStruct;
+
+// What a `TEST_P` body gets: one row of its data file, split at the commas
+typedef struct psiParamStruct {
+    psiFieldStruct row;         // The whole line, without its line break
+    psi_ull lineNumber;         // Starting at 1
+    psi_ull numFields;
+    psiFieldStruct fields[PSI_MAX_PARAM_FIELDS_];   // Past `numFields`, empty
+} psiParamStruct;
+
 typedef void (*psi_testsuite_t)();
+typedef void (*psi_param_testsuite_t)(const psiParamStruct* const);
 typedef struct psiTestSuiteStruct {
     psi_testsuite_t func;
-    char* name;
+    const char* name;
+    // A `TEST_P` has a body that takes a row instead of `func`, and the file the rows come from (relative paths
+    // are looked up next to `sourceFile` if they aren't found in the working directory)
+    psi_param_testsuite_t paramFunc;
+    const char* dataFile;
+    const char* sourceFile;
+    // `psi_main` turns every row of a `TEST_P` into a test of its own, pointing right into the mapped file.
+    // `row.data` is PSI_NULL if the file couldn't be read or had no rows.
+    psiFieldStruct row;
+    psi_ull lineNumber;
+    // A test added with `psiRegisterTest` calls this instead of `func`, with `ctx`
+    void (*ctxFunc)(void*);
+    void* ctx;
+    // Next test in the registration list (see `psiRegisterTestSuite_`)
+    struct psiTestSuiteStruct* next;
 } psiTestSuiteStruct;
 
+/**
+    What a `BENCHMARK` body gets: how many iterations to run this time, and - once its `BENCHMARK_LOOP` has run -
+    when that loop started and stopped.
+*/
+typedef struct psiBenchmarkStateStruct {
+    psi_u64 iterations;
+    psi_u64 n;          // The input size of a `BENCHMARK_RANGE`, 0 otherwise
+    psi_u64 (*clock)(void);  // The runner's `psiClock`: the `--time` setting lives in its translation unit
+    int isTimed;        // Set by `BENCHMARK_LOOP`. Without one, the whole body is timed.
+    psi_u64 start;
+    psi_u64 stop;
+} psiBenchmarkStateStruct;
+
+typedef void (*psi_benchmark_t)(psiBenchmarkStateStruct* const);
+typedef struct psiBenchmarkStruct {
+    psi_benchmark_t func;
+    const char* name;
+    // The input sizes of a `BENCHMARK_RANGE`: `rangeLo`, times `rangeMultiplier` until `rangeHi`. All 0 otherwise.
+    psi_u64 rangeLo;
+    psi_u64 rangeHi;
+    psi_u64 rangeMultiplier;
+    struct psiBenchmarkStruct* next;
+} psiBenchmarkStruct;
+
 typedef struct psiTestStateStruct {
+    // Every registered test, in registration order. Built from `registered` when `psi_main` starts.
     psiTestSuiteStruct* tests;
     psi_ull numTestSuites;
     FILE* foutput;
+    // Every `TEST`/`TEST_F` has a static descriptor that its initializer pushes onto this list (newest first)
+    psiTestSuiteStruct* registered;
+    // Cleared in `psi_main` if stdout isn't a terminal, or if the cmdline option `--no-color` is passed. Lives
+    // here so that every translation unit's failure messages see it.
+    int shouldColourizeOutput;
+    // Every `BENCHMARK`, newest first. They only run with `--benchmark`.
+    psiBenchmarkStruct* benchmarks;
+    // Whether the allocation hooks are compiled into this binary (`PSI_TRACK_ALLOCS`)
+    int tracksAllocs;
+    // Every test added with `psiRegisterTest`, in the order they were added. They own their names.
+    psiTestSuiteStruct* dynamicTests;
+    psi_ull numDynamicTests;
+    psi_ull dynamicTestsCapacity;
+    // How many cases every `PROPERTY` tries (`--property-cases=N`, 0 for the default), the seed of the first one
+    // (`--property-seed=S`, random unless `hasPropertySeed`), and how many threads run them
+    // (`--property-threads=N`). Set by the runner, read by the properties in every translation unit.
+    psi_u64 propertyCases;
+    psi_u64 propertySeed;
+    int hasPropertySeed;
+    psi_ull propertyThreads;
+    // The `PSI_FUZZ` target `--fuzz=<target>` fuzzes (instead of running the tests), and when it stops: after
+    // `--fuzz-runs=N` inputs, or `--fuzz-time=S` (in nanoseconds here); 0 for never. And the longest input it
+    // tries (`--fuzz-max-len=N`, 0 for the default), and where the corpora are (`--corpus=<dir>`).
+    const char* fuzzTarget;
+    psi_u64 fuzzRuns;
+    psi_u64 fuzzTime;
+    psi_ull fuzzMaxLength;
+    const char* corpusDir;
+    // One hit counter per edge of the code built with `-fsanitize-coverage=trace-pc-guard`, from index 1 (see
+    // `PSI_FUZZ_COVERAGE`). Never freed: instrumented code can still run after `main` returns.
+    psi_u8* coverage;
+    psi_ull numCoverage;
+    // The most a failed string check prints of its diff (`--diff-max-bytes=N`, 0 for the default)
+    psi_ull diffMaxBytes;
 } psiTestStateStruct;
 
+// What a test cost the process it ran in (`--rusage`). Sizes are in KiB.
+typedef struct psiUsageStruct {
+    psi_u64 maxRss;             // The high-water mark of the process, once the test was done
+    psi_u64 rssGrowth;          // How much the test raised it
+    psi_u64 minorFaults;
+    psi_u64 majorFaults;
+    psi_u64 voluntarySwitches;
+    psi_u64 involuntarySwitches;
+} psiUsageStruct;
+
 static psi_u64 psiStatsTotalTestSuites = 0;
 static psi_u64 psiStatsTestsRan = 0;
 static psi_u64 psiStatsNumTestsFailed = 0;
 static psi_u64 psiStatsSkippedTests = 0;
 static psi_ull* psiStatsFailedTestSuites = PSI_NULL;
 static psi_ull psiStatsNumFailedTestSuites = 0;
+// Per registered test: how long it took (in ns), or < 0 if it didn't run
+static double* psiStatsTestDurations = PSI_NULL;
+// Per registered test: its resource usage, if it ran and that was collected
+static psiUsageStruct* psiStatsTestUsage = PSI_NULL;
+// Per registered test: how long it took last time, according to the timing cache (< 0 if unknown)
+static double* psiCachedDurations = PSI_NULL;
+// Per registered test: whether it belongs to the shard this run executes
+static char* psiIsInShard = PSI_NULL;
+// The data files of the `TEST_P`s, mapped for as long as the tests run, and the names of their rows
+typedef struct psiDataFileStruct {
+    const char* data;
+    psi_ull size;
+} psiDataFileStruct;
+static psiDataFileStruct* psiDataFiles = PSI_NULL;
+static psi_ull psiNumDataFiles = 0;
+static char* psiParamNames = PSI_NULL;
 extern psi_u64 psiStatsNumWarnings;
 
-// Overridden in `psi_main` if the cmdline option `--no-color` is passed
-static int psiShouldColourizeOutput = 1;
+// Whether stdout is a terminal: if so, the results of tests run by workers are flushed as soon as they come in
+static int psiOutputIsTerminal = 0;
 static int psiDisableSummary = 0;
 static int psiDisplayOnlyFailedOutput = 0;
 static int psiDisplayTests = 0;
+// Number of workers used to run the tests (`--jobs=N`). 1 runs every test serially in-process.
+static psi_ull psiNumJobs = 1;
+// Run the workers as threads inside this process instead of forked processes (`--threads`)
+static int psiUseThreads = 0;
+// The clock test durations are measured with: one of the `PSI_TIMER_*` values (`--time=TIMER`)
+static int psiTimer = 0;
+// Run the benchmarks instead of the tests (`--benchmark`)
+static int psiBenchmarkMode = 0;
+// How many samples each benchmark is measured over (`--benchmark-samples=N`), and how long a sample takes at
+// least, in ns (`--benchmark-min-time=<ms>`)
+static psi_ull psiBenchmarkSamples = 20;
+static psi_u64 psiBenchmarkMinTime = 10000000;
+// File the samples of every benchmark are compared against (`--benchmark-baseline=<file>`), and the one they're
+// written to for a later run to compare against (`--benchmark-save=<file>`)
+static const char* psiBenchmarkBaselinePath = PSI_NULL;
+static const char* psiBenchmarkSavePath = PSI_NULL;
+// How much slower than the baseline (in %) a benchmark has to be to fail (`--benchmark-threshold=<percent>`)
+static double psiBenchmarkThreshold = 5;
+// The performance counters every test is measured with (`--perf-counters=...`), as indices into
+// `psiPerfCounterTable`
+static int psiPerfCounters[PSI_MAX_PERF_COUNTERS_];
+static psi_ull psiNumPerfCounters = 0;
+// Collect the resource usage of every test (`--rusage`, `--sort-by`), and print it with each result (`--rusage`)
+static int psiCollectUsage = 0;
+static int psiPrintUsage = 0;
+// Which tests the summary lists as the most expensive (`--sort-by=KEY`, one of the `PSI_SORT_BY_*` values),
+// and how many (`--top=N`)
+static int psiSortBy = 0;
+static psi_ull psiTopTests = 10;
+// How many of the slowest tests the summary lists, next to the time per suite and the spread of the durations
+// (`--durations=N`)
+static psi_ull psiNumSlowestTests = 0;
+// File the duration of every test is recorded in, and read back from to schedule the longest tests first
+// (`--timing-cache=<file>`)
+static const char* psiTimingCachePath = PSI_NULL;
+// Only run one of several disjoint shards of the tests (`--shard-index=I --shard-count=N`)
+static psi_ull psiShardIndex = 0;
+static psi_ull psiShardCount = 1;
+// Split the shards by the durations in the timing cache instead of by name (`--shard-balance`)
+static int psiShardBalance = 0;
+// Trace-event JSON file the timeline of the run is written to (`--trace=<file>`), how many events are in it, and
+// the real time its timestamps count from
+static const char* psiTracePath = PSI_NULL;
+static FILE* psiTraceFile = PSI_NULL;
+static psi_ull psiTraceNumEvents = 0;
+static psi_u64 psiTraceStart = 0;
+// Directory the sampling profiler writes a folded-stack file per test into (`--profile=<dir>`)
+static const char* psiProfileDir = PSI_NULL;
+#ifdef PSI_HAS_PROFILER_
+    #define PSI_PROFILE_INTERVAL_US_    1000
+    #define PSI_PROFILE_MAX_DEPTH_      64
+    #define PSI_PROFILE_MAX_SAMPLES_    16384
+    // The handler's own frame and the signal trampoline
+    #define PSI_PROFILE_SKIP_FRAMES_    2
+
+typedef struct psiProfileSampleStruct {
+    int depth;
+    void* frames[PSI_PROFILE_MAX_DEPTH_];
+} psiProfileSampleStruct;
+
+// Allocated by the first profiled test
+static psiProfileSampleStruct* psiProfileSamples = PSI_NULL;
+static psi_ull psiProfileNumSamples = 0;     // Claimed slots, including the ones past the end of the buffer
+#endif // PSI_HAS_PROFILER_
 
 static const char* psi_argv0_ = PSI_NULL;
 static const char* cmd_filter = PSI_NULL;
 #endif // PSI_NO_TESTING
 
-/**
-    This helps us determine whether a CHECK or a REQUIRE are being called from within (or outside)
-    a Test Suite. Psi supports both - so we need to handle this.
+// A growable character buffer
+typedef struct psiBufferStruct {
+    char* data;
+    psi_ull size;
+    psi_ull capacity;
+} psiBufferStruct;
+
+// Where Psi's output goes. Everything is formatted once, and then copied to each sink it is meant for.
+#define PSI_SINK_TERMINAL_      1   // stdout
+#define PSI_SINK_REPORT_        2   // The XUnit file (`--output=<FILE>`)
+#define PSI_NUM_SINKS_          2
+// When stdout isn't a terminal, finished records are only handed over to the sinks once this much is pending
+#define PSI_OUTPUT_BATCH_SIZE_  (64 * 1024)
+
+// The heap use of the test running on a thread (`PSI_TRACK_ALLOCS`). Sizes are as rounded up by the allocator.
+typedef struct psiAllocStatsStruct {
+    int isTracking;         // Only set while a test runs, and only if the allocation hooks are compiled in
+    psi_u64 numAllocs;
+    psi_u64 numFrees;
+    psi_u64 bytes;          // Allocated in total
+    psi_i64 liveBytes;      // Goes below 0 if the test frees memory allocated before it started
+    psi_i64 peakBytes;
+} psiAllocStatsStruct;
 
-    We could have somehow determined this from within a function, but this is a cleaner approach
-    (which is the Psi's aim).
+/**
+    The state of the test currently running on this thread. Every thread has its own copy, so the threaded
+    runner (`--threads`) can run several tests at once.
 
+    `checkIsInsideTestSuite` helps us determine whether a CHECK or a REQUIRE are being called from within (or
+    outside) a Test Suite. Psi supports both - so we need to handle this.
     Inside the TEST() initializer, this is set to `true` (because we are inside a Test Suite), so the
     `CHECK`s and `REQUIRE`s will do their thing and return the appropriate result.
-    If the assertion macro is not within the `TEST()` scope, it simply does not return anything - it only
-    resets it back to false so that this same process occurs for the rest of the checks.
+    If the assertion macro is not within the `TEST()` scope, it simply does not return anything.
 */
-extern volatile int checkIsInsideTestSuite;
-extern volatile int hasCurrentTestFailed;
+typedef struct psiThreadContextStruct {
+    int checkIsInsideTestSuite;
+    int hasCurrentTestFailed;
+    int shouldFailTest;
+    int shouldAbortTest;
+    // If set, everything Psi prints on this thread is appended here instead of going to stdout
+    psiBufferStruct* capture;
+    // If set, what Psi prints on this thread for the XUnit file is appended here, for the process that owns the
+    // file to add to the test's record. Captured output without it never reaches the file.
+    psiBufferStruct* captureReport;
+    // Output formatted on this thread that hasn't been handed to the sinks yet, one buffer per sink (indexed
+    // by the sink's bit position). See `psiWriteOutput`.
+    psiBufferStruct pending[PSI_NUM_SINKS_];
+    // This thread's group of performance counters (`--perf-counters`), leader first. Opened by the first test the
+    // thread runs; `numPerfFds` is -1 if that failed.
+    int perfFds[PSI_MAX_PERF_COUNTERS_];
+    int numPerfFds;
+    psiAllocStatsStruct allocs;
+    // When the first failed assertions of the running test failed, on the real timer (for `--trace`)
+    psi_u64 failureTimes[PSI_MAX_TRACE_FAILURES_];
+    psi_ull numFailureTimes;
+    // The case of the `PROPERTY` running on this thread, which the generators draw from
+    struct psiPropertyCaseStruct* propertyCase;
+} psiThreadContextStruct;
+
+#ifndef PSI_NO_TESTING
+PSI_EXTERN PSI_THREAD_LOCAL psiThreadContextStruct psiThreadContext;
+#else
+// Never written to: without the runner, a failing assertion aborts straight away
+static psiThreadContextStruct psiThreadContext = {0, 0, 0, 0, PSI_NULL, {{PSI_NULL, 0, 0}, {PSI_NULL, 0, 0}},
+                                                   {0, 0, 0, 0, 0, 0, 0, 0}, 0, {0, 0, 0, 0, 0, 0},
+                                                   {0, 0, 0, 0, 0, 0, 0, 0}, 0, PSI_NULL};
+#endif // PSI_NO_TESTING
 
 #ifndef PSI_NO_TESTING
-extern volatile int shouldFailTest;
-extern volatile int shouldAbortTest;
 
 /**
     This function is called from within a macro in the format {CHECK|REQUIRE)_*
@@ -157,18 +454,21 @@ extern volatile int shouldAbortTest;
 */
 static void failIfInsideTestSuite__();
 static void abortIfInsideTestSuite__();
+static void psiMarkFailure_();
 
 static void failIfInsideTestSuite__() {
-    if(checkIsInsideTestSuite == 1) {
-        hasCurrentTestFailed = 1;
-        shouldFailTest = 1;
+    if(psiThreadContext.checkIsInsideTestSuite == 1) {
+        psiThreadContext.hasCurrentTestFailed = 1;
+        psiThreadContext.shouldFailTest = 1;
+        psiMarkFailure_();
     }
 }
 
 static void abortIfInsideTestSuite__() {
-    if(checkIsInsideTestSuite == 1) {
-        hasCurrentTestFailed = 1;
-        shouldAbortTest = 1;
+    if(psiThreadContext.checkIsInsideTestSuite == 1) {
+        psiThreadContext.hasCurrentTestFailed = 1;
+        psiThreadContext.shouldAbortTest = 1;
+        psiMarkFailure_();
     }
 }
 
@@ -176,7 +476,7 @@ static void abortIfInsideTestSuite__() {
 
 static void incrementWarnings() {
 #ifndef PSI_NO_TESTING
-    psiStatsNumWarnings++;
+    PSI_ATOMIC_FETCH_ADD(&psiStatsNumWarnings, 1);
 #endif // PSI_NO_TESTING
 }
 
@@ -232,64 +532,323 @@ PSI_EXTERN psiTestStateStruct psiTestContext;
     #include <mach/mach_time.h>
 #endif // _MSC_VER
 
+#if defined(PSI_HAS_POSIX_TIMER_)
+    typedef clockid_t psi_clockid_t_;
+    #define PSI_CLOCK_MONOTONIC_            CLOCK_MONOTONIC
+    #define PSI_CLOCK_PROCESS_CPUTIME_      CLOCK_PROCESS_CPUTIME_ID
+    #define PSI_CLOCK_THREAD_CPUTIME_       CLOCK_THREAD_CPUTIME_ID
+#elif defined(__linux__)
+    // Strict ISO C modes (`-std=c11`) hide the POSIX clocks in <time.h>, but every Linux libc has them - with
+    // these ids
+    PSI_C_FUNC int clock_gettime(int, struct timespec*);
+    typedef int psi_clockid_t_;
+    #define PSI_CLOCK_MONOTONIC_            1
+    #define PSI_CLOCK_PROCESS_CPUTIME_      2
+    #define PSI_CLOCK_THREAD_CPUTIME_       3
+    #define PSI_HAS_POSIX_TIMER_            1
+#endif // PSI_HAS_POSIX_TIMER_
+
+// The time-stamp counter of x86 CPUs (`--time=tsc`)
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define PSI_HAS_TSC_    1
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+        #include <cpuid.h>
+    #endif // _MSC_VER
+#endif // x86
+
+// The vector instructions `psiFindByte_` uses: the widest the compiler targets
+#if defined(__AVX2__)
+    #define PSI_HAS_AVX2_   1
+    #include <immintrin.h>
+#endif // __AVX2__
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define PSI_HAS_SSE2_   1
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define PSI_HAS_NEON_   1
+    #include <arm_neon.h>
+#endif // __SSE2__
+
+// Hardware performance counters (`--perf-counters=...`), through Linux's perf_event_open
+#if defined(__linux__) && defined(__has_include)
+    #if __has_include(<linux/perf_event.h>)
+        #define PSI_HAS_PERF_COUNTERS_  1
+        #include <linux/perf_event.h>
+        #include <sys/ioctl.h>
+        #include <sys/syscall.h>
+        #ifndef __cplusplus
+            // Strict ISO C modes (`-std=c11`) hide it in <unistd.h>
+            long syscall(long, ...);
+        #endif // __cplusplus
+    #endif // __has_include(<linux/perf_event.h>)
+#endif // __linux__
+
+// What the summary can rank the tests by (`--sort-by=KEY`)
+#define PSI_SORT_BY_NONE_       0
+#define PSI_SORT_BY_RSS_        1   // How much each test grew the high-water mark of its process
+#define PSI_SORT_BY_FAULTS_     2   // Minor and major page faults
+#define PSI_SORT_BY_TIME_       3
+
+// Resource usage (`--rusage`): for threads, faults and context switches are counted per thread where possible
+#ifdef PSI_UNIX_
+    #if defined(RUSAGE_THREAD)
+        #define PSI_RUSAGE_THREAD_  RUSAGE_THREAD
+    #elif defined(__linux__)
+        // Strict ISO C modes hide it, but Linux has had it since 2.6.26
+        #define PSI_RUSAGE_THREAD_  1
+    #else
+        #define PSI_RUSAGE_THREAD_  RUSAGE_SELF
+    #endif // RUSAGE_THREAD
+#endif // PSI_UNIX_
+
+// The clocks test durations can be measured with (`--time=TIMER`)
+#define PSI_TIMER_REAL_         0   // Monotonic wall-clock time
+#define PSI_TIMER_CPU_          1   // CPU time used by the whole process
+#define PSI_TIMER_THREAD_CPU_   2   // CPU time used by the calling thread (`cpu`, when the tests run on threads)
+#define PSI_TIMER_TSC_          3   // The time-stamp counter, calibrated against the real timer
+
+// Nanoseconds per tick of the time-stamp counter, and its value when it was calibrated (see `psiCalibrateTsc`)
+static double psiTscNsPerTick = 0;
+static psi_u64 psiTscBase = 0;
+
+#ifdef PSI_HAS_POSIX_TIMER_
+static inline psi_u64 psiClockGettime_(const psi_clockid_t_ clockId) {
+    struct timespec ts;
+    #if defined(__linux__) && !defined(PSI_USE_CLOCKGETTIME)
+        syscall(SYS_clock_gettime, clockId, &ts);
+    #else
+        clock_gettime(clockId, &ts);
+    #endif
+    return PSI_CAST(psi_u64, ts.tv_sec) * 1000000000 + PSI_CAST(psi_u64, ts.tv_nsec);
+}
+#endif // PSI_HAS_POSIX_TIMER_
+
+#ifdef PSI_WIN_
+// FILETIMEs count 100ns intervals
+static inline psi_u64 psiFileTimeToNs_(const FILETIME* const kernel, const FILETIME* const user) {
+    return ((PSI_CAST(psi_u64, kernel->dwHighDateTime) << 32 | kernel->dwLowDateTime) +
+            (PSI_CAST(psi_u64, user->dwHighDateTime) << 32 | user->dwLowDateTime)) * 100;
+}
+#endif // PSI_WIN_
+
 /**
     Psi Timer
-    This method is useful in timing the execution of an Psi Test Suite
-    To use this, simply call this function before and after the particular code block you want to time,
-    and their difference will give you the time (in seconds).
-    NOTE: This method has been edited to return the time (in nanoseconds). Depending on how large this value
-    (e.g: 54890938849ns), we appropriately convert it to milliseconds/seconds before displaying it to stdout.
+    Returns the current reading of the given timer (one of the `PSI_TIMER_*` values), in nanoseconds. Call it
+    before and after the code you want to time, and the difference is how long it took.
+    The real timer is monotonic, so the durations it measures aren't thrown off when the system time is
+    adjusted. Timers a platform doesn't have fall back to the real timer.
 */
-static inline double psiClock() {
+static inline psi_u64 psiClockRead(const int timer) {
+#ifdef PSI_HAS_TSC_
+    if(timer == PSI_TIMER_TSC_ && psiTscNsPerTick > 0)
+        return PSI_CAST(psi_u64, PSI_CAST(double, __rdtsc() - psiTscBase) * psiTscNsPerTick);
+#endif // PSI_HAS_TSC_
+
 #ifdef PSI_WIN_
-    LARGE_INTEGER counter;
-    LARGE_INTEGER frequency;
-    QueryPerformanceCounter(&counter);
-    QueryPerformanceFrequency(&frequency);
-    return PSI_CAST(double, (counter.QuadPart * 1000 * 1000 * 1000) / frequency.QuadPart); // in nanoseconds
+    {
+        FILETIME creation, exited, kernel, user;
+        if(timer == PSI_TIMER_CPU_ && GetProcessTimes(GetCurrentProcess(), &creation, &exited, &kernel, &user))
+            return psiFileTimeToNs_(&kernel, &user);
+        if(timer == PSI_TIMER_THREAD_CPU_ && GetThreadTimes(GetCurrentThread(), &creation, &exited, &kernel, &user))
+            return psiFileTimeToNs_(&kernel, &user);
+    }
+    {
+        static LARGE_INTEGER frequency;
+        LARGE_INTEGER counter;
+        if(frequency.QuadPart == 0)
+            QueryPerformanceFrequency(&frequency);
+        QueryPerformanceCounter(&counter);
+        // Split up, so that `counter * 10^9` can't overflow
+        return PSI_CAST(psi_u64, counter.QuadPart / frequency.QuadPart) * 1000000000 +
+               PSI_CAST(psi_u64, counter.QuadPart % frequency.QuadPart) * 1000000000 /
+               PSI_CAST(psi_u64, frequency.QuadPart);
+    }
 
-#elif defined(__linux) && defined(__STRICT_ANSI__)
-    return PSI_CAST(double, clock()) * 1000000000 / CLOCKS_PER_SEC; // in nanoseconds
+#elif defined(PSI_HAS_POSIX_TIMER_)
+    switch(timer) {
+        case PSI_TIMER_CPU_:         return psiClockGettime_(PSI_CLOCK_PROCESS_CPUTIME_);
+        case PSI_TIMER_THREAD_CPU_:  return psiClockGettime_(PSI_CLOCK_THREAD_CPUTIME_);
+        default:                     return psiClockGettime_(PSI_CLOCK_MONOTONIC_);
+    }
 
-#elif defined(__linux)
-    struct timespec ts;
-    #if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
-        timespec_get(&ts, TIME_UTC);
-    #else
-        const clockid_t cid = CLOCK_REALTIME;
-        #if defined(PSI_USE_CLOCKGETTIME)
-            clock_gettime(cid, &ts);
-        #else
-            syscall(SYS_clock_gettime, cid, &ts);
-        #endif
-    #endif
-    return PSI_CAST(double, ts.tv_sec) * 1000 * 1000 * 1000 + PSI_CAST(double, ts.tv_nsec); // in nanoseconds
+#elif defined(__APPLE__)
+    {
+        static mach_timebase_info_data_t timebase;
+        (void)timer;
+        if(timebase.denom == 0)
+            mach_timebase_info(&timebase);
+        return PSI_CAST(psi_u64, mach_absolute_time()) * timebase.numer / timebase.denom;
+    }
 
-#elif __APPLE__
-    return PSI_CAST(double, mach_absolute_time());
+#else
+    (void)timer;
+    return PSI_CAST(psi_u64, clock()) * 1000000000 / CLOCKS_PER_SEC;
 #endif // PSI_WIN_
 }
 
-static void psiClockPrintDuration(const double nanoseconds_duration) {
-    psi_u64 n;
-    int num_digits = 0;
-    n = PSI_CAST(psi_u64, nanoseconds_duration);
-    while(n!=0) {
-        n/=10;
-        ++num_digits;
+/**
+    Measures how many nanoseconds a tick of the time-stamp counter takes, against the real timer. Fails unless
+    the CPU has an invariant TSC (one that ticks at the same rate on every core, whatever their frequency).
+*/
+static psi_bool psiCalibrateTsc() {
+#ifdef PSI_HAS_TSC_
+    unsigned int regs[4] = {0, 0, 0, 0};
+    #if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, PSI_CAST(int, 0x80000000));
+        if(PSI_CAST(unsigned int, info[0]) >= 0x80000007) {
+            __cpuid(info, PSI_CAST(int, 0x80000007));
+            regs[3] = PSI_CAST(unsigned int, info[3]);
+        }
+    #else
+        if(__get_cpuid_max(0x80000000, PSI_NULL) >= 0x80000007)
+            __get_cpuid(0x80000007, &regs[0], &regs[1], &regs[2], &regs[3]);
+    #endif // _MSC_VER
+    if(!(regs[3] & (1u << 8)))
+        return psi_false;
+
+    // 10ms is plenty for an error well below a microsecond per second
+    const psi_u64 startNs = psiClockRead(PSI_TIMER_REAL_);
+    const psi_u64 startTicks = __rdtsc();
+    psi_u64 endNs;
+    do {
+        endNs = psiClockRead(PSI_TIMER_REAL_);
+    } while(endNs - startNs < 10000000);
+    const psi_u64 endTicks = __rdtsc();
+
+    psiTscBase = startTicks;
+    psiTscNsPerTick = PSI_CAST(double, (endNs - startNs)) / PSI_CAST(double, (endTicks - startTicks));
+    return psi_true;
+#else
+    return psi_false;
+#endif // PSI_HAS_TSC_
+}
+
+#ifndef PSI_NO_TESTING
+static void psiMarkFailure_() {
+    if(psiThreadContext.numFailureTimes < PSI_MAX_TRACE_FAILURES_)
+        psiThreadContext.failureTimes[psiThreadContext.numFailureTimes++] = psiClockRead(PSI_TIMER_REAL_);
+}
+#endif // PSI_NO_TESTING
+
+// Reads the timer picked on the cmdline
+static inline psi_u64 psiClock() {
+    return psiClockRead(psiTimer);
+}
+
+/**
+    Performance Counters (`--perf-counters=cycles,instructions,...`)
+    Every thread that runs tests opens its own group of counters, which only counts that thread, in user space.
+    The group is read all at once, and scaled up if the kernel had to share the hardware with other groups.
+    Where perf_event_open isn't allowed (in most containers, say) or a counter doesn't exist, psi warns and goes
+    on without that counter.
+*/
+#ifdef PSI_HAS_PERF_COUNTERS_
+typedef struct psiPerfCounterStruct {
+    const char* name;
+    unsigned int type;
+    psi_u64 config;
+} psiPerfCounterStruct;
+
+static const psiPerfCounterStruct psiPerfCounterTable[] = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"cache-references", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+    {"cache-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"branches", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+    {"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"page-faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+    {"context-switches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES}
+};
+
+// Returns the new counter's fd, or -1. Without a `group`, it opens a new (disabled) group leader.
+static int psiPerfOpenCounter_(const int counter, const int group) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = psiPerfCounterTable[counter].type;
+    attr.config = psiPerfCounterTable[counter].config;
+    attr.disabled = group < 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return PSI_CAST(int, syscall(__NR_perf_event_open, &attr, 0, -1, group, 0));
+}
+#endif // PSI_HAS_PERF_COUNTERS_
+
+static void psiPerfClose() {
+#ifdef PSI_HAS_PERF_COUNTERS_
+    for(int i = 0; i < psiThreadContext.numPerfFds; i++)
+        close(psiThreadContext.perfFds[i]);
+#endif // PSI_HAS_PERF_COUNTERS_
+    psiThreadContext.numPerfFds = 0;
+}
+
+// Opens the calling thread's group of counters
+static void psiPerfOpen() {
+#ifdef PSI_HAS_PERF_COUNTERS_
+    for(psi_ull i = 0; i < psiNumPerfCounters; i++) {
+        const int fd = psiPerfOpenCounter_(psiPerfCounters[i], i == 0 ? -1 : psiThreadContext.perfFds[0]);
+        if(fd < 0) {
+            psiPerfClose();
+            psiThreadContext.numPerfFds = -1;
+            return;
+        }
+        psiThreadContext.perfFds[psiThreadContext.numPerfFds++] = fd;
     }
+#endif // PSI_HAS_PERF_COUNTERS_
+}
 
-    // Stick with nanoseconds (no need for decimal points here)
-    switch(num_digits) {
-        case 1: case 2:
-            printf("%.0lfns", nanoseconds_duration); break;
-        case 3: case 4: case 5:
-            printf("%.2lfus", nanoseconds_duration/1000); break;
-        case 6: case 7: case 8:
-            printf("%.2lfms", nanoseconds_duration/1000000); break;
-        default:
-            printf("%.2lfs", nanoseconds_duration/1000000000); break;
+// Zero the calling thread's counters and start them, and stop them again. Both do nothing without counters.
+static inline void psiPerfStart_() {
+#ifdef PSI_HAS_PERF_COUNTERS_
+    if(psiThreadContext.numPerfFds > 0) {
+        ioctl(psiThreadContext.perfFds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(psiThreadContext.perfFds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif // PSI_HAS_PERF_COUNTERS_
+}
+
+static inline void psiPerfStop_() {
+#ifdef PSI_HAS_PERF_COUNTERS_
+    if(psiThreadContext.numPerfFds > 0)
+        ioctl(psiThreadContext.perfFds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+#endif // PSI_HAS_PERF_COUNTERS_
+}
+
+// Reads the calling thread's counters into `counts`. Fails if it has none, or if they never got to count.
+static psi_bool psiPerfRead(psi_u64* const counts) {
+#ifdef PSI_HAS_PERF_COUNTERS_
+    // The number of counters, how long the group was enabled and how long it actually counted, then the counts
+    psi_u64 data[3 + PSI_MAX_PERF_COUNTERS_];
+    const psi_ull numCounters = PSI_CAST(psi_ull, psiThreadContext.numPerfFds);
+    if(psiThreadContext.numPerfFds <= 0 ||
+       read(psiThreadContext.perfFds[0], data, sizeof(data)) < PSI_CAST(ssize_t, sizeof(psi_u64) * (3 + numCounters)) ||
+       data[2] == 0)
+        return psi_false;
+
+    for(psi_ull i = 0; i < numCounters; i++) {
+        counts[i] = data[2] < data[1]
+                        ? PSI_CAST(psi_u64, PSI_CAST(double, data[3 + i]) * PSI_CAST(double, data[1]) / PSI_CAST(double, data[2]))
+                        : data[3 + i];
     }
+    return psi_true;
+#else
+    (void)counts;
+    return psi_false;
+#endif // PSI_HAS_PERF_COUNTERS_
+}
+
+static const char* psiPerfCounterName(const psi_ull index) {
+#ifdef PSI_HAS_PERF_COUNTERS_
+    return psiPerfCounterTable[psiPerfCounters[index]].name;
+#else
+    (void)index;
+    return "";
+#endif // PSI_HAS_PERF_COUNTERS_
 }
 
 // PSI_TEST_INITIALIZER
@@ -336,22 +895,169 @@ static inline void* psi_realloc(void* const ptr, const psi_ull new_size) {
 #define PSI_COLOUR_BRIGHTCYAN_           11
 #define PSI_COLOUR_BOLD_                 12
 
+#ifndef PSI_NO_TESTING
+/**
+    Psi's own allocations (its output, failure reports, the `PROPERTY` and `PSI_FUZZ` runners) aren't the test's:
+    they are made between these two, so that only the test body is counted. Pausing returns whether the calling
+    thread was counting, to resume with.
+*/
+static inline int psiPauseAllocTracking_() {
+    const int isTracking = psiThreadContext.allocs.isTracking;
+    psiThreadContext.allocs.isTracking = 0;
+    return isTracking;
+}
+
+static inline void psiResumeAllocTracking_(const int isTracking) {
+    psiThreadContext.allocs.isTracking = isTracking;
+}
+
+// Makes room for `size` more bytes (and a terminating NUL)
+static void psiBufferReserve(psiBufferStruct* const buffer, const psi_ull size) {
+    const psi_ull needed = buffer->size + size + 1;
+    if(needed > buffer->capacity) {
+        const int isTracking = psiPauseAllocTracking_();
+        buffer->capacity = buffer->capacity * 2 > needed ? buffer->capacity * 2 : needed;
+        buffer->data = PSI_PTRCAST(char*, psi_realloc(buffer->data, buffer->capacity));
+        psiResumeAllocTracking_(isTracking);
+    }
+}
+
+static void psiBufferAppend(psiBufferStruct* const buffer, const char* const data, const psi_ull size) {
+    psiBufferReserve(buffer, size);
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+}
+
+static void psiBufferAppendV(psiBufferStruct* const buffer, const char* const fmt, va_list args) {
+    va_list argsCopy;
+    int n;
+
+    va_copy(argsCopy, args);
+    n = vsnprintf(buffer->data + buffer->size, buffer->capacity - buffer->size, fmt, argsCopy);
+    va_end(argsCopy);
+    if(n < 0)
+        return;
+
+    if(buffer->size + PSI_CAST(psi_ull, n) + 1 > buffer->capacity) {
+        psiBufferReserve(buffer, PSI_CAST(psi_ull, n));
+        vsnprintf(buffer->data + buffer->size, buffer->capacity - buffer->size, fmt, args);
+    }
+    buffer->size += PSI_CAST(psi_ull, n);
+}
+
+// The stream behind each sink, or PSI_NULL if that sink isn't open
+static FILE* psiSinkStream(const int sink) {
+    return sink == PSI_SINK_TERMINAL_ ? stdout : psiTestContext.foutput;
+}
+
+/**
+    Hands everything formatted on this thread so far over to the sinks, with a single `fwrite` per sink - so
+    each record reaches its stream whole, and stays in order with whatever the tests print to stdout
+    themselves. This doesn't flush the streams: see `psiFlushOutput` for that.
+*/
+static void psiWriteOutput() {
+    for(int i = 0; i < PSI_NUM_SINKS_; i++) {
+        psiBufferStruct* const pending = &psiThreadContext.pending[i];
+        FILE* const stream = psiSinkStream(1 << i);
+        if(pending->size > 0 && PSI_SOME(stream))
+            fwrite(pending->data, 1, pending->size, stream);
+        pending->size = 0;
+    }
+}
+
+static void psiFlushOutput() {
+    psiWriteOutput();
+    fflush(stdout);
+    if(psiTestContext.foutput)
+        fflush(psiTestContext.foutput);
+}
+
+/**
+    Formats into the calling thread's pending output (or its capture buffer, when its output is being captured)
+    for each of the given `sinks`. If `colour` is set, the text is wrapped in that escape sequence on the
+    terminal.
+*/
+static int psiPrintV_(const int sinks, const char* const colour, const char* const fmt, va_list args) {
+    psiBufferStruct* const capture = psiThreadContext.capture;
+    psiBufferStruct* const report = PSI_SOME(psiThreadContext.captureReport) ? psiThreadContext.captureReport
+                                                                            : &psiThreadContext.pending[1];
+    const int toTerminal = sinks & PSI_SINK_TERMINAL_;
+    // Only the main process's main thread writes to the XUnit file: everyone else hands it their report text
+    const int toReport = (sinks & PSI_SINK_REPORT_) &&
+                         (PSI_SOME(psiThreadContext.captureReport) ||
+                          (PSI_NONE(capture) && PSI_SOME(psiTestContext.foutput)));
+    psiBufferStruct* const target = !toTerminal ? report : (PSI_SOME(capture) ? capture : &psiThreadContext.pending[0]);
+
+    if(!toTerminal && !toReport)
+        return 0;
+
+    if(toTerminal && colour)
+        psiBufferAppend(target, colour, strlen(colour));
+    const psi_ull start = target->size;
+    psiBufferAppendV(target, fmt, args);
+    const psi_ull n = target->size - start;
+    if(toTerminal && colour)
+        psiBufferAppend(target, "\033[0m", 4); // Reset the colour
+
+    if(toTerminal && toReport)
+        psiBufferAppend(report, target->data + start, n);
+
+    // The test may print to stdout itself right after this, so anything it has Psi print can't wait
+    if(PSI_NONE(capture) && psiThreadContext.checkIsInsideTestSuite)
+        psiWriteOutput();
+    return PSI_CAST(int, n);
+}
+
 static inline int PSI_ATTRIBUTE_(format (printf, 2, 3))
-psiColouredPrintf(const int colour, const char* const fmt, ...);
+psiPrintf_(const int sinks, const char* const fmt, ...);
 static inline int PSI_ATTRIBUTE_(format (printf, 2, 3))
-psiColouredPrintf(const int colour, const char* const fmt, ...) {
+psiPrintf_(const int sinks, const char* const fmt, ...) {
     va_list args;
-    char buffer[256];
     int n;
 
     va_start(args, fmt);
-    vsnprintf(buffer, sizeof(buffer), fmt, args);
+    n = psiPrintV_(sinks, PSI_NULL, fmt, args);
     va_end(args);
-    buffer[sizeof(buffer)-1] = '\0';
+    return n;
+}
+
+    #define psiPrintf(...)              psiPrintf_(PSI_SINK_TERMINAL_ | PSI_SINK_REPORT_, __VA_ARGS__)
+    // Like `psiPrintf`, but never written to the XUnit file
+    #define psiTerminalPrintf(...)      psiPrintf_(PSI_SINK_TERMINAL_, __VA_ARGS__)
+    // Only written to the XUnit file
+    #define psiReportPrintf(...)        psiPrintf_(PSI_SINK_REPORT_, __VA_ARGS__)
+#else
+static inline int psiPrintV_(const int sinks, const char* const colour, const char* const fmt, va_list args) {
+    int n;
+
+    (void)sinks;
+    if(colour)
+        printf("%s", colour);
+    n = vprintf(fmt, args);
+    if(colour)
+        printf("\033[0m"); // Reset the colour
+    return n;
+}
+
+static inline void psiFlushOutput() { fflush(stdout); }
+
+    #define psiPrintf(...)              printf(__VA_ARGS__)
+    #define psiTerminalPrintf(...)      printf(__VA_ARGS__)
+#endif // PSI_NO_TESTING
+
+static inline int PSI_ATTRIBUTE_(format (printf, 2, 3))
+psiColouredPrintf(const int colour, const char* const fmt, ...);
+static inline int PSI_ATTRIBUTE_(format (printf, 2, 3))
+psiColouredPrintf(const int colour, const char* const fmt, ...) {
+    va_list args;
+    int n;
 
 #ifndef PSI_NO_TESTING
-    if(!psiShouldColourizeOutput) {
-        return printf("%s", buffer);
+    if(!psiTestContext.shouldColourizeOutput) {
+        va_start(args, fmt);
+        n = psiPrintV_(PSI_SINK_TERMINAL_, PSI_NULL, fmt, args);
+        va_end(args);
+        return n;
     }
 #endif // PSI_NO_TESTING
 
@@ -372,9 +1078,9 @@ psiColouredPrintf(const int colour, const char* const fmt, ...) {
             case PSI_COLOUR_BOLD_:         str = "\033[1m"; break;
             default:                       str = "\033[0m"; break;
         }
-        printf("%s", str);
-        n = printf("%s", buffer);
-        printf("\033[0m"); // Reset the colour
+        va_start(args, fmt);
+        n = psiPrintV_(PSI_SINK_TERMINAL_, str, fmt, args);
+        va_end(args);
         return n;
     }
 #elif defined(PSI_WIN_)
@@ -402,29 +1108,50 @@ psiColouredPrintf(const int colour, const char* const fmt, ...) {
                                                     FOREGROUND_RED | FOREGROUND_INTENSITY; break;
             default:                         attr = 0; break;
         }
+        // The console colours whatever is written while the attribute is set, so nothing can stay pending
+        psiFlushOutput();
         if(attr != 0)
             SetConsoleTextAttribute(h, attr);
-        n = printf("%s", buffer);
+        va_start(args, fmt);
+        n = psiPrintV_(PSI_SINK_TERMINAL_, PSI_NULL, fmt, args);
+        va_end(args);
+        psiFlushOutput();
         SetConsoleTextAttribute(h, info.wAttributes);
         return n;
     }
 #else
-    n = printf("%s", buffer);
+    va_start(args, fmt);
+    n = psiPrintV_(PSI_SINK_TERMINAL_, PSI_NULL, fmt, args);
+    va_end(args);
     return n;
 #endif // PSI_UNIX_
 }
 
+
 #ifndef PSI_NO_TESTING
-    #define psiPrintf(...) {                                \
-        if(psiTestContext.foutput)                          \
-            fprintf(psiTestContext.foutput, __VA_ARGS__);   \
-        printf(__VA_ARGS__);                                \
+static void psiClockPrintDuration(const psi_u64 nanoseconds) {
+    const double nanoseconds_duration = PSI_CAST(double, nanoseconds);
+    psi_u64 n;
+    int num_digits = 0;
+    n = nanoseconds;
+    while(n!=0) {
+        n/=10;
+        ++num_digits;
     }
-#else
-    #define psiPrintf(...)   \
-        printf(__VA_ARGS__)
-#endif // PSI_NO_TESTING
 
+    // Stick with nanoseconds (no need for decimal points here)
+    switch(num_digits) {
+        case 1: case 2:
+            psiTerminalPrintf("%.0lfns", nanoseconds_duration); break;
+        case 3: case 4: case 5:
+            psiTerminalPrintf("%.2lfus", nanoseconds_duration/1000); break;
+        case 6: case 7: case 8:
+            psiTerminalPrintf("%.2lfms", nanoseconds_duration/1000000); break;
+        default:
+            psiTerminalPrintf("%.2lfs", nanoseconds_duration/1000000000); break;
+    }
+}
+#endif // PSI_NO_TESTING
 
 static inline int psiIsDigit(const char c) { return c >= '0' && c <= '9'; }
 // If the macro arguments can be decomposed further, we need to print the `In macro ..., so and so failed`.
@@ -478,36 +1205,169 @@ static inline int psiShouldDecomposeMacro(const char* const actual, const char*
 }
 
 
+/**
+    Failure Reporting
+    Every assertion macro expands to its comparison, plus an unlikely branch into one of the `psiReport*Failure_`
+    functions below. None of the printing is expanded inline, so passing assertions cost a compare and a branch,
+    and a test with thousands of them stays small and quick to compile.
+    The call site is described by its file, its line and a single string literal holding the source text of the
+    arguments (see `PSI_SITE_`), so it needs no data or relocations of its own.
+*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define PSI_COLD_               __attribute__((cold, noinline))
+    #define PSI_UNLIKELY_(x)        __builtin_expect(!!(x), 0)
+#elif defined(_MSC_VER)
+    #define PSI_COLD_               __declspec(noinline)
+    #define PSI_UNLIKELY_(x)        (x)
+#else
+    #define PSI_COLD_
+    #define PSI_UNLIKELY_(x)        (x)
+#endif // __GNUC__
+
+typedef struct psiAssertSiteStruct {
+    const char* file;
+    unsigned line;
+    const char* macroName;
+    const char* actual;         // Source text of the arguments
+    const char* expected;
+    const char* extra;          // The length/count argument, the condition (TRUE/FALSE) or the message (CHECK)
+    const char* op;             // How the comparison reads when it fails (eg. `==` for `CHECK_NE`)
+    const char* actualPrint;    // What actually happened, for the string and buffer checks
+} psiAssertSiteStruct;
+
+// The arguments every `psiReport*Failure_` function starts with. Unused fields are empty strings.
+#define PSI_SITE_(macroName, actual, expected, extra, op, actualPrint)                         \
+    __FILE__, __LINE__, macroName "\0" actual "\0" expected "\0" extra "\0" op "\0" actualPrint
+
+#define PSI_SITE_PARAMS_    const char* const file, const unsigned line, const char* const packed
+
+static const char* psiNextSiteField_(const char* const field) {
+    return field + strlen(field) + 1;
+}
+
+// Unpacks the `PSI_SITE_` a report function was called with
+static psiAssertSiteStruct psiUnpackSite_(const char* const file, const unsigned line, const char* const packed) {
+    psiAssertSiteStruct site;
+    site.file = file;
+    site.line = line;
+    site.macroName = packed;
+    site.actual = psiNextSiteField_(site.macroName);
+    site.expected = psiNextSiteField_(site.actual);
+    site.extra = psiNextSiteField_(site.expected);
+    site.op = psiNextSiteField_(site.extra);
+    site.actualPrint = psiNextSiteField_(site.op);
+    return site;
+}
+
+#define PSI_VALUE_INT_      0
+#define PSI_VALUE_UINT_     1
+#define PSI_VALUE_FLOAT_    2
+#define PSI_VALUE_CHAR_     3
+#define PSI_VALUE_STRING_   4
+#define PSI_VALUE_POINTER_  5
+
+// The value of either side of a failed comparison, tagged with how it should be printed
+typedef struct psiValueStruct {
+    int kind;
+    union {
+        long long i;
+        unsigned long long u;
+        double f;
+        const void* p;
+    } as;
+} psiValueStruct;
+
+static inline psiValueStruct psiValueInt_(const long long i) {
+    psiValueStruct value;
+    value.kind = PSI_VALUE_INT_;
+    value.as.i = i;
+    return value;
+}
+
+static inline psiValueStruct psiValueUInt_(const unsigned long long u) {
+    psiValueStruct value;
+    value.kind = PSI_VALUE_UINT_;
+    value.as.u = u;
+    return value;
+}
+
+static inline psiValueStruct psiValueFloat_(const double f) {
+    psiValueStruct value;
+    value.kind = PSI_VALUE_FLOAT_;
+    value.as.f = f;
+    return value;
+}
+
+static inline psiValueStruct psiValueLongDouble_(const long double f) {
+    return psiValueFloat_(PSI_CAST(double, f));
+}
+
+static inline psiValueStruct psiValuePointer_(const void* const p) {
+    psiValueStruct value;
+    value.kind = PSI_VALUE_POINTER_;
+    value.as.p = p;
+    return value;
+}
+
+static inline psiValueStruct psiValueChar_(const char c) {
+    psiValueStruct value;
+    value.kind = PSI_VALUE_CHAR_;
+    value.as.i = c;
+    return value;
+}
+
+static inline psiValueStruct psiValueString_(const char* const s) {
+    psiValueStruct value;
+    value.kind = PSI_VALUE_STRING_;
+    value.as.p = s;
+    return value;
+}
+
+static void psiPrintValue_(const psiValueStruct* const value) {
+    switch(value->kind) {
+        case PSI_VALUE_INT_:     psiPrintf("%lld", value->as.i); break;
+        case PSI_VALUE_UINT_:    psiPrintf("%llu", value->as.u); break;
+        case PSI_VALUE_FLOAT_:   psiPrintf("%f", value->as.f); break;
+        case PSI_VALUE_CHAR_:    psiPrintf("'%c'", PSI_CAST(char, value->as.i)); break;
+        case PSI_VALUE_STRING_:  psiPrintf("%s", PSI_CAST(const char*, value->as.p)); break;
+        default:                 psiPrintf("%p", value->as.p); break;
+    }
+}
+
 #ifdef PSI_OVERLOADABLE
     #ifndef PSI_CAN_USE_OVERLOADABLES
         #define PSI_CAN_USE_OVERLOADABLES
     #endif // PSI_CAN_USE_OVERLOADABLES
 
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const float f);
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const double d);
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const long double d);
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const int i);
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const unsigned int i);
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const long int i);
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const long unsigned int i);
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const void* const p);
-
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const float f) { psiPrintf("%f", PSI_CAST(double, f)); }
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const double d) { psiPrintf("%f", d); }
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const long double d) { psiPrintf("%Lf", d); }
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const int i) { psiPrintf("%d", i); }
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const unsigned int i) { psiPrintf("%u", i); }
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const long int i) { psiPrintf("%ld", i); }
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const long unsigned int i) { psiPrintf("%lu", i); }
-    PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const void* const p) { psiPrintf("%p", p); }
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const float f);
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const double d);
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const long double d);
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const int i);
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const unsigned int i);
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const long int i);
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const long unsigned int i);
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const void* const p);
+
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const float f) { return psiValueFloat_(f); }
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const double d) { return psiValueFloat_(d); }
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const long double d) {
+        return psiValueFloat_(PSI_CAST(double, d));
+    }
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const int i) { return psiValueInt_(i); }
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const unsigned int i) { return psiValueUInt_(i); }
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const long int i) { return psiValueInt_(i); }
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const long unsigned int i) { return psiValueUInt_(i); }
+    PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const void* const p) { return psiValuePointer_(p); }
 
     // long long is in C++ only
     #if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L) || defined(__cplusplus) && (__cplusplus >= 201103L)
-        PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const long long int i);
-        PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const long long unsigned int i);
+        PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const long long int i);
+        PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const long long unsigned int i);
 
-        PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const long long int i) { psiPrintf("%lld", i); }
-        PSI_WEAK PSI_OVERLOADABLE void PSI_OVERLOAD_PRINTER(const long long unsigned int i) { psiPrintf("%llu", i); }
+        PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const long long int i) { return psiValueInt_(i); }
+        PSI_WEAK PSI_OVERLOADABLE psiValueStruct psiMakeValue(const long long unsigned int i) {
+            return psiValueUInt_(i);
+        }
     #endif // __STDC_VERSION__
 
 #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
@@ -515,31 +1375,23 @@ static inline int psiShouldDecomposeMacro(const char* const actual, const char*
         #define PSI_CAN_USE_OVERLOADABLES
     #endif // PSI_CAN_USE_OVERLOADABLES
 
-    #define PSI_OVERLOAD_PRINTER(val)                         \
-        psiPrintf(                                            \
-            _Generic((val),                                   \
-                        char : "'%c'",                        \
-                        char* : "%s",                         \
-                        unsigned char : "%hhu",               \
-                        short : "%hd",                        \
-                        unsigned short : "%hu",               \
-                        int : "%d",                           \
-                        unsigned int : "%u",                  \
-                        long : "%ld",                         \
-                        long long : "%lld",                   \
-                        unsigned long : "%lu",                \
-                        unsigned long long : "%"PSI_PRIu64,   \
-                        float : "%f",                         \
-                        double : "%f",                        \
-                        long double : "%Lf",                  \
-                        void* : "%p"),                        \
-                (val))
-
-#else
-    // If we're here, this means that the Compiler does not support overloadable methods
-    #define PSI_OVERLOAD_PRINTER(...)                                                              \
-        psiPrintf("Error: Your compiler does not support overloadable methods.");                  \
-        psiPrintf("If you think this was an error, please file an issue on Psi's Github repo.")
+    #define psiMakeValue(val)                                 \
+        _Generic((val),                                       \
+                    char : psiValueChar_,                     \
+                    char* : psiValueString_,                  \
+                    unsigned char : psiValueUInt_,            \
+                    short : psiValueInt_,                     \
+                    unsigned short : psiValueUInt_,           \
+                    int : psiValueInt_,                       \
+                    unsigned int : psiValueUInt_,             \
+                    long : psiValueInt_,                      \
+                    long long : psiValueInt_,                 \
+                    unsigned long : psiValueUInt_,            \
+                    unsigned long long : psiValueUInt_,       \
+                    float : psiValueFloat_,                   \
+                    double : psiValueFloat_,                  \
+                    long double : psiValueLongDouble_,        \
+                    void* : psiValuePointer_)(val)
 #endif // PSI_OVERLOADABLE
 
 #ifndef PSI_NO_TESTING
@@ -550,89 +1402,175 @@ static inline int psiShouldDecomposeMacro(const char* const actual, const char*
     #define PSI_ABORT_IF_INSIDE_TESTSUITE   PSI_ABORT
 #endif // PSI_NO_TESTING
 
+static void psiPrintFailureLocation_(const psiAssertSiteStruct* const site) {
+    psiPrintf("%s:%u: ", site->file, site->line);
+    psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "FAILED\n");
+}
+
+// `actual`/`expected` are null if the compiler can't print values, in which case we print the source text
+static PSI_COLD_ void psiReportCmpFailure_(PSI_SITE_PARAMS_,
+                                           const psiValueStruct* const actual, const psiValueStruct* const expected) {
+    const psiAssertSiteStruct site = psiUnpackSite_(file, line, packed);
+    psiPrintFailureLocation_(&site);
+    if(psiShouldDecomposeMacro(site.actual, site.expected, 0)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s, %s )\n", site.macroName, site.actual, site.expected);
+    }
+    psiPrintf("  Expected : %s", site.actual);
+    psiTerminalPrintf(" %s ", site.op);
+    if(PSI_SOME(expected))
+        psiPrintValue_(expected);
+    else
+        psiTerminalPrintf("%s", site.expected);
+    psiPrintf("\n");
+
+    psiPrintf("    Actual : %s", site.actual);
+    psiTerminalPrintf(" == ");
+    if(PSI_SOME(actual))
+        psiPrintValue_(actual);
+    else
+        psiTerminalPrintf("%s", site.actual);
+    psiPrintf("\n");
+}
+
+static PSI_COLD_ void psiReportTFFailure_(PSI_SITE_PARAMS_) {
+    const psiAssertSiteStruct site = psiUnpackSite_(file, line, packed);
+    psiPrintFailureLocation_(&site);
+    if(psiShouldDecomposeMacro(site.actual, PSI_NULL, 0)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s )\n", site.macroName, site.extra);
+    }
+    psiPrintf("  Expected : %s\n", site.expected);
+    psiPrintf("    Actual : %s\n", site.actual);
+}
+
+static PSI_COLD_ void psiReportCheckFailure_(PSI_SITE_PARAMS_) {
+    const psiAssertSiteStruct site = psiUnpackSite_(file, line, packed);
+    psiPrintf("%s:%u: ", site.file, site.line);
+    psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "%s", site.extra[0] != '\0' ? site.extra : "FAILED");
+    psiTerminalPrintf("\n");
+    psiTerminalPrintf("The following assertion failed: \n");
+    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "    %s( %s )\n", site.macroName, site.actual);
+}
+
+static PSI_COLD_ void psiReportAllocFailure_(PSI_SITE_PARAMS_, const psi_u64 numAllocs) {
+    const psiAssertSiteStruct site = psiUnpackSite_(file, line, packed);
+    psiPrintFailureLocation_(&site);
+    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");
+    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s%s\n", site.macroName, site.extra);
+    psiPrintf("  Expected : at most %s allocations\n", site.actual);
+    psiPrintf("    Actual : %" PSI_PRIu64 " allocations\n", numAllocs);
+}
+
+// Bails out of the test if the failure was a REQUIRE
+#define PSI_RETURN_IF_ABORTED_()                                                               \
+    if(psiThreadContext.shouldAbortTest) {                                                     \
+        return;                                                                                \
+    }
+
 // ifCondFailsThenPrint is the string representation of the opposite of the truthy value of `cond`
 // For example, if `cond` is "!=", then `ifCondFailsThenPrint` will be `==`
 #if defined(PSI_CAN_USE_OVERLOADABLES)
     #define __TAUCMP__(actual, expected, cond, space, macroName, failOrAbort)                  \
         do {                                                                                   \
-            if(!((actual)cond(expected))) {                                                    \
-                psiPrintf("%s:%u: ", __FILE__, __LINE__);                                      \
-                psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "FAILED\n");                          \
-                if(psiShouldDecomposeMacro(#actual, #expected, 0)) {                           \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");                \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s, %s )\n",                \
-                                                                #macroName,                    \
-                                                                #actual, #expected);           \
-                }                                                                              \
-                psiPrintf("  Expected : %s", #actual);                                         \
-                printf(" %s ", #cond space);                                                   \
-                PSI_OVERLOAD_PRINTER(expected);                                                \
-                psiPrintf("\n");                                                               \
-                                                                                               \
-                psiPrintf("    Actual : %s", #actual);                                         \
-                printf(" == ");                                                                \
-                PSI_OVERLOAD_PRINTER(actual);                                                  \
-                psiPrintf("\n");                                                               \
+            if(PSI_UNLIKELY_(!((actual)cond(expected)))) {                                     \
+                const psiValueStruct psiActual_ = psiMakeValue(actual);                        \
+                const psiValueStruct psiExpected_ = psiMakeValue(expected);                    \
+                psiReportCmpFailure_(PSI_SITE_(#macroName, #actual, #expected, "", #cond space, ""), \
+                                     &psiActual_, &psiExpected_);                              \
                 failOrAbort;                                                                   \
-                if(shouldAbortTest) {                                                          \
-                    return;                                                                    \
-                }                                                                              \
+                PSI_RETURN_IF_ABORTED_()                                                       \
             }                                                                                  \
         }                                                                                      \
         while(0)
 
-// PSI_OVERLOAD_PRINTER does not work on some compilers
+// psiMakeValue does not work on some compilers
 #else
-    #define __TAUCMP__(actual, expected, cond, space, macroName, failOrAbort)                          \
-        do {                                                                                           \
-            if(!((actual)cond(expected))) {                                                            \
-                psiPrintf("%s:%u: ", __FILE__, __LINE__);                                              \
-                psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "FAILED\n");                                  \
-                if(psiShouldDecomposeMacro(#actual, #expected, 0)) {                                   \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");                        \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s, %s )\n",                        \
-                                                                #macroName,                            \
-                                                                #actual, #expected);                   \
-                }                                                                                      \
-                psiPrintf("  Expected : %s", #actual);                                                 \
-                printf(" %s ", #cond space);                                                           \
-                printf(#expected);                                                                     \
-                psiPrintf("\n");                                                                       \
-                                                                                                       \
-                psiPrintf("    Actual : %s", #actual);                                                 \
-                printf(" == ");                                                                        \
-                printf(#actual);                                                                       \
-                psiPrintf("\n");                                                                       \
-                failOrAbort;                                                                           \
-                if(shouldAbortTest) {                                                                  \
-                    return;                                                                            \
-                }                                                                                      \
-            }                                                                                          \
-        }                                                                                              \
+    #define __TAUCMP__(actual, expected, cond, space, macroName, failOrAbort)                  \
+        do {                                                                                   \
+            if(PSI_UNLIKELY_(!((actual)cond(expected)))) {                                     \
+                psiReportCmpFailure_(PSI_SITE_(#macroName, #actual, #expected, "", #cond space, ""), \
+                                     PSI_NULL, PSI_NULL);                                      \
+                failOrAbort;                                                                   \
+                PSI_RETURN_IF_ABORTED_()                                                       \
+            }                                                                                  \
+        }                                                                                      \
         while(0)
 #endif // PSI_CAN_USE_OVERLOADABLES
 
-#define __TAUCMP_STR__(actual, expected, cond, ifCondFailsThenPrint, actualPrint, macroName, failOrAbort)       \
-    do {                                                                                                        \
-        if(strcmp(actual, expected) cond 0) {                                                                   \
-            psiPrintf("%s:%u: ", __FILE__, __LINE__);                                                           \
-            psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "FAILED\n");                                               \
-            if(psiShouldDecomposeMacro(#actual, #expected, 1)) {                                                \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");                                 \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s, %s )\n",                                 \
-                                                                #macroName,                                     \
-                                                                #actual, #expected);                            \
-                }                                                                                               \
-            psiPrintf("  Expected : \"%s\" %s \"%s\"\n", actual, #ifCondFailsThenPrint, expected);              \
-            psiPrintf("    Actual : %s\n", #actualPrint);                                                       \
-            failOrAbort;                                                                                        \
-            if(shouldAbortTest) {                                                                               \
-                return;                                                                                         \
-            }                                                                                                   \
-        }                                                                                                       \
-    }                                                                                                           \
-    while(0)
 
+/**
+    Buffer Comparisons (`CHECK_BUF_EQ`, ...)
+    The checks themselves are a `memcmp`. Only once one fails are the buffers gone over again, to find out where
+    they differ - 32 or 16 bytes at a time with AVX2, SSE2 or NEON (whichever the compiler targets), and 8 at a
+    time everywhere else - and the report only shows the rows around the first few regions that do.
+*/
+#define PSI_BUF_ROW_SIZE_           16
+// How many of the regions where the buffers differ are shown, and how many rows each at most
+#define PSI_BUF_MAX_REGIONS_        4
+#define PSI_BUF_MAX_REGION_ROWS_    4
+
+// The index of the lowest bit set in `x` (which can't be 0)
+static inline unsigned psiLowestBit_(const psi_u64 x) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    if(_BitScanForward(&index, PSI_CAST(unsigned long, (x & 0xFFFFFFFFu))))
+        return PSI_CAST(unsigned, index);
+    _BitScanForward(&index, PSI_CAST(unsigned long, (x >> 32)));
+    return PSI_CAST(unsigned, index) + 32;
+#else
+    return PSI_CAST(unsigned, __builtin_ctzll(x));
+#endif // _MSC_VER
+}
+
+// The first offset from `i` on (or `size`) where `a` and `b` have the same byte if `findEqual`, or different ones
+static psi_ull psiFindByte_(const psi_u8* const a, const psi_u8* const b, psi_ull i, const psi_ull size,
+                            const int findEqual) {
+#ifdef PSI_HAS_AVX2_
+    for(; i + 32 <= size; i += 32) {
+        const __m256i equal = _mm256_cmpeq_epi8(_mm256_loadu_si256(PSI_PTRCAST(const __m256i*, (a + i))),
+                                                _mm256_loadu_si256(PSI_PTRCAST(const __m256i*, (b + i))));
+        const psi_u32 mask = PSI_CAST(psi_u32, _mm256_movemask_epi8(equal));
+        const psi_u32 found = findEqual ? mask : ~mask;
+        if(found != 0)
+            return i + psiLowestBit_(found);
+    }
+#endif // PSI_HAS_AVX2_
+#if defined(PSI_HAS_SSE2_)
+    for(; i + 16 <= size; i += 16) {
+        const __m128i equal = _mm_cmpeq_epi8(_mm_loadu_si128(PSI_PTRCAST(const __m128i*, (a + i))),
+                                             _mm_loadu_si128(PSI_PTRCAST(const __m128i*, (b + i))));
+        const psi_u32 mask = PSI_CAST(psi_u32, _mm_movemask_epi8(equal));
+        const psi_u32 found = findEqual ? mask : ~mask & 0xFFFF;
+        if(found != 0)
+            return i + psiLowestBit_(found);
+    }
+#elif defined(PSI_HAS_NEON_)
+    for(; i + 16 <= size; i += 16) {
+        const uint8x16_t equal = vceqq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+        // NEON has no movemask: narrowing every byte to 4 bits fits them all in 64
+        const psi_u64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)), 0);
+        const psi_u64 found = findEqual ? mask : ~mask;
+        if(found != 0)
+            return i + psiLowestBit_(found) / 4;
+    }
+#else
+    for(; i + 8 <= size; i += 8) {
+        psi_u64 x, y, diff;
+        memcpy(&x, a + i, sizeof(x));
+        memcpy(&y, b + i, sizeof(y));
+        diff = x ^ y;
+        // A byte of `diff` is 0 where the bytes are the same
+        if(findEqual ? ((diff - 0x0101010101010101ull) & ~diff & 0x8080808080808080ull) != 0 : diff != 0)
+            break;
+    }
+#endif // PSI_HAS_SSE2_
+    for(; i < size; i++) {
+        if((a[i] == b[i]) == (findEqual != 0))
+            return i;
+    }
+    return size;
+}
 
 static void psiPrintColouredIfDifferent(const psi_u8 ch, const psi_u8 ref) {
     if(ch == ref) {
@@ -642,42 +1580,755 @@ static void psiPrintColouredIfDifferent(const psi_u8 ch, const psi_u8 ref) {
     }
 }
 
+// Prints the rows of both buffers from `from` to `to`, the bytes that differ highlighted
+static void psiPrintBufRows_(const psi_u8* const actual, const psi_u8* const expected, const psi_ull from,
+                             const psi_ull to) {
+    for(psi_ull row = from; row < to; row += PSI_BUF_ROW_SIZE_) {
+        const psi_ull end = row + PSI_BUF_ROW_SIZE_ < to ? row + PSI_BUF_ROW_SIZE_ : to;
+        psiPrintf("             %08" PSI_PRIx64 "  actual  ", PSI_CAST(psi_u64, row));
+        for(psi_ull i = row; i < end; i++) {
+            psiPrintf(" ");
+            psiPrintColouredIfDifferent(actual[i], expected[i]);
+        }
+        psiPrintf("\n                       expected");
+        for(psi_ull i = row; i < end; i++) {
+            psiPrintf(" ");
+            psiPrintColouredIfDifferent(expected[i], actual[i]);
+        }
+        psiPrintf("\n");
+    }
+}
+
+/**
+    Says how many bytes of the buffers differ, in how many regions, and shows the rows around the first
+    `PSI_BUF_MAX_REGIONS_` of those (regions less than two rows apart are shown as one)
+*/
+static void psiPrintBufDiff_(const psi_u8* const actual, const psi_u8* const expected, const psi_ull size,
+                             const char* const actualPrint) {
+    psi_ull starts[PSI_BUF_MAX_REGIONS_];
+    psi_ull ends[PSI_BUF_MAX_REGIONS_];
+    psi_ull numShown = 0;
+    psi_ull numRegions = 0;
+    psi_ull numBytes = 0;
+    psi_ull start = psiFindByte_(actual, expected, 0, size, 0);
+
+    while(start < size) {
+        const psi_ull end = psiFindByte_(actual, expected, start, size, 1);
+        numRegions++;
+        numBytes += end - start;
+        if(numShown > 0 && start - ends[numShown - 1] < 2 * PSI_BUF_ROW_SIZE_) {
+            ends[numShown - 1] = end;
+        } else if(numShown < PSI_BUF_MAX_REGIONS_) {
+            starts[numShown] = start;
+            ends[numShown++] = end;
+        }
+        start = psiFindByte_(actual, expected, end, size, 0);
+    }
 
-static void psiPrintHexBufCmp(const void* const buff, const void* const ref, const int size) {
-    const psi_u8* const test_buff = PSI_CAST(const psi_u8* const, buff);
-    const psi_u8* const ref_buff = PSI_CAST(const psi_u8* const, ref);
-
-    psiColouredPrintf(PSI_COLOUR_CYAN_,"<");
-    if(size != 0)
-        psiPrintColouredIfDifferent(test_buff[0], ref_buff[0]);
-
-    for(int i = 1; i < size; ++i) {
-        printf(" ");
-        psiPrintColouredIfDifferent(test_buff[i], ref_buff[i]);
+    psiPrintf("    Actual : %s, %" PSI_PRIu64 " of %" PSI_PRIu64 " bytes differ, in %" PSI_PRIu64 " %s\n",
+              actualPrint, PSI_CAST(psi_u64, numBytes), PSI_CAST(psi_u64, size), PSI_CAST(psi_u64, numRegions),
+              numRegions == 1 ? "region" : "regions");
+    for(psi_ull r = 0; r < numShown; r++) {
+        // With a row of context on either side
+        const psi_ull row = starts[r] / PSI_BUF_ROW_SIZE_ * PSI_BUF_ROW_SIZE_;
+        const psi_ull first = row >= PSI_BUF_ROW_SIZE_ ? row - PSI_BUF_ROW_SIZE_ : 0;
+        const psi_ull after = ((ends[r] - 1) / PSI_BUF_ROW_SIZE_ + 2) * PSI_BUF_ROW_SIZE_;
+        const psi_ull last = after < size ? after : size;
+        const psi_ull maxLast = first + PSI_BUF_MAX_REGION_ROWS_ * PSI_BUF_ROW_SIZE_;
+        psiPrintf(" At offset : %" PSI_PRIu64 " (0x%" PSI_PRIx64 ")\n", PSI_CAST(psi_u64, starts[r]),
+                  PSI_CAST(psi_u64, starts[r]));
+        psiPrintBufRows_(actual, expected, first, last < maxLast ? last : maxLast);
+        if(last > maxLast)
+            psiPrintf("             ...\n");
     }
-    psiColouredPrintf(PSI_COLOUR_CYAN_,">");
+    if(numShown == PSI_BUF_MAX_REGIONS_ && start < size)
+        psiPrintf("             (and more, not shown)\n");
 }
 
+static PSI_COLD_ void psiReportBufFailure_(PSI_SITE_PARAMS_,
+                                           const void* const actual, const void* const expected, const psi_ull size) {
+    const psiAssertSiteStruct site = psiUnpackSite_(file, line, packed);
+    const psi_u8* const actualBytes = PSI_CAST(const psi_u8*, actual);
+    const psi_u8* const expectedBytes = PSI_CAST(const psi_u8*, expected);
+    psiPrintFailureLocation_(&site);
+    if(psiShouldDecomposeMacro(site.actual, site.expected, 1)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s, %s, %s )\n",
+                          site.macroName, site.actual, site.expected, site.extra);
+    }
+    psiPrintf("  Expected : %s %s %s (%" PSI_PRIu64 " bytes)\n", site.actual, site.op, site.expected,
+              PSI_CAST(psi_u64, size));
+    if(psiFindByte_(actualBytes, expectedBytes, 0, size, 0) < size) {
+        psiPrintBufDiff_(actualBytes, expectedBytes, size, site.actualPrint);
+    } else {
+        // `CHECK_BUF_NE`: the buffers are the same, so their first rows are as good as any
+        const psi_ull last = PSI_BUF_MAX_REGION_ROWS_ * PSI_BUF_ROW_SIZE_;
+        psiPrintf("    Actual : %s\n", site.actualPrint);
+        psiPrintBufRows_(actualBytes, expectedBytes, 0, size < last ? size : last);
+        if(size > last)
+            psiPrintf("             ...\n");
+    }
+}
 
 #define __TAUCMP_BUF__(actual, expected, len, cond, ifCondFailsThenPrint, actualPrint, macroName, failOrAbort)  \
     do {                                                                                                        \
-        if(memcmp(actual, expected, len) cond 0) {                                                              \
-            psiPrintf("%s:%u: ", __FILE__, __LINE__);                                                           \
-            psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "FAILED\n");                                               \
-            if(psiShouldDecomposeMacro(#actual, #expected, 1)) {                                                \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");                                 \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s, %s, %s )\n",                             \
-                                                                #macroName,                                     \
-                                                                #actual, #expected, #len);                      \
-                }                                                                                               \
-            psiPrintf("  Expected : "); psiPrintHexBufCmp(actual, expected, len);                               \
-            psiPrintf(" %s ", #ifCondFailsThenPrint);                                                           \
-            psiPrintHexBufCmp(expected, actual, len);                                                           \
-            psiPrintf("\n    Actual : %s\n", #actualPrint);                                                     \
+        if(PSI_UNLIKELY_(memcmp(actual, expected, len) cond 0)) {                                               \
+            psiReportBufFailure_(PSI_SITE_(#macroName, #actual, #expected, #len, #ifCondFailsThenPrint, #actualPrint), \
+                                 actual, expected, PSI_CAST(psi_ull, len));                                     \
+            failOrAbort;                                                                                        \
+            PSI_RETURN_IF_ABORTED_()                                                                            \
+        }                                                                                                       \
+    }                                                                                                           \
+    while(0)
+
+/**
+    String Diffs (`CHECK_STREQ`, ...)
+    Short strings are printed whole when a check fails. Longer ones, or ones with several lines, are diffed
+    instead: their common prefix and suffix are skipped with the vector loops of the buffer checks, the lines in
+    between are diffed with Myers' algorithm (in linear space), and the report prints unified-diff hunks of them,
+    with the characters that changed within a changed line highlighted. It stops after `--diff-max-bytes=N`.
+*/
+// Strings up to this long, on a single line, are printed whole
+#define PSI_DIFF_MAX_INLINE_        64
+#define PSI_DIFF_CONTEXT_LINES_     3
+// The unchanged characters kept on either side of a change in a changed line, and at most shown of other lines
+#define PSI_DIFF_CONTEXT_CHARS_     24
+#define PSI_DIFF_MAX_LINE_CHARS_    120
+#define PSI_DIFF_MAX_BYTES_         8192
+// The steps a diff may take before it settles for a longer (but still correct) edit script than the shortest
+#define PSI_DIFF_MAX_COST_          (1 << 24)
+// Changed lines that still differ over more than this once their common ends are skipped aren't diffed by character
+#define PSI_DIFF_MAX_CHAR_DIFF_     4096
+
+// The index of the highest bit set in `x` (which can't be 0)
+static inline unsigned psiHighestBit_(const psi_u64 x) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    if(_BitScanReverse(&index, PSI_CAST(unsigned long, (x >> 32))))
+        return PSI_CAST(unsigned, index) + 32;
+    _BitScanReverse(&index, PSI_CAST(unsigned long, (x & 0xFFFFFFFFu)));
+    return PSI_CAST(unsigned, index);
+#else
+    return 63 - PSI_CAST(unsigned, __builtin_clzll(x));
+#endif // _MSC_VER
+}
+
+// How many of their last `size` bytes (at most) `a` and `b` have in common. Both point just past their last byte.
+static psi_ull psiCommonSuffix_(const psi_u8* const a, const psi_u8* const b, const psi_ull size) {
+    psi_ull i = 0;
+#ifdef PSI_HAS_AVX2_
+    for(; i + 32 <= size; i += 32) {
+        const __m256i equal = _mm256_cmpeq_epi8(_mm256_loadu_si256(PSI_PTRCAST(const __m256i*, (a - i - 32))),
+                                                _mm256_loadu_si256(PSI_PTRCAST(const __m256i*, (b - i - 32))));
+        const psi_u32 differ = ~PSI_CAST(psi_u32, _mm256_movemask_epi8(equal));
+        if(differ != 0)
+            return i + 31 - psiHighestBit_(differ);
+    }
+#endif // PSI_HAS_AVX2_
+#if defined(PSI_HAS_SSE2_)
+    for(; i + 16 <= size; i += 16) {
+        const __m128i equal = _mm_cmpeq_epi8(_mm_loadu_si128(PSI_PTRCAST(const __m128i*, (a - i - 16))),
+                                             _mm_loadu_si128(PSI_PTRCAST(const __m128i*, (b - i - 16))));
+        const psi_u32 differ = ~PSI_CAST(psi_u32, _mm_movemask_epi8(equal)) & 0xFFFF;
+        if(differ != 0)
+            return i + 15 - psiHighestBit_(differ);
+    }
+#elif defined(PSI_HAS_NEON_)
+    for(; i + 16 <= size; i += 16) {
+        const uint8x16_t equal = vceqq_u8(vld1q_u8(a - i - 16), vld1q_u8(b - i - 16));
+        const psi_u64 differ = ~vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)), 0);
+        if(differ != 0)
+            return i + 15 - psiHighestBit_(differ) / 4;
+    }
+#else
+    for(; i + 8 <= size; i += 8) {
+        if(memcmp(a - i - 8, b - i - 8, 8) != 0)
+            break;
+    }
+#endif // PSI_HAS_SSE2_
+    for(; i < size; i++) {
+        if(*(a - i - 1) != *(b - i - 1))
+            break;
+    }
+    return i;
+}
+
+// A line of a string being diffed, with its '\n' (but the last one of the string may not have one)
+typedef struct {
+    const char* text;
+    psi_ull length;
+} psiDiffLineStruct;
+
+typedef struct {
+    // The ids of the lines (or characters) of the two sides: equal elements have the same one
+    const psi_u32* a;
+    const psi_u32* b;
+    // Set for the elements of `a` that were removed, and those of `b` that were added
+    psi_u8* removed;
+    psi_u8* added;
+    // The furthest paths on each diagonal, going forward from the start and backward from the end
+    psi_ll* forward;
+    psi_ll* backward;
+    // Counts down the steps the diff may still take (one per diagonal tried, and per element its snakes pass)
+    psi_ll budget;
+} psiDiffStruct;
+
+/**
+    Finds a point on a shortest edit script from a[aLo, aHi) to b[bLo, bHi) halfway through it, by running Myers'
+    algorithm from both ends until their paths meet. Returns 0 if there is none (or the budget ran out).
+*/
+static int psiDiffBisect_(psiDiffStruct* const diff, const psi_ull aLo, const psi_ull aHi,
+                          const psi_ull bLo, const psi_ull bHi, psi_ull* const x, psi_ull* const y) {
+    const psi_u32* const a = diff->a + aLo;
+    const psi_u32* const b = diff->b + bLo;
+    const psi_ll n = PSI_CAST(psi_ll, (aHi - aLo));
+    const psi_ll m = PSI_CAST(psi_ll, (bHi - bLo));
+    const psi_ll maxD = (n + m + 1) / 2;
+    const psi_ll offset = maxD;
+    const psi_ll length = 2 * maxD;
+    const psi_ll delta = n - m;
+    // The paths can only meet on the forward pass if `delta` is odd, and on the backward one if it's even
+    const int front = (delta % 2) != 0;
+    psi_ll k1Start = 0, k1End = 0, k2Start = 0, k2End = 0;
+
+    for(psi_ll k = 0; k < length + 2; k++) {
+        diff->forward[k] = -1;
+        diff->backward[k] = -1;
+    }
+    diff->forward[offset + 1] = 0;
+    diff->backward[offset + 1] = 0;
+
+    for(psi_ll d = 0; d < maxD; d++) {
+        for(psi_ll k1 = -d + k1Start; k1 <= d - k1End; k1 += 2) {
+            const psi_ll k1Offset = offset + k1;
+            psi_ll x1, y1;
+            if(k1 == -d || (k1 != d && diff->forward[k1Offset - 1] < diff->forward[k1Offset + 1]))
+                x1 = diff->forward[k1Offset + 1];
+            else
+                x1 = diff->forward[k1Offset - 1] + 1;
+            y1 = x1 - k1;
+            diff->budget -= 1 - x1;
+            while(x1 < n && y1 < m && a[x1] == b[y1]) {
+                x1++;
+                y1++;
+            }
+            diff->budget -= x1;
+            diff->forward[k1Offset] = x1;
+            if(x1 > n) {
+                k1End += 2;
+            } else if(y1 > m) {
+                k1Start += 2;
+            } else if(front) {
+                const psi_ll k2Offset = offset + delta - k1;
+                if(k2Offset >= 0 && k2Offset < length && diff->backward[k2Offset] != -1
+                   && x1 >= n - diff->backward[k2Offset]) {
+                    *x = PSI_CAST(psi_ull, x1);
+                    *y = PSI_CAST(psi_ull, y1);
+                    return 1;
+                }
+            }
+        }
+
+        for(psi_ll k2 = -d + k2Start; k2 <= d - k2End; k2 += 2) {
+            const psi_ll k2Offset = offset + k2;
+            psi_ll x2, y2;
+            if(k2 == -d || (k2 != d && diff->backward[k2Offset - 1] < diff->backward[k2Offset + 1]))
+                x2 = diff->backward[k2Offset + 1];
+            else
+                x2 = diff->backward[k2Offset - 1] + 1;
+            y2 = x2 - k2;
+            diff->budget -= 1 - x2;
+            while(x2 < n && y2 < m && a[n - x2 - 1] == b[m - y2 - 1]) {
+                x2++;
+                y2++;
+            }
+            diff->budget -= x2;
+            diff->backward[k2Offset] = x2;
+            if(x2 > n) {
+                k2End += 2;
+            } else if(y2 > m) {
+                k2Start += 2;
+            } else if(!front) {
+                const psi_ll k1Offset = offset + delta - k2;
+                if(k1Offset >= 0 && k1Offset < length && diff->forward[k1Offset] != -1) {
+                    const psi_ll x1 = diff->forward[k1Offset];
+                    if(x1 >= n - x2) {
+                        *x = PSI_CAST(psi_ull, x1);
+                        *y = PSI_CAST(psi_ull, (x1 - (k1Offset - offset)));
+                        return 1;
+                    }
+                }
+            }
+        }
+
+        if(diff->budget < 0)
+            return 0;
+    }
+    return 0;
+}
+
+// Marks what was removed from a[aLo, aHi) and added to b[bLo, bHi) to turn one into the other
+static void psiDiffRange_(psiDiffStruct* const diff, psi_ull aLo, psi_ull aHi, psi_ull bLo, psi_ull bHi) {
+    for(;;) {
+        psi_ull x, y;
+        while(aLo < aHi && bLo < bHi && diff->a[aLo] == diff->b[bLo]) {
+            aLo++;
+            bLo++;
+        }
+        while(aLo < aHi && bLo < bHi && diff->a[aHi - 1] == diff->b[bHi - 1]) {
+            aHi--;
+            bHi--;
+        }
+        if(aLo == aHi || bLo == bHi
+           || !psiDiffBisect_(diff, aLo, aHi, bLo, bHi, &x, &y)
+           || (x == 0 && y == 0) || (x == aHi - aLo && y == bHi - bLo)) {
+            // Everything left was replaced (if only since it took too long to find out otherwise)
+            memset(diff->removed + aLo, 1, aHi - aLo);
+            memset(diff->added + bLo, 1, bHi - bLo);
+            return;
+        }
+        psiDiffRange_(diff, aLo, aLo + x, bLo, bLo + y);
+        aLo += x;
+        bLo += y;
+    }
+}
+
+// Diffs `a` against `b`, setting `removed` and `added`. Returns 0 if out of memory.
+static int psiDiff_(const psi_u32* const a, const psi_ull numA, const psi_u32* const b, const psi_ull numB,
+                    psi_u8* const removed, psi_u8* const added) {
+    const psi_ull length = 2 * ((numA + numB + 1) / 2) + 2;
+    psiDiffStruct diff;
+    diff.a = a;
+    diff.b = b;
+    diff.removed = removed;
+    diff.added = added;
+    diff.forward = PSI_PTRCAST(psi_ll*, malloc(2 * length * sizeof(psi_ll)));
+    diff.budget = PSI_DIFF_MAX_COST_;
+    if(PSI_NONE(diff.forward))
+        return 0;
+    diff.backward = diff.forward + length;
+
+    memset(removed, 0, numA);
+    memset(added, 0, numB);
+    psiDiffRange_(&diff, 0, numA, 0, numB);
+    free(diff.forward);
+    return 1;
+}
+
+// Splits `str[from, to)` into lines, or counts them if `lines` is null. Returns how many there are.
+static psi_ull psiDiffSplitLines_(const char* const str, const psi_ull from, const psi_ull to,
+                                  psiDiffLineStruct* const lines) {
+    psi_ull numLines = 0;
+    psi_ull i = from;
+    while(i < to) {
+        const char* const newline = PSI_CAST(const char*, memchr(str + i, '\n', to - i));
+        const psi_ull end = PSI_SOME(newline) ? PSI_CAST(psi_ull, (newline - str)) + 1 : to;
+        if(PSI_SOME(lines)) {
+            lines[numLines].text = str + i;
+            lines[numLines].length = end - i;
+        }
+        numLines++;
+        i = end;
+    }
+    return numLines;
+}
+
+// Gives the lines ids, the same for all the lines with the same text. Returns 0 if out of memory.
+static int psiDiffInternLines_(const psiDiffLineStruct* const lines, const psi_ull numLines, psi_u32* const ids) {
+    psi_ull capacity = 16;
+    psi_u32* table;
+    while(capacity < 2 * numLines)
+        capacity *= 2;
+    // Holds the index of the first line with each text plus 1, 0 for empty slots
+    table = PSI_PTRCAST(psi_u32*, calloc(capacity, sizeof(psi_u32)));
+    if(PSI_NONE(table))
+        return 0;
+
+    for(psi_ull i = 0; i < numLines; i++) {
+        // FNV-1a
+        psi_u64 hash = 0xcbf29ce484222325ull;
+        psi_ull slot;
+        for(psi_ull c = 0; c < lines[i].length; c++)
+            hash = (hash ^ PSI_CAST(psi_u8, lines[i].text[c])) * 0x100000001b3ull;
+        for(slot = PSI_CAST(psi_ull, hash) & (capacity - 1);; slot = (slot + 1) & (capacity - 1)) {
+            const psi_u32 first = table[slot];
+            if(first == 0) {
+                table[slot] = PSI_CAST(psi_u32, (i + 1));
+                ids[i] = PSI_CAST(psi_u32, i);
+                break;
+            }
+            if(lines[first - 1].length == lines[i].length
+               && memcmp(lines[first - 1].text, lines[i].text, lines[i].length) == 0) {
+                ids[i] = first - 1;
+                break;
+            }
+        }
+    }
+    free(table);
+    return 1;
+}
+
+typedef struct {
+    // The bytes of the diff printed so far, and the most it may print
+    psi_ull numBytes;
+    psi_ull maxBytes;
+} psiDiffOutputStruct;
+
+// Prints `text[0, length)` in `colour` (if it isn't PSI_COLOUR_DEFAULT_), counting it towards the diff's output
+static void psiDiffPut_(psiDiffOutputStruct* const out, const int colour, const char* const text,
+                        const psi_ull length) {
+    const int n = PSI_CAST(int, length);
+    if(colour == PSI_COLOUR_DEFAULT_) {
+        psiPrintf("%.*s", n, text);
+    } else {
+        psiColouredPrintf(colour, "%.*s", n, text);
+        psiReportPrintf("%.*s", n, text);
+    }
+    out->numBytes += length;
+}
+
+// Prints the first `maxLength` characters of `text[0, length)`, and how many more there were
+static void psiDiffPutClipped_(psiDiffOutputStruct* const out, const int colour, const char* const text,
+                               const psi_ull length, const psi_ull maxLength) {
+    if(length <= maxLength) {
+        psiDiffPut_(out, colour, text, length);
+    } else {
+        char more[64];
+        psiDiffPut_(out, colour, text, maxLength);
+        PSI_SNPRINTF(more, sizeof(more), "[...%" PSI_PRIu64 " more bytes]", PSI_CAST(psi_u64, (length - maxLength)));
+        psiDiffPut_(out, PSI_COLOUR_DEFAULT_, more, strlen(more));
+    }
+}
+
+/**
+    Prints a line of the diff: `sign` and the line (without its '\n'). `changed`, if set, has the characters that
+    changed: they're highlighted, and only `PSI_DIFF_CONTEXT_CHARS_` of the others are kept around each run of them.
+*/
+static void psiDiffPutLine_(psiDiffOutputStruct* const out, const char sign, const int colour, const int highlight,
+                            const psiDiffLineStruct* const line, const psi_u8* const changed) {
+    const int hasNewline = line->length > 0 && line->text[line->length - 1] == '\n';
+    const psi_ull length = line->length - (hasNewline ? 1 : 0);
+    char prefix[16];
+
+    PSI_SNPRINTF(prefix, sizeof(prefix), "             %c", sign);
+    psiDiffPut_(out, colour, prefix, strlen(prefix));
+    if(PSI_NONE(changed)) {
+        psiDiffPutClipped_(out, colour, line->text, length, PSI_DIFF_MAX_LINE_CHARS_);
+    } else {
+        psi_ull i = 0;
+        while(i < length) {
+            psi_ull end = i;
+            while(end < length && changed[end] == changed[i])
+                end++;
+            if(changed[i]) {
+                psiDiffPutClipped_(out, highlight, line->text + i, end - i, PSI_DIFF_MAX_LINE_CHARS_);
+            } else {
+                // Only the unchanged characters next to a change are of any help
+                const psi_ull keepBefore = i > 0 ? PSI_DIFF_CONTEXT_CHARS_ : 0;
+                const psi_ull keepAfter = end < length ? PSI_DIFF_CONTEXT_CHARS_ : 0;
+                if(i == 0 && end == length) {
+                    psiDiffPutClipped_(out, colour, line->text, length, PSI_DIFF_MAX_LINE_CHARS_);
+                } else if(end - i <= keepBefore + keepAfter + 3) {
+                    psiDiffPut_(out, colour, line->text + i, end - i);
+                } else {
+                    psiDiffPut_(out, colour, line->text + i, keepBefore);
+                    psiDiffPut_(out, PSI_COLOUR_DEFAULT_, "...", 3);
+                    psiDiffPut_(out, colour, line->text + end - keepAfter, keepAfter);
+                }
+            }
+            i = end;
+        }
+    }
+    psiDiffPut_(out, PSI_COLOUR_DEFAULT_, "\n", 1);
+    if(!hasNewline) {
+        const char* const noNewline = "             \\ No newline at the end\n";
+        psiDiffPut_(out, PSI_COLOUR_DEFAULT_, noNewline, strlen(noNewline));
+    }
+}
+
+/**
+    Prints a line that was removed and the one that replaced it, with the characters that differ between the two
+    highlighted (or not, if that can't be worked out cheaply)
+*/
+static void psiDiffPutChangedLines_(psiDiffOutputStruct* const out, const psiDiffLineStruct* const removed,
+                                    const psiDiffLineStruct* const added) {
+    const psi_ull minLength = removed->length < added->length ? removed->length : added->length;
+    const psi_u8* const r = PSI_PTRCAST(const psi_u8*, removed->text);
+    const psi_u8* const a = PSI_PTRCAST(const psi_u8*, added->text);
+    const psi_ull prefix = psiFindByte_(r, a, 0, minLength, 0);
+    const psi_ull suffix = psiCommonSuffix_(r + removed->length, a + added->length, minLength - prefix);
+    const psi_ull numR = removed->length - prefix - suffix;
+    const psi_ull numA = added->length - prefix - suffix;
+    psi_u8* const changed = PSI_PTRCAST(psi_u8*, calloc(removed->length + added->length + 1, 1));
+    psi_u32* const ids = numR + numA <= PSI_DIFF_MAX_CHAR_DIFF_
+                             ? PSI_PTRCAST(psi_u32*, malloc((numR + numA + 1) * sizeof(psi_u32)))
+                             : PSI_NULL;
+
+    if(PSI_NONE(changed)) {
+        psiDiffPutLine_(out, '-', PSI_COLOUR_RED_, PSI_COLOUR_BRIGHTRED_, removed, PSI_NULL);
+        psiDiffPutLine_(out, '+', PSI_COLOUR_GREEN_, PSI_COLOUR_BRIGHTGREEN_, added, PSI_NULL);
+        free(ids);
+        return;
+    }
+
+    // Down to single characters if it's small enough, or else everything between the common ends changed
+    if(PSI_SOME(ids)) {
+        for(psi_ull i = 0; i < numR; i++)
+            ids[i] = r[prefix + i];
+        for(psi_ull i = 0; i < numA; i++)
+            ids[numR + i] = a[prefix + i];
+    }
+    if(PSI_NONE(ids) || !psiDiff_(ids, numR, ids + numR, numA, changed + prefix, changed + removed->length + prefix)) {
+        memset(changed + prefix, 1, numR);
+        memset(changed + removed->length + prefix, 1, numA);
+    }
+    psiDiffPutLine_(out, '-', PSI_COLOUR_RED_, PSI_COLOUR_BRIGHTRED_, removed, changed);
+    psiDiffPutLine_(out, '+', PSI_COLOUR_GREEN_, PSI_COLOUR_BRIGHTGREEN_, added, changed + removed->length);
+    free(ids);
+    free(changed);
+}
+
+/**
+    Prints the hunks of the diff of lines `a` (what was expected, numbered from `firstLine`) to lines `b` (what
+    the string actually was), given what was `removed` from the one and `added` to the other. Returns 0 if it had
+    to stop because of the output limit.
+*/
+static int psiDiffPutHunks_(psiDiffOutputStruct* const out, const psiDiffLineStruct* const a, const psi_ull numA,
+                            const psiDiffLineStruct* const b, const psi_ull numB, const psi_u8* const removed,
+                            const psi_u8* const added, const psi_ull firstLine) {
+    psi_ull i = 0, j = 0;
+    while(i < numA || j < numB) {
+        psi_ull hunkA, hunkB, endA, endB, k;
+        char header[128];
+
+        // The start of the next hunk: context lines before its first change
+        while(i < numA && j < numB && !removed[i] && !added[j]) {
+            i++;
+            j++;
+        }
+        if(i == numA && j == numB)
+            break;
+        if(out->numBytes >= out->maxBytes)
+            return 0;
+        for(k = 0; k < PSI_DIFF_CONTEXT_LINES_ && i > 0 && j > 0; k++) {
+            i--;
+            j--;
+        }
+        hunkA = i;
+        hunkB = j;
+
+        // Its end: the first run of more unchanged lines than two hunks' worth of context, or the end
+        endA = i;
+        endB = j;
+        for(;;) {
+            psi_ull numSame = 0;
+            while(endA < numA && removed[endA])
+                endA++;
+            while(endB < numB && added[endB])
+                endB++;
+            while(endA + numSame < numA && endB + numSame < numB && !removed[endA + numSame] && !added[endB + numSame])
+                numSame++;
+            if(numSame > 2 * PSI_DIFF_CONTEXT_LINES_ || (endA + numSame == numA && endB + numSame == numB)) {
+                const psi_ull context = numSame < PSI_DIFF_CONTEXT_LINES_ ? numSame : PSI_DIFF_CONTEXT_LINES_;
+                endA += context;
+                endB += context;
+                break;
+            }
+            endA += numSame;
+            endB += numSame;
+        }
+
+        // As in unified diffs, a side the hunk has no lines of is numbered after the line before it (0 if none)
+        PSI_SNPRINTF(header, sizeof(header),
+                     "             @@ -%" PSI_PRIu64 ",%" PSI_PRIu64 " +%" PSI_PRIu64 ",%" PSI_PRIu64 " @@\n",
+                     PSI_CAST(psi_u64, (firstLine + hunkA - (endA == hunkA ? 1 : 0))),
+                     PSI_CAST(psi_u64, (endA - hunkA)),
+                     PSI_CAST(psi_u64, (firstLine + hunkB - (endB == hunkB ? 1 : 0))),
+                     PSI_CAST(psi_u64, (endB - hunkB)));
+        psiDiffPut_(out, PSI_COLOUR_CYAN_, header, strlen(header));
+        while(i < endA || j < endB) {
+            psi_ull numRemoved = 0, numAdded = 0;
+            if(out->numBytes >= out->maxBytes)
+                return 0;
+            if(i < endA && j < endB && !removed[i] && !added[j]) {
+                psiDiffPutLine_(out, ' ', PSI_COLOUR_DEFAULT_, PSI_COLOUR_DEFAULT_, &a[i++], PSI_NULL);
+                j++;
+                continue;
+            }
+            while(i + numRemoved < endA && removed[i + numRemoved])
+                numRemoved++;
+            while(j + numAdded < endB && added[j + numAdded])
+                numAdded++;
+            // Lines replaced one for one are shown in pairs, with what changed in them highlighted
+            if(numRemoved == numAdded) {
+                for(k = 0; k < numRemoved; k++) {
+                    if(out->numBytes >= out->maxBytes)
+                        return 0;
+                    psiDiffPutChangedLines_(out, &a[i + k], &b[j + k]);
+                }
+            } else {
+                for(k = 0; k < numRemoved + numAdded; k++) {
+                    if(out->numBytes >= out->maxBytes)
+                        return 0;
+                    if(k < numRemoved)
+                        psiDiffPutLine_(out, '-', PSI_COLOUR_RED_, PSI_COLOUR_BRIGHTRED_, &a[i + k], PSI_NULL);
+                    else
+                        psiDiffPutLine_(out, '+', PSI_COLOUR_GREEN_, PSI_COLOUR_BRIGHTGREEN_, &b[j + k - numRemoved],
+                                        PSI_NULL);
+                }
+            }
+            i += numRemoved;
+            j += numAdded;
+        }
+    }
+    return 1;
+}
+
+/**
+    Prints the diff of `actual` against `expected` (which differ), as the hunks of the lines they don't have in
+    common - and the lines around them
+*/
+static void psiPrintStrDiff_(const char* const actual, const psi_ull actualLength, const char* const expected,
+                             const psi_ull expectedLength, const char* const actualName, const char* const expectedName,
+                             const char* const actualPrint) {
+    const psi_ull minLength = actualLength < expectedLength ? actualLength : expectedLength;
+    const psi_ull prefix = psiFindByte_(PSI_PTRCAST(const psi_u8*, actual), PSI_PTRCAST(const psi_u8*, expected),
+                                        0, minLength, 0);
+    const psi_ull suffix = psiCommonSuffix_(PSI_PTRCAST(const psi_u8*, (actual + actualLength)),
+                                            PSI_PTRCAST(const psi_u8*, (expected + expectedLength)),
+                                            minLength - prefix);
+    psi_ull start = prefix, actualEnd = actualLength - suffix, expectedEnd, firstLine = 1, differingLine = 1;
+    psi_ull numA, numB;
+    psi_ull numRemoved = 0, numAdded = 0;
+    psiDiffLineStruct* lines;
+    psi_u32* ids;
+    psi_u8* flags;
+    psiDiffOutputStruct out;
+
+    // Only whole lines are diffed, with the context lines around them
+    while(start > 0 && expected[start - 1] != '\n')
+        start--;
+    for(int k = 0; k < PSI_DIFF_CONTEXT_LINES_ && start > 0; k++) {
+        start--;
+        while(start > 0 && expected[start - 1] != '\n')
+            start--;
+    }
+    for(int k = 0; k <= PSI_DIFF_CONTEXT_LINES_ && actualEnd < actualLength; k++) {
+        // The common suffix is the same in both, so `actual` is as good as `expected` to look for lines in
+        const char* newline;
+        if(k == 0 && (actualEnd == 0 || actual[actualEnd - 1] == '\n'))
+            continue;
+        newline = PSI_CAST(const char*, memchr(actual + actualEnd, '\n', actualLength - actualEnd));
+        actualEnd = PSI_SOME(newline) ? PSI_CAST(psi_ull, (newline - actual)) + 1 : actualLength;
+    }
+    expectedEnd = expectedLength - (actualLength - actualEnd);
+    for(psi_ull i = 0; i < prefix; i++) {
+        if(expected[i] == '\n') {
+            differingLine++;
+            firstLine += i < start ? 1 : 0;
+        }
+    }
+
+    psiPrintf("    Actual : %s, from byte %" PSI_PRIu64 " (line %" PSI_PRIu64 ")\n", actualPrint,
+              PSI_CAST(psi_u64, prefix), PSI_CAST(psi_u64, differingLine));
+
+    numB = psiDiffSplitLines_(actual, start, actualEnd, PSI_NULL);
+    numA = psiDiffSplitLines_(expected, start, expectedEnd, PSI_NULL);
+    lines = PSI_PTRCAST(psiDiffLineStruct*, malloc((numA + numB + 1) * sizeof(psiDiffLineStruct)));
+    ids = PSI_PTRCAST(psi_u32*, malloc((numA + numB + 1) * sizeof(psi_u32)));
+    flags = PSI_PTRCAST(psi_u8*, malloc(numA + numB + 1));
+    if(PSI_NONE(lines) || PSI_NONE(ids) || PSI_NONE(flags)) {
+        psiPrintf("             (out of memory for the diff)\n");
+        free(lines);
+        free(ids);
+        free(flags);
+        return;
+    }
+    psiDiffSplitLines_(expected, start, expectedEnd, lines);
+    psiDiffSplitLines_(actual, start, actualEnd, lines + numA);
+    if(!psiDiffInternLines_(lines, numA + numB, ids) || !psiDiff_(ids, numA, ids + numA, numB, flags, flags + numA)) {
+        // Every line replaced is still a correct diff
+        memset(flags, 1, numA + numB);
+    }
+    for(psi_ull i = 0; i < numA; i++)
+        numRemoved += flags[i];
+    for(psi_ull i = 0; i < numB; i++)
+        numAdded += flags[numA + i];
+
+    out.numBytes = 0;
+    out.maxBytes = psiTestContext.diffMaxBytes > 0 ? psiTestContext.diffMaxBytes : PSI_DIFF_MAX_BYTES_;
+    psiPrintf("             --- %s (%" PSI_PRIu64 " %s removed)\n", expectedName, PSI_CAST(psi_u64, numRemoved),
+              numRemoved == 1 ? "line" : "lines");
+    psiPrintf("             +++ %s (%" PSI_PRIu64 " %s added)\n", actualName, PSI_CAST(psi_u64, numAdded),
+              numAdded == 1 ? "line" : "lines");
+    if(!psiDiffPutHunks_(&out, lines, numA, lines + numA, numB, flags, flags + numA, firstLine))
+        psiPrintf("             ... (the diff goes on, see --diff-max-bytes)\n");
+    free(lines);
+    free(ids);
+    free(flags);
+}
+
+// What `CHECK_STREQ` and `CHECK_SUBSTREQ` (and the others) print after the macro, of `actual[0, actualLength)` and
+// `expected[0, expectedLength)`
+static void psiPrintStrFailure_(const psiAssertSiteStruct* const site, const char* const actual,
+                                const psi_ull actualLength, const char* const expected, const psi_ull expectedLength) {
+    if(actualLength <= PSI_DIFF_MAX_INLINE_ && expectedLength <= PSI_DIFF_MAX_INLINE_
+       && PSI_NONE(memchr(actual, '\n', actualLength)) && PSI_NONE(memchr(expected, '\n', expectedLength))) {
+        psiPrintf("  Expected : \"%.*s\" %s \"%.*s\"\n", PSI_CAST(int, actualLength), actual, site->op,
+                  PSI_CAST(int, expectedLength), expected);
+        psiPrintf("    Actual : %s\n", site->actualPrint);
+        return;
+    }
+    psiPrintf("  Expected : %s %s %s (%" PSI_PRIu64 " and %" PSI_PRIu64 " bytes)\n", site->actual, site->op,
+              site->expected, PSI_CAST(psi_u64, actualLength), PSI_CAST(psi_u64, expectedLength));
+    if(actualLength == expectedLength && memcmp(actual, expected, actualLength) == 0) {
+        // `CHECK_STRNE`: there is nothing to diff
+        psiPrintf("    Actual : %s\n", site->actualPrint);
+        return;
+    }
+    {
+        const int isTracking = psiPauseAllocTracking_();
+        psiPrintStrDiff_(actual, actualLength, expected, expectedLength, site->actual, site->expected,
+                         site->actualPrint);
+        psiResumeAllocTracking_(isTracking);
+    }
+}
+
+static PSI_COLD_ void psiReportStrFailure_(PSI_SITE_PARAMS_, const char* const actual, const char* const expected) {
+    const psiAssertSiteStruct site = psiUnpackSite_(file, line, packed);
+    psiPrintFailureLocation_(&site);
+    if(psiShouldDecomposeMacro(site.actual, site.expected, 1)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s, %s )\n", site.macroName, site.actual, site.expected);
+    }
+    psiPrintStrFailure_(&site, actual, strlen(actual), expected, strlen(expected));
+}
+
+// The length of `str`, up to `n`
+static psi_ull psiStrnLength_(const char* const str, const int n) {
+    const char* const end = PSI_CAST(const char*, memchr(str, '\0', PSI_CAST(size_t, n)));
+    return PSI_SOME(end) ? PSI_CAST(psi_ull, (end - str)) : PSI_CAST(psi_ull, n);
+}
+
+static PSI_COLD_ void psiReportStrnFailure_(PSI_SITE_PARAMS_,
+                                            const char* const actual, const char* const expected, const int n) {
+    const psiAssertSiteStruct site = psiUnpackSite_(file, line, packed);
+    psiPrintFailureLocation_(&site);
+    if(psiShouldDecomposeMacro(site.actual, site.expected, 1)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s, %s, %s )\n",
+                          site.macroName, site.actual, site.expected, site.extra);
+    }
+    psiPrintStrFailure_(&site, actual, psiStrnLength_(actual, n), expected, psiStrnLength_(expected, n));
+}
+
+#define __TAUCMP_STR__(actual, expected, cond, ifCondFailsThenPrint, actualPrint, macroName, failOrAbort)       \
+    do {                                                                                                        \
+        if(PSI_UNLIKELY_(strcmp(actual, expected) cond 0)) {                                                    \
+            psiReportStrFailure_(PSI_SITE_(#macroName, #actual, #expected, "", #ifCondFailsThenPrint, #actualPrint), \
+                                 actual, expected);                                                             \
             failOrAbort;                                                                                        \
-            if(shouldAbortTest) {                                                                               \
-                return;                                                                                         \
-            }                                                                                                   \
+            PSI_RETURN_IF_ABORTED_()                                                                            \
         }                                                                                                       \
     }                                                                                                           \
     while(0)
@@ -688,23 +2339,535 @@ static void psiPrintHexBufCmp(const void* const buff, const void* const ref, con
             psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "`n` cannot be negative\n");                               \
             PSI_ABORT;                                                                                          \
         }                                                                                                       \
-        if(strncmp(actual, expected, n) cond 0) {                                                               \
-            psiPrintf("%s:%u: ", __FILE__, __LINE__);                                                           \
-            psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "FAILED\n");                                               \
-            if(psiShouldDecomposeMacro(#actual, #expected, 1)) {                                                \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");                                 \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s, %s, %s)\n",                              \
-                                                                #macroName,                                     \
-                                                                #actual, #expected, #n);                        \
-                }                                                                                               \
-            psiPrintf("  Expected : \"%.*s\" %s \"%.*s\"\n", PSI_CAST(int, n), actual,                          \
-                                                              #ifCondFailsThenPrint,                            \
-                                                              PSI_CAST(int, n), expected);                      \
-            psiPrintf("    Actual : %s\n", #actualPrint);                                                       \
+        if(PSI_UNLIKELY_(strncmp(actual, expected, n) cond 0)) {                                                \
+            psiReportStrnFailure_(PSI_SITE_(#macroName, #actual, #expected, #n, #ifCondFailsThenPrint, #actualPrint), \
+                                  actual, expected, PSI_CAST(int, n));                                          \
+            failOrAbort;                                                                                        \
+            PSI_RETURN_IF_ABORTED_()                                                                            \
+        }                                                                                                       \
+    }                                                                                                           \
+    while(0)
+
+/**
+    Array Comparisons (`CHECK_ARRAY_NEAR`, `CHECK_ARRAY_ULP`)
+    Of `float` or `double` arrays (told apart by the size of their elements), a vector at a time with AVX2, SSE2 or
+    NEON (whichever the compiler targets; NEON only has `double` lanes on AArch64) and one element at a time
+    everywhere else. A failed check goes over the rest of the arrays with the same loops, to count the elements
+    that are off and find the worst of them.
+    An element is near if `|actual - expected| <= absTol + relTol * |expected|`, or if they're equal (as infinities
+    can be). It's within `maxUlps` if there are at most that many representable values from `expected` to it (+0
+    and -0 being the same). NaNs never are either.
+*/
+#if defined(PSI_HAS_NEON_) && (defined(__aarch64__) || defined(_M_ARM64))
+    #define PSI_HAS_NEON_DOUBLE_    1
+#endif // PSI_HAS_NEON_
+
+static inline int psiIsNearF_(const float a, const float e, const float absTol, const float relTol) {
+    return a == e || fabsf(a - e) <= absTol + relTol * fabsf(e);
+}
+
+static inline int psiIsNearD_(const double a, const double e, const double absTol, const double relTol) {
+    return a == e || fabs(a - e) <= absTol + relTol * fabs(e);
+}
+
+// How many representable values there are from `e` to `a`, or the most there can be if either is a NaN
+static psi_u64 psiUlpsF_(const float a, const float e) {
+    psi_u32 x, y;
+    psi_u64 magX, magY;
+    if(a != a || e != e)
+        return ~PSI_CAST(psi_u64, 0);
+    memcpy(&x, &a, sizeof(x));
+    memcpy(&y, &e, sizeof(y));
+    magX = x & 0x7FFFFFFFu;
+    magY = y & 0x7FFFFFFFu;
+    // Through 0 if their signs differ
+    if((x ^ y) >> 31)
+        return magX + magY;
+    return magX > magY ? magX - magY : magY - magX;
+}
+
+static psi_u64 psiUlpsD_(const double a, const double e) {
+    psi_u64 x, y, magX, magY;
+    if(a != a || e != e)
+        return ~PSI_CAST(psi_u64, 0);
+    memcpy(&x, &a, sizeof(x));
+    memcpy(&y, &e, sizeof(y));
+    magX = x & 0x7FFFFFFFFFFFFFFFull;
+    magY = y & 0x7FFFFFFFFFFFFFFFull;
+    if((x ^ y) >> 63)
+        return magX + magY;
+    return magX > magY ? magX - magY : magY - magX;
+}
+
+// The first index from `i` on (or `n`) where `a` isn't near `e`
+static psi_ull psiFindNotNearF_(const float* const a, const float* const e, psi_ull i, const psi_ull n,
+                                const float absTol, const float relTol) {
+#ifdef PSI_HAS_AVX2_
+    {
+        const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+        const __m256 vAbsTol = _mm256_set1_ps(absTol);
+        const __m256 vRelTol = _mm256_set1_ps(relTol);
+        for(; i + 8 <= n; i += 8) {
+            const __m256 x = _mm256_loadu_ps(a + i);
+            const __m256 y = _mm256_loadu_ps(e + i);
+            const __m256 diff = _mm256_and_ps(_mm256_sub_ps(x, y), absMask);
+            const __m256 tol = _mm256_add_ps(vAbsTol, _mm256_mul_ps(vRelTol, _mm256_and_ps(y, absMask)));
+            const __m256 near = _mm256_or_ps(_mm256_cmp_ps(diff, tol, _CMP_LE_OQ), _mm256_cmp_ps(x, y, _CMP_EQ_OQ));
+            const psi_u32 off = ~PSI_CAST(psi_u32, _mm256_movemask_ps(near)) & 0xFF;
+            if(off != 0)
+                return i + psiLowestBit_(off);
+        }
+    }
+#endif // PSI_HAS_AVX2_
+#if defined(PSI_HAS_SSE2_)
+    {
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        const __m128 vAbsTol = _mm_set1_ps(absTol);
+        const __m128 vRelTol = _mm_set1_ps(relTol);
+        for(; i + 4 <= n; i += 4) {
+            const __m128 x = _mm_loadu_ps(a + i);
+            const __m128 y = _mm_loadu_ps(e + i);
+            const __m128 diff = _mm_and_ps(_mm_sub_ps(x, y), absMask);
+            const __m128 tol = _mm_add_ps(vAbsTol, _mm_mul_ps(vRelTol, _mm_and_ps(y, absMask)));
+            const __m128 near = _mm_or_ps(_mm_cmple_ps(diff, tol), _mm_cmpeq_ps(x, y));
+            const psi_u32 off = ~PSI_CAST(psi_u32, _mm_movemask_ps(near)) & 0xF;
+            if(off != 0)
+                return i + psiLowestBit_(off);
+        }
+    }
+#elif defined(PSI_HAS_NEON_)
+    {
+        const float32x4_t vAbsTol = vdupq_n_f32(absTol);
+        const float32x4_t vRelTol = vdupq_n_f32(relTol);
+        for(; i + 4 <= n; i += 4) {
+            const float32x4_t x = vld1q_f32(a + i);
+            const float32x4_t y = vld1q_f32(e + i);
+            const float32x4_t tol = vaddq_f32(vAbsTol, vmulq_f32(vRelTol, vabsq_f32(y)));
+            const uint64x2_t near = vreinterpretq_u64_u32(vorrq_u32(vcleq_f32(vabdq_f32(x, y), tol), vceqq_f32(x, y)));
+            // Which one is off is left to the loop below
+            if((vgetq_lane_u64(near, 0) & vgetq_lane_u64(near, 1)) != ~PSI_CAST(psi_u64, 0))
+                break;
+        }
+    }
+#endif // PSI_HAS_SSE2_
+    for(; i < n; i++) {
+        if(!psiIsNearF_(a[i], e[i], absTol, relTol))
+            return i;
+    }
+    return n;
+}
+
+static psi_ull psiFindNotNearD_(const double* const a, const double* const e, psi_ull i, const psi_ull n,
+                                const double absTol, const double relTol) {
+#ifdef PSI_HAS_AVX2_
+    {
+        const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFll));
+        const __m256d vAbsTol = _mm256_set1_pd(absTol);
+        const __m256d vRelTol = _mm256_set1_pd(relTol);
+        for(; i + 4 <= n; i += 4) {
+            const __m256d x = _mm256_loadu_pd(a + i);
+            const __m256d y = _mm256_loadu_pd(e + i);
+            const __m256d diff = _mm256_and_pd(_mm256_sub_pd(x, y), absMask);
+            const __m256d tol = _mm256_add_pd(vAbsTol, _mm256_mul_pd(vRelTol, _mm256_and_pd(y, absMask)));
+            const __m256d near = _mm256_or_pd(_mm256_cmp_pd(diff, tol, _CMP_LE_OQ), _mm256_cmp_pd(x, y, _CMP_EQ_OQ));
+            const psi_u32 off = ~PSI_CAST(psi_u32, _mm256_movemask_pd(near)) & 0xF;
+            if(off != 0)
+                return i + psiLowestBit_(off);
+        }
+    }
+#endif // PSI_HAS_AVX2_
+#if defined(PSI_HAS_SSE2_)
+    {
+        const __m128d absMask = _mm_castsi128_pd(_mm_set_epi32(0x7FFFFFFF, -1, 0x7FFFFFFF, -1));
+        const __m128d vAbsTol = _mm_set1_pd(absTol);
+        const __m128d vRelTol = _mm_set1_pd(relTol);
+        for(; i + 2 <= n; i += 2) {
+            const __m128d x = _mm_loadu_pd(a + i);
+            const __m128d y = _mm_loadu_pd(e + i);
+            const __m128d diff = _mm_and_pd(_mm_sub_pd(x, y), absMask);
+            const __m128d tol = _mm_add_pd(vAbsTol, _mm_mul_pd(vRelTol, _mm_and_pd(y, absMask)));
+            const __m128d near = _mm_or_pd(_mm_cmple_pd(diff, tol), _mm_cmpeq_pd(x, y));
+            const psi_u32 off = ~PSI_CAST(psi_u32, _mm_movemask_pd(near)) & 0x3;
+            if(off != 0)
+                return i + psiLowestBit_(off);
+        }
+    }
+#elif defined(PSI_HAS_NEON_DOUBLE_)
+    {
+        const float64x2_t vAbsTol = vdupq_n_f64(absTol);
+        const float64x2_t vRelTol = vdupq_n_f64(relTol);
+        for(; i + 2 <= n; i += 2) {
+            const float64x2_t x = vld1q_f64(a + i);
+            const float64x2_t y = vld1q_f64(e + i);
+            const float64x2_t tol = vaddq_f64(vAbsTol, vmulq_f64(vRelTol, vabsq_f64(y)));
+            const uint64x2_t near = vorrq_u64(vcleq_f64(vabdq_f64(x, y), tol), vceqq_f64(x, y));
+            if((vgetq_lane_u64(near, 0) & vgetq_lane_u64(near, 1)) != ~PSI_CAST(psi_u64, 0))
+                break;
+        }
+    }
+#endif // PSI_HAS_SSE2_
+    for(; i < n; i++) {
+        if(!psiIsNearD_(a[i], e[i], absTol, relTol))
+            return i;
+    }
+    return n;
+}
+
+// The first index from `i` on (or `n`) where `a` is more than `maxUlps` from `e`
+static psi_ull psiFindNotWithinUlpsF_(const float* const a, const float* const e, psi_ull i, const psi_ull n,
+                                      const psi_u64 maxUlps) {
+    // No two floats that aren't NaNs are more than 0xFF000000 apart
+    const psi_u32 ulps = maxUlps < 0xFFFFFFFFu ? PSI_CAST(psi_u32, maxUlps) : 0xFFFFFFFFu;
+#ifdef PSI_HAS_AVX2_
+    {
+        const __m256i magMask = _mm256_set1_epi32(0x7FFFFFFF);
+        // Unsigned comparisons are signed ones with the sign bits flipped
+        const __m256i bias = _mm256_set1_epi32(PSI_CAST(int, 0x80000000u));
+        const __m256i vUlps = _mm256_xor_si256(_mm256_set1_epi32(PSI_CAST(int, ulps)), bias);
+        for(; i + 8 <= n; i += 8) {
+            const __m256 xf = _mm256_loadu_ps(a + i);
+            const __m256 yf = _mm256_loadu_ps(e + i);
+            const __m256i x = _mm256_castps_si256(xf);
+            const __m256i y = _mm256_castps_si256(yf);
+            const __m256i magX = _mm256_and_si256(x, magMask);
+            const __m256i magY = _mm256_and_si256(y, magMask);
+            const __m256i through0 = _mm256_srai_epi32(_mm256_xor_si256(x, y), 31);
+            const __m256i dist = _mm256_blendv_epi8(_mm256_abs_epi32(_mm256_sub_epi32(magX, magY)),
+                                                    _mm256_add_epi32(magX, magY), through0);
+            const __m256i over = _mm256_cmpgt_epi32(_mm256_xor_si256(dist, bias), vUlps);
+            const __m256 off = _mm256_or_ps(_mm256_castsi256_ps(over), _mm256_cmp_ps(xf, yf, _CMP_UNORD_Q));
+            const int mask = _mm256_movemask_ps(off);
+            if(mask != 0)
+                return i + psiLowestBit_(PSI_CAST(psi_u32, mask));
+        }
+    }
+#endif // PSI_HAS_AVX2_
+#if defined(PSI_HAS_SSE2_)
+    {
+        const __m128i magMask = _mm_set1_epi32(0x7FFFFFFF);
+        const __m128i bias = _mm_set1_epi32(PSI_CAST(int, 0x80000000u));
+        const __m128i vUlps = _mm_xor_si128(_mm_set1_epi32(PSI_CAST(int, ulps)), bias);
+        for(; i + 4 <= n; i += 4) {
+            const __m128 xf = _mm_loadu_ps(a + i);
+            const __m128 yf = _mm_loadu_ps(e + i);
+            const __m128i x = _mm_castps_si128(xf);
+            const __m128i y = _mm_castps_si128(yf);
+            const __m128i magX = _mm_and_si128(x, magMask);
+            const __m128i magY = _mm_and_si128(y, magMask);
+            const __m128i through0 = _mm_srai_epi32(_mm_xor_si128(x, y), 31);
+            // SSE2 has no abs: negate the negative ones
+            const __m128i diff = _mm_sub_epi32(magX, magY);
+            const __m128i diffSign = _mm_srai_epi32(diff, 31);
+            const __m128i absDiff = _mm_sub_epi32(_mm_xor_si128(diff, diffSign), diffSign);
+            const __m128i dist = _mm_or_si128(_mm_and_si128(through0, _mm_add_epi32(magX, magY)),
+                                              _mm_andnot_si128(through0, absDiff));
+            const __m128i over = _mm_cmpgt_epi32(_mm_xor_si128(dist, bias), vUlps);
+            const __m128 off = _mm_or_ps(_mm_castsi128_ps(over), _mm_cmpunord_ps(xf, yf));
+            const int mask = _mm_movemask_ps(off);
+            if(mask != 0)
+                return i + psiLowestBit_(PSI_CAST(psi_u32, mask));
+        }
+    }
+#elif defined(PSI_HAS_NEON_)
+    {
+        const uint32x4_t magMask = vdupq_n_u32(0x7FFFFFFFu);
+        const uint32x4_t vUlps = vdupq_n_u32(ulps);
+        for(; i + 4 <= n; i += 4) {
+            const float32x4_t xf = vld1q_f32(a + i);
+            const float32x4_t yf = vld1q_f32(e + i);
+            const uint32x4_t x = vreinterpretq_u32_f32(xf);
+            const uint32x4_t y = vreinterpretq_u32_f32(yf);
+            const uint32x4_t magX = vandq_u32(x, magMask);
+            const uint32x4_t magY = vandq_u32(y, magMask);
+            const uint32x4_t through0 = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_u32(veorq_u32(x, y)), 31));
+            const uint32x4_t dist = vbslq_u32(through0, vaddq_u32(magX, magY), vabdq_u32(magX, magY));
+            const uint32x4_t numbers = vandq_u32(vceqq_f32(xf, xf), vceqq_f32(yf, yf));
+            const uint64x2_t within = vreinterpretq_u64_u32(vandq_u32(vcleq_u32(dist, vUlps), numbers));
+            if((vgetq_lane_u64(within, 0) & vgetq_lane_u64(within, 1)) != ~PSI_CAST(psi_u64, 0))
+                break;
+        }
+    }
+#endif // PSI_HAS_SSE2_
+    for(; i < n; i++) {
+        if(a[i] != a[i] || e[i] != e[i] || psiUlpsF_(a[i], e[i]) > maxUlps)
+            return i;
+    }
+    return n;
+}
+
+static psi_ull psiFindNotWithinUlpsD_(const double* const a, const double* const e, psi_ull i, const psi_ull n,
+                                      const psi_u64 maxUlps) {
+#ifdef PSI_HAS_AVX2_
+    {
+        const __m256i magMask = _mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFll);
+        const __m256i bias = _mm256_set1_epi64x(PSI_CAST(long long, 0x8000000000000000ull));
+        const __m256i vUlps = _mm256_xor_si256(_mm256_set1_epi64x(PSI_CAST(long long, maxUlps)), bias);
+        const __m256i zero = _mm256_setzero_si256();
+        for(; i + 4 <= n; i += 4) {
+            const __m256d xf = _mm256_loadu_pd(a + i);
+            const __m256d yf = _mm256_loadu_pd(e + i);
+            const __m256i x = _mm256_castpd_si256(xf);
+            const __m256i y = _mm256_castpd_si256(yf);
+            const __m256i magX = _mm256_and_si256(x, magMask);
+            const __m256i magY = _mm256_and_si256(y, magMask);
+            const __m256i through0 = _mm256_cmpgt_epi64(zero, _mm256_xor_si256(x, y));
+            const __m256i diff = _mm256_sub_epi64(magX, magY);
+            const __m256i diffSign = _mm256_cmpgt_epi64(zero, diff);
+            const __m256i absDiff = _mm256_sub_epi64(_mm256_xor_si256(diff, diffSign), diffSign);
+            const __m256i dist = _mm256_blendv_epi8(absDiff, _mm256_add_epi64(magX, magY), through0);
+            const __m256i over = _mm256_cmpgt_epi64(_mm256_xor_si256(dist, bias), vUlps);
+            const __m256d off = _mm256_or_pd(_mm256_castsi256_pd(over), _mm256_cmp_pd(xf, yf, _CMP_UNORD_Q));
+            const int mask = _mm256_movemask_pd(off);
+            if(mask != 0)
+                return i + psiLowestBit_(PSI_CAST(psi_u32, mask));
+        }
+    }
+#endif // PSI_HAS_AVX2_
+#if defined(PSI_HAS_SSE2_)
+    {
+        // SSE2 has no 64-bit comparisons: they're made of 32-bit ones, of the high halves and then the low ones
+        const __m128i magMask = _mm_set_epi32(0x7FFFFFFF, -1, 0x7FFFFFFF, -1);
+        const __m128i bias = _mm_set1_epi32(PSI_CAST(int, 0x80000000u));
+        const __m128i vUlps = _mm_set_epi32(PSI_CAST(int, (maxUlps >> 32)), PSI_CAST(int, (maxUlps & 0xFFFFFFFFu)),
+                                            PSI_CAST(int, (maxUlps >> 32)), PSI_CAST(int, (maxUlps & 0xFFFFFFFFu)));
+        const __m128i vUlpsBiased = _mm_xor_si128(vUlps, bias);
+        for(; i + 2 <= n; i += 2) {
+            const __m128d xf = _mm_loadu_pd(a + i);
+            const __m128d yf = _mm_loadu_pd(e + i);
+            const __m128i x = _mm_castpd_si128(xf);
+            const __m128i y = _mm_castpd_si128(yf);
+            const __m128i magX = _mm_and_si128(x, magMask);
+            const __m128i magY = _mm_and_si128(y, magMask);
+            const __m128i through0 = _mm_shuffle_epi32(_mm_srai_epi32(_mm_xor_si128(x, y), 31),
+                                                       _MM_SHUFFLE(3, 3, 1, 1));
+            const __m128i diff = _mm_sub_epi64(magX, magY);
+            const __m128i diffSign = _mm_shuffle_epi32(_mm_srai_epi32(diff, 31), _MM_SHUFFLE(3, 3, 1, 1));
+            const __m128i absDiff = _mm_sub_epi64(_mm_xor_si128(diff, diffSign), diffSign);
+            const __m128i dist = _mm_or_si128(_mm_and_si128(through0, _mm_add_epi64(magX, magY)),
+                                              _mm_andnot_si128(through0, absDiff));
+            const __m128i greater = _mm_cmpgt_epi32(_mm_xor_si128(dist, bias), vUlpsBiased);
+            const __m128i equal = _mm_cmpeq_epi32(dist, vUlps);
+            const __m128i over = _mm_or_si128(_mm_shuffle_epi32(greater, _MM_SHUFFLE(3, 3, 1, 1)),
+                                              _mm_and_si128(_mm_shuffle_epi32(equal, _MM_SHUFFLE(3, 3, 1, 1)),
+                                                            _mm_shuffle_epi32(greater, _MM_SHUFFLE(2, 2, 0, 0))));
+            const __m128d off = _mm_or_pd(_mm_castsi128_pd(over), _mm_cmpunord_pd(xf, yf));
+            const int mask = _mm_movemask_pd(off);
+            if(mask != 0)
+                return i + psiLowestBit_(PSI_CAST(psi_u32, mask));
+        }
+    }
+#elif defined(PSI_HAS_NEON_DOUBLE_)
+    {
+        const uint64x2_t magMask = vdupq_n_u64(0x7FFFFFFFFFFFFFFFull);
+        const uint64x2_t vUlps = vdupq_n_u64(maxUlps);
+        for(; i + 2 <= n; i += 2) {
+            const float64x2_t xf = vld1q_f64(a + i);
+            const float64x2_t yf = vld1q_f64(e + i);
+            const uint64x2_t x = vreinterpretq_u64_f64(xf);
+            const uint64x2_t y = vreinterpretq_u64_f64(yf);
+            const uint64x2_t magX = vandq_u64(x, magMask);
+            const uint64x2_t magY = vandq_u64(y, magMask);
+            const uint64x2_t through0 = vcltzq_s64(vreinterpretq_s64_u64(veorq_u64(x, y)));
+            const uint64x2_t absDiff = vreinterpretq_u64_s64(vabsq_s64(vsubq_s64(vreinterpretq_s64_u64(magX),
+                                                                                 vreinterpretq_s64_u64(magY))));
+            const uint64x2_t dist = vbslq_u64(through0, vaddq_u64(magX, magY), absDiff);
+            const uint64x2_t numbers = vandq_u64(vceqq_f64(xf, xf), vceqq_f64(yf, yf));
+            const uint64x2_t within = vandq_u64(vcleq_u64(dist, vUlps), numbers);
+            if((vgetq_lane_u64(within, 0) & vgetq_lane_u64(within, 1)) != ~PSI_CAST(psi_u64, 0))
+                break;
+        }
+    }
+#endif // PSI_HAS_SSE2_
+    for(; i < n; i++) {
+        if(a[i] != a[i] || e[i] != e[i] || psiUlpsD_(a[i], e[i]) > maxUlps)
+            return i;
+    }
+    return n;
+}
+
+// For the `CHECK_ARRAY_*` macros: the first index from `i` on (or `n`) where an element of the arrays is off
+static psi_ull psiFindArrayNotNear_(const void* const actual, const void* const expected, const int isDouble,
+                                    const psi_ull i, const psi_ull n, const double absTol, const double relTol) {
+    if(isDouble)
+        return psiFindNotNearD_(PSI_PTRCAST(const double*, actual), PSI_PTRCAST(const double*, expected), i, n,
+                                absTol, relTol);
+    return psiFindNotNearF_(PSI_PTRCAST(const float*, actual), PSI_PTRCAST(const float*, expected), i, n,
+                            PSI_CAST(float, absTol), PSI_CAST(float, relTol));
+}
+
+static psi_ull psiFindArrayNotWithinUlps_(const void* const actual, const void* const expected, const int isDouble,
+                                          const psi_ull i, const psi_ull n, const psi_u64 maxUlps) {
+    if(isDouble)
+        return psiFindNotWithinUlpsD_(PSI_PTRCAST(const double*, actual), PSI_PTRCAST(const double*, expected), i,
+                                      n, maxUlps);
+    return psiFindNotWithinUlpsF_(PSI_PTRCAST(const float*, actual), PSI_PTRCAST(const float*, expected), i, n,
+                                  maxUlps);
+}
+
+// An element of a `float` or `double` array
+static double psiArrayElement_(const void* const array, const int isDouble, const psi_ull i) {
+    return isDouble ? PSI_PTRCAST(const double*, array)[i] : PSI_CAST(double, PSI_PTRCAST(const float*, array)[i]);
+}
+
+// Prints how many elements of a failed `CHECK_ARRAY_*` are off, and the worst of them: `off` is how far it is
+static void psiPrintArrayOff_(const psiAssertSiteStruct* const site, const void* const actual,
+                              const void* const expected, const int isDouble, const psi_ull n, const psi_ull numOff,
+                              const psi_ull first, const psi_ull worst, const char* const off) {
+    // Enough digits to tell any two of them apart
+    const int digits = isDouble ? 17 : 9;
+    psiPrintf("    Actual : %" PSI_PRIu64 " of them %s not, the first at index %" PSI_PRIu64 "\n",
+              PSI_CAST(psi_u64, numOff), numOff == 1 ? "is" : "are", PSI_CAST(psi_u64, first));
+    psiPrintf("     Worst : %s[%" PSI_PRIu64 "] = %.*g, %s[%" PSI_PRIu64 "] = %.*g, %s\n",
+              site->actual, PSI_CAST(psi_u64, worst), digits, psiArrayElement_(actual, isDouble, worst),
+              site->expected, PSI_CAST(psi_u64, worst), digits, psiArrayElement_(expected, isDouble, worst), off);
+}
+
+static PSI_COLD_ void psiReportArrayNearFailure_(PSI_SITE_PARAMS_, const void* const actual,
+                                                 const void* const expected, const int isDouble, const psi_ull n,
+                                                 const psi_ull first, const double absTol, const double relTol) {
+    const psiAssertSiteStruct site = psiUnpackSite_(file, line, packed);
+    psi_ull numOff = 0, worst = first;
+    double worstOff = -1;
+    char off[64];
+
+    for(psi_ull i = first; i < n; i = psiFindArrayNotNear_(actual, expected, isDouble, i + 1, n, absTol, relTol)) {
+        const double diff = fabs(psiArrayElement_(actual, isDouble, i) - psiArrayElement_(expected, isDouble, i));
+        // NaNs are the furthest off
+        const double elementOff = diff == diff ? diff : HUGE_VAL;
+        numOff++;
+        if(elementOff > worstOff) {
+            worst = i;
+            worstOff = elementOff;
+        }
+    }
+
+    psiPrintFailureLocation_(&site);
+    if(psiShouldDecomposeMacro(site.actual, site.expected, 1)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s, %s, %s )\n",
+                          site.macroName, site.actual, site.expected, site.extra);
+    }
+    psiPrintf("  Expected : |%s[i] - %s[i]| <= %g + %g * |%s[i]|, for each of the %" PSI_PRIu64 " elements\n",
+              site.actual, site.expected, absTol, relTol, site.expected, PSI_CAST(psi_u64, n));
+    PSI_SNPRINTF(off, sizeof(off), "off by %.*g", isDouble ? 17 : 9,
+                 fabs(psiArrayElement_(actual, isDouble, worst) - psiArrayElement_(expected, isDouble, worst)));
+    psiPrintArrayOff_(&site, actual, expected, isDouble, n, numOff, first, worst, off);
+}
+
+static PSI_COLD_ void psiReportArrayUlpFailure_(PSI_SITE_PARAMS_, const void* const actual,
+                                                const void* const expected, const int isDouble, const psi_ull n,
+                                                const psi_ull first, const psi_u64 maxUlps) {
+    const psiAssertSiteStruct site = psiUnpackSite_(file, line, packed);
+    psi_ull numOff = 0, worst = first;
+    psi_u64 worstUlps = 0;
+    char off[64];
+
+    for(psi_ull i = first; i < n; i = psiFindArrayNotWithinUlps_(actual, expected, isDouble, i + 1, n, maxUlps)) {
+        const psi_u64 ulps = isDouble ? psiUlpsD_(PSI_PTRCAST(const double*, actual)[i],
+                                                  PSI_PTRCAST(const double*, expected)[i])
+                                      : psiUlpsF_(PSI_PTRCAST(const float*, actual)[i],
+                                                  PSI_PTRCAST(const float*, expected)[i]);
+        numOff++;
+        if(ulps > worstUlps) {
+            worst = i;
+            worstUlps = ulps;
+        }
+    }
+
+    psiPrintFailureLocation_(&site);
+    if(psiShouldDecomposeMacro(site.actual, site.expected, 1)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");
+        psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s, %s, %s )\n",
+                          site.macroName, site.actual, site.expected, site.extra);
+    }
+    psiPrintf("  Expected : %s[i] within %" PSI_PRIu64 " %s of %s[i], for each of the %" PSI_PRIu64 " elements\n",
+              site.actual, maxUlps, maxUlps == 1 ? "ULP" : "ULPs", site.expected, PSI_CAST(psi_u64, n));
+    if(worstUlps == ~PSI_CAST(psi_u64, 0))
+        PSI_SNPRINTF(off, sizeof(off), "a NaN");
+    else
+        PSI_SNPRINTF(off, sizeof(off), "%" PSI_PRIu64 " ULPs off", worstUlps);
+    psiPrintArrayOff_(&site, actual, expected, isDouble, n, numOff, first, worst, off);
+}
+
+// The two arrays a `CHECK_ARRAY_*` compares, and whether they hold `double`s (rather than `float`s)
+typedef struct psiArrayPairStruct {
+    const void* actualData;
+    const void* expectedData;
+    int isDouble;
+} psiArrayPairStruct;
+
+/**
+    `actual` and `expected` must both be arrays of `float`, or both of `double`: anything else doesn't compile,
+    instead of having its bits compared as floating-point numbers. C++ has an overload for each, C11 checks
+    with `_Generic`, and older C can only check that the elements have the same size.
+*/
+#ifdef __cplusplus
+    static inline psiArrayPairStruct psiArrayPair_(const float* const actual, const float* const expected) {
+        const psiArrayPairStruct pair = {actual, expected, 0};
+        return pair;
+    }
+    static inline psiArrayPairStruct psiArrayPair_(const double* const actual, const double* const expected) {
+        const psiArrayPairStruct pair = {actual, expected, 1};
+        return pair;
+    }
+    #define PSI_ARRAY_PAIR_(actual, expected)   psiArrayPair_((actual), (expected))
+#else
+    static inline psiArrayPairStruct psiArrayPair_(const void* const actual, const void* const expected,
+                                                   const int isDouble) {
+        psiArrayPairStruct pair;
+        pair.actualData = actual;
+        pair.expectedData = expected;
+        pair.isDouble = isDouble;
+        return pair;
+    }
+    #if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+        #define PSI_FLOAT_ARRAY_KIND_(x)                                                        \
+            _Generic((x), float* : 1, const float* : 1, double* : 2, const double* : 2, default : 0)
+        #define PSI_ARRAY_PAIR_(actual, expected)                                               \
+            psiArrayPair_((actual), (expected), PSI_FLOAT_ARRAY_KIND_(actual) == 2);            \
+            _Static_assert(PSI_FLOAT_ARRAY_KIND_(actual) != 0 &&                                \
+                           PSI_FLOAT_ARRAY_KIND_(actual) == PSI_FLOAT_ARRAY_KIND_(expected),    \
+                           "Both arrays must be of float, or both of double")
+    #else
+        #define PSI_ARRAY_PAIR_(actual, expected)                                               \
+            psiArrayPair_((actual), (expected), sizeof(*(actual)) == sizeof(double));           \
+            (void)sizeof(char[sizeof(*(actual)) == sizeof(*(expected)) ? 1 : -1])
+    #endif // __STDC_VERSION__
+#endif // __cplusplus
+
+#define __TAUCMP_ARRAY_NEAR__(actual, expected, n, absTol, relTol, macroName, failOrAbort)                      \
+    do {                                                                                                        \
+        const psiArrayPairStruct psiArrays_ = PSI_ARRAY_PAIR_(actual, expected);                                \
+        const psi_ull psiNumElements_ = PSI_CAST(psi_ull, (n));                                                 \
+        const double psiAbsTol_ = (absTol);                                                                     \
+        const double psiRelTol_ = (relTol);                                                                     \
+        const psi_ull psiFirstOff_ = psiFindArrayNotNear_(psiArrays_.actualData, psiArrays_.expectedData,               \
+                                                          psiArrays_.isDouble, 0, psiNumElements_,              \
+                                                          psiAbsTol_, psiRelTol_);                              \
+        if(PSI_UNLIKELY_(psiFirstOff_ < psiNumElements_)) {                                                     \
+            psiReportArrayNearFailure_(PSI_SITE_(#macroName, #actual, #expected, #n ", " #absTol ", " #relTol, "", ""), \
+                                       psiArrays_.actualData, psiArrays_.expectedData, psiArrays_.isDouble,             \
+                                       psiNumElements_, psiFirstOff_, psiAbsTol_, psiRelTol_);                  \
+            failOrAbort;                                                                                        \
+            PSI_RETURN_IF_ABORTED_()                                                                            \
+        }                                                                                                       \
+    }                                                                                                           \
+    while(0)
+
+#define __TAUCMP_ARRAY_ULP__(actual, expected, n, maxUlps, macroName, failOrAbort)                              \
+    do {                                                                                                        \
+        const psiArrayPairStruct psiArrays_ = PSI_ARRAY_PAIR_(actual, expected);                                \
+        const psi_ull psiNumElements_ = PSI_CAST(psi_ull, (n));                                                 \
+        const psi_u64 psiMaxUlps_ = PSI_CAST(psi_u64, (maxUlps));                                               \
+        const psi_ull psiFirstOff_ = psiFindArrayNotWithinUlps_(psiArrays_.actualData, psiArrays_.expectedData,         \
+                                                                psiArrays_.isDouble, 0, psiNumElements_,        \
+                                                                psiMaxUlps_);                                   \
+        if(PSI_UNLIKELY_(psiFirstOff_ < psiNumElements_)) {                                                     \
+            psiReportArrayUlpFailure_(PSI_SITE_(#macroName, #actual, #expected, #n ", " #maxUlps, "", ""),       \
+                                      psiArrays_.actualData, psiArrays_.expectedData, psiArrays_.isDouble,              \
+                                      psiNumElements_, psiFirstOff_, psiMaxUlps_);                              \
             failOrAbort;                                                                                        \
-            if(shouldAbortTest) {                                                                               \
-                return;                                                                                         \
-            }                                                                                                   \
+            PSI_RETURN_IF_ABORTED_()                                                                            \
         }                                                                                                       \
     }                                                                                                           \
     while(0)
@@ -712,21 +2875,10 @@ static void psiPrintHexBufCmp(const void* const buff, const void* const ref, con
 
 #define __TAUCMP_TF(cond, actual, expected, negateSign, macroName, failOrAbort)     \
     do {                                                                            \
-        if(negateSign(cond)) {                                                      \
-            psiPrintf("%s:%u: ", __FILE__, __LINE__);                               \
-            psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "FAILED\n");                   \
-            if(psiShouldDecomposeMacro(#actual, PSI_NULL, 0)) {                     \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "  In macro : ");     \
-                    psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "%s( %s )\n",         \
-                                                                #macroName,         \
-                                                                #cond);             \
-                }                                                                   \
-            psiPrintf("  Expected : %s\n", #expected);                              \
-            psiPrintf("    Actual : %s\n", #actual);                                \
+        if(PSI_UNLIKELY_(negateSign(cond))) {                                       \
+            psiReportTFFailure_(PSI_SITE_(#macroName, #actual, #expected, #cond, "", "")); \
             failOrAbort;                                                            \
-            if(shouldAbortTest) {                                                   \
-                return;                                                             \
-            }                                                                       \
+            PSI_RETURN_IF_ABORTED_()                                                \
         }                                                                           \
     } while(0)
 
@@ -767,6 +2919,12 @@ static void psiPrintHexBufCmp(const void* const buff, const void* const ref, con
 #define REQUIRE_BUF_EQ(actual, expected, n)     __TAUCMP_BUF__(actual, expected, n, !=, ==, not equal, REQUIRE_BUF_EQ, PSI_ABORT_IF_INSIDE_TESTSUITE)
 #define REQUIRE_BUF_NE(actual, expected, n)     __TAUCMP_BUF__(actual, expected, n, ==, !=, equal, REQUIRE_BUF_NE, PSI_ABORT_IF_INSIDE_TESTSUITE)
 
+// Float/double array checks (see "Array Comparisons")
+#define CHECK_ARRAY_NEAR(actual, expected, n, absTol, relTol)   __TAUCMP_ARRAY_NEAR__(actual, expected, n, absTol, relTol, CHECK_ARRAY_NEAR, PSI_FAIL_IF_INSIDE_TESTSUITE)
+#define CHECK_ARRAY_ULP(actual, expected, n, maxUlps)           __TAUCMP_ARRAY_ULP__(actual, expected, n, maxUlps, CHECK_ARRAY_ULP, PSI_FAIL_IF_INSIDE_TESTSUITE)
+#define REQUIRE_ARRAY_NEAR(actual, expected, n, absTol, relTol) __TAUCMP_ARRAY_NEAR__(actual, expected, n, absTol, relTol, REQUIRE_ARRAY_NEAR, PSI_ABORT_IF_INSIDE_TESTSUITE)
+#define REQUIRE_ARRAY_ULP(actual, expected, n, maxUlps)         __TAUCMP_ARRAY_ULP__(actual, expected, n, maxUlps, REQUIRE_ARRAY_ULP, PSI_ABORT_IF_INSIDE_TESTSUITE)
+
 // Note: The negate sign `!` must be there for {CHECK|REQUIRE}_TRUE
 // Do not remove it
 #define CHECK_TRUE(cond)      __TAUCMP_TF(cond, false, true, !, CHECK_TRUE, PSI_FAIL_IF_INSIDE_TESTSUITE)
@@ -777,19 +2935,10 @@ static void psiPrintHexBufCmp(const void* const buff, const void* const ref, con
 
 #define __TAUCHECKREQUIRE__(cond, failOrAbort, macroName, ...)                                 \
     do {                                                                                       \
-        if(!(cond)) {                                                                          \
-            psiPrintf("%s:%u: ", __FILE__, __LINE__);                                          \
-            if((sizeof(char[]){__VA_ARGS__}) <= 1)                                             \
-                psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "FAILED");                            \
-            else                                                                               \
-                psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, __VA_ARGS__);                         \
-            printf("\n");                                                                      \
-            printf("The following assertion failed: \n");                                      \
-            psiColouredPrintf(PSI_COLOUR_BRIGHTCYAN_, "    %s( %s )\n", #macroName, #cond);    \
+        if(PSI_UNLIKELY_(!(cond))) {                                                           \
+            psiReportCheckFailure_(PSI_SITE_(#macroName, #cond, "", __VA_ARGS__, "", ""));     \
             failOrAbort;                                                                       \
-            if(shouldAbortTest) {                                                              \
-                return;                                                                        \
-            }                                                                                  \
+            PSI_RETURN_IF_ABORTED_()                                                           \
         }                                                                                      \
     }                                                                                          \
     while(0)
@@ -822,9 +2971,63 @@ static void psiPrintHexBufCmp(const void* const buff, const void* const ref, con
 #define CHECK_NULL(val)       CHECK(val == PSI_NULL)
 #define CHECK_NOT_NULL(val)   CHECK(val != PSI_NULL)
 
-#define WARN(msg)                                                        \
-    incrementWarnings();                                                 \
-    psiColouredPrintf(PSI_COLOUR_YELLOW_, "%s:%u:\nWARNING: %s\n", __FILE__, __LINE__, #msg)
+/**
+    Allocation Budgets
+    Scopes that fail if the code in them makes more than `n` heap allocations (or any, for the `NO_ALLOC`
+    variants), counted on the calling thread:
+
+        REQUIRE_NO_ALLOC {
+            handleRequest(&request);
+        }
+
+    Allocations are only counted in binaries built with `PSI_TRACK_ALLOCS` (see below) - anywhere else these
+    scopes warn and always pass. Leaving a scope with `break` skips its check.
+*/
+typedef struct psiAllocScopeStruct {
+    psi_u64 numAllocs;      // When the scope was entered
+    int hasRun;
+} psiAllocScopeStruct;
+
+static PSI_COLD_ void psiWarnNoAllocTracking_() {
+    // Claimed by the first test to get here, whichever thread it's on
+    static psi_u64 hasWarned = 0;
+    if(PSI_ATOMIC_CAS(&hasWarned, 0, 1)) {
+        incrementWarnings();
+        psiColouredPrintf(PSI_COLOUR_YELLOW_, "WARNING: Allocations aren't counted in this binary: define "
+                                              "PSI_TRACK_ALLOCS before including psi/psi.h where PSI_MAIN() is\n");
+    }
+}
+
+static inline psiAllocScopeStruct psiAllocScopeBegin_() {
+    psiAllocScopeStruct scope;
+    scope.numAllocs = psiThreadContext.allocs.numAllocs;
+    scope.hasRun = 0;
+    if(PSI_UNLIKELY_(!psiThreadContext.allocs.isTracking && psiThreadContext.checkIsInsideTestSuite))
+        psiWarnNoAllocTracking_();
+    return scope;
+}
+
+// Runs the block that follows once, then checks how much it allocated
+#define PSI_ALLOC_SCOPE_(maxAllocs, macroName, args, failOrAbort)                              \
+    for(psiAllocScopeStruct psiAllocScope_ = psiAllocScopeBegin_();; psiAllocScope_.hasRun = 1) \
+        if(psiAllocScope_.hasRun) {                                                            \
+            const psi_u64 psiNumAllocs_ = psiThreadContext.allocs.numAllocs - psiAllocScope_.numAllocs; \
+            if(PSI_UNLIKELY_(psiNumAllocs_ > PSI_CAST(psi_u64, (maxAllocs)))) {                 \
+                psiReportAllocFailure_(PSI_SITE_(#macroName, #maxAllocs, "", args, "", ""), psiNumAllocs_); \
+                failOrAbort;                                                                   \
+                PSI_RETURN_IF_ABORTED_()                                                       \
+            }                                                                                  \
+            break;                                                                             \
+        } else
+
+#define CHECK_MAX_ALLOCS(n)     PSI_ALLOC_SCOPE_(n, CHECK_MAX_ALLOCS, "( " #n " )", PSI_FAIL_IF_INSIDE_TESTSUITE)
+#define REQUIRE_MAX_ALLOCS(n)   PSI_ALLOC_SCOPE_(n, REQUIRE_MAX_ALLOCS, "( " #n " )", PSI_ABORT_IF_INSIDE_TESTSUITE)
+#define CHECK_NO_ALLOC          PSI_ALLOC_SCOPE_(0, CHECK_NO_ALLOC, "", PSI_FAIL_IF_INSIDE_TESTSUITE)
+#define REQUIRE_NO_ALLOC        PSI_ALLOC_SCOPE_(0, REQUIRE_NO_ALLOC, "", PSI_ABORT_IF_INSIDE_TESTSUITE)
+
+#define WARN(msg)                                                        \
+    incrementWarnings();                                                 \
+    psiColouredPrintf(PSI_COLOUR_YELLOW_, "%s:%u:\nWARNING: %s\n", __FILE__, __LINE__, #msg)
 
 #ifdef __cplusplus
     #define SECTION(...)    \
@@ -850,320 +3053,4348 @@ static void psiPrintHexBufCmp(const void* const buff, const void* const ref, con
 */
 
 #ifndef PSI_NO_TESTING
-#ifdef _MSC_VER
-    #define PSI_SNPRINTF(BUFFER, N, ...)   _snprintf_s(BUFFER, N, N, __VA_ARGS__)
+
+/**
+    Registration doesn't allocate: each test's descriptor is a static object pointing at the test function and
+    the name literal, and its initializer only links it into `psiTestContext.registered`. `psi_main` then copies
+    the list into `psiTestContext.tests` with a single allocation.
+*/
+static void psiRegisterTestSuite_(psiTestSuiteStruct* const test) {
+    test->next = psiTestContext.registered;
+    psiTestContext.registered = test;
+    psiTestContext.numTestSuites++;
+}
+
+/**
+    Runtime Registration
+    Adds a test called `name` (copied), that calls `fn(ctx)`. Call it before `psi_main` starts - from a static
+    initializer, or from your own `main` (with `PSI_NO_MAIN()`) before it hands over to `psi_main` - to make up
+    tests from data that is only known at startup, like the files of a corpus directory:
+
+        static void checkFile(void* path) { ... }
+
+        int main(int argc, const char* const* argv) {
+            for(each file in the corpus)
+                psiRegisterTest(nameOfTheFile, checkFile, pathOfTheFile);
+            return psi_main(argc, argv);
+        }
+
+    They come after the `TEST`s, and are filtered, sharded, run in parallel and reported just like them.
+    Not thread-safe.
+*/
+static void psiRegisterTest(const char* const name, void (*fn)(void*), void* const ctx) {
+    psiTestSuiteStruct* test;
+    char* const nameCopy = PSI_PTRCAST(char*, malloc(strlen(name) + 1));
+    memcpy(nameCopy, name, strlen(name) + 1);
+
+    if(psiTestContext.numDynamicTests == psiTestContext.dynamicTestsCapacity) {
+        psiTestContext.dynamicTestsCapacity = psiTestContext.dynamicTestsCapacity * 2 + 64;
+        psiTestContext.dynamicTests = PSI_PTRCAST(psiTestSuiteStruct*,
+                                                  psi_realloc(psiTestContext.dynamicTests,
+                                                              sizeof(psiTestSuiteStruct) *
+                                                              psiTestContext.dynamicTestsCapacity));
+    }
+
+    test = &psiTestContext.dynamicTests[psiTestContext.numDynamicTests++];
+    memset(test, 0, sizeof(*test));
+    test->name = nameCopy;
+    test->ctxFunc = fn;
+    test->ctx = ctx;
+}
+
+/**
+    Linker-Section Registry (`#define PSI_SECTION_REGISTRY` before including `psi/psi.h`)
+    Instead of running an initializer per test at startup, every test puts a pointer to its (const) descriptor
+    in the `psi_tests` section, and `psi_main` walks that section directly. There's no startup code per test,
+    the descriptors end up in read-only pages, and registration can't depend on static initialization order.
+    Tests are then ordered the way the linker lays the section out - by translation unit, in link order.
+    Only available with GCC/Clang on ELF and Mach-O targets. Everywhere else this falls back to initializers.
+    Translation units with and without this option can be mixed freely.
+*/
+#if defined(PSI_SECTION_REGISTRY) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__ELF__) || defined(__APPLE__))
+    #define PSI_HAS_SECTION_REGISTRY_   1
+
+    #if defined(__APPLE__)
+        #define PSI_REGISTRY_SECTION_   "__DATA_CONST,psi_tests"
+        PSI_EXTERN const psiTestSuiteStruct* const psiRegistryStart_[]
+            __asm("section$start$__DATA_CONST$psi_tests");
+        PSI_EXTERN const psiTestSuiteStruct* const psiRegistryStop_[]
+            __asm("section$end$__DATA_CONST$psi_tests");
+    #else
+        #define PSI_REGISTRY_SECTION_   "psi_tests"
+        // Weak, so a binary without a single test still links
+        PSI_EXTERN const psiTestSuiteStruct* const __start_psi_tests[] __attribute__((weak));
+        PSI_EXTERN const psiTestSuiteStruct* const __stop_psi_tests[] __attribute__((weak));
+        #define psiRegistryStart_       __start_psi_tests
+        #define psiRegistryStop_        __stop_psi_tests
+    #endif // __APPLE__
+
+    // GCC would otherwise emit a translation unit's entries in reverse when optimizing
+    #if defined(__GNUC__) && !defined(__clang__)
+        #define PSI_NO_REORDER_         __attribute__((no_reorder))
+    #else
+        #define PSI_NO_REORDER_
+    #endif // __GNUC__
+
+    #define PSI_REGISTER_(descriptor, ...)                                                       \
+        static const psiTestSuiteStruct descriptor = {__VA_ARGS__};                              \
+        static const psiTestSuiteStruct* const descriptor##_entry_ PSI_NO_REORDER_               \
+            __attribute__((used, section(PSI_REGISTRY_SECTION_))) = &descriptor;
 #else
-    #define PSI_SNPRINTF(...)              snprintf(__VA_ARGS__)
-#endif // _MSC_VER
+    #define PSI_REGISTER_(descriptor, ...)                                                       \
+        static psiTestSuiteStruct descriptor = {__VA_ARGS__};                                    \
+        PSI_TEST_INITIALIZER(descriptor##_register_) {                                           \
+            psiRegisterTestSuite_(&descriptor);                                                  \
+        }
+#endif // PSI_SECTION_REGISTRY
+
+#define PSI_REGISTER_TEST_(descriptor, function, testName)                                       \
+    PSI_REGISTER_(descriptor, function, testName, PSI_NULL, PSI_NULL, PSI_NULL, {PSI_NULL, 0}, 0, PSI_NULL,      \
+                  PSI_NULL, PSI_NULL)
+
+/**
+    Allocation Tracking (`#define PSI_TRACK_ALLOCS` before including `psi/psi.h` in the file with `PSI_MAIN()`)
+    `PSI_MAIN()` then also defines `malloc`, `calloc`, `realloc`, `free` and the aligned allocators, which count
+    what the running test allocates before handing over to the C library. `operator new` and `delete` go through
+    `malloc` and `free`, so they're counted too. Every test then reports its allocations, frees, bytes allocated
+    and peak live bytes next to its duration, and the allocation budgets above can be used.
+    Only available with glibc, which lets programs replace its allocator this way. Everywhere else this does
+    nothing.
+*/
+#if defined(PSI_TRACK_ALLOCS) && defined(__GLIBC__)
+    #define PSI_HAS_ALLOC_HOOKS_    1
+    #include <malloc.h>
+
+    // The replacements have to match the exception specification glibc declares them with in C++
+    #ifdef __cplusplus
+        #define PSI_ALLOC_THROW_    __THROW
+    #else
+        #define PSI_ALLOC_THROW_
+    #endif // __cplusplus
+    // ...and they have to be visible to the C library and libstdc++, even when building with `-fvisibility=hidden`
+    #define PSI_ALLOC_EXPORT_       __attribute__((visibility("default")))
+
+    PSI_C_FUNC void* __libc_malloc(size_t);
+    PSI_C_FUNC void* __libc_calloc(size_t, size_t);
+    PSI_C_FUNC void* __libc_realloc(void*, size_t);
+    PSI_C_FUNC void* __libc_memalign(size_t, size_t);
+    PSI_C_FUNC void __libc_free(void*);
+
+    static inline void psiCountAlloc_(void* const ptr) {
+        psiAllocStatsStruct* const allocs = &psiThreadContext.allocs;
+        if(PSI_SOME(ptr) && allocs->isTracking) {
+            const psi_ull size = malloc_usable_size(ptr);
+            allocs->numAllocs++;
+            allocs->bytes += size;
+            allocs->liveBytes += PSI_CAST(psi_i64, size);
+            if(allocs->liveBytes > allocs->peakBytes)
+                allocs->peakBytes = allocs->liveBytes;
+        }
+    }
+
+    static inline void psiCountFree_(void* const ptr) {
+        psiAllocStatsStruct* const allocs = &psiThreadContext.allocs;
+        if(PSI_SOME(ptr) && allocs->isTracking) {
+            allocs->numFrees++;
+            allocs->liveBytes -= PSI_CAST(psi_i64, malloc_usable_size(ptr));
+        }
+    }
+
+    #define PSI_ALLOC_HOOKS_()                                                               \
+        PSI_C_FUNC PSI_ALLOC_EXPORT_ void* malloc(size_t size) PSI_ALLOC_THROW_ {            \
+            void* const ptr = __libc_malloc(size);                                           \
+            psiCountAlloc_(ptr);                                                             \
+            return ptr;                                                                      \
+        }                                                                                    \
+        PSI_C_FUNC PSI_ALLOC_EXPORT_ void* calloc(size_t count, size_t size) PSI_ALLOC_THROW_ { \
+            void* const ptr = __libc_calloc(count, size);                                    \
+            psiCountAlloc_(ptr);                                                             \
+            return ptr;                                                                      \
+        }                                                                                    \
+        PSI_C_FUNC PSI_ALLOC_EXPORT_ void* realloc(void* ptr, size_t size) PSI_ALLOC_THROW_ { \
+            psiCountFree_(ptr);                                                              \
+            void* const newPtr = __libc_realloc(ptr, size);                                  \
+            psiCountAlloc_(PSI_NONE(newPtr) && size > 0 ? ptr : newPtr);                     \
+            return newPtr;                                                                   \
+        }                                                                                    \
+        PSI_C_FUNC PSI_ALLOC_EXPORT_ void* memalign(size_t alignment, size_t size) PSI_ALLOC_THROW_ { \
+            void* const ptr = __libc_memalign(alignment, size);                              \
+            psiCountAlloc_(ptr);                                                             \
+            return ptr;                                                                      \
+        }                                                                                    \
+        PSI_C_FUNC PSI_ALLOC_EXPORT_ void* aligned_alloc(size_t alignment, size_t size) PSI_ALLOC_THROW_ { \
+            return memalign(alignment, size);                                                \
+        }                                                                                    \
+        PSI_C_FUNC PSI_ALLOC_EXPORT_ int posix_memalign(void** ptr, size_t alignment, size_t size) PSI_ALLOC_THROW_ { \
+            if(alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0)              \
+                return EINVAL;                                                               \
+            *ptr = memalign(alignment, size);                                                \
+            return PSI_SOME(*ptr) || size == 0 ? 0 : ENOMEM;                                 \
+        }                                                                                    \
+        PSI_C_FUNC PSI_ALLOC_EXPORT_ void free(void* ptr) PSI_ALLOC_THROW_ {                 \
+            psiCountFree_(ptr);                                                              \
+            __libc_free(ptr);                                                                \
+        }
+#else
+    #define PSI_ALLOC_HOOKS_()
+#endif // PSI_TRACK_ALLOCS
+
+/**
+    Coverage (`#define PSI_FUZZ_COVERAGE` before including `psi/psi.h` in the file with `PSI_MAIN()`)
+    `PSI_MAIN()` then also defines the callbacks that code built with `-fsanitize-coverage=trace-pc-guard` calls
+    on every edge it takes. They count the hits of every edge into `psiTestContext.coverage`, which is how
+    `--fuzz` tells that an input reached new code. The callbacks mustn't be instrumented themselves, which takes
+    Clang, or GCC 12 or later (older GCCs don't have `trace-pc-guard` at all).
+*/
+#if defined(__clang__)
+    #define PSI_NO_COVERAGE_    __attribute__((no_sanitize("coverage")))
+#elif defined(__GNUC__) && __GNUC__ >= 12
+    #define PSI_NO_COVERAGE_    __attribute__((no_sanitize_coverage))
+#else
+    #define PSI_NO_COVERAGE_
+#endif // __clang__
+
+#ifdef PSI_FUZZ_COVERAGE
+    // Numbers the edges of every module, in the order they're loaded
+    static PSI_NO_COVERAGE_ void psiCoverageInit_(psi_u32* guard, const psi_u32* const stop) {
+        psi_ull size;
+        if(guard == stop || *guard != 0)
+            return;
+
+        while(guard < stop)
+            *guard++ = PSI_CAST(psi_u32, ++psiTestContext.numCoverage);
+        // Rounded up to whole words, which is how `--fuzz` reads them
+        size = (psiTestContext.numCoverage + 8) & ~PSI_CAST(psi_ull, 7);
+        psiTestContext.coverage = PSI_PTRCAST(psi_u8*, realloc(psiTestContext.coverage, size));
+        memset(psiTestContext.coverage, 0, size);
+    }
+
+    #define PSI_COVERAGE_HOOKS_()                                                            \
+        PSI_C_FUNC PSI_NO_COVERAGE_ void __sanitizer_cov_trace_pc_guard_init(psi_u32* start, psi_u32* stop) { \
+            psiCoverageInit_(start, stop);                                                   \
+        }                                                                                    \
+        PSI_C_FUNC PSI_NO_COVERAGE_ void __sanitizer_cov_trace_pc_guard(psi_u32* guard) {    \
+            psiTestContext.coverage[*guard]++;                                               \
+        }
+#else
+    #define PSI_COVERAGE_HOOKS_()
+#endif // PSI_FUZZ_COVERAGE
 
 #define TEST(TESTSUITE, TESTNAME)                                                              \
     PSI_EXTERN psiTestStateStruct psiTestContext;                                              \
     static void _PSI_TEST_FUNC_##TESTSUITE##_##TESTNAME(void);                                 \
-    PSI_TEST_INITIALIZER(psi_register_##TESTSUITE##_##TESTNAME) {                              \
-        const psi_ull index = psiTestContext.numTestSuites++;                                  \
-        const char* const namePart = #TESTSUITE "." #TESTNAME;                                 \
-        const psi_ull nameSize = strlen(namePart) + 1;                                         \
-        char* const name = PSI_PTRCAST(char* , malloc(nameSize));                              \
-        psiTestContext.tests = PSI_PTRCAST(                                                    \
-                                    psiTestSuiteStruct*,                                       \
-                                    psi_realloc(PSI_PTRCAST(void* , psiTestContext.tests),     \
-                                                sizeof(psiTestSuiteStruct) *                   \
-                                                    psiTestContext.numTestSuites));            \
-        psiTestContext.tests[index].func = &_PSI_TEST_FUNC_##TESTSUITE##_##TESTNAME;           \
-        psiTestContext.tests[index].name = name;                                               \
-        PSI_SNPRINTF(name, nameSize, "%s", namePart);                                          \
-    }                                                                                          \
+    PSI_REGISTER_TEST_(psi_test_##TESTSUITE##_##TESTNAME,                                      \
+                       &_PSI_TEST_FUNC_##TESTSUITE##_##TESTNAME, #TESTSUITE "." #TESTNAME)     \
     void _PSI_TEST_FUNC_##TESTSUITE##_##TESTNAME(void)
 
 
-#define TEST_F_SETUP(FIXTURE)                                                  \
-    static void __PSI_TEST_FIXTURE_SETUP_##FIXTURE(struct FIXTURE* const psi)
+/**
+    Data-Driven Tests
+    A `TEST_P` runs its body once for every line of a data file, and every line is reported (and can be
+    `--filter`ed) as a test of its own, called `Suite.Name/<line number>`:
+
+        TEST_P(Parse, integers, "integers.csv") {
+            const psi_i64 value = psiFieldToInt(&psiParam->fields[0]);
+            CHECK_EQ(value * 2, psiFieldToInt(&psiParam->fields[1]));
+        }
+
+    The file is memory-mapped when the tests start, and the fields point right into it, so however many rows
+    it has, nothing is copied and there's nothing more to compile. Fields are separated by commas, with the
+    spaces around them trimmed; a field in double quotes can contain commas (the quotes aren't part of it).
+    Blank lines are skipped. A file that can't be read, or has no rows, fails the test.
+*/
+#define TEST_P(TESTSUITE, TESTNAME, DATAFILE)                                                  \
+    PSI_EXTERN psiTestStateStruct psiTestContext;                                              \
+    static void _PSI_TEST_FUNC_##TESTSUITE##_##TESTNAME(const psiParamStruct* const psiParam); \
+    PSI_REGISTER_(psi_test_##TESTSUITE##_##TESTNAME, PSI_NULL, #TESTSUITE "." #TESTNAME,       \
+                  &_PSI_TEST_FUNC_##TESTSUITE##_##TESTNAME, DATAFILE, __FILE__, {PSI_NULL, 0}, 0, \
+                  PSI_NULL, PSI_NULL, PSI_NULL)                                                \
+    void _PSI_TEST_FUNC_##TESTSUITE##_##TESTNAME(const psiParamStruct* const psiParam PSI_UNUSED)
+
+// Whether a field holds exactly `str`
+static inline int psiFieldEquals(const psiFieldStruct* const field, const char* const str) {
+    return strlen(str) == field->size && memcmp(field->data, str, field->size) == 0;
+}
+
+// The decimal integer in a field (0 if there's none)
+static inline psi_i64 psiFieldToInt(const psiFieldStruct* const field) {
+    psi_ull i = 0;
+    psi_u64 value = 0;
+    const int isNegative = field->size > 0 && field->data[0] == '-';
+    if(field->size > 0 && (field->data[0] == '-' || field->data[0] == '+'))
+        i++;
+    for(; i < field->size && field->data[i] >= '0' && field->data[i] <= '9'; i++)
+        value = value * 10 + PSI_CAST(psi_u64, (field->data[i] - '0'));
+    return isNegative ? -PSI_CAST(psi_i64, value) : PSI_CAST(psi_i64, value);
+}
+
+// The floating-point number in a field (0 if there's none)
+static inline double psiFieldToDouble(const psiFieldStruct* const field) {
+    char number[64];
+    const psi_ull size = field->size < sizeof(number) - 1 ? field->size : sizeof(number) - 1;
+    if(size > 0)
+        memcpy(number, field->data, size);
+    number[size] = PSI_NULLCHAR;
+    return strtod(number, PSI_NULL);
+}
+
+#define TEST_F_SETUP(FIXTURE)                                                  \
+    static void __PSI_TEST_FIXTURE_SETUP_##FIXTURE(struct FIXTURE* const psi)
+
+#define TEST_F_TEARDOWN(FIXTURE)                                               \
+    static void __PSI_TEST_FIXTURE_TEARDOWN_##FIXTURE(struct FIXTURE* const psi)
+
+#define TEST_F(FIXTURE, NAME)                                                                            \
+    PSI_EXTERN psiTestStateStruct psiTestContext;                                                        \
+    static void __PSI_TEST_FIXTURE_SETUP_##FIXTURE(struct FIXTURE* const);                               \
+    static void __PSI_TEST_FIXTURE_TEARDOWN_##FIXTURE(struct FIXTURE* const);                            \
+    static void __PSI_TEST_FIXTURE_RUN_##FIXTURE##_##NAME(struct FIXTURE* const);                        \
+                                                                                                         \
+    static void __PSI_TEST_FIXTURE_##FIXTURE##_##NAME() {                                                \
+        struct FIXTURE fixture;                                                                          \
+        memset(&fixture, 0, sizeof(fixture));                                                            \
+        __PSI_TEST_FIXTURE_SETUP_##FIXTURE(&fixture);                                                    \
+        if(psiThreadContext.hasCurrentTestFailed == 1) {                                                 \
+            return;                                                                                      \
+        }                                                                                                \
+                                                                                                         \
+        __PSI_TEST_FIXTURE_RUN_##FIXTURE##_##NAME(&fixture);                                             \
+        __PSI_TEST_FIXTURE_TEARDOWN_##FIXTURE(&fixture);                                                 \
+    }                                                                                                    \
+                                                                                                         \
+    PSI_REGISTER_TEST_(psi_test_##FIXTURE##_##NAME,                                                      \
+                       &__PSI_TEST_FIXTURE_##FIXTURE##_##NAME, #FIXTURE "." #NAME)                       \
+    static void __PSI_TEST_FIXTURE_RUN_##FIXTURE##_##NAME(struct FIXTURE* const psi)
+
+/**
+    Benchmarks (`--benchmark`)
+    A `BENCHMARK` is registered next to the tests, but only runs (instead of them) when `--benchmark` is passed.
+    The code to measure goes inside `BENCHMARK_LOOP` - anything before or after the loop is setup and teardown,
+    and isn't timed:
+
+        BENCHMARK(String, strlen) {
+            const char* const str = "Hello, World";
+            BENCHMARK_LOOP {
+                psiDoNotOptimize(strlen(str));
+            }
+        }
+
+    Psi picks the number of iterations so that a sample takes at least `--benchmark-min-time`, runs a warmup
+    sample, and reports the mean, median, standard deviation, min and max time per iteration over
+    `--benchmark-samples` samples. CHECKs and REQUIREs work as usual: a benchmark that fails is stopped.
+*/
+static void psiRegisterBenchmark_(psiBenchmarkStruct* const benchmark) {
+    benchmark->next = psiTestContext.benchmarks;
+    psiTestContext.benchmarks = benchmark;
+}
+
+static inline psi_u64 psiBenchmarkStart_(psiBenchmarkStateStruct* const state) {
+    state->isTimed = 1;
+    psiPerfStart_();
+    state->start = state->clock();
+    return state->iterations;
+}
+
+// Always 0, so that it can end the loop's condition
+static inline int psiBenchmarkStop_(psiBenchmarkStateStruct* const state) {
+    state->stop = state->clock();
+    psiPerfStop_();
+    return 0;
+}
+
+#define BENCHMARK(SUITE, NAME)                                                                   \
+    PSI_EXTERN psiTestStateStruct psiTestContext;                                                \
+    static void _PSI_BENCHMARK_FUNC_##SUITE##_##NAME(psiBenchmarkStateStruct* const);            \
+    static psiBenchmarkStruct psi_benchmark_##SUITE##_##NAME =                                   \
+        {&_PSI_BENCHMARK_FUNC_##SUITE##_##NAME, #SUITE "." #NAME, 0, 0, 0, PSI_NULL};            \
+    PSI_TEST_INITIALIZER(psi_benchmark_##SUITE##_##NAME##_register_) {                           \
+        psiRegisterBenchmark_(&psi_benchmark_##SUITE##_##NAME);                                  \
+    }                                                                                            \
+    static void _PSI_BENCHMARK_FUNC_##SUITE##_##NAME(psiBenchmarkStateStruct* const psiBenchmark PSI_UNUSED)
+
+/**
+    A `BENCHMARK` that runs once for every input size from `LO` to `HI`, multiplying it by `MULT` each time (`HI`
+    itself always runs). The body gets the current size as `n`:
+
+        BENCHMARK_RANGE(Vector, push_back, 8, 8192, 8) {
+            BENCHMARK_LOOP {
+                vector_clear(&v);
+                for(psi_u64 i = 0; i < n; i++)
+                    vector_push_back(&v, i);
+            }
+        }
+
+    On top of each size's timings, psi fits the median time per iteration against n to O(1), O(log n), O(n),
+    O(n log n) and O(n^2), and reports the closest fit along with its RMS error (relative to the mean time).
+*/
+#define BENCHMARK_RANGE(SUITE, NAME, LO, HI, MULT)                                               \
+    PSI_EXTERN psiTestStateStruct psiTestContext;                                                \
+    static void _PSI_BENCHMARK_RUN_##SUITE##_##NAME(psiBenchmarkStateStruct* const, const psi_u64); \
+    static void _PSI_BENCHMARK_FUNC_##SUITE##_##NAME(psiBenchmarkStateStruct* const state) {     \
+        _PSI_BENCHMARK_RUN_##SUITE##_##NAME(state, state->n);                                    \
+    }                                                                                            \
+    static psiBenchmarkStruct psi_benchmark_##SUITE##_##NAME =                                   \
+        {&_PSI_BENCHMARK_FUNC_##SUITE##_##NAME, #SUITE "." #NAME, (LO), (HI), (MULT), PSI_NULL}; \
+    PSI_TEST_INITIALIZER(psi_benchmark_##SUITE##_##NAME##_register_) {                           \
+        psiRegisterBenchmark_(&psi_benchmark_##SUITE##_##NAME);                                  \
+    }                                                                                            \
+    static void _PSI_BENCHMARK_RUN_##SUITE##_##NAME(psiBenchmarkStateStruct* const psiBenchmark PSI_UNUSED, \
+                                                   const psi_u64 n PSI_UNUSED)
+
+#define BENCHMARK_LOOP                                                                           \
+    for(psi_u64 psiIterationsLeft_ = psiBenchmarkStart_(psiBenchmark);                           \
+        psiIterationsLeft_ > 0 || psiBenchmarkStop_(psiBenchmark);                               \
+        psiIterationsLeft_--)
+
+/**
+    Keep the compiler from optimizing away a value the benchmark computes but never uses (`psiDoNotOptimize`),
+    or the stores it makes to memory (`psiClobberMemory`).
+*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define psiDoNotOptimize(value)                                                              \
+        do {                                                                                     \
+            __typeof__(value) psiValue_ = (value);                                               \
+            __asm__ __volatile__("" : : "r,m"(psiValue_) : "memory");                            \
+        } while(0)
+    #define psiClobberMemory()          __asm__ __volatile__("" : : : "memory")
+#elif defined(_MSC_VER)
+    #include <intrin.h>
+    static __declspec(noinline) void psiUseCharPointer_(char const volatile* const ptr) { (void)ptr; }
+    #ifdef __cplusplus
+        template <class T>
+        inline void psiDoNotOptimize(T const& value) {
+            psiUseCharPointer_(&reinterpret_cast<char const volatile&>(value));
+            _ReadWriteBarrier();
+        }
+    #else
+        // Has to be an lvalue here
+        #define psiDoNotOptimize(value)                                                          \
+            (psiUseCharPointer_(PSI_PTRCAST(char const volatile*, &(value))), _ReadWriteBarrier())
+    #endif // __cplusplus
+    #define psiClobberMemory()          _ReadWriteBarrier()
+#endif // __GNUC__
+
+
+static int psiShouldFilterTest(const char* const filter, const char* const testcase);
+static int psiShouldFilterTest(const char* const filter, const char* const testcase) {
+    if(PSI_SOME(filter)) {
+        const char* filter_curr = filter;
+        const char* testcase_curr = testcase;
+        const char* filter_wildcard = PSI_NULL;
+
+        while ((*filter_curr != PSI_NULLCHAR) && (*testcase_curr != PSI_NULLCHAR)) {
+            if(*filter_curr == '*') {
+                // store the position of the wildcard
+                filter_wildcard = filter_curr;
+
+                // skip the wildcard character
+                filter_curr++;
+
+                while ((*filter_curr != PSI_NULLCHAR) && (*testcase_curr != PSI_NULLCHAR)) {
+                    if(*filter_curr == '*') {
+                        // Found another wildcard (filter is something like *foo*), so exit the current loop,
+                        // and return to the parent loop to handle the wildcard case
+                        break;
+                    } else if(*filter_curr != *testcase_curr) {
+                        // otherwise our filter didn't match, so reset it
+                        filter_curr = filter_wildcard;
+                    }
+
+                    // move testcase along
+                    testcase_curr++;
+
+                    // move filter along
+                    filter_curr++;
+                }
+
+                if((*filter_curr == PSI_NULLCHAR) && (*testcase_curr == PSI_NULLCHAR))
+                    return 0;
+
+                // if the testcase has been exhausted, we don't have a match!
+                if(*testcase_curr == PSI_NULLCHAR)
+                    return 1;
+            } else {
+                if(*testcase_curr != *filter_curr) {
+                    // test case doesn't match filter
+                    return 1;
+                } else {
+                    // move our filter and testcase forward
+                    testcase_curr++;
+                    filter_curr++;
+                }
+            }
+        }
+
+        if((*filter_curr != PSI_NULLCHAR) || ((*testcase_curr == PSI_NULLCHAR) && ((filter == filter_curr) ||
+            (filter_curr[-1] != '*')))) {
+            // We have a mismatch
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static inline FILE* psi_fopen(const char* const filename, const char* const mode) {
+#ifdef _MSC_VER
+    FILE* file;
+    if(fopen_s(&file, filename, mode) == 0) {
+        return file;
+    } else {
+        return PSI_NULL;
+    }
+#else
+    return fopen(filename, mode);
+#endif // _MSC_VER
+}
+
+
+static void psi_help_() {
+    psiTerminalPrintf("Usage: %s [options] [test...]\n", psi_argv0_);
+    psiTerminalPrintf("\n");
+    psiTerminalPrintf("Run the specified unit tests; or if the option '--skip' is used, run all\n");
+    psiTerminalPrintf("tests in the suite but those listed. By default, if no tests are specified\n");
+    psiTerminalPrintf("on the command line, all unit tests in the suite are run.\n");
+    psiTerminalPrintf("\n");
+    psiTerminalPrintf("Options:\n");
+    psiTerminalPrintf("  --failed-output-only     Output only failed Test Suites\n");
+    psiTerminalPrintf("  --filter=<filter>        Filter the test suites to run (e.g: Suite1*.a\n");
+    psiTerminalPrintf("                             would run Suite1Case.a but not Suite1Case.b}\n");
+    psiTerminalPrintf("  --time                   Measure test duration (real time)\n");
+#if defined(PSI_WIN_) || defined(PSI_HAS_POSIX_TIMER_)
+    psiTerminalPrintf("  --time=TIMER             Measure test duration, using given timer\n");
+    #ifdef PSI_HAS_TSC_
+    psiTerminalPrintf("                               (TIMER is one of 'real', 'cpu', 'tsc')\n");
+    #else
+    psiTerminalPrintf("                               (TIMER is one of 'real', 'cpu')\n");
+    #endif // PSI_HAS_TSC_
+#endif // PSI_WIN_ || PSI_HAS_POSIX_TIMER_
+#if defined(PSI_UNIX_)
+    psiTerminalPrintf("  --jobs=N                 Run the tests in N worker processes (0 picks the\n");
+    psiTerminalPrintf("                             number of online CPUs)\n");
+    psiTerminalPrintf("  --threads                Run the --jobs workers as threads of this process\n");
+    psiTerminalPrintf("                             (tests must be thread-safe)\n");
+#elif defined(PSI_WIN_)
+    psiTerminalPrintf("  --jobs=N                 Run the tests in N worker threads (0 picks the\n");
+    psiTerminalPrintf("                             number of CPUs; tests must be thread-safe)\n");
+#endif // PSI_UNIX_
+    psiTerminalPrintf("  --rusage                 Report the max RSS, page faults and context\n");
+    psiTerminalPrintf("                             switches of every test (Unix only)\n");
+    psiTerminalPrintf("  --sort-by=KEY            List the most expensive tests in the summary\n");
+    psiTerminalPrintf("                             (KEY is one of 'rss', 'faults', 'time')\n");
+    psiTerminalPrintf("  --top=N                  How many tests --sort-by lists (default 10)\n");
+    psiTerminalPrintf("  --durations=N            List the N slowest tests, the time per suite and\n");
+    psiTerminalPrintf("                             the 50th/90th/99th percentile of the durations\n");
+    psiTerminalPrintf("  --perf-counters=LIST     Count hardware events for every test and benchmark\n");
+    psiTerminalPrintf("                             (LIST of cycles, instructions, cache-references,\n");
+    psiTerminalPrintf("                             cache-misses, branches, branch-misses,\n");
+    psiTerminalPrintf("                             page-faults, context-switches; Linux only)\n");
+    psiTerminalPrintf("  --timing-cache=<FILE>    Record how long each test took in FILE, and run\n");
+    psiTerminalPrintf("                             the slowest tests first next time\n");
+    psiTerminalPrintf("  --trace=<FILE>           Write a timeline of the run to FILE, one lane per\n");
+    psiTerminalPrintf("                             worker (Chrome trace-event JSON, for Perfetto or\n");
+    psiTerminalPrintf("                             chrome://tracing)\n");
+    psiTerminalPrintf("  --property-cases=N       How many cases each PROPERTY tries (default 1000)\n");
+    psiTerminalPrintf("  --property-seed=S        The seed of the first case of each PROPERTY\n");
+    psiTerminalPrintf("                             (random by default, printed on failure)\n");
+    psiTerminalPrintf("  --property-threads=N     Try the cases and shrink the counterexamples of a\n");
+    psiTerminalPrintf("                             PROPERTY on N threads (its body must be\n");
+    psiTerminalPrintf("                             thread-safe)\n");
+    psiTerminalPrintf("  --fuzz=<TARGET>          Fuzz the PSI_FUZZ target TARGET (e.g: Parser.Json)\n");
+    psiTerminalPrintf("                             instead of running the tests, saving the inputs\n");
+    psiTerminalPrintf("                             that reach new code to its corpus\n");
+    psiTerminalPrintf("  --fuzz-runs=N            Stop fuzzing after N inputs\n");
+    psiTerminalPrintf("  --fuzz-time=S            Stop fuzzing after S seconds\n");
+    psiTerminalPrintf("  --fuzz-max-len=N         The longest input to fuzz with (default 4096)\n");
+    psiTerminalPrintf("  --corpus=<DIR>           Where the PSI_FUZZ targets keep their inputs, one\n");
+    psiTerminalPrintf("                             directory per target (default: corpus)\n");
+    psiTerminalPrintf("  --diff-max-bytes=N       Print at most N bytes of the diff of the strings a\n");
+    psiTerminalPrintf("                             failed string check compares (default 8192)\n");
+    psiTerminalPrintf("  --profile=<DIR>          Sample the stack of every test, and write them to\n");
+    psiTerminalPrintf("                             DIR as one folded-stack file per test (for\n");
+    psiTerminalPrintf("                             flamegraph tools; Unix only)\n");
+    psiTerminalPrintf("  --shard-count=N          Split the tests into N disjoint shards (by test\n");
+    psiTerminalPrintf("                             name) and only run one of them\n");
+    psiTerminalPrintf("  --shard-index=I          The shard to run, from 0 to N-1\n");
+    psiTerminalPrintf("  --shard-balance          Split the shards by the durations in the timing\n");
+    psiTerminalPrintf("                             cache instead, so they take about as long\n");
+    psiTerminalPrintf("  --benchmark              Run the benchmarks instead of the tests\n");
+    psiTerminalPrintf("  --benchmark-samples=N    Measure each benchmark over N samples (default 20)\n");
+    psiTerminalPrintf("  --benchmark-min-time=MS  Run each sample for at least MS milliseconds\n");
+    psiTerminalPrintf("                             (default 10)\n");
+    psiTerminalPrintf("  --benchmark-save=<FILE>  Save the samples of every benchmark to FILE\n");
+    psiTerminalPrintf("  --benchmark-baseline=<FILE>\n");
+    psiTerminalPrintf("                           Compare the benchmarks to the samples saved in FILE,\n");
+    psiTerminalPrintf("                             and fail the ones that got significantly slower\n");
+    psiTerminalPrintf("  --benchmark-threshold=P  Only fail a benchmark if it got more than P%% slower\n");
+    psiTerminalPrintf("                             than the baseline (default 5)\n");
+    psiTerminalPrintf("  --no-summary             Suppress printing of test results summary\n");
+    psiTerminalPrintf("  --output=<FILE>          Write an XUnit XML file to Enable XUnit output\n");
+    psiTerminalPrintf("                             to the given file\n");
+    psiTerminalPrintf("  --list                   List unit tests in the suite and exit\n");
+    psiTerminalPrintf("  --no-color               Disable coloured output\n");
+    psiTerminalPrintf("  --help                   Display this help and exit\n");
+}
+
+
+static psi_ull psiNumCPUs() {
+#if defined(PSI_UNIX_)
+    const long numCPUs = sysconf(_SC_NPROCESSORS_ONLN);
+    return numCPUs > 0 ? PSI_CAST(psi_ull, numCPUs) : 1;
+#elif defined(PSI_WIN_)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? PSI_CAST(psi_ull, info.dwNumberOfProcessors) : 1;
+#else
+    return 1;
+#endif // PSI_UNIX_
+}
+
+/**
+    Parses the comma-separated list of `--perf-counters`, and leaves out (with a warning) the ones this machine
+    can't count. Fails on a name psi doesn't know.
+*/
+static psi_bool psiPerfConfigure(const char* const list) {
+#ifdef PSI_HAS_PERF_COUNTERS_
+    const char* curr = list;
+    psiNumPerfCounters = 0;
+    while(*curr != PSI_NULLCHAR) {
+        const char* const comma = strchr(curr, ',');
+        const psi_ull length = PSI_SOME(comma) ? PSI_CAST(psi_ull, (comma - curr)) : strlen(curr);
+        int counter = -1;
+        for(psi_ull i = 0; i < sizeof(psiPerfCounterTable) / sizeof(psiPerfCounterTable[0]); i++) {
+            if(strlen(psiPerfCounterTable[i].name) == length && strncmp(psiPerfCounterTable[i].name, curr, length) == 0)
+                counter = PSI_CAST(int, i);
+        }
+        if(counter < 0) {
+            psiTerminalPrintf("ERROR: Unknown performance counter: %.*s\n", PSI_CAST(int, length), curr);
+            return psi_false;
+        }
+
+        const int fd = psiPerfOpenCounter_(counter, -1);
+        if(fd < 0) {
+            psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+            psiTerminalPrintf("Can't count %s here (%s), leaving it out\n", psiPerfCounterTable[counter].name,
+                              strerror(errno));
+        } else {
+            close(fd);
+            if(psiNumPerfCounters < PSI_MAX_PERF_COUNTERS_)
+                psiPerfCounters[psiNumPerfCounters++] = counter;
+        }
+
+        curr += length;
+        if(*curr == ',')
+            curr++;
+    }
+#else
+    (void)list;
+    psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+    psiTerminalPrintf("Performance counters are only supported on Linux, leaving them out\n");
+#endif // PSI_HAS_PERF_COUNTERS_
+    return psi_true;
+}
+
+static psi_bool psiCmdLineRead(const int argc, const char* const * const argv) {
+    // Coloured output
+#ifdef PSI_UNIX_
+    psiOutputIsTerminal = isatty(STDOUT_FILENO);
+#elif defined PSI_WIN_
+    #ifdef _BORLANDC_
+        psiOutputIsTerminal = isatty(_fileno(stdout));
+    #else
+        psiOutputIsTerminal = _isatty(_fileno(stdout));
+    #endif // _BORLANDC_
+#else
+    psiOutputIsTerminal = isatty(STDOUT_FILENO);
+#endif // PSI_UNIX_
+    psiTestContext.shouldColourizeOutput = psiOutputIsTerminal;
+
+    // loop through all arguments looking for our options
+    for(psi_ull i = 1; i < PSI_CAST(psi_ull, argc); i++) {
+        /* Informational switches */
+        const char* const helpStr = "--help";
+        const char* const listStr = "--list";
+        const char* const colourStr = "--no-color";
+        const char* const summaryStr = "--no-summary";
+        const char* const onlyFailedOutput = "--failed-output-only";
+        /* Test config switches */
+        const char* const filterStr = "--filter=";
+        const char* const XUnitOutput = "--output=";
+        const char* const jobsStr = "--jobs=";
+        const char* const threadsStr = "--threads";
+        const char* const timingCacheStr = "--timing-cache=";
+        const char* const traceStr = "--trace=";
+        const char* const profileStr = "--profile=";
+        const char* const propertyCasesStr = "--property-cases=";
+        const char* const propertySeedStr = "--property-seed=";
+        const char* const propertyThreadsStr = "--property-threads=";
+        const char* const fuzzRunsStr = "--fuzz-runs=";
+        const char* const fuzzTimeStr = "--fuzz-time=";
+        const char* const fuzzMaxLengthStr = "--fuzz-max-len=";
+        const char* const diffMaxBytesStr = "--diff-max-bytes=";
+        const char* const fuzzStr = "--fuzz=";
+        const char* const corpusStr = "--corpus=";
+        const char* const shardIndexStr = "--shard-index=";
+        const char* const shardCountStr = "--shard-count=";
+        const char* const shardBalanceStr = "--shard-balance";
+        const char* const timeStr = "--time";
+        const char* const perfCountersStr = "--perf-counters=";
+        const char* const usageStr = "--rusage";
+        const char* const sortByStr = "--sort-by=";
+        const char* const topStr = "--top=";
+        const char* const durationsStr = "--durations=";
+        const char* const benchmarkSamplesStr = "--benchmark-samples=";
+        const char* const benchmarkMinTimeStr = "--benchmark-min-time=";
+        const char* const benchmarkBaselineStr = "--benchmark-baseline=";
+        const char* const benchmarkSaveStr = "--benchmark-save=";
+        const char* const benchmarkThresholdStr = "--benchmark-threshold=";
+        const char* const benchmarkStr = "--benchmark";
+
+        // Help
+        if(strncmp(argv[i], helpStr, strlen(helpStr)) == 0) {
+            psi_help_();
+            return psi_false;
+        }
+
+        // Only failed output
+        else if(strncmp(argv[i], onlyFailedOutput, strlen(onlyFailedOutput)) == 0) {
+            psiDisplayOnlyFailedOutput = 1;
+        }
+
+        // Filter tests
+        else if(strncmp(argv[i], filterStr, strlen(filterStr)) == 0)
+            // user wants to filter what test suites run!
+            cmd_filter = argv[i] + strlen(filterStr);
+
+        // Write XUnit XML file
+        else if(strncmp(argv[i], XUnitOutput, strlen(XUnitOutput)) == 0)
+            psiTestContext.foutput = psi_fopen(argv[i] + strlen(XUnitOutput), "w+");
+
+        // List tests
+        else if(strncmp(argv[i], listStr, strlen(listStr)) == 0) {
+            for (i = 0; i < psiTestContext.numTestSuites; i++)
+                psiPrintf("%s\n", psiTestContext.tests[i].name);
+            psiDisplayTests = 1;
+        }
+
+        // Disable colouring
+        else if(strncmp(argv[i], colourStr, strlen(colourStr)) == 0) {
+            psiTestContext.shouldColourizeOutput = 0;
+        }
+
+        // Disable Summary
+        else if(strncmp(argv[i], summaryStr, strlen(summaryStr)) == 0) {
+            psiDisableSummary = 1;
+        }
+
+        // Number of worker processes
+        else if(strncmp(argv[i], jobsStr, strlen(jobsStr)) == 0) {
+            psiNumJobs = PSI_CAST(psi_ull, strtoull(argv[i] + strlen(jobsStr), PSI_NULL, 10));
+            if(psiNumJobs == 0)
+                psiNumJobs = psiNumCPUs();
+        }
+
+        // Threaded workers
+        else if(strncmp(argv[i], threadsStr, strlen(threadsStr)) == 0) {
+            psiUseThreads = 1;
+        }
+
+        // Timing cache
+        else if(strncmp(argv[i], timingCacheStr, strlen(timingCacheStr)) == 0) {
+            psiTimingCachePath = argv[i] + strlen(timingCacheStr);
+        }
+
+        // Timeline
+        else if(strncmp(argv[i], traceStr, strlen(traceStr)) == 0) {
+            psiTracePath = argv[i] + strlen(traceStr);
+        }
+
+        // Sampling profiler
+        else if(strncmp(argv[i], profileStr, strlen(profileStr)) == 0) {
+            psiProfileDir = argv[i] + strlen(profileStr);
+        }
+
+        // Property-based tests
+        else if(strncmp(argv[i], propertyCasesStr, strlen(propertyCasesStr)) == 0) {
+            psiTestContext.propertyCases = PSI_CAST(psi_u64, strtoull(argv[i] + strlen(propertyCasesStr), PSI_NULL, 10));
+        }
+        else if(strncmp(argv[i], propertySeedStr, strlen(propertySeedStr)) == 0) {
+            psiTestContext.propertySeed = PSI_CAST(psi_u64, strtoull(argv[i] + strlen(propertySeedStr), PSI_NULL, 0));
+            psiTestContext.hasPropertySeed = 1;
+        }
+        else if(strncmp(argv[i], propertyThreadsStr, strlen(propertyThreadsStr)) == 0) {
+            psiTestContext.propertyThreads = PSI_CAST(psi_ull, strtoull(argv[i] + strlen(propertyThreadsStr), PSI_NULL, 10));
+        }
+
+        // Fuzzing
+        else if(strncmp(argv[i], fuzzRunsStr, strlen(fuzzRunsStr)) == 0) {
+            psiTestContext.fuzzRuns = PSI_CAST(psi_u64, strtoull(argv[i] + strlen(fuzzRunsStr), PSI_NULL, 10));
+        }
+        else if(strncmp(argv[i], fuzzTimeStr, strlen(fuzzTimeStr)) == 0) {
+            psiTestContext.fuzzTime = PSI_CAST(psi_u64, strtod(argv[i] + strlen(fuzzTimeStr), PSI_NULL) * 1000000000);
+        }
+        else if(strncmp(argv[i], fuzzMaxLengthStr, strlen(fuzzMaxLengthStr)) == 0) {
+            psiTestContext.fuzzMaxLength = PSI_CAST(psi_ull, strtoull(argv[i] + strlen(fuzzMaxLengthStr), PSI_NULL, 10));
+        }
+        else if(strncmp(argv[i], fuzzStr, strlen(fuzzStr)) == 0) {
+            psiTestContext.fuzzTarget = argv[i] + strlen(fuzzStr);
+        }
+        else if(strncmp(argv[i], corpusStr, strlen(corpusStr)) == 0) {
+            psiTestContext.corpusDir = argv[i] + strlen(corpusStr);
+        }
+
+        // Failure reports
+        else if(strncmp(argv[i], diffMaxBytesStr, strlen(diffMaxBytesStr)) == 0) {
+            psiTestContext.diffMaxBytes = PSI_CAST(psi_ull, strtoull(argv[i] + strlen(diffMaxBytesStr), PSI_NULL, 10));
+        }
+
+        // Sharding
+        else if(strncmp(argv[i], shardIndexStr, strlen(shardIndexStr)) == 0) {
+            psiShardIndex = PSI_CAST(psi_ull, strtoull(argv[i] + strlen(shardIndexStr), PSI_NULL, 10));
+        }
+        else if(strncmp(argv[i], shardCountStr, strlen(shardCountStr)) == 0) {
+            psiShardCount = PSI_CAST(psi_ull, strtoull(argv[i] + strlen(shardCountStr), PSI_NULL, 10));
+        }
+        else if(strncmp(argv[i], shardBalanceStr, strlen(shardBalanceStr)) == 0) {
+            psiShardBalance = 1;
+        }
+
+        // Benchmarks
+        else if(strncmp(argv[i], benchmarkSamplesStr, strlen(benchmarkSamplesStr)) == 0) {
+            psiBenchmarkSamples = PSI_CAST(psi_ull, strtoull(argv[i] + strlen(benchmarkSamplesStr), PSI_NULL, 10));
+            if(psiBenchmarkSamples == 0)
+                psiBenchmarkSamples = 1;
+        }
+        else if(strncmp(argv[i], benchmarkMinTimeStr, strlen(benchmarkMinTimeStr)) == 0) {
+            psiBenchmarkMinTime = PSI_CAST(psi_u64, strtod(argv[i] + strlen(benchmarkMinTimeStr), PSI_NULL) * 1000000);
+        }
+        else if(strncmp(argv[i], benchmarkBaselineStr, strlen(benchmarkBaselineStr)) == 0) {
+            psiBenchmarkBaselinePath = argv[i] + strlen(benchmarkBaselineStr);
+        }
+        else if(strncmp(argv[i], benchmarkSaveStr, strlen(benchmarkSaveStr)) == 0) {
+            psiBenchmarkSavePath = argv[i] + strlen(benchmarkSaveStr);
+        }
+        else if(strncmp(argv[i], benchmarkThresholdStr, strlen(benchmarkThresholdStr)) == 0) {
+            psiBenchmarkThreshold = strtod(argv[i] + strlen(benchmarkThresholdStr), PSI_NULL);
+        }
+        else if(strcmp(argv[i], benchmarkStr) == 0) {
+            psiBenchmarkMode = 1;
+        }
+
+        // Resource usage
+        else if(strcmp(argv[i], usageStr) == 0) {
+            psiCollectUsage = 1;
+            psiPrintUsage = 1;
+        }
+        else if(strncmp(argv[i], sortByStr, strlen(sortByStr)) == 0) {
+            const char* const key = argv[i] + strlen(sortByStr);
+            if(strcmp(key, "rss") == 0)
+                psiSortBy = PSI_SORT_BY_RSS_;
+            else if(strcmp(key, "faults") == 0)
+                psiSortBy = PSI_SORT_BY_FAULTS_;
+            else if(strcmp(key, "time") == 0)
+                psiSortBy = PSI_SORT_BY_TIME_;
+            else {
+                psiTerminalPrintf("ERROR: Unsupported sort key: %s\n", argv[i]);
+                return psi_false;
+            }
+            psiCollectUsage = 1;
+        }
+        else if(strncmp(argv[i], topStr, strlen(topStr)) == 0) {
+            psiTopTests = PSI_CAST(psi_ull, strtoull(argv[i] + strlen(topStr), PSI_NULL, 10));
+        }
+        else if(strncmp(argv[i], durationsStr, strlen(durationsStr)) == 0) {
+            psiNumSlowestTests = PSI_CAST(psi_ull, strtoull(argv[i] + strlen(durationsStr), PSI_NULL, 10));
+        }
+
+        // Performance counters
+        else if(strncmp(argv[i], perfCountersStr, strlen(perfCountersStr)) == 0) {
+            if(!psiPerfConfigure(argv[i] + strlen(perfCountersStr)))
+                return psi_false;
+        }
+
+        // Timer
+        else if(strncmp(argv[i], timeStr, strlen(timeStr)) == 0) {
+            const char* const timer = argv[i] + strlen(timeStr);
+            if(strcmp(timer, "") == 0 || strcmp(timer, "=real") == 0)
+                psiTimer = PSI_TIMER_REAL_;
+#if defined(PSI_WIN_) || defined(PSI_HAS_POSIX_TIMER_)
+            else if(strcmp(timer, "=cpu") == 0)
+                psiTimer = PSI_TIMER_CPU_;
+#endif // PSI_WIN_ || PSI_HAS_POSIX_TIMER_
+#ifdef PSI_HAS_TSC_
+            else if(strcmp(timer, "=tsc") == 0) {
+                psiTimer = PSI_TIMER_TSC_;
+                if(!psiCalibrateTsc()) {
+                    psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+                    psiTerminalPrintf("This CPU has no invariant TSC, measuring in real time instead\n");
+                    psiTimer = PSI_TIMER_REAL_;
+                }
+            }
+#endif // PSI_HAS_TSC_
+            else {
+                psiTerminalPrintf("ERROR: Unsupported timer: %s\n", argv[i]);
+                return psi_false;
+            }
+        }
+
+        else {
+            psiTerminalPrintf("ERROR: Unrecognized option: %s", argv[i]);
+            return psi_false;
+        }
+    }
+
+#ifndef PSI_UNIX_
+    if(psiCollectUsage) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+        psiTerminalPrintf("Resource usage is only collected on Unix, leaving it out\n");
+        psiCollectUsage = 0;
+        psiPrintUsage = 0;
+    }
+#endif // PSI_UNIX_
+
+#ifndef PSI_HAS_PROFILER_
+    if(psiProfileDir) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+        psiTerminalPrintf("The profiler needs SIGPROF and backtrace(), leaving it out\n");
+        psiProfileDir = PSI_NULL;
+    }
+#else
+    if(psiProfileDir && mkdir(psiProfileDir, 0777) != 0 && errno != EEXIST) {
+        psiTerminalPrintf("ERROR: Could not create the profile directory %s\n", psiProfileDir);
+        return psi_false;
+    }
+    // SIGPROF goes to whichever thread happens to be running, so threads can't be told apart
+    if(psiProfileDir && psiUseThreads) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+        psiTerminalPrintf("--profile can't tell threads apart, running the --jobs in processes instead\n");
+        psiUseThreads = 0;
+    }
+#endif // PSI_HAS_PROFILER_
+
+    // The fuzzing loop runs in this process, where the coverage is counted
+    if(psiTestContext.fuzzTarget) {
+        psiNumJobs = 1;
+        psiUseThreads = 0;
+    }
+
+    if(psiShardCount == 0 || psiShardIndex >= psiShardCount) {
+        psiTerminalPrintf("ERROR: --shard-index must be less than --shard-count (got %" PSI_PRIu64 " of %" PSI_PRIu64 ")\n",
+                          PSI_CAST(psi_u64, psiShardIndex), PSI_CAST(psi_u64, psiShardCount));
+        return psi_false;
+    }
+
+    return psi_true;
+}
+
+/**
+    Data Files (`TEST_P`)
+    Mapped read-only where the platform can (and read into memory everywhere else). Rows are never copied: the
+    tests `psi_main` makes out of them point straight into the mapping.
+*/
+static const char* psiMapFile(const char* const path, psi_ull* const size) {
+#if defined(PSI_UNIX_)
+    struct stat info;
+    void* data;
+    const int fd = open(path, O_RDONLY);
+    if(fd < 0)
+        return PSI_NULL;
+    if(fstat(fd, &info) != 0) {
+        close(fd);
+        return PSI_NULL;
+    }
+
+    *size = PSI_CAST(psi_ull, info.st_size);
+    data = *size > 0 ? mmap(PSI_NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0) : PSI_NULL;
+    close(fd);
+    if(data == MAP_FAILED)
+        return PSI_NULL;
+    return *size > 0 ? PSI_CAST(const char*, data) : "";
+#elif defined(PSI_WIN_)
+    LARGE_INTEGER fileSize;
+    const char* data = PSI_NULL;
+    const HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, PSI_NULL, OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL, PSI_NULL);
+    if(file == INVALID_HANDLE_VALUE)
+        return PSI_NULL;
+    if(!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return PSI_NULL;
+    }
+
+    *size = PSI_CAST(psi_ull, fileSize.QuadPart);
+    if(*size == 0) {
+        CloseHandle(file);
+        return "";
+    }
+    {
+        const HANDLE mapping = CreateFileMappingA(file, PSI_NULL, PAGE_READONLY, 0, 0, PSI_NULL);
+        if(PSI_SOME(mapping)) {
+            data = PSI_CAST(const char*, MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+    return data;
+#else
+    FILE* const file = psi_fopen(path, "rb");
+    char* data;
+    if(PSI_NONE(file))
+        return PSI_NULL;
+
+    fseek(file, 0, SEEK_END);
+    *size = PSI_CAST(psi_ull, ftell(file));
+    fseek(file, 0, SEEK_SET);
+    data = PSI_PTRCAST(char*, malloc(*size + 1));
+    if(fread(data, 1, *size, file) != *size) {
+        free(data);
+        data = PSI_NULL;
+    }
+    fclose(file);
+    return data;
+#endif // PSI_UNIX_
+}
+
+// Empty files are never mapped
+static void psiUnmapFile(const char* const data, const psi_ull size) {
+#if defined(PSI_UNIX_)
+    if(size > 0)
+        munmap(PSI_PTRCAST(void*, PSI_PTRCAST(psi_uptr, data)), size);
+#elif defined(PSI_WIN_)
+    if(size > 0)
+        UnmapViewOfFile(data);
+#else
+    (void)size;
+    free(PSI_PTRCAST(void*, PSI_PTRCAST(psi_uptr, data)));
+#endif // PSI_UNIX_
+}
+
+// How much of `sourceFile` is the directory it's in (with the last slash), 0 if none
+static psi_ull psiSourceDirLength(const char* const sourceFile) {
+    const char* const slash = strrchr(sourceFile, '/');
+    const char* const backslash = strrchr(sourceFile, '\\');
+    const char* const end = PSI_SOME(slash) && (PSI_NONE(backslash) || slash > backslash) ? slash : backslash;
+    return PSI_SOME(end) ? PSI_CAST(psi_ull, (end - sourceFile + 1)) : 0;
+}
+
+static psi_bool psiIsAbsolutePath(const char* const path) {
+    return path[0] == '/' || path[0] == '\\' || PSI_SOME(strchr(path, ':'));
+}
+
+// Maps the data file of a `TEST_P`, looking next to its source file too if the path is relative
+static const char* psiMapDataFile(const psiTestSuiteStruct* const test, psi_ull* const size) {
+    const char* data = psiMapFile(test->dataFile, size);
+    const psi_ull dirLength = psiSourceDirLength(test->sourceFile);
+    if(PSI_SOME(data) || dirLength == 0 || psiIsAbsolutePath(test->dataFile))
+        return data;
+
+    psiBufferStruct path = {PSI_NULL, 0, 0};
+    psiBufferAppend(&path, test->sourceFile, dirLength);
+    psiBufferAppend(&path, test->dataFile, strlen(test->dataFile) + 1);
+    data = psiMapFile(path.data, size);
+    free(path.data);
+    return data;
+}
+
+// The next non-blank line of `data` at or after `*offset`, without its line break. Moves `*offset` past it.
+static psi_bool psiNextRow(const char* const data, const psi_ull size, psi_ull* const offset,
+                           psiFieldStruct* const row, psi_ull* const lineNumber) {
+    while(*offset < size) {
+        const char* const start = data + *offset;
+        const char* const newline = PSI_CAST(const char*, memchr(start, '\n', size - *offset));
+        psi_ull length = newline ? PSI_CAST(psi_ull, (newline - start)) : size - *offset;
+        psi_ull blank = 0;
+
+        *offset += length + (newline ? 1 : 0);
+        (*lineNumber)++;
+        if(length > 0 && start[length - 1] == '\r')
+            length--;
+        while(blank < length && (start[blank] == ' ' || start[blank] == '\t'))
+            blank++;
+        if(blank < length) {
+            row->data = start;
+            row->size = length;
+            return psi_true;
+        }
+    }
+    return psi_false;
+}
+
+static void psiTrimField(psiFieldStruct* const field) {
+    while(field->size > 0 && (field->data[0] == ' ' || field->data[0] == '\t')) {
+        field->data++;
+        field->size--;
+    }
+    while(field->size > 0 && (field->data[field->size - 1] == ' ' || field->data[field->size - 1] == '\t'))
+        field->size--;
+    if(field->size >= 2 && field->data[0] == '"' && field->data[field->size - 1] == '"') {
+        field->data++;
+        field->size -= 2;
+    }
+}
+
+// Splits a row at the commas that aren't inside double quotes
+static void psiSplitRow(const psiTestSuiteStruct* const test, psiParamStruct* const param) {
+    psi_ull start = 0;
+    int isQuoted = 0;
+
+    memset(param, 0, sizeof(*param));
+    param->row = test->row;
+    param->lineNumber = test->lineNumber;
+    for(psi_ull i = 0; i <= test->row.size; i++) {
+        if(i < test->row.size && test->row.data[i] == '"')
+            isQuoted = !isQuoted;
+        if(i < test->row.size && (isQuoted || test->row.data[i] != ',' ||
+                                  param->numFields == PSI_MAX_PARAM_FIELDS_ - 1))
+            continue;
+
+        param->fields[param->numFields].data = test->row.data + start;
+        param->fields[param->numFields].size = i - start;
+        psiTrimField(&param->fields[param->numFields]);
+        param->numFields++;
+        start = i + 1;
+    }
+}
+
+/**
+    Replaces every `TEST_P` in `psiTestContext.tests` by one test per row of its data file. A `TEST_P` whose
+    file can't be read (or is empty) stays a single test, which fails.
+*/
+static void psiExpandParamTests() {
+    psi_ull numTests = 0;
+    psi_ull numParamTests = 0;
+    psi_ull namesSize = 0;
+
+    for(psi_ull i = 0; i < psiTestContext.numTestSuites; i++) {
+        if(psiTestContext.tests[i].paramFunc)
+            numParamTests++;
+    }
+    if(numParamTests == 0)
+        return;
+
+    // Map the files and count their rows, leaving room for a name like "Suite.Name/123" per row
+    psiDataFiles = PSI_PTRCAST(psiDataFileStruct*, calloc(numParamTests, sizeof(psiDataFileStruct)));
+    for(psi_ull i = 0; i < psiTestContext.numTestSuites; i++) {
+        const psiTestSuiteStruct* const test = &psiTestContext.tests[i];
+        psiDataFileStruct* const file = &psiDataFiles[psiNumDataFiles];
+        psi_ull numRows = 0;
+        psi_ull offset = 0;
+        psi_ull lineNumber = 0;
+        psiFieldStruct row;
+
+        if(PSI_NONE(test->paramFunc)) {
+            numTests++;
+            continue;
+        }
+        psiNumDataFiles++;
+        file->data = psiMapDataFile(test, &file->size);
+        while(PSI_SOME(file->data) && psiNextRow(file->data, file->size, &offset, &row, &lineNumber))
+            numRows++;
+        numTests += numRows > 0 ? numRows : 1;
+        namesSize += numRows * (strlen(test->name) + 22);
+    }
+
+    psiTestSuiteStruct* const tests = PSI_PTRCAST(psiTestSuiteStruct*,
+                                                  malloc(sizeof(psiTestSuiteStruct) * (numTests + 1)));
+    char* name = psiParamNames = PSI_PTRCAST(char*, malloc(namesSize + 1));
+    psi_ull numDataFiles = 0;
+    numTests = 0;
+    for(psi_ull i = 0; i < psiTestContext.numTestSuites; i++) {
+        const psiTestSuiteStruct* const test = &psiTestContext.tests[i];
+        const psiDataFileStruct* file;
+        psi_ull offset = 0;
+        psi_ull lineNumber = 0;
+        psi_ull numRows = 0;
+        psiFieldStruct row;
+
+        tests[numTests] = *test;
+        if(PSI_NONE(test->paramFunc)) {
+            numTests++;
+            continue;
+        }
+
+        file = &psiDataFiles[numDataFiles++];
+        while(PSI_SOME(file->data) && psiNextRow(file->data, file->size, &offset, &row, &lineNumber)) {
+            const int length = PSI_SNPRINTF(name, strlen(test->name) + 22, "%s/%" PSI_PRIu64, test->name,
+                                            PSI_CAST(psi_u64, lineNumber));
+            tests[numTests] = *test;
+            tests[numTests].name = name;
+            tests[numTests].row = row;
+            tests[numTests].lineNumber = lineNumber;
+            name += length + 1;
+            numTests++;
+            numRows++;
+        }
+        if(numRows == 0) {
+            tests[numTests].row.data = PSI_NULL;
+            numTests++;
+        }
+    }
+
+    free(PSI_PTRCAST(void*, psiTestContext.tests));
+    psiTestContext.tests = tests;
+    psiTestContext.numTestSuites = numTests;
+}
+
+// Runs the body of a `TEST_P` on the row this test stands for
+static void psiRunParamTest(const psiTestSuiteStruct* const test, const psiParamStruct* const param) {
+    if(PSI_NONE(test->row.data)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "ERROR: ");
+        psiPrintf("Could not read any rows from the data file %s\n", test->dataFile);
+        psiThreadContext.hasCurrentTestFailed = 1;
+        return;
+    }
+    test->paramFunc(param);
+}
+
+static int psiCleanup() {
+    psiFlushOutput();
+    psiPerfClose();
+    for(int i = 0; i < PSI_NUM_SINKS_; i++) {
+        free(psiThreadContext.pending[i].data);
+        psiThreadContext.pending[i].data = PSI_NULL;
+        psiThreadContext.pending[i].capacity = 0;
+    }
+
+    free(PSI_PTRCAST(void* , psiStatsFailedTestSuites));
+    free(PSI_PTRCAST(void* , psiStatsTestDurations));
+    free(PSI_PTRCAST(void* , psiStatsTestUsage));
+    free(PSI_PTRCAST(void* , psiCachedDurations));
+    free(PSI_PTRCAST(void* , psiIsInShard));
+    for(psi_ull i = 0; i < psiNumDataFiles; i++) {
+        if(PSI_SOME(psiDataFiles[i].data))
+            psiUnmapFile(psiDataFiles[i].data, psiDataFiles[i].size);
+    }
+    free(PSI_PTRCAST(void* , psiDataFiles));
+    free(PSI_PTRCAST(void* , psiParamNames));
+#ifdef PSI_HAS_PROFILER_
+    free(PSI_PTRCAST(void* , psiProfileSamples));
+#endif // PSI_HAS_PROFILER_
+    free(PSI_PTRCAST(void* , psiTestContext.tests));
+    for(psi_ull i = 0; i < psiTestContext.numDynamicTests; i++)
+        free(PSI_PTRCAST(void*, PSI_PTRCAST(psi_uptr, psiTestContext.dynamicTests[i].name)));
+    free(PSI_PTRCAST(void* , psiTestContext.dynamicTests));
+
+    if(psiTestContext.foutput)
+        fclose(psiTestContext.foutput);
+    if(psiTraceFile)
+        fclose(psiTraceFile);
+
+    return PSI_CAST(int, psiStatsNumTestsFailed);
+}
+
+// The outcome of a single test run
+typedef struct psiTestResultStruct {
+    int hasFailed;
+    psi_u64 duration;   // In nanoseconds, as measured by the `--time` timer
+    // When it started and ended on the real timer, the worker that ran it (0 when it ran on the main thread,
+    // otherwise the worker's index + 1), and when its first failed assertions failed. For `--trace`.
+    psi_u64 startTime;
+    psi_u64 endTime;
+    psi_ull worker;
+    psi_u64 failureTimes[PSI_MAX_TRACE_FAILURES_];
+    psi_ull numFailureTimes;
+    // The `--perf-counters` of the thread that ran the test, if they could be read
+    int hasPerfCounts;
+    psi_u64 perfCounts[PSI_MAX_PERF_COUNTERS_];
+    // Its heap use, if the allocation hooks are compiled in
+    int hasAllocStats;
+    psiAllocStatsStruct allocStats;
+    // What it cost the process it ran in, with `--rusage`/`--sort-by`
+    int hasUsage;
+    psiUsageStruct usage;
+    // Output the test produced while running in a worker (`--jobs`), and what it had Psi print for the XUnit file.
+    // Always empty for serial runs, since the output there goes straight to the sinks.
+    char* output;
+    psi_ull outputSize;
+    char* report;
+    psi_ull reportSize;
+} psiTestResultStruct;
+
+static void psiPrintTestStart(const psi_ull index) {
+    if(!psiDisplayOnlyFailedOutput) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[ RUN      ] ");
+        psiColouredPrintf(PSI_COLOUR_DEFAULT_, "%s\n", psiTestContext.tests[index].name);
+    }
+
+    psiReportPrintf("<testcase name=\"%s\">", psiTestContext.tests[index].name);
+}
+
+// Prints an amount of memory given in KiB
+static void psiPrintKilobytes(const psi_u64 kilobytes) {
+    if(kilobytes < 1024)
+        psiTerminalPrintf("%" PSI_PRIu64 "KB", kilobytes);
+    else if(kilobytes < 1024 * 1024)
+        psiTerminalPrintf("%.1fMB", PSI_CAST(double, kilobytes) / 1024);
+    else
+        psiTerminalPrintf("%.2fGB", PSI_CAST(double, kilobytes) / (1024 * 1024));
+}
+
+static void psiPrintUsage_(const psiUsageStruct* const usage) {
+    psiTerminalPrintf("max RSS ");
+    psiPrintKilobytes(usage->maxRss);
+    psiTerminalPrintf(" (+");
+    psiPrintKilobytes(usage->rssGrowth);
+    psiTerminalPrintf("), %" PSI_PRIu64 " minor/%" PSI_PRIu64 " major faults, %" PSI_PRIu64 "/%" PSI_PRIu64
+                      " context switches", usage->minorFaults, usage->majorFaults, usage->voluntarySwitches,
+                      usage->involuntarySwitches);
+}
+
+// Prints the duration of a test (and its `--perf-counters`) inside the parentheses of its result line
+static void psiPrintTestDuration(const psiTestResultStruct* const result) {
+    psiClockPrintDuration(result->duration);
+    if(result->hasUsage && psiPrintUsage) {
+        psiTerminalPrintf(", ");
+        psiPrintUsage_(&result->usage);
+    }
+    if(result->hasAllocStats) {
+        psiTerminalPrintf(", %" PSI_PRIu64 " allocs, %" PSI_PRIu64 " frees, %" PSI_PRIu64 " bytes, peak %" PSI_PRIu64 " bytes",
+                          result->allocStats.numAllocs, result->allocStats.numFrees, result->allocStats.bytes,
+                          PSI_CAST(psi_u64, result->allocStats.peakBytes));
+    }
+    if(result->hasPerfCounts) {
+        for(psi_ull i = 0; i < psiNumPerfCounters; i++)
+            psiTerminalPrintf(", %" PSI_PRIu64 " %s", result->perfCounts[i], psiPerfCounterName(i));
+    }
+}
+
+/**
+    Timeline (`--trace=<file>`)
+    A Chrome trace-event JSON file: one complete event per test, on the lane of the worker that ran it, and an
+    instant event for each of its failed assertions (up to `PSI_MAX_TRACE_FAILURES_`). Timestamps are in
+    microseconds since the tests started. The forked workers read the same monotonic clock as this process, so
+    their lanes line up with each other.
+*/
+static void psiTraceBegin(const psi_ull numWorkers) {
+    psiTraceFile = psi_fopen(psiTracePath, "w");
+    if(PSI_NONE(psiTraceFile)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+        psiTerminalPrintf("Could not open %s, leaving the trace out\n", psiTracePath);
+        return;
+    }
+
+    psiTraceStart = psiClockRead(PSI_TIMER_REAL_);
+    psiTraceNumEvents = 0;
+    fprintf(psiTraceFile, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for(psi_ull w = 0; w <= numWorkers; w++) {
+        fprintf(psiTraceFile, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%" PSI_PRIu64
+                              ",\"args\":{\"name\":\"", psiTraceNumEvents++ ? ",\n" : "", PSI_CAST(psi_u64, w));
+        if(w == 0)
+            fprintf(psiTraceFile, "main\"}}");
+        else
+            fprintf(psiTraceFile, "worker %" PSI_PRIu64 "\"}}", PSI_CAST(psi_u64, w));
+    }
+}
+
+// Microseconds since the tests started
+static double psiTraceTime(const psi_u64 time) {
+    return time > psiTraceStart ? PSI_CAST(double, (time - psiTraceStart)) / 1000 : 0;
+}
+
+static void psiTraceTest(const psi_ull index, const psiTestResultStruct* const result) {
+    // A test whose worker died never got to tell us when it ran
+    if(PSI_NONE(psiTraceFile) || result->endTime == 0)
+        return;
+
+    fprintf(psiTraceFile, "%s{\"name\":\"", psiTraceNumEvents++ ? ",\n" : "");
+    for(const char* c = psiTestContext.tests[index].name; *c; c++) {
+        if(*c == '"' || *c == '\\')
+            fprintf(psiTraceFile, "\\%c", *c);
+        else if(PSI_CAST(unsigned char, *c) < 0x20)
+            fprintf(psiTraceFile, "\\u%04x", PSI_CAST(unsigned int, PSI_CAST(unsigned char, *c)));
+        else
+            fputc(*c, psiTraceFile);
+    }
+    fprintf(psiTraceFile, "\",\"cat\":\"test\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%" PSI_PRIu64
+                          ",\"args\":{\"failed\":%s}}",
+            psiTraceTime(result->startTime), PSI_CAST(double, (result->endTime - result->startTime)) / 1000,
+            PSI_CAST(psi_u64, result->worker), result->hasFailed ? "true" : "false");
+    for(psi_ull i = 0; i < result->numFailureTimes; i++)
+        fprintf(psiTraceFile, ",\n{\"name\":\"assertion failed\",\"cat\":\"failure\",\"ph\":\"i\",\"s\":\"t\","
+                              "\"ts\":%.3f,\"pid\":1,\"tid\":%" PSI_PRIu64 "}",
+                psiTraceTime(result->failureTimes[i]), PSI_CAST(psi_u64, result->worker));
+}
+
+static void psiTraceEnd() {
+    if(PSI_NONE(psiTraceFile))
+        return;
+
+    fprintf(psiTraceFile, "\n]}\n");
+    fclose(psiTraceFile);
+    psiTraceFile = PSI_NULL;
+}
+
+// Records the result of a test in the global stats and prints its `[ OK ]`/`[ FAILED ]` line
+static void psiReportTestResult(const psi_ull index, const psiTestResultStruct* const result) {
+    psiTraceTest(index, result);
+    if(result->hasPerfCounts || result->hasAllocStats || result->hasUsage) {
+        psiReportPrintf("<properties>");
+        if(result->hasUsage) {
+            psiReportPrintf("<property name=\"max_rss_kb\" value=\"%" PSI_PRIu64 "\"/>"
+                            "<property name=\"rss_growth_kb\" value=\"%" PSI_PRIu64 "\"/>"
+                            "<property name=\"minor_faults\" value=\"%" PSI_PRIu64 "\"/>"
+                            "<property name=\"major_faults\" value=\"%" PSI_PRIu64 "\"/>"
+                            "<property name=\"voluntary_switches\" value=\"%" PSI_PRIu64 "\"/>"
+                            "<property name=\"involuntary_switches\" value=\"%" PSI_PRIu64 "\"/>",
+                            result->usage.maxRss, result->usage.rssGrowth, result->usage.minorFaults,
+                            result->usage.majorFaults, result->usage.voluntarySwitches,
+                            result->usage.involuntarySwitches);
+        }
+        if(result->hasAllocStats) {
+            psiReportPrintf("<property name=\"allocs\" value=\"%" PSI_PRIu64 "\"/><property name=\"frees\" value=\"%" PSI_PRIu64 "\"/>"
+                            "<property name=\"allocated_bytes\" value=\"%" PSI_PRIu64 "\"/>"
+                            "<property name=\"peak_bytes\" value=\"%" PSI_PRIu64 "\"/>",
+                            result->allocStats.numAllocs, result->allocStats.numFrees, result->allocStats.bytes,
+                            PSI_CAST(psi_u64, result->allocStats.peakBytes));
+        }
+        for(psi_ull i = 0; result->hasPerfCounts && i < psiNumPerfCounters; i++)
+            psiReportPrintf("<property name=\"%s\" value=\"%" PSI_PRIu64 "\"/>", psiPerfCounterName(i),
+                            result->perfCounts[i]);
+        psiReportPrintf("</properties>");
+    }
+    psiReportPrintf("%s</testcase>\n", result->hasFailed ? "<failure message=\"Test failed\"/>" : "");
+
+    if(psiStatsTestDurations)
+        psiStatsTestDurations[index] = PSI_CAST(double, result->duration);
+    if(psiStatsTestUsage && result->hasUsage)
+        psiStatsTestUsage[index] = result->usage;
+
+    if(result->hasFailed) {
+        const psi_ull failed_testcase_index = psiStatsNumFailedTestSuites++;
+        psiStatsFailedTestSuites = PSI_PTRCAST(psi_ull*,
+                                        psi_realloc(PSI_PTRCAST(void*, psiStatsFailedTestSuites),
+                                                      sizeof(psi_ull) * psiStatsNumFailedTestSuites));
+        psiStatsFailedTestSuites[failed_testcase_index] = index;
+        psiStatsNumTestsFailed++;
+        psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "[  FAILED  ] ");
+        psiColouredPrintf(PSI_COLOUR_DEFAULT_, "%s (", psiTestContext.tests[index].name);
+        psiPrintTestDuration(result);
+        psiTerminalPrintf(")\n");
+    } else {
+        if(!psiDisplayOnlyFailedOutput) {
+            psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[       OK ] ");
+            psiColouredPrintf(PSI_COLOUR_DEFAULT_, "%s (", psiTestContext.tests[index].name);
+            psiPrintTestDuration(result);
+            psiTerminalPrintf(")\n");
+        }
+    }
+}
+
+// Prints a test that ran in a worker, along with the output it produced there
+static void psiReportCapturedTestResult(const psi_ull index, psiTestResultStruct* const result) {
+    psiPrintTestStart(index);
+    psiBufferAppend(&psiThreadContext.pending[0], result->output, result->outputSize);
+    if(psiTestContext.foutput)
+        psiBufferAppend(&psiThreadContext.pending[1], result->report, result->reportSize);
+    psiReportTestResult(index, result);
+    free(result->output);
+    free(result->report);
+    result->output = PSI_NULL;
+    result->report = PSI_NULL;
+
+    // Nothing else runs on this thread, so finished records can pile up - unless someone is watching
+    if(psiOutputIsTerminal)
+        psiFlushOutput();
+    else if(psiThreadContext.pending[0].size >= PSI_OUTPUT_BATCH_SIZE_ ||
+            psiThreadContext.pending[1].size >= PSI_OUTPUT_BATCH_SIZE_)
+        psiWriteOutput();
+}
+
+/**
+    Sampling Profiler (`--profile=<dir>`)
+    While a test runs, `ITIMER_PROF` sends this process a SIGPROF every `PSI_PROFILE_INTERVAL_US_` of CPU time it
+    uses, and the handler walks the stack into the next free slot of a buffer allocated up front. Slots are
+    claimed with an atomic increment, so the handler never takes a lock or allocates. Once the test is done, the
+    samples are symbolized and counted, and written to `<dir>/<test name>.folded` - one `root;...;leaf count` line
+    per distinct stack, the input flamegraph.pl, speedscope and friends expect.
+
+    Only symbols the dynamic linker can see get a name (link with `-rdynamic` to include the test binary's own
+    functions); everything else is written as `module+offset`, which `addr2line` can resolve. Samples past the
+    end of the buffer are dropped, with a warning.
+*/
+#ifdef PSI_HAS_PROFILER_
+static void psiProfileHandler_(const int signal) {
+    const int savedErrno = errno;
+    const psi_ull slot = PSI_ATOMIC_FETCH_ADD(&psiProfileNumSamples, 1);
+    (void)signal;
+    if(slot < PSI_PROFILE_MAX_SAMPLES_)
+        psiProfileSamples[slot].depth = backtrace(psiProfileSamples[slot].frames, PSI_PROFILE_MAX_DEPTH_);
+    errno = savedErrno;
+}
+
+static void psiProfileSetTimer_(const long interval) {
+    struct itimerval timer;
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = interval;
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_PROF, &timer, PSI_NULL);
+}
+
+static void psiProfileStart_() {
+    if(PSI_NONE(psiProfileSamples)) {
+        struct sigaction action;
+        void* frame;
+        psiProfileSamples = PSI_PTRCAST(psiProfileSampleStruct*,
+                                        malloc(sizeof(psiProfileSampleStruct) * PSI_PROFILE_MAX_SAMPLES_));
+        // The first call loads the unwinder, which allocates: get that out of the way outside the handler
+        backtrace(&frame, 1);
+
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = psiProfileHandler_;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGPROF, &action, PSI_NULL);
+    }
+
+    PSI_ATOMIC_STORE(&psiProfileNumSamples, 0);
+    psiProfileSetTimer_(PSI_PROFILE_INTERVAL_US_);
+}
+
+static void psiProfileStop_() {
+    psiProfileSetTimer_(0);
+}
+
+// `name+0x1f` of a `backtrace_symbols` line, or `module+0x1f` if the symbol has no name
+static void psiProfileAppendFrame(psiBufferStruct* const line, const char* const symbol) {
+    const char* const open = strchr(symbol, '(');
+    const char* const close = open ? strchr(open, ')') : PSI_NULL;
+    if(open && close) {
+        const char* const plus = strchr(open, '+');
+        if(plus && plus < close && plus > open + 1) {
+            psiBufferAppend(line, open + 1, PSI_CAST(psi_ull, (plus - open - 1)));
+        } else {
+            const char* const slash = strrchr(symbol, '/');
+            const char* const module = slash && slash < open ? slash + 1 : symbol;
+            psiBufferAppend(line, module, PSI_CAST(psi_ull, (open - module)));
+            psiBufferAppend(line, open + 1, PSI_CAST(psi_ull, (close - open - 1)));
+        }
+        return;
+    }
+
+    // macOS: "3   binary   0x0000000100003f1c name + 28"
+    const char* name = strstr(symbol, " 0x");
+    name = name ? strchr(name + 1, ' ') : PSI_NULL;
+    if(name) {
+        const char* const end = strstr(name, " + ");
+        while(*name == ' ')
+            name++;
+        psiBufferAppend(line, name, end ? PSI_CAST(psi_ull, (end - name)) : strlen(name));
+    } else {
+        psiBufferAppend(line, symbol, strlen(symbol));
+    }
+}
+
+static int psiCompareStrings(const void* const lhs, const void* const rhs) {
+    return strcmp(*PSI_CAST(const char* const*, lhs), *PSI_CAST(const char* const*, rhs));
+}
+
+// Folds the samples of the test that just ran into `<dir>/<test name>.folded`
+static void psiProfileWrite(const psi_ull index) {
+    const psi_ull numClaimed = PSI_ATOMIC_LOAD(&psiProfileNumSamples);
+    const psi_ull numSamples = numClaimed < PSI_PROFILE_MAX_SAMPLES_ ? numClaimed : PSI_PROFILE_MAX_SAMPLES_;
+    const char* const name = psiTestContext.tests[index].name;
+    psiBufferStruct lines = {PSI_NULL, 0, 0};
+    psi_ull* const offsets = PSI_PTRCAST(psi_ull*, malloc(sizeof(psi_ull) * (numSamples + 1)));
+    const char** const stacks = PSI_PTRCAST(const char**, malloc(sizeof(const char*) * (numSamples + 1)));
+    psi_ull numStacks = 0;
+
+    // One `root;...;leaf` line per sample, each terminated by a NUL
+    for(psi_ull i = 0; i < numSamples; i++) {
+        const int depth = psiProfileSamples[i].depth - PSI_PROFILE_SKIP_FRAMES_;
+        char** const symbols = depth > 0 ? backtrace_symbols(psiProfileSamples[i].frames + PSI_PROFILE_SKIP_FRAMES_,
+                                                             depth) : PSI_NULL;
+        if(PSI_NONE(symbols))
+            continue;
+
+        offsets[numStacks++] = lines.size;
+        for(int frame = depth - 1; frame >= 0; frame--) {
+            psiProfileAppendFrame(&lines, symbols[frame]);
+            psiBufferAppend(&lines, frame > 0 ? ";" : "", frame > 0 ? 1 : 0);
+        }
+        psiBufferAppend(&lines, "", 1);
+        free(PSI_PTRCAST(void*, symbols));
+    }
+    for(psi_ull i = 0; i < numStacks; i++)
+        stacks[i] = lines.data + offsets[i];
+    qsort(PSI_PTRCAST(void*, stacks), numStacks, sizeof(const char*), psiCompareStrings);
+
+    // Anything but a plain identifier character is left out of the file name
+    psiBufferStruct path = {PSI_NULL, 0, 0};
+    psiBufferAppend(&path, psiProfileDir, strlen(psiProfileDir));
+    psiBufferAppend(&path, "/", 1);
+    for(const char* c = name; *c; c++) {
+        const int isPlain = (*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z') || (*c >= '0' && *c <= '9') ||
+                            *c == '.' || *c == '_' || *c == '-';
+        psiBufferAppend(&path, isPlain ? c : "_", 1);
+    }
+    psiBufferAppend(&path, ".folded", strlen(".folded") + 1);
+
+    FILE* const file = psi_fopen(path.data, "w");
+    if(PSI_SOME(file)) {
+        for(psi_ull i = 0, count = 1; i < numStacks; i++, count++) {
+            if(i + 1 == numStacks || strcmp(stacks[i], stacks[i + 1]) != 0) {
+                fprintf(file, "%s %" PSI_PRIu64 "\n", stacks[i], PSI_CAST(psi_u64, count));
+                count = 0;
+            }
+        }
+        fclose(file);
+    } else {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+        psiTerminalPrintf("Could not write the profile of %s to %s\n", name, path.data);
+    }
+
+    if(numClaimed > numSamples) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+        psiTerminalPrintf("Dropped %" PSI_PRIu64 " of the %" PSI_PRIu64 " samples of %s\n",
+                          PSI_CAST(psi_u64, numClaimed - numSamples), PSI_CAST(psi_u64, numClaimed), name);
+    }
+
+    free(path.data);
+    free(lines.data);
+    free(PSI_PTRCAST(void*, stacks));
+    free(offsets);
+}
+#else
+static void psiProfileStart_() {}
+static void psiProfileStop_() {}
+static void psiProfileWrite(const psi_ull index) { (void)index; }
+#endif // PSI_HAS_PROFILER_
+
+#ifdef PSI_UNIX_
+// Threads only count their own faults and context switches, so that tests running next to them don't add to it
+static void psiGetUsage(struct rusage* const usage) {
+    getrusage(psiUseThreads ? PSI_RUSAGE_THREAD_ : RUSAGE_SELF, usage);
+}
+
+// The difference between `before` and `after` a test. Linux reports the max RSS in KiB, macOS in bytes.
+static void psiUsageBetween(const struct rusage* const before, const struct rusage* const after,
+                            psiUsageStruct* const usage) {
+    #ifdef __APPLE__
+        const psi_u64 unit = 1024;
+    #else
+        const psi_u64 unit = 1;
+    #endif // __APPLE__
+    usage->maxRss = PSI_CAST(psi_u64, after->ru_maxrss) / unit;
+    usage->rssGrowth = PSI_CAST(psi_u64, (after->ru_maxrss - before->ru_maxrss)) / unit;
+    usage->minorFaults = PSI_CAST(psi_u64, (after->ru_minflt - before->ru_minflt));
+    usage->majorFaults = PSI_CAST(psi_u64, (after->ru_majflt - before->ru_majflt));
+    usage->voluntarySwitches = PSI_CAST(psi_u64, (after->ru_nvcsw - before->ru_nvcsw));
+    usage->involuntarySwitches = PSI_CAST(psi_u64, (after->ru_nivcsw - before->ru_nivcsw));
+}
+#endif // PSI_UNIX_
+
+// Runs a single test in the calling process
+static void psiRunTest(const psi_ull index, psiTestResultStruct* const result) {
+    psiThreadContext.checkIsInsideTestSuite = 1;
+    psiThreadContext.hasCurrentTestFailed = 0;
+    psiThreadContext.shouldFailTest = 0;
+    psiThreadContext.shouldAbortTest = 0;
+    if(psiNumPerfCounters > 0 && psiThreadContext.numPerfFds == 0)
+        psiPerfOpen();
+    memset(&psiThreadContext.allocs, 0, sizeof(psiThreadContext.allocs));
+    psiThreadContext.allocs.isTracking = psiTestContext.tracksAllocs;
+    psiThreadContext.numFailureTimes = 0;
+#ifdef PSI_UNIX_
+    struct rusage usageBefore;
+    if(psiCollectUsage)
+        psiGetUsage(&usageBefore);
+#endif // PSI_UNIX_
+
+    // A `TEST_P` row is split up before the timer starts
+    psiParamStruct param;
+    if(psiTestContext.tests[index].paramFunc)
+        psiSplitRow(&psiTestContext.tests[index], &param);
+
+    // Start the timer (the counters go outside it, so that they don't add to the duration)
+    result->startTime = psiClockRead(PSI_TIMER_REAL_);
+    if(psiProfileDir)
+        psiProfileStart_();
+    psiPerfStart_();
+    const psi_u64 start = psiClock();
+
+    // The actual test
+    if(psiTestContext.tests[index].paramFunc)
+        psiRunParamTest(&psiTestContext.tests[index], &param);
+    else if(psiTestContext.tests[index].ctxFunc)
+        psiTestContext.tests[index].ctxFunc(psiTestContext.tests[index].ctx);
+    else
+        psiTestContext.tests[index].func();
+
+    // Stop the timer
+    result->duration = psiClock() - start;
+    psiPerfStop_();
+    if(psiProfileDir)
+        psiProfileStop_();
+    result->endTime = psiClockRead(PSI_TIMER_REAL_);
+    result->worker = 0;
+    memcpy(result->failureTimes, psiThreadContext.failureTimes, sizeof(result->failureTimes));
+    result->numFailureTimes = psiThreadContext.numFailureTimes;
+    result->hasPerfCounts = psiPerfRead(result->perfCounts);
+    psiThreadContext.allocs.isTracking = 0;
+    result->hasAllocStats = psiTestContext.tracksAllocs;
+    result->allocStats = psiThreadContext.allocs;
+    result->hasUsage = 0;
+#ifdef PSI_UNIX_
+    if(psiCollectUsage) {
+        struct rusage usageAfter;
+        psiGetUsage(&usageAfter);
+        psiUsageBetween(&usageBefore, &usageAfter, &result->usage);
+        result->hasUsage = 1;
+    }
+#endif // PSI_UNIX_
+    result->hasFailed = psiThreadContext.hasCurrentTestFailed;
+    psiThreadContext.checkIsInsideTestSuite = 0;
+    if(psiProfileDir)
+        psiProfileWrite(index);
+    result->output = PSI_NULL;
+    result->outputSize = 0;
+    result->report = PSI_NULL;
+    result->reportSize = 0;
+}
+
+static void psiRunTestsSerially(const psi_ull* const order, const psi_ull numTests) {
+    for(psi_ull i = 0; i < numTests; i++) {
+        psiTestResultStruct result;
+        psiPrintTestStart(order[i]);
+        // The test may print to stdout itself, so its `[ RUN ]` line (and the previous test's result) has to
+        // be in the stream first
+        psiWriteOutput();
+        psiRunTest(order[i], &result);
+        psiReportTestResult(order[i], &result);
+    }
+}
+
+/**
+    Timing Cache (`--timing-cache=<file>`)
+    One line per test: how long it took to run (in ns), a space, and its name. Tests that didn't run this time
+    (because of `--filter`, for example) keep the timing recorded for them earlier.
+*/
+typedef struct psiTestHashStruct {
+    psi_u64 hash;
+    psi_ull index;
+} psiTestHashStruct;
+
+// FNV-1a
+static psi_u64 psiHashString(const char* str) {
+    psi_u64 hash = PSI_CAST(psi_u64, 14695981039346656037ULL);
+    for(; *str; str++) {
+        hash ^= PSI_CAST(unsigned char, *str);
+        hash *= PSI_CAST(psi_u64, 1099511628211ULL);
+    }
+    return hash;
+}
+
+static int psiCompareTestHashes(const void* const lhs, const void* const rhs) {
+    const psi_u64 a = PSI_CAST(const psiTestHashStruct*, lhs)->hash;
+    const psi_u64 b = PSI_CAST(const psiTestHashStruct*, rhs)->hash;
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+// Returns the index of the registered test called `name`, or `psiTestContext.numTestSuites` if there's none.
+// `hashes` holds the hash of every registered test's name, sorted.
+static psi_ull psiFindTest(const psiTestHashStruct* const hashes, const char* const name) {
+    const psi_u64 hash = psiHashString(name);
+    psi_ull lo = 0;
+    psi_ull hi = psiTestContext.numTestSuites;
+    while(lo < hi) {
+        const psi_ull mid = lo + (hi - lo) / 2;
+        if(hashes[mid].hash < hash)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    for(; lo < psiTestContext.numTestSuites && hashes[lo].hash == hash; lo++) {
+        if(strcmp(psiTestContext.tests[hashes[lo].index].name, name) == 0)
+            return hashes[lo].index;
+    }
+    return psiTestContext.numTestSuites;
+}
+
+// Reads a line (without its line ending) into `line`. Returns false at the end of the file.
+static psi_bool psiReadLine(FILE* const file, psiBufferStruct* const line) {
+    line->size = 0;
+    for(;;) {
+        if(line->capacity - line->size < 256) {
+            line->capacity = line->capacity * 2 + 256;
+            line->data = PSI_PTRCAST(char*, psi_realloc(line->data, line->capacity));
+        }
+        if(PSI_NONE(fgets(line->data + line->size, PSI_CAST(int, line->capacity - line->size), file)))
+            return line->size > 0;
+
+        line->size += strlen(line->data + line->size);
+        if(line->size > 0 && line->data[line->size - 1] == '\n') {
+            line->data[--line->size] = '\0';
+            if(line->size > 0 && line->data[line->size - 1] == '\r')
+                line->data[--line->size] = '\0';
+            return psi_true;
+        }
+    }
+}
+
+// Returns the duration recorded in the cache for every registered test (< 0 if there's none)
+static double* psiLoadTimingCache(const char* const path) {
+    double* const durations = PSI_PTRCAST(double*, malloc(sizeof(double) * (psiTestContext.numTestSuites + 1)));
+    for(psi_ull i = 0; i < psiTestContext.numTestSuites; i++)
+        durations[i] = -1;
+
+    FILE* const file = psi_fopen(path, "r");
+    if(PSI_NONE(file))
+        return durations;
+
+    psiTestHashStruct* const hashes = PSI_PTRCAST(psiTestHashStruct*,
+                                            malloc(sizeof(psiTestHashStruct) * (psiTestContext.numTestSuites + 1)));
+    for(psi_ull i = 0; i < psiTestContext.numTestSuites; i++) {
+        hashes[i].hash = psiHashString(psiTestContext.tests[i].name);
+        hashes[i].index = i;
+    }
+    qsort(hashes, psiTestContext.numTestSuites, sizeof(psiTestHashStruct), psiCompareTestHashes);
+
+    psiBufferStruct line = {PSI_NULL, 0, 0};
+    while(psiReadLine(file, &line)) {
+        char* name = PSI_NULL;
+        const double duration = strtod(line.data, &name);
+        if(name == line.data || *name != ' ' || duration < 0)
+            continue;
+
+        const psi_ull index = psiFindTest(hashes, name + 1);
+        if(index < psiTestContext.numTestSuites)
+            durations[index] = duration;
+    }
+
+    free(line.data);
+    free(hashes);
+    fclose(file);
+    return durations;
+}
+
+static void psiSaveTimingCache(const char* const path, const double* const cached) {
+    FILE* const file = psi_fopen(path, "w");
+    if(PSI_NONE(file)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+        psiTerminalPrintf("Could not write the timing cache to %s\n", path);
+        return;
+    }
+
+    for(psi_ull i = 0; i < psiTestContext.numTestSuites; i++) {
+        const double duration = psiStatsTestDurations[i] >= 0 ? psiStatsTestDurations[i] : cached[i];
+        if(duration >= 0)
+            fprintf(file, "%.0f %s\n", duration, psiTestContext.tests[i].name);
+    }
+    fclose(file);
+}
+
+/**
+    Sharding (`--shard-index=I --shard-count=N`)
+    By default a test belongs to shard `hash(name) % N`, so every test stays in the same shard no matter what
+    gets added or removed around it.
+    With `--shard-balance`, the tests with a recorded duration are instead handed out longest first, each to the
+    shard with the least work so far. Every shard has to read the same timing cache for this to be consistent.
+    Tests without a recorded duration still go by their hash, and count as an average test.
+*/
+typedef struct psiShardEntryStruct {
+    double duration;
+    psi_ull index;
+    const char* name;
+} psiShardEntryStruct;
+
+// Longest first. Ties are broken by name, which doesn't depend on the order the tests were registered in.
+static int psiCompareShardEntries(const void* const lhs, const void* const rhs) {
+    const psiShardEntryStruct* const a = PSI_CAST(const psiShardEntryStruct*, lhs);
+    const psiShardEntryStruct* const b = PSI_CAST(const psiShardEntryStruct*, rhs);
+    if(a->duration != b->duration)
+        return a->duration > b->duration ? -1 : 1;
+    return strcmp(a->name, b->name);
+}
+
+/**
+    Sets `isInShard[i]` for each of the `numTests` tests: whether it belongs to shard `shardIndex` of
+    `shardCount`. `durations` (< 0 where unknown) balances the shards; without them, it's by hash alone.
+*/
+static void psiShardTests_(const psiTestSuiteStruct* const tests, const psi_ull numTests,
+                           const double* const durations, const psi_ull shardCount, const psi_ull shardIndex,
+                           char* const isInShard) {
+    if(PSI_NONE(durations)) {
+        for(psi_ull i = 0; i < numTests; i++)
+            isInShard[i] = psiHashString(tests[i].name) % shardCount == shardIndex;
+        return;
+    }
+
+    double* const load = PSI_PTRCAST(double*, calloc(shardCount, sizeof(double)));
+    psiShardEntryStruct* const known = PSI_PTRCAST(psiShardEntryStruct*,
+                                              malloc(sizeof(psiShardEntryStruct) * (numTests + 1)));
+    psi_ull numKnown = 0;
+    double totalKnown = 0;
+
+    for(psi_ull i = 0; i < numTests; i++) {
+        if(durations[i] >= 0) {
+            known[numKnown].duration = durations[i];
+            known[numKnown].name = tests[i].name;
+            known[numKnown++].index = i;
+            totalKnown += durations[i];
+        }
+    }
+    qsort(known, numKnown, sizeof(psiShardEntryStruct), psiCompareShardEntries);
+
+    for(psi_ull i = 0; i < numTests; i++) {
+        if(durations[i] < 0) {
+            const psi_ull shard = psiHashString(tests[i].name) % shardCount;
+            load[shard] += numKnown > 0 ? totalKnown / PSI_CAST(double, numKnown) : 1;
+            isInShard[i] = shard == shardIndex;
+        }
+    }
+
+    for(psi_ull i = 0; i < numKnown; i++) {
+        psi_ull shard = 0;
+        for(psi_ull s = 1; s < shardCount; s++) {
+            if(load[s] < load[shard])
+                shard = s;
+        }
+        load[shard] += known[i].duration;
+        isInShard[known[i].index] = shard == shardIndex;
+    }
+
+    free(known);
+    free(load);
+}
+
+static void psiAssignShards() {
+    psiIsInShard = PSI_PTRCAST(char*, malloc(psiTestContext.numTestSuites + 1));
+    psiShardTests_(psiTestContext.tests, psiTestContext.numTestSuites, psiShardBalance ? psiCachedDurations : PSI_NULL,
+                   psiShardCount, psiShardIndex, psiIsInShard);
+}
+
+// Whether the test passes `--filter` and is in this run's shard
+static psi_bool psiShouldRunTest(const psi_ull index) {
+    if(psiTestContext.fuzzTarget)
+        return strcmp(psiTestContext.tests[index].name, psiTestContext.fuzzTarget) == 0;
+    return !psiShouldFilterTest(cmd_filter, psiTestContext.tests[index].name) &&
+           (PSI_NONE(psiIsInShard) || psiIsInShard[index]);
+}
+
+typedef struct psiExpectedDurationStruct {
+    double duration;    // < 0 if unknown
+    psi_ull position;
+} psiExpectedDurationStruct;
+
+// Slowest first. Tests we know nothing about could be anything, so they go before all the others.
+static int psiCompareExpectedDurations(const void* const lhs, const void* const rhs) {
+    const psiExpectedDurationStruct* const a = PSI_CAST(const psiExpectedDurationStruct*, lhs);
+    const psiExpectedDurationStruct* const b = PSI_CAST(const psiExpectedDurationStruct*, rhs);
+    if(a->duration != b->duration) {
+        if(a->duration < 0 || b->duration < 0)
+            return a->duration < 0 ? -1 : 1;
+        return a->duration > b->duration ? -1 : 1;
+    }
+    return a->position < b->position ? -1 : (a->position > b->position ? 1 : 0);
+}
+
+/**
+    Work Scheduler (used by both parallel runners)
+    The tests are dealt out slowest-first, round-robin, into one contiguous range of `schedule` per worker, so
+    every worker starts on one of the longest tests. A worker runs its own range front to back; once it's empty,
+    it steals the back half of the fullest range left.
+    Each range is a single 64-bit word (`head << 32 | tail`), so taking a test and stealing are both a single
+    compare-and-swap. That keeps working across `fork()`, as long as `ranges` lives in shared memory.
+*/
+#define PSI_RANGE_(head, tail)      ((PSI_CAST(psi_u64, head) << 32) | PSI_CAST(psi_u64, tail))
+#define PSI_RANGE_HEAD_(range)      PSI_CAST(psi_ull, (range) >> 32)
+#define PSI_RANGE_TAIL_(range)      PSI_CAST(psi_ull, (range) & 0xFFFFFFFFu)
+
+typedef struct psiSchedulerStruct {
+    const psi_ull* schedule;    // Positions in the run order, grouped by worker
+    psi_ull numWorkers;
+    psi_u64* ranges;            // Per worker: the part of `schedule` it has yet to run
+} psiSchedulerStruct;
+
+// `byDuration` holds the positions in the run order, slowest test first
+static void psiSchedulerInit(psiSchedulerStruct* const scheduler, psi_ull* const schedule, psi_u64* const ranges,
+                             const psi_ull* const byDuration, const psi_ull numTests, const psi_ull numWorkers) {
+    psi_ull next = 0;
+    for(psi_ull w = 0; w < numWorkers; w++) {
+        const psi_ull head = next;
+        for(psi_ull i = w; i < numTests; i += numWorkers)
+            schedule[next++] = byDuration[i];
+        ranges[w] = PSI_RANGE_(head, next);
+    }
+
+    scheduler->schedule = schedule;
+    scheduler->numWorkers = numWorkers;
+    scheduler->ranges = ranges;
+}
+
+// Claims the next test for `worker`, returning its position in the run order through `position`.
+// Returns false once there's nothing left to run (or steal).
+static psi_bool psiSchedulerNext(psiSchedulerStruct* const scheduler, const psi_ull worker, psi_ull* const position) {
+    for(;;) {
+        const psi_u64 own = PSI_ATOMIC_LOAD(&scheduler->ranges[worker]);
+        const psi_ull head = PSI_RANGE_HEAD_(own);
+        const psi_ull tail = PSI_RANGE_TAIL_(own);
+        if(head < tail) {
+            if(PSI_ATOMIC_CAS(&scheduler->ranges[worker], own, PSI_RANGE_(head + 1, tail))) {
+                *position = scheduler->schedule[head];
+                return psi_true;
+            }
+            continue;
+        }
+
+        psi_ull victim = worker;
+        psi_ull victimSize = 0;
+        psi_u64 range = 0;
+        for(psi_ull w = 0; w < scheduler->numWorkers; w++) {
+            const psi_u64 r = PSI_ATOMIC_LOAD(&scheduler->ranges[w]);
+            if(PSI_RANGE_HEAD_(r) < PSI_RANGE_TAIL_(r) && PSI_RANGE_TAIL_(r) - PSI_RANGE_HEAD_(r) > victimSize) {
+                victim = w;
+                victimSize = PSI_RANGE_TAIL_(r) - PSI_RANGE_HEAD_(r);
+                range = r;
+            }
+        }
+        if(victimSize == 0)
+            return psi_false;
+
+        const psi_ull split = PSI_RANGE_TAIL_(range) - (victimSize + 1) / 2;
+        if(!PSI_ATOMIC_CAS(&scheduler->ranges[victim], range, PSI_RANGE_(PSI_RANGE_HEAD_(range), split)))
+            continue;
+
+        // [split, tail) is ours now. Nobody steals from an empty range, so a plain store is enough to publish it.
+        PSI_ATOMIC_STORE(&scheduler->ranges[worker], PSI_RANGE_(split + 1, PSI_RANGE_TAIL_(range)));
+        *position = scheduler->schedule[split];
+        return psi_true;
+    }
+}
+
+static psi_bool psiSchedulerHasWork(psiSchedulerStruct* const scheduler) {
+    for(psi_ull w = 0; w < scheduler->numWorkers; w++) {
+        const psi_u64 range = PSI_ATOMIC_LOAD(&scheduler->ranges[w]);
+        if(PSI_RANGE_HEAD_(range) < PSI_RANGE_TAIL_(range))
+            return psi_true;
+    }
+    return psi_false;
+}
+
+#ifdef PSI_UNIX_
+/**
+    Parallel Runner (`--jobs=N`)
+    The parent forks N worker processes. Each worker repeatedly claims a test from the scheduler, which lives in
+    memory shared with the parent, runs it with its stdout redirected to a scratch file, and sends the result (and
+    whatever the test printed) back over a pipe.
+    The parent prints the results strictly in registration order, so the log looks the same as a serial run.
+    If a worker dies while running a test (a crash, a call to `exit()`, ...), that test is reported as failed and
+    a fresh worker takes over the rest of its range.
+*/
+typedef struct psiWorkQueueStruct {
+    psiSchedulerStruct scheduler;
+    psi_ull* running;    // Per worker: (position + 1) of the test it is currently running, 0 if idle (shared)
+} psiWorkQueueStruct;
+
+// Sent by a worker after each test, followed by `outputSize` bytes of captured output and `reportSize` bytes of
+// report text
+typedef struct psiWorkerMessageStruct {
+    psi_ull position;
+    psi_ull worker;
+    int hasFailed;
+    psi_u64 duration;
+    psi_u64 startTime;
+    psi_u64 endTime;
+    psi_u64 failureTimes[PSI_MAX_TRACE_FAILURES_];
+    psi_ull numFailureTimes;
+    int hasPerfCounts;
+    psi_u64 perfCounts[PSI_MAX_PERF_COUNTERS_];
+    int hasAllocStats;
+    psiAllocStatsStruct allocStats;
+    int hasUsage;
+    psiUsageStruct usage;
+    psi_u64 numWarnings;
+    psi_ull outputSize;
+    psi_ull reportSize;
+} psiWorkerMessageStruct;
+
+typedef struct psiWorkerStruct {
+    pid_t pid;
+    int fd;             // Read end of the worker's result pipe (-1 once the worker has exited)
+    char* buffer;       // Bytes received from the worker that don't yet form a complete message
+    psi_ull size;
+    psi_ull capacity;
+} psiWorkerStruct;
+
+static int psiWriteAll(const int fd, const void* const data, psi_ull size) {
+    const char* curr = PSI_CAST(const char*, data);
+    while(size > 0) {
+        const ssize_t n = write(fd, curr, size);
+        if(n < 0) {
+            if(errno == EINTR)
+                continue;
+            return 0;
+        }
+        curr += n;
+        size -= PSI_CAST(psi_ull, n);
+    }
+    return 1;
+}
+
+static void psiWorkerMain(const psi_ull worker, psiWorkQueueStruct* const queue, const psi_ull* const order,
+                          const int fd) {
+    FILE* const capture = tmpfile();
+    char* output = PSI_NULL;
+    psi_ull outputCapacity = 0;
+    psiBufferStruct report = {PSI_NULL, 0, 0};
+
+    if(PSI_NONE(capture) || dup2(fileno(capture), STDOUT_FILENO) < 0)
+        _exit(1);
+
+    // The parent owns the XUnit file: it gets the report text along with the result
+    psiTestContext.foutput = PSI_NULL;
+    psiThreadContext.captureReport = &report;
+    // Counters opened by the parent count the parent: this process needs its own
+    psiPerfClose();
+
+    psi_ull position;
+    while(psiSchedulerNext(&queue->scheduler, worker, &position)) {
+        PSI_ATOMIC_STORE(&queue->running[worker], position + 1);
+
+        if(ftruncate(STDOUT_FILENO, 0) != 0 || lseek(STDOUT_FILENO, 0, SEEK_SET) != 0)
+            _exit(1);
+        report.size = 0;
+
+        const psi_u64 numWarnings = psiStatsNumWarnings;
+        psiTestResultStruct result;
+        psiRunTest(order[position], &result);
+        psiFlushOutput();
+
+        psiWorkerMessageStruct message;
+        message.position = position;
+        message.worker = worker + 1;
+        message.hasFailed = result.hasFailed;
+        message.duration = result.duration;
+        message.startTime = result.startTime;
+        message.endTime = result.endTime;
+        memcpy(message.failureTimes, result.failureTimes, sizeof(message.failureTimes));
+        message.numFailureTimes = result.numFailureTimes;
+        message.hasPerfCounts = result.hasPerfCounts;
+        memcpy(message.perfCounts, result.perfCounts, sizeof(message.perfCounts));
+        message.hasAllocStats = result.hasAllocStats;
+        message.allocStats = result.allocStats;
+        message.hasUsage = result.hasUsage;
+        message.usage = result.usage;
+        message.numWarnings = psiStatsNumWarnings - numWarnings;
+        message.outputSize = PSI_CAST(psi_ull, lseek(STDOUT_FILENO, 0, SEEK_CUR));
+        message.reportSize = report.size;
+
+        if(message.outputSize > outputCapacity) {
+            outputCapacity = message.outputSize;
+            output = PSI_PTRCAST(char*, psi_realloc(output, outputCapacity));
+        }
+        if(message.outputSize > 0 &&
+           pread(STDOUT_FILENO, output, message.outputSize, 0) != PSI_CAST(ssize_t, message.outputSize))
+            _exit(1);
+
+        if(!psiWriteAll(fd, &message, sizeof(message)) || !psiWriteAll(fd, output, message.outputSize) ||
+           !psiWriteAll(fd, report.data, message.reportSize))
+            _exit(1);
+        PSI_ATOMIC_STORE(&queue->running[worker], 0);
+    }
+
+    _exit(0);
+}
+
+static psi_bool psiSpawnWorker(psiWorkerStruct* const workers, const psi_ull worker, psiWorkQueueStruct* const queue,
+                               const psi_ull* const order) {
+    int fds[2];
+    if(pipe(fds) != 0)
+        return psi_false;
+
+    // Anything still pending (or sitting in stdio's buffers) would otherwise be printed by the worker too
+    psiFlushOutput();
+
+    const pid_t pid = fork();
+    if(pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return psi_false;
+    }
+
+    if(pid == 0) {
+        close(fds[0]);
+        psiWorkerMain(worker, queue, order, fds[1]);
+    }
+
+    close(fds[1]);
+    workers[worker].pid = pid;
+    workers[worker].fd = fds[0];
+    workers[worker].size = 0;
+    return psi_true;
+}
+
+// Parses every complete message in the worker's buffer into `results`
+static void psiCollectWorkerMessages(psiWorkerStruct* const worker, psiTestResultStruct* const results,
+                                     char* const isComplete) {
+    psi_ull consumed = 0;
+    while(worker->size - consumed >= sizeof(psiWorkerMessageStruct)) {
+        psiWorkerMessageStruct message;
+        memcpy(&message, worker->buffer + consumed, sizeof(message));
+        if(worker->size - consumed - sizeof(message) < message.outputSize + message.reportSize)
+            break;
+
+        psiTestResultStruct* const result = &results[message.position];
+        result->hasFailed = message.hasFailed;
+        result->duration = message.duration;
+        result->startTime = message.startTime;
+        result->endTime = message.endTime;
+        result->worker = message.worker;
+        memcpy(result->failureTimes, message.failureTimes, sizeof(result->failureTimes));
+        result->numFailureTimes = message.numFailureTimes;
+        result->hasPerfCounts = message.hasPerfCounts;
+        memcpy(result->perfCounts, message.perfCounts, sizeof(result->perfCounts));
+        result->hasAllocStats = message.hasAllocStats;
+        result->allocStats = message.allocStats;
+        result->hasUsage = message.hasUsage;
+        result->usage = message.usage;
+        result->outputSize = message.outputSize;
+        psiStatsNumWarnings += message.numWarnings;
+        result->output = PSI_PTRCAST(char*, malloc(message.outputSize + 1));
+        memcpy(result->output, worker->buffer + consumed + sizeof(message), message.outputSize);
+        result->reportSize = message.reportSize;
+        result->report = PSI_PTRCAST(char*, malloc(message.reportSize + 1));
+        memcpy(result->report, worker->buffer + consumed + sizeof(message) + message.outputSize, message.reportSize);
+        isComplete[message.position] = 1;
+
+        consumed += sizeof(message) + message.outputSize + message.reportSize;
+    }
+
+    memmove(worker->buffer, worker->buffer + consumed, worker->size - consumed);
+    worker->size -= consumed;
+}
+
+// Marks the test a dead worker was running (if any) as failed
+static void psiReportWorkerDeath(const psi_ull position, const int status, psiTestResultStruct* const results,
+                                 char* const isComplete) {
+    char message[128];
+    if(WIFSIGNALED(status))
+        PSI_SNPRINTF(message, sizeof(message), "Worker process terminated by signal %d while running this test\n",
+                     WTERMSIG(status));
+    else
+        PSI_SNPRINTF(message, sizeof(message), "Worker process exited with status %d while running this test\n",
+                     WEXITSTATUS(status));
+
+    results[position].hasFailed = 1;
+    results[position].duration = 0;
+    results[position].outputSize = strlen(message);
+    results[position].output = PSI_PTRCAST(char*, malloc(results[position].outputSize + 1));
+    memcpy(results[position].output, message, results[position].outputSize);
+    results[position].report = PSI_NULL;
+    results[position].reportSize = 0;
+    isComplete[position] = 1;
+}
+
+static void psiRunTestsInWorkers(const psi_ull* const order, const psi_ull* const byDuration, const psi_ull numTests) {
+    const psi_ull numWorkers = psiNumJobs < numTests ? psiNumJobs : numTests;
+    const psi_ull sharedSize = (sizeof(psi_u64) + sizeof(psi_ull)) * numWorkers;
+    void* const shared = mmap(PSI_NULL, sharedSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if(shared == MAP_FAILED) {
+        psiRunTestsSerially(order, numTests);
+        return;
+    }
+    memset(shared, 0, sharedSize);
+
+    psiWorkQueueStruct workQueue;
+    psiWorkQueueStruct* const queue = &workQueue;
+    psi_ull* const schedule = PSI_PTRCAST(psi_ull*, malloc(sizeof(psi_ull) * numTests));
+    psi_u64* const ranges = PSI_PTRCAST(psi_u64*, shared);
+    psiSchedulerInit(&queue->scheduler, schedule, ranges, byDuration, numTests, numWorkers);
+    queue->running = PSI_PTRCAST(psi_ull*, ranges + numWorkers);
+
+    psiTestResultStruct* const results = PSI_PTRCAST(psiTestResultStruct*,
+                                                calloc(numTests, sizeof(psiTestResultStruct)));
+    char* const isComplete = PSI_PTRCAST(char*, calloc(numTests, 1));
+    psiWorkerStruct* const workers = PSI_PTRCAST(psiWorkerStruct*, calloc(numWorkers, sizeof(psiWorkerStruct)));
+    struct pollfd* const fds = PSI_PTRCAST(struct pollfd*, calloc(numWorkers, sizeof(struct pollfd)));
+    psi_ull* const fdWorkers = PSI_PTRCAST(psi_ull*, calloc(numWorkers, sizeof(psi_ull)));
+    psi_ull numAlive = 0;
+    psi_ull nextToReport = 0;
+
+    for(psi_ull w = 0; w < numWorkers; w++) {
+        workers[w].fd = -1;
+        if(psiSpawnWorker(workers, w, queue, order))
+            numAlive++;
+    }
+
+    while(numAlive > 0) {
+        nfds_t numFds = 0;
+        for(psi_ull w = 0; w < numWorkers; w++) {
+            if(workers[w].fd >= 0) {
+                fds[numFds].fd = workers[w].fd;
+                fds[numFds].events = POLLIN;
+                fds[numFds].revents = 0;
+                fdWorkers[numFds++] = w;
+            }
+        }
+
+        if(poll(fds, numFds, -1) < 0) {
+            if(errno == EINTR)
+                continue;
+            break;
+        }
+
+        for(nfds_t f = 0; f < numFds; f++) {
+            psiWorkerStruct* const worker = &workers[fdWorkers[f]];
+            if(fds[f].revents == 0)
+                continue;
+
+            if(worker->capacity - worker->size < 65536) {
+                worker->capacity = worker->capacity * 2 + 65536;
+                worker->buffer = PSI_PTRCAST(char*, psi_realloc(worker->buffer, worker->capacity));
+            }
+
+            const ssize_t n = read(worker->fd, worker->buffer + worker->size, worker->capacity - worker->size);
+            if(n > 0) {
+                worker->size += PSI_CAST(psi_ull, n);
+                psiCollectWorkerMessages(worker, results, isComplete);
+                continue;
+            }
+            if(n < 0 && errno == EINTR)
+                continue;
+
+            // The worker closed its pipe - it either ran out of tests or died
+            int status = 0;
+            const psi_ull w = fdWorkers[f];
+            const psi_ull running = PSI_ATOMIC_LOAD(&queue->running[w]);
+            close(worker->fd);
+            worker->fd = -1;
+            numAlive--;
+            waitpid(worker->pid, &status, 0);
+
+            if(running != 0) {
+                psiReportWorkerDeath(running - 1, status, results, isComplete);
+                PSI_ATOMIC_STORE(&queue->running[w], 0);
+
+                if(psiSchedulerHasWork(&queue->scheduler) && psiSpawnWorker(workers, w, queue, order))
+                    numAlive++;
+            }
+        }
+
+        while(nextToReport < numTests && isComplete[nextToReport]) {
+            psiReportCapturedTestResult(order[nextToReport], &results[nextToReport]);
+            nextToReport++;
+        }
+    }
+
+    // Whatever could not be handed to a worker (e.g. `fork()` failed) is run in-process
+    for(; nextToReport < numTests; nextToReport++) {
+        if(isComplete[nextToReport]) {
+            psiReportCapturedTestResult(order[nextToReport], &results[nextToReport]);
+        } else {
+            psiTestResultStruct result;
+            psiPrintTestStart(order[nextToReport]);
+            psiRunTest(order[nextToReport], &result);
+            psiReportTestResult(order[nextToReport], &result);
+        }
+    }
+
+    for(psi_ull w = 0; w < numWorkers; w++)
+        free(workers[w].buffer);
+    free(fdWorkers);
+    free(fds);
+    free(workers);
+    free(isComplete);
+    free(results);
+    free(schedule);
+    munmap(shared, sharedSize);
+}
+#endif // PSI_UNIX_
+
+#if defined(PSI_UNIX_) || defined(PSI_WIN_)
+    #define PSI_HAS_THREADS_    1
+
+    #if defined(PSI_WIN_)
+        typedef HANDLE                  psi_thread_t;
+        typedef CRITICAL_SECTION        psi_mutex_t;
+        typedef CONDITION_VARIABLE      psi_cond_t;
+        #define PSI_THREAD_FUNC(name, arg)      static DWORD WINAPI name(LPVOID arg)
+        #define PSI_THREAD_RETURN               return 0
+
+        static psi_bool psiThreadCreate(psi_thread_t* const thread, LPTHREAD_START_ROUTINE func, void* const arg) {
+            *thread = CreateThread(PSI_NULL, 0, func, arg, 0, PSI_NULL);
+            return *thread != PSI_NULL;
+        }
+        static void psiThreadJoin(psi_thread_t thread) { WaitForSingleObject(thread, INFINITE); CloseHandle(thread); }
+        static void psiMutexInit(psi_mutex_t* const mutex) { InitializeCriticalSection(mutex); }
+        static void psiMutexDestroy(psi_mutex_t* const mutex) { DeleteCriticalSection(mutex); }
+        static void psiMutexLock(psi_mutex_t* const mutex) { EnterCriticalSection(mutex); }
+        static void psiMutexUnlock(psi_mutex_t* const mutex) { LeaveCriticalSection(mutex); }
+        static void psiCondInit(psi_cond_t* const cond) { InitializeConditionVariable(cond); }
+        static void psiCondDestroy(psi_cond_t* const cond) { (void)cond; }
+        static void psiCondWait(psi_cond_t* const cond, psi_mutex_t* const mutex) {
+            SleepConditionVariableCS(cond, mutex, INFINITE);
+        }
+        static void psiCondBroadcast(psi_cond_t* const cond) { WakeAllConditionVariable(cond); }
+    #else
+        typedef pthread_t               psi_thread_t;
+        typedef pthread_mutex_t         psi_mutex_t;
+        typedef pthread_cond_t          psi_cond_t;
+        #define PSI_THREAD_FUNC(name, arg)      static void* name(void* arg)
+        #define PSI_THREAD_RETURN               return PSI_NULL
+
+        static psi_bool psiThreadCreate(psi_thread_t* const thread, void* (*func)(void*), void* const arg) {
+            return pthread_create(thread, PSI_NULL, func, arg) == 0;
+        }
+        static void psiThreadJoin(psi_thread_t thread) { pthread_join(thread, PSI_NULL); }
+        static void psiMutexInit(psi_mutex_t* const mutex) { pthread_mutex_init(mutex, PSI_NULL); }
+        static void psiMutexDestroy(psi_mutex_t* const mutex) { pthread_mutex_destroy(mutex); }
+        static void psiMutexLock(psi_mutex_t* const mutex) { pthread_mutex_lock(mutex); }
+        static void psiMutexUnlock(psi_mutex_t* const mutex) { pthread_mutex_unlock(mutex); }
+        static void psiCondInit(psi_cond_t* const cond) { pthread_cond_init(cond, PSI_NULL); }
+        static void psiCondDestroy(psi_cond_t* const cond) { pthread_cond_destroy(cond); }
+        static void psiCondWait(psi_cond_t* const cond, psi_mutex_t* const mutex) { pthread_cond_wait(cond, mutex); }
+        static void psiCondBroadcast(psi_cond_t* const cond) { pthread_cond_broadcast(cond); }
+    #endif // PSI_WIN_
+
+/**
+    Threaded Runner (`--jobs=N --threads`)
+    Like the forked runner, but the workers are threads of this process, so there's no `fork()` per worker and no
+    pipe traffic per test. The workers share the same scheduler, and Psi's own output (assertion failures,
+    warnings, ...) is captured per thread through `psiThreadContext`.
+    Tests must be thread-safe to run this way. Anything they print with plain `printf` goes straight to stdout,
+    and a crashing test takes the whole run down with it.
+*/
+typedef struct psiThreadPoolStruct {
+    const psi_ull* order;
+    psiSchedulerStruct scheduler;
+    psiTestResultStruct* results;
+    char* isComplete;           // Guarded by `mutex`
+    psi_mutex_t mutex;
+    psi_cond_t completed;       // Signalled every time a result is stored
+} psiThreadPoolStruct;
+
+typedef struct psiThreadWorkerStruct {
+    psiThreadPoolStruct* pool;
+    psi_ull worker;
+} psiThreadWorkerStruct;
+
+PSI_THREAD_FUNC(psiThreadWorkerMain, arg) {
+    psiThreadPoolStruct* const pool = PSI_PTRCAST(psiThreadWorkerStruct*, arg)->pool;
+    const psi_ull worker = PSI_PTRCAST(psiThreadWorkerStruct*, arg)->worker;
+    psiBufferStruct capture = {PSI_NULL, 0, 0};
+    psiBufferStruct report = {PSI_NULL, 0, 0};
+    psiThreadContext.capture = &capture;
+    psiThreadContext.captureReport = &report;
+
+    psi_ull position;
+    while(psiSchedulerNext(&pool->scheduler, worker, &position)) {
+        psiTestResultStruct result;
+        capture.size = 0;
+        report.size = 0;
+        psiRunTest(pool->order[position], &result);
+        result.worker = worker + 1;
+        result.outputSize = capture.size;
+        result.output = PSI_PTRCAST(char*, malloc(capture.size + 1));
+        memcpy(result.output, capture.data, capture.size);
+        result.reportSize = report.size;
+        result.report = PSI_PTRCAST(char*, malloc(report.size + 1));
+        memcpy(result.report, report.data, report.size);
+
+        psiMutexLock(&pool->mutex);
+        pool->results[position] = result;
+        pool->isComplete[position] = 1;
+        psiCondBroadcast(&pool->completed);
+        psiMutexUnlock(&pool->mutex);
+    }
+
+    psiThreadContext.capture = PSI_NULL;
+    psiThreadContext.captureReport = PSI_NULL;
+    free(capture.data);
+    free(report.data);
+    psiPerfClose();
+    PSI_THREAD_RETURN;
+}
+
+static void psiRunTestsInThreads(const psi_ull* const order, const psi_ull* const byDuration, const psi_ull numTests) {
+    const psi_ull numWorkers = psiNumJobs < numTests ? psiNumJobs : numTests;
+    psi_thread_t* const threads = PSI_PTRCAST(psi_thread_t*, calloc(numWorkers, sizeof(psi_thread_t)));
+    psiThreadWorkerStruct* const workers = PSI_PTRCAST(psiThreadWorkerStruct*,
+                                                  calloc(numWorkers, sizeof(psiThreadWorkerStruct)));
+    psi_ull* const schedule = PSI_PTRCAST(psi_ull*, malloc(sizeof(psi_ull) * numTests));
+    psi_u64* const ranges = PSI_PTRCAST(psi_u64*, calloc(numWorkers, sizeof(psi_u64)));
+    psi_ull numThreads = 0;
+    psiThreadPoolStruct pool;
+
+    // The CPU time of the whole process would include every other test running at the same time
+    if(psiTimer == PSI_TIMER_CPU_)
+        psiTimer = PSI_TIMER_THREAD_CPU_;
+
+    pool.order = order;
+    psiSchedulerInit(&pool.scheduler, schedule, ranges, byDuration, numTests, numWorkers);
+    pool.results = PSI_PTRCAST(psiTestResultStruct*, calloc(numTests, sizeof(psiTestResultStruct)));
+    pool.isComplete = PSI_PTRCAST(char*, calloc(numTests, 1));
+    psiMutexInit(&pool.mutex);
+    psiCondInit(&pool.completed);
+
+    // The header (and anything else pending) has to be out before a test's own prints can reach stdout
+    psiFlushOutput();
+
+    for(psi_ull w = 0; w < numWorkers; w++) {
+        workers[w].pool = &pool;
+        workers[w].worker = w;
+        if(psiThreadCreate(&threads[numThreads], psiThreadWorkerMain, &workers[w]))
+            numThreads++;
+    }
+
+    // If no thread could be started at all, run everything on this one (it steals every other worker's range)
+    if(numThreads == 0)
+        psiThreadWorkerMain(&workers[0]);
+
+    // Print the results in registration order as they come in
+    for(psi_ull nextToReport = 0; nextToReport < numTests; nextToReport++) {
+        psiMutexLock(&pool.mutex);
+        while(!pool.isComplete[nextToReport])
+            psiCondWait(&pool.completed, &pool.mutex);
+        psiMutexUnlock(&pool.mutex);
+
+        psiReportCapturedTestResult(order[nextToReport], &pool.results[nextToReport]);
+    }
+
+    for(psi_ull w = 0; w < numThreads; w++)
+        psiThreadJoin(threads[w]);
+
+    psiCondDestroy(&pool.completed);
+    psiMutexDestroy(&pool.mutex);
+    free(pool.isComplete);
+    free(pool.results);
+    free(ranges);
+    free(schedule);
+    free(workers);
+    free(threads);
+}
+#endif // PSI_UNIX_ || PSI_WIN_
+
+/**
+    Property-Based Tests
+    A `PROPERTY` is a test whose body runs for many random cases (`--property-cases`, 1000 by default). The body
+    draws its inputs from the generators below, and checks them with the usual `CHECK`s and `REQUIRE`s:
+
+        PROPERTY(Math, AdditionCommutes) {
+            const psi_i64 a = psiGenInt(-1000000, 1000000);
+            const psi_i64 b = psiGenInt(-1000000, 1000000);
+            CHECK_EQ(a + b, b + a);
+        }
+
+    Every value a case draws is recorded. Once a case fails, that record is shrunk - draws are removed, zeroed
+    and halved, for as long as the case keeps failing - and every generator turns smaller draws into simpler
+    values (closer to 0, shorter), so what's left is a minimal counterexample. Only that one is run with its
+    output shown. The seed printed next to it reproduces it with `--property-seed`.
+    The draws come from xoshiro256**, seeded per case with splitmix64. With `--property-threads=N`, the cases
+    and the shrinking candidates are tried on N threads at once - the body must then be thread-safe.
+*/
+#define PSI_PROPERTY_CASES_         1000
+// How many candidates shrinking tries at most, before settling for the smallest counterexample so far
+#define PSI_PROPERTY_MAX_SHRINKS_   10000
+// Added to the seed for every next case (the golden ratio, as in splitmix64)
+#define PSI_PROPERTY_SEED_STEP_     0x9E3779B97F4A7C15ull
+
+typedef struct psiRngStruct {
+    psi_u64 s[4];
+} psiRngStruct;
+
+static inline psi_u64 psiSplitMix64(psi_u64* const state) {
+    psi_u64 z = (*state += PSI_PROPERTY_SEED_STEP_);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static inline void psiRngSeed(psiRngStruct* const rng, psi_u64 seed) {
+    for(int i = 0; i < 4; i++)
+        rng->s[i] = psiSplitMix64(&seed);
+}
+
+// xoshiro256**
+static inline psi_u64 psiRngNext(psiRngStruct* const rng) {
+    psi_u64* const s = rng->s;
+    const psi_u64 x = s[1] * 5;
+    const psi_u64 result = ((x << 7) | (x >> 57)) * 9;
+    const psi_u64 t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+    return result;
+}
+
+typedef struct psiPropertyCaseStruct {
+    psiRngStruct rng;
+    // While shrinking, the draws to replay instead of drawing from `rng` (past their end, every draw is 0)
+    const psi_u64* replay;
+    psi_ull numReplay;
+    // Every draw the body made, in order
+    psi_u64* draws;
+    psi_ull numDraws;
+    psi_ull capacity;
+} psiPropertyCaseStruct;
+
+// A draw from 0 to `max`. Fresh draws hit 0, `max` and small values more often than chance would.
+static psi_u64 psiPropertyDraw_(const psi_u64 max) {
+    psiPropertyCaseStruct* const current = psiThreadContext.propertyCase;
+    psi_u64 value;
+    if(PSI_NONE(current))
+        return 0;
+
+    if(PSI_SOME(current->replay)) {
+        value = current->numDraws < current->numReplay ? current->replay[current->numDraws] : 0;
+    } else {
+        const psi_u64 kind = psiRngNext(&current->rng) & 15;
+        value = psiRngNext(&current->rng);
+        if(kind == 0)
+            value = 0;
+        else if(kind == 1)
+            value = max;
+        else if(kind < 5)
+            value &= 15;
+    }
+    if(max != ~PSI_CAST(psi_u64, 0))
+        value %= max + 1;
+
+    if(current->numDraws == current->capacity) {
+        const int isTracking = psiPauseAllocTracking_();
+        current->capacity = current->capacity * 2 + 64;
+        current->draws = PSI_PTRCAST(psi_u64*, psi_realloc(current->draws, sizeof(psi_u64) * current->capacity));
+        psiResumeAllocTracking_(isTracking);
+    }
+    current->draws[current->numDraws++] = value;
+    return value;
+}
+
+static inline int psiGenBool() {
+    return psiPropertyDraw_(1) != 0;
+}
+
+// An integer from `lo` to `hi` (inclusive), simplest closest to 0
+static psi_i64 psiGenInt(const psi_i64 lo, const psi_i64 hi) {
+    const psi_i64 low = lo < hi ? lo : hi;
+    const psi_i64 high = lo < hi ? hi : lo;
+    const psi_i64 origin = low > 0 ? low : (high < 0 ? high : 0);
+    // How far the range reaches above and below `origin`
+    const psi_u64 up = PSI_CAST(psi_u64, high) - PSI_CAST(psi_u64, origin);
+    const psi_u64 down = PSI_CAST(psi_u64, origin) - PSI_CAST(psi_u64, low);
+    const psi_u64 both = up < down ? up : down;
+    const psi_u64 k = psiPropertyDraw_(up + down);
+    psi_u64 offset;
+    int isUp;
+
+    // 0, 1, -1, 2, -2, ... for as long as both sides have room, then on along the longer side
+    if(k <= 2 * both) {
+        isUp = k % 2 == 1;
+        offset = isUp ? (k + 1) / 2 : k / 2;
+    } else {
+        isUp = up > down;
+        offset = k - both;
+    }
+    return PSI_CAST(psi_i64, isUp ? PSI_CAST(psi_u64, origin) + offset : PSI_CAST(psi_u64, origin) - offset);
+}
+
+// A floating-point number from `lo` to `hi` (inclusive), simplest closest to 0
+static double psiGenDouble(const double lo, const double hi) {
+    const double low = lo < hi ? lo : hi;
+    const double high = lo < hi ? hi : lo;
+    const psi_u64 steps = (PSI_CAST(psi_u64, 1) << 53) - 1;
+    if(low <= 0 && high >= 0) {
+        const psi_u64 k = psiPropertyDraw_(steps * 2 + 1);
+        const double fraction = PSI_CAST(double, (k >> 1)) / PSI_CAST(double, steps);
+        return k & 1 ? fraction * low : fraction * high;
+    } else {
+        const double origin = low > 0 ? low : high;
+        const double other = low > 0 ? high : low;
+        return origin + PSI_CAST(double, psiPropertyDraw_(steps)) / PSI_CAST(double, steps) * (other - origin);
+    }
+}
+
+// Fills `buffer` with `minSize` to `maxSize` random bytes, and returns how many
+static psi_ull psiGenBytes(unsigned char* const buffer, const psi_ull minSize, const psi_ull maxSize) {
+    const psi_ull size = minSize + PSI_CAST(psi_ull, psiPropertyDraw_(maxSize > minSize ? maxSize - minSize : 0));
+    for(psi_ull i = 0; i < size; i++)
+        buffer[i] = PSI_CAST(unsigned char, psiPropertyDraw_(255));
+    return size;
+}
+
+/**
+    Fills `buffer` (which must hold `maxLength + 1` characters) with a NUL-terminated string of `minLength` to
+    `maxLength` printable ASCII characters, and returns its length. Shrinks towards 'a's.
+*/
+static psi_ull psiGenString(char* const buffer, const psi_ull minLength, const psi_ull maxLength) {
+    static const char alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+                                   " !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+    const psi_ull length = minLength +
+                           PSI_CAST(psi_ull, psiPropertyDraw_(maxLength > minLength ? maxLength - minLength : 0));
+    for(psi_ull i = 0; i < length; i++)
+        buffer[i] = alphabet[psiPropertyDraw_(sizeof(alphabet) - 2)];
+    buffer[length] = PSI_NULLCHAR;
+    return length;
+}
+
+typedef struct psiPropertyRunStruct {
+    void (*body)(void);
+    psi_u64 seed;
+    psi_u64 numCases;
+    psi_ull numThreads;
+    // Exploring: the first case that failed (`numCases` while none has)
+    psi_u64 firstFailure;
+    // Shrinking: the current batch of candidates, and - per candidate - whether it failed, and what it drew
+    psi_u64** candidates;
+    psi_ull* candidateSizes;
+    psi_ull numCandidates;
+    char* hasFailed;
+    psiPropertyCaseStruct* results;
+    // What the threads do: explore, or try the batch of candidates
+    int isShrinking;
+    // Whether the test's allocations are counted: only while the body runs
+    int tracksAllocs;
+} psiPropertyRunStruct;
+
+// Runs one case of the body with its output thrown away, and returns whether it failed
+static int psiPropertyEvaluate_(const psiPropertyRunStruct* const run, psiPropertyCaseStruct* const current,
+                                psiBufferStruct* const scratch, const psi_u64 seed) {
+    psiBufferStruct* const capture = psiThreadContext.capture;
+    psiBufferStruct* const captureReport = psiThreadContext.captureReport;
+    int hasFailed;
+
+    psiRngSeed(&current->rng, seed);
+    current->numDraws = 0;
+    scratch->size = 0;
+    psiThreadContext.capture = scratch;
+    psiThreadContext.captureReport = PSI_NULL;
+    psiThreadContext.propertyCase = current;
+    psiThreadContext.hasCurrentTestFailed = 0;
+    psiThreadContext.shouldFailTest = 0;
+    psiThreadContext.shouldAbortTest = 0;
+
+    psiResumeAllocTracking_(run->tracksAllocs);
+    run->body();
+    psiPauseAllocTracking_();
+
+    hasFailed = psiThreadContext.hasCurrentTestFailed;
+    psiThreadContext.hasCurrentTestFailed = 0;
+    psiThreadContext.shouldFailTest = 0;
+    psiThreadContext.shouldAbortTest = 0;
+    psiThreadContext.propertyCase = PSI_NULL;
+    psiThreadContext.capture = capture;
+    psiThreadContext.captureReport = captureReport;
+    return hasFailed;
+}
+
+// The share of the exploring or shrinking that thread `thread` of `run->numThreads` does
+static void psiPropertyWork_(psiPropertyRunStruct* const run, const psi_ull thread) {
+    psiPropertyCaseStruct current;
+    psiBufferStruct scratch = {PSI_NULL, 0, 0};
+    memset(&current, 0, sizeof(current));
+
+    if(run->isShrinking) {
+        for(psi_ull i = thread; i < run->numCandidates; i += run->numThreads) {
+            psiPropertyCaseStruct* const result = &run->results[i];
+            result->replay = run->candidates[i];
+            result->numReplay = run->candidateSizes[i];
+            run->hasFailed[i] = PSI_CAST(char, psiPropertyEvaluate_(run, result, &scratch, 0));
+        }
+    } else {
+        // Every thread takes every `numThreads`th case, and stops at the first failure - or once another thread
+        // found an earlier one. So the failure found is always the first of them all, however the threads ran.
+        for(psi_u64 i = thread; i < run->numCases && i < PSI_ATOMIC_LOAD(&run->firstFailure); i += run->numThreads) {
+            if(psiPropertyEvaluate_(run, &current, &scratch, run->seed + i * PSI_PROPERTY_SEED_STEP_)) {
+                psi_u64 first = PSI_ATOMIC_LOAD(&run->firstFailure);
+                while(i < first && !PSI_ATOMIC_CAS(&run->firstFailure, first, i))
+                    first = PSI_ATOMIC_LOAD(&run->firstFailure);
+                break;
+            }
+        }
+    }
+
+    free(current.draws);
+    free(scratch.data);
+}
+
+#ifdef PSI_HAS_THREADS_
+typedef struct psiPropertyThreadStruct {
+    psiPropertyRunStruct* run;
+    psi_ull thread;
+} psiPropertyThreadStruct;
+
+PSI_THREAD_FUNC(psiPropertyThreadMain_, arg) {
+    psiPropertyThreadStruct* const self = PSI_PTRCAST(psiPropertyThreadStruct*, arg);
+    psiThreadContext.checkIsInsideTestSuite = 1;
+    psiPropertyWork_(self->run, self->thread);
+    psiThreadContext.checkIsInsideTestSuite = 0;
+    PSI_THREAD_RETURN;
+}
+#endif // PSI_HAS_THREADS_
+
+// Has `run->numThreads` threads (this one included) do their share
+static void psiPropertyRunThreads_(psiPropertyRunStruct* const run) {
+#ifdef PSI_HAS_THREADS_
+    psi_thread_t* const threads = PSI_PTRCAST(psi_thread_t*, calloc(run->numThreads, sizeof(psi_thread_t)));
+    psiPropertyThreadStruct* const args = PSI_PTRCAST(psiPropertyThreadStruct*,
+                                                      calloc(run->numThreads, sizeof(psiPropertyThreadStruct)));
+    char* const isRunning = PSI_PTRCAST(char*, calloc(run->numThreads, 1));
+    for(psi_ull t = 1; t < run->numThreads; t++) {
+        args[t].run = run;
+        args[t].thread = t;
+        isRunning[t] = PSI_CAST(char, psiThreadCreate(&threads[t], psiPropertyThreadMain_, &args[t]));
+    }
+    psiPropertyWork_(run, 0);
+    for(psi_ull t = 1; t < run->numThreads; t++) {
+        // A thread that couldn't be started leaves its share to this one
+        if(isRunning[t])
+            psiThreadJoin(threads[t]);
+        else
+            psiPropertyWork_(run, t);
+    }
+    free(isRunning);
+    free(args);
+    free(threads);
+#else
+    for(psi_ull t = 0; t < run->numThreads; t++)
+        psiPropertyWork_(run, t);
+#endif // PSI_HAS_THREADS_
+}
+
+// Shorter first, then lexicographically smaller
+static int psiPropertyIsSimpler_(const psi_u64* const a, const psi_ull aSize, const psi_u64* const b,
+                                 const psi_ull bSize) {
+    if(aSize != bSize)
+        return aSize < bSize;
+    for(psi_ull i = 0; i < aSize; i++) {
+        if(a[i] != b[i])
+            return a[i] < b[i];
+    }
+    return 0;
+}
+
+/**
+    The `index`th way of simplifying `draws`: deleting a run of 8, 4, 2 or 1 draws, zeroing such a run, and
+    lowering a single draw by a half, a quarter, an eighth, ... of itself, by 2 (which keeps the sign of what
+    `psiGenInt` makes of it) or by 1. The biggest steps come first, so a draw closes in on the boundary of what fails
+    in as many shrinks as it has bits. Writes it to `candidate` and returns 1, or returns 0 once there are no more.
+*/
+static int psiPropertyCandidate_(const psi_u64* const draws, const psi_ull numDraws, psi_ull index,
+                                 psi_u64* const candidate, psi_ull* const candidateSize) {
+    static const psi_ull chunks[] = {8, 4, 2, 1};
+    for(int pass = 0; pass < 2; pass++) {
+        for(int c = 0; c < 4; c++) {
+            const psi_ull size = chunks[c];
+            const psi_ull numPositions = numDraws >= size ? numDraws - size + 1 : 0;
+            if(index >= numPositions) {
+                index -= numPositions;
+                continue;
+            }
+            memcpy(candidate, draws, sizeof(psi_u64) * numDraws);
+            if(pass == 0) {
+                memmove(candidate + index, candidate + index + size, sizeof(psi_u64) * (numDraws - index - size));
+                *candidateSize = numDraws - size;
+            } else {
+                memset(candidate + index, 0, sizeof(psi_u64) * size);
+                *candidateSize = numDraws;
+            }
+            return 1;
+        }
+    }
+
+    for(psi_ull i = 0; i < numDraws; i++) {
+        const psi_u64 value = draws[i];
+        for(int shift = 1; shift < 66; shift++) {
+            // The halvings stop short of 2 and 1, which come last whatever the draw's size
+            const psi_u64 by = shift < 64 ? value >> shift : PSI_CAST(psi_u64, (66 - shift));
+            if(by > value || (shift < 64 && by <= 2))
+                continue;
+            if(index-- > 0)
+                continue;
+            memcpy(candidate, draws, sizeof(psi_u64) * numDraws);
+            candidate[i] = value - by;
+            *candidateSize = numDraws;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+    Shrinks the failing `*draws` for as long as one of its candidates still fails with fewer or smaller draws,
+    and returns how many times it did.
+*/
+static psi_u64 psiPropertyShrink_(psiPropertyRunStruct* const run, psi_u64** const draws, psi_ull* const numDraws) {
+    const psi_ull batchSize = run->numThreads * 8;
+    psi_u64 numShrinks = 0;
+    psi_u64 numTried = 0;
+    psi_ull next = 0;
+
+    run->isShrinking = 1;
+    run->candidates = PSI_PTRCAST(psi_u64**, calloc(batchSize, sizeof(psi_u64*)));
+    run->candidateSizes = PSI_PTRCAST(psi_ull*, calloc(batchSize, sizeof(psi_ull)));
+    run->hasFailed = PSI_PTRCAST(char*, calloc(batchSize, 1));
+    run->results = PSI_PTRCAST(psiPropertyCaseStruct*, calloc(batchSize, sizeof(psiPropertyCaseStruct)));
+
+    while(numTried < PSI_PROPERTY_MAX_SHRINKS_) {
+        psi_ull simplest = batchSize;
+        run->numCandidates = 0;
+        while(run->numCandidates < batchSize) {
+            const psi_ull i = run->numCandidates;
+            run->candidates[i] = PSI_PTRCAST(psi_u64*, psi_realloc(run->candidates[i], sizeof(psi_u64) * (*numDraws + 1)));
+            if(!psiPropertyCandidate_(*draws, *numDraws, next, run->candidates[i], &run->candidateSizes[i]))
+                break;
+            next++;
+            run->numCandidates++;
+        }
+        if(run->numCandidates == 0)
+            break;
+
+        numTried += run->numCandidates;
+        psiPropertyRunThreads_(run);
+
+        // The simplest of the candidates that failed with simpler draws than before (they may not have used all of
+        // them), rather than the first: that would take the smallest step whenever a batch holds a whole draw's steps
+        for(psi_ull i = 0; i < run->numCandidates; i++) {
+            const psi_u64* const best = simplest == batchSize ? *draws : run->results[simplest].draws;
+            const psi_ull numBest = simplest == batchSize ? *numDraws : run->results[simplest].numDraws;
+            if(run->hasFailed[i] && psiPropertyIsSimpler_(run->results[i].draws, run->results[i].numDraws,
+                                                           best, numBest))
+                simplest = i;
+        }
+        if(simplest == batchSize)
+            continue;
+
+        *numDraws = run->results[simplest].numDraws;
+        *draws = PSI_PTRCAST(psi_u64*, psi_realloc(*draws, sizeof(psi_u64) * (*numDraws + 1)));
+        if(*numDraws > 0)
+            memcpy(*draws, run->results[simplest].draws, sizeof(psi_u64) * *numDraws);
+        numShrinks++;
+        next = 0;
+    }
+
+    for(psi_ull i = 0; i < batchSize; i++) {
+        free(run->candidates[i]);
+        free(run->results[i].draws);
+    }
+    free(PSI_PTRCAST(void*, run->candidates));
+    free(run->candidateSizes);
+    free(run->hasFailed);
+    free(run->results);
+    return numShrinks;
+}
+
+// What `PROPERTY` runs as its test: tries the cases, and shrinks and shows the first one that fails
+static void psiRunProperty_(void (*body)(void)) {
+    psiPropertyRunStruct run;
+    psiPropertyCaseStruct current;
+    psiBufferStruct scratch = {PSI_NULL, 0, 0};
+    psi_u64 seed;
+    psi_u64 numShrinks;
+
+    memset(&run, 0, sizeof(run));
+    memset(&current, 0, sizeof(current));
+    run.body = body;
+    run.tracksAllocs = psiPauseAllocTracking_();
+    run.numCases = psiTestContext.propertyCases > 0 ? psiTestContext.propertyCases : PSI_PROPERTY_CASES_;
+    run.numThreads = psiTestContext.propertyThreads > 0 ? psiTestContext.propertyThreads : 1;
+    if(psiTestContext.hasPropertySeed) {
+        run.seed = psiTestContext.propertySeed;
+    } else {
+        psi_u64 entropy = psiClockRead(PSI_TIMER_REAL_) ^ PSI_PTRCAST(psi_uptr, &run);
+        run.seed = psiSplitMix64(&entropy);
+    }
+    run.firstFailure = run.numCases;
+    psiPropertyRunThreads_(&run);
+    if(run.firstFailure == run.numCases) {
+        psiResumeAllocTracking_(run.tracksAllocs);
+        return;
+    }
+
+    // Draw the first failing case again, to have its draws to shrink. Cases are numbered from 1 in what's printed.
+    seed = run.seed + run.firstFailure * PSI_PROPERTY_SEED_STEP_;
+    if(!psiPropertyEvaluate_(&run, &current, &scratch, seed)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "Property failed at case %" PSI_PRIu64 " of %" PSI_PRIu64
+                          ", but passed when run again. ", run.firstFailure + 1, run.numCases);
+        psiTerminalPrintf("Is it deterministic? Reproduce with --property-seed=0x%016" PSI_PRIx64 "\n", seed);
+        psiThreadContext.hasCurrentTestFailed = 1;
+        free(current.draws);
+        free(scratch.data);
+        psiResumeAllocTracking_(run.tracksAllocs);
+        return;
+    }
+    numShrinks = psiPropertyShrink_(&run, &current.draws, &current.numDraws);
+
+    // And run the smallest counterexample once more, this time with its failures shown
+    psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "Property falsified by case %" PSI_PRIu64 " of %" PSI_PRIu64,
+                      run.firstFailure + 1, run.numCases);
+    psiTerminalPrintf(" (shrunk %" PSI_PRIu64 " times, to %" PSI_PRIu64 " draws). Reproduce with --property-seed=0x%016"
+                      PSI_PRIx64 "\n", numShrinks, PSI_CAST(psi_u64, current.numDraws), seed);
+    current.replay = current.draws;
+    current.numReplay = current.numDraws;
+    current.draws = PSI_NULL;
+    current.numDraws = 0;
+    current.capacity = 0;
+    psiThreadContext.propertyCase = &current;
+    psiResumeAllocTracking_(run.tracksAllocs);
+    body();
+    psiPauseAllocTracking_();
+    psiThreadContext.propertyCase = PSI_NULL;
+    psiThreadContext.hasCurrentTestFailed = 1;
+
+    free(PSI_PTRCAST(void*, PSI_PTRCAST(psi_uptr, current.replay)));
+    free(current.draws);
+    free(scratch.data);
+    psiResumeAllocTracking_(run.tracksAllocs);
+}
+
+#define PROPERTY(TESTSUITE, TESTNAME)                                                          \
+    static void _PSI_PROPERTY_FUNC_##TESTSUITE##_##TESTNAME(void);                             \
+    TEST(TESTSUITE, TESTNAME) {                                                                \
+        psiRunProperty_(&_PSI_PROPERTY_FUNC_##TESTSUITE##_##TESTNAME);                         \
+    }                                                                                          \
+    static void _PSI_PROPERTY_FUNC_##TESTSUITE##_##TESTNAME(void)
+
+/**
+    Fuzz Targets (`PSI_FUZZ`)
+        PSI_FUZZ(Parser, Json)(const uint8_t* data, size_t size) {
+            psiJsonValue value;
+            if(psiJsonParse(&value, data, size))
+                CHECK(psiJsonIsValid(&value));
+        }
+
+    A fuzz target is a test too. When the tests run, it runs on the empty input, and then on every file in its
+    corpus: `corpus/Parser.Json/` (or under `--corpus=<dir>`), looked up here first and then next to the source
+    file. It fails if any of them fails a check, and says which input that was.
+    With `--fuzz=Parser.Json`, only that target runs, in a loop: it mutates the inputs of its corpus, and adds
+    every mutant that reaches new code to it - as counted by the `-fsanitize-coverage=trace-pc-guard` callbacks
+    (`PSI_FUZZ_COVERAGE`, above) - saving it to the corpus directory too. Everything runs in this process, so
+    there's no fork or exec per input. It stops after `--fuzz-runs=N` inputs, `--fuzz-time=S` seconds or
+    Ctrl-C, or at the first input that fails a check or crashes the process. That input is saved to the current
+    directory as `crash-<hash>`, ready to be moved into the corpus once it's fixed.
+*/
+#define PSI_FUZZ_MAX_LENGTH_        4096
+// How many mutations are stacked onto an input at most
+#define PSI_FUZZ_MAX_MUTATIONS_     5
+// How many inputs go by between two looks at the clock
+#define PSI_FUZZ_CLOCK_INTERVAL_    256
+
+typedef void (*psiFuzzFunc)(const psi_u8*, size_t);
+
+typedef struct psiFuzzInputStruct {
+    psi_u8* data;
+    psi_ull size;
+} psiFuzzInputStruct;
+
+static psi_bool psiIsDirectory(const char* const path) {
+#if defined(PSI_UNIX_)
+    struct stat info;
+    return stat(path, &info) == 0 && S_ISDIR(info.st_mode);
+#elif defined(PSI_WIN_)
+    const DWORD attributes = GetFileAttributesA(path);
+    return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+#else
+    (void)path;
+    return psi_false;
+#endif // PSI_UNIX_
+}
+
+static psi_bool psiMakeDirectory(const char* const path) {
+#if defined(PSI_UNIX_)
+    return mkdir(path, 0777) == 0 || errno == EEXIST;
+#elif defined(PSI_WIN_)
+    return CreateDirectoryA(path, PSI_NULL) || GetLastError() == ERROR_ALREADY_EXISTS;
+#else
+    (void)path;
+    return psi_false;
+#endif // PSI_UNIX_
+}
+
+static int psiComparePaths(const void* const a, const void* const b) {
+    return strcmp(*PSI_PTRCAST(const char* const*, a), *PSI_PTRCAST(const char* const*, b));
+}
+
+// Adds `<dir>/<name>` to `*paths`, unless it's a directory
+static void psiAddFile_(char*** const paths, psi_ull* const count, psi_ull* const capacity, const char* const dir,
+                        const char* const name) {
+    psiBufferStruct path = {PSI_NULL, 0, 0};
+    psiBufferAppend(&path, dir, strlen(dir));
+    psiBufferAppend(&path, "/", 1);
+    psiBufferAppend(&path, name, strlen(name) + 1);
+    if(psiIsDirectory(path.data)) {
+        free(path.data);
+        return;
+    }
+
+    if(*count == *capacity) {
+        *capacity = *capacity * 2 + 16;
+        *paths = PSI_PTRCAST(char**, psi_realloc(*paths, sizeof(char*) * *capacity));
+    }
+    (*paths)[(*count)++] = path.data;
+}
+
+// The paths of the files in `dir` (hidden ones left out), sorted. The caller frees them and the array.
+static char** psiListFiles(const char* const dir, psi_ull* const count) {
+    char** paths = PSI_NULL;
+    psi_ull capacity = 0;
+    *count = 0;
+#if defined(PSI_UNIX_)
+    DIR* const stream = opendir(dir);
+    const struct dirent* entry;
+    if(PSI_NONE(stream))
+        return PSI_NULL;
+    while(PSI_SOME(entry = readdir(stream))) {
+        if(entry->d_name[0] != '.')
+            psiAddFile_(&paths, count, &capacity, dir, entry->d_name);
+    }
+    closedir(stream);
+#elif defined(PSI_WIN_)
+    WIN32_FIND_DATAA entry;
+    HANDLE find;
+    psiBufferStruct pattern = {PSI_NULL, 0, 0};
+    psiBufferAppend(&pattern, dir, strlen(dir));
+    psiBufferAppend(&pattern, "\\*", 3);
+    find = FindFirstFileA(pattern.data, &entry);
+    free(pattern.data);
+    if(find == INVALID_HANDLE_VALUE)
+        return PSI_NULL;
+    do {
+        if(entry.cFileName[0] != '.')
+            psiAddFile_(&paths, count, &capacity, dir, entry.cFileName);
+    } while(FindNextFileA(find, &entry));
+    FindClose(find);
+#else
+    (void)dir;
+#endif // PSI_UNIX_
+    if(*count > 1)
+        qsort(PSI_PTRCAST(void*, paths), *count, sizeof(char*), psiComparePaths);
+    return paths;
+}
+
+/**
+    Sets `path` to the corpus directory of the target `name`: `<root>/<name>`, where `<root>` is `--corpus` (or
+    `corpus`) - or the same next to `sourceFile`, if that's the only place it exists. Returns the length of
+    `<root>`.
+*/
+static psi_ull psiFuzzCorpusDir_(psiBufferStruct* const path, const char* const name, const char* const sourceFile) {
+    const char* const root = psiTestContext.corpusDir ? psiTestContext.corpusDir : "corpus";
+    const psi_ull dirLength = psiSourceDirLength(sourceFile);
+    psiBufferStruct besideSource = {PSI_NULL, 0, 0};
+    psi_bool isBesideSource;
+    psi_ull rootLength;
+    psiBufferAppend(&besideSource, sourceFile, dirLength);
+    psiBufferAppend(&besideSource, root, strlen(root) + 1);
+    isBesideSource = !psiIsAbsolutePath(root) && !psiIsDirectory(root) && psiIsDirectory(besideSource.data);
+    free(besideSource.data);
+
+    path->size = 0;
+    if(isBesideSource)
+        psiBufferAppend(path, sourceFile, dirLength);
+    psiBufferAppend(path, root, strlen(root));
+    rootLength = path->size;
+    psiBufferAppend(path, "/", 1);
+    psiBufferAppend(path, name, strlen(name) + 1);
+    return rootLength;
+}
+
+// The name an input is saved under: its FNV-1a hash, in hex. Safe to call from a signal handler.
+static void psiFuzzInputName_(const psi_u8* const data, const psi_ull size, char* const name) {
+    static const char digits[] = "0123456789abcdef";
+    psi_u64 hash = 0xCBF29CE484222325ull;
+    for(psi_ull i = 0; i < size; i++)
+        hash = (hash ^ data[i]) * 0x100000001B3ull;
+    for(int i = 15; i >= 0; i--) {
+        name[i] = digits[hash & 15];
+        hash >>= 4;
+    }
+    name[16] = PSI_NULLCHAR;
+}
+
+// Saves an input as `<prefix><hash>`, and sets `path` to that
+static void psiFuzzSave_(psiBufferStruct* const path, const char* const prefix, const psi_u8* const data,
+                         const psi_ull size) {
+    char name[17];
+    FILE* file;
+    psiFuzzInputName_(data, size, name);
+    path->size = 0;
+    psiBufferAppend(path, prefix, strlen(prefix));
+    psiBufferAppend(path, name, sizeof(name));
+
+    file = psi_fopen(path->data, "wb");
+    if(PSI_NONE(file) || fwrite(data, 1, size, file) != size) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+        psiTerminalPrintf("Could not write %s\n", path->data);
+    }
+    if(PSI_SOME(file))
+        fclose(file);
+}
+
+#ifdef PSI_UNIX_
+// The input the target is running on, for the crash handler
+static const psi_u8* volatile psiFuzzInput_ = PSI_NULL;
+static volatile psi_ull psiFuzzInputSize_ = 0;
+static volatile sig_atomic_t psiFuzzShouldStop_ = 0;
+static const int psiFuzzCrashSignals_[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+
+static void psiFuzzStopHandler_(const int number) {
+    (void)number;
+    psiFuzzShouldStop_ = 1;
+}
+
+// Saves the input the target crashed on as `crash-<hash>`, and lets the signal take the process down
+static void psiFuzzCrashHandler_(const int number) {
+    static const char message[] = "\nThe fuzz target crashed, on the input saved as ";
+    char path[] = "crash-0123456789abcdef";
+    ssize_t written = 0;
+    int fd;
+    psiFuzzInputName_(psiFuzzInput_, psiFuzzInputSize_, path + 6);
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fd >= 0) {
+        written = write(fd, psiFuzzInput_, psiFuzzInputSize_);
+        close(fd);
+    }
+    written = write(STDERR_FILENO, message, sizeof(message) - 1);
+    written = write(STDERR_FILENO, path, sizeof(path) - 1);
+    written = write(STDERR_FILENO, "\n", 1);
+    (void)written;
+    // The handler was reset on the way in (`SA_RESETHAND`)
+    raise(number);
+}
+#endif // PSI_UNIX_
+
+static void psiFuzzSetHandlers_(const psi_bool isFuzzing) {
+#ifdef PSI_UNIX_
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESETHAND;
+    for(psi_ull i = 0; i < sizeof(psiFuzzCrashSignals_) / sizeof(psiFuzzCrashSignals_[0]); i++) {
+        action.sa_handler = isFuzzing ? psiFuzzCrashHandler_ : SIG_DFL;
+        sigaction(psiFuzzCrashSignals_[i], &action, PSI_NULL);
+    }
+    action.sa_flags = 0;
+    action.sa_handler = isFuzzing ? psiFuzzStopHandler_ : SIG_DFL;
+    sigaction(SIGINT, &action, PSI_NULL);
+    psiFuzzShouldStop_ = 0;
+#else
+    (void)isFuzzing;
+#endif // PSI_UNIX_
+}
+
+// Hit counts are only told apart by bucket: 1, 2, 3, 4-7, 8-15, 16-31, 32-127, 128+
+static inline psi_u8 psiCoverageBucket_(const psi_u8 count) {
+    return count >= 128 ? 128 : count >= 32 ? 64 : count >= 16 ? 32 : count >= 8 ? 16 :
+           count >= 4 ? 8 : count == 3 ? 4 : count;
+}
+
+/**
+    Runs the target on one input, and returns how many features - edges, with the bucket of their hit count -
+    it hit that no input had before. These are added to `seen`, and the edges hit for the first time to
+    `*numEdges`.
+*/
+static psi_u64 psiFuzzRun_(const psiFuzzFunc target, const psi_u8* const data, const psi_ull size,
+                           psi_u8* const seen, psi_u64* const numEdges, const int tracksAllocs) {
+    psi_u8* const counters = psiTestContext.coverage;
+    const psi_ull numWords = (psiTestContext.numCoverage + 8) / 8;
+    psi_u64 numNew = 0;
+    if(psiTestContext.numCoverage > 0)
+        memset(counters, 0, numWords * 8);
+#ifdef PSI_UNIX_
+    psiFuzzInput_ = data;
+    psiFuzzInputSize_ = size;
+#endif // PSI_UNIX_
+
+    psiResumeAllocTracking_(tracksAllocs);
+    target(data, PSI_CAST(size_t, size));
+    psiPauseAllocTracking_();
+    if(psiTestContext.numCoverage == 0)
+        return 0;
+
+    for(psi_ull w = 0; w < numWords; w++) {
+        psi_u64 word;
+        memcpy(&word, counters + w * 8, sizeof(word));
+        if(word == 0)
+            continue;
+        for(psi_ull i = w * 8; i < w * 8 + 8; i++) {
+            const psi_u8 bucket = psiCoverageBucket_(counters[i]);
+            if((seen[i] & bucket) != bucket) {
+                *numEdges += seen[i] == 0 ? 1 : 0;
+                seen[i] = PSI_CAST(psi_u8, seen[i] | bucket);
+                numNew++;
+            }
+        }
+    }
+    return numNew;
+}
+
+static inline psi_ull psiFuzzMin_(const psi_ull a, const psi_ull b) {
+    return a < b ? a : b;
+}
+
+/**
+    Applies one random mutation to the `size` bytes of `data` (which can hold `maxLength`), and returns their new
+    size: erasing or inserting bytes, flipping a bit, changing or nudging a byte, writing an interesting
+    integer, copying a run of bytes elsewhere, or splicing in a run of another input of the corpus.
+*/
+static psi_ull psiFuzzMutate_(psiRngStruct* const rng, psi_u8* const data, const psi_ull size,
+                              const psi_ull maxLength, const psiFuzzInputStruct* const corpus,
+                              const psi_ull numCorpus) {
+    static const psi_u64 interesting[] = {0, 1, 0x7Full, 0x80ull, 0xFFull, 0x100ull, 0x7FFFull, 0x8000ull,
+                                          0xFFFFull, 0x10000ull, 0x7FFFFFFFull, 0x80000000ull, 0xFFFFFFFFull,
+                                          0x7FFFFFFFFFFFFFFFull, 0x8000000000000000ull, 0xFFFFFFFFFFFFFFFFull};
+    const psi_u64 choice = psiRngNext(rng);
+    const psi_ull position = size > 0 ? PSI_CAST(psi_ull, (choice >> 8) % size) : 0;
+    int operation = PSI_CAST(int, choice % 8);
+    if(size == 0 && maxLength == 0)
+        return 0;
+    // Only inserting works on an empty input, and only erasing on a full one
+    if(size == 0)
+        operation = 1;
+    else if(size >= maxLength && (operation == 1 || operation == 7))
+        operation = 0;
+
+    switch(operation) {
+        case 0: {
+            const psi_ull count = 1 + psiRngNext(rng) % psiFuzzMin_(size - position, 16);
+            memmove(data + position, data + position + count, size - position - count);
+            return size - count;
+        }
+        case 1: {
+            const psi_ull at = psiRngNext(rng) % (size + 1);
+            const psi_ull count = 1 + psiRngNext(rng) % psiFuzzMin_(maxLength - size, 16);
+            memmove(data + at + count, data + at, size - at);
+            memset(data + at, PSI_CAST(int, psiRngNext(rng) & 255), count);
+            return size + count;
+        }
+        case 2:
+            data[position] = PSI_CAST(psi_u8, data[position] ^ (1u << (psiRngNext(rng) & 7)));
+            return size;
+        case 3:
+            data[position] = PSI_CAST(psi_u8, psiRngNext(rng));
+            return size;
+        case 4: {
+            const psi_u64 delta = 1 + psiRngNext(rng) % 16;
+            data[position] = PSI_CAST(psi_u8, (choice & 128) ? data[position] + delta : data[position] - delta);
+            return size;
+        }
+        case 5: {
+            psi_u64 value = interesting[psiRngNext(rng) % (sizeof(interesting) / sizeof(interesting[0]))];
+            const psi_ull width = psiFuzzMin_(PSI_CAST(psi_ull, 1) << (psiRngNext(rng) & 3), size - position);
+            for(psi_ull i = 0; i < width; i++, value >>= 8)
+                data[position + i] = PSI_CAST(psi_u8, value);
+            return size;
+        }
+        case 6: {
+            const psi_ull from = psiRngNext(rng) % size;
+            const psi_ull count = 1 + psiRngNext(rng) % psiFuzzMin_(size - (from > position ? from : position), 32);
+            memmove(data + position, data + from, count);
+            return size;
+        }
+        default: {
+            const psiFuzzInputStruct* const other = &corpus[psiRngNext(rng) % numCorpus];
+            psi_ull from, count, at;
+            if(other->size == 0)
+                return size;
+            from = psiRngNext(rng) % other->size;
+            count = 1 + psiRngNext(rng) % psiFuzzMin_(psiFuzzMin_(other->size - from, maxLength - size), 64);
+            at = psiRngNext(rng) % (size + 1);
+            memmove(data + at + count, data + at, size - at);
+            memcpy(data + at, other->data + from, count);
+            return size + count;
+        }
+    }
+}
+
+static void psiFuzzAddInput_(psiFuzzInputStruct** const corpus, psi_ull* const numCorpus, psi_ull* const capacity,
+                             const psi_u8* const data, const psi_ull size) {
+    if(*numCorpus == *capacity) {
+        *capacity = *capacity * 2 + 64;
+        *corpus = PSI_PTRCAST(psiFuzzInputStruct*, psi_realloc(*corpus, sizeof(psiFuzzInputStruct) * *capacity));
+    }
+    (*corpus)[*numCorpus].data = PSI_PTRCAST(psi_u8*, malloc(size + 1));
+    (*corpus)[*numCorpus].size = size;
+    memcpy((*corpus)[*numCorpus].data, data, size);
+    (*numCorpus)++;
+}
+
+static void psiFuzzReport_(const char* const event, const psi_u64 numRuns, const psi_u64 numEdges,
+                           const psi_u64 numFeatures, const psi_ull numCorpus, const psi_u64 start) {
+    const double seconds = PSI_CAST(double, (psiClockRead(PSI_TIMER_REAL_) - start)) / 1e9;
+    psiTerminalPrintf("#%-10" PSI_PRIu64 " %-6s cov: %-6" PSI_PRIu64 " ft: %-6" PSI_PRIu64 " corp: %-6" PSI_PRIu64
+                      " exec/s: %" PSI_PRIu64 "\n", numRuns, event, numEdges, numFeatures,
+                      PSI_CAST(psi_u64, numCorpus), PSI_CAST(psi_u64, (seconds > 0 ? numRuns / seconds : 0)));
+}
+
+// `--fuzz`: mutates the corpus of the target for as long as it's told to, or until an input fails
+static void psiFuzz_(const psiFuzzFunc target, const char* const name, const char* const sourceFile,
+                     const int tracksAllocs) {
+    const psi_ull maxLength = psiTestContext.fuzzMaxLength > 0 ? psiTestContext.fuzzMaxLength : PSI_FUZZ_MAX_LENGTH_;
+    const psi_u64 start = psiClockRead(PSI_TIMER_REAL_);
+    psiBufferStruct dir = {PSI_NULL, 0, 0};
+    psiBufferStruct prefix = {PSI_NULL, 0, 0};
+    psiBufferStruct path = {PSI_NULL, 0, 0};
+    psiFuzzInputStruct* corpus = PSI_NULL;
+    psi_ull numCorpus = 0;
+    psi_ull capacity = 0;
+    psi_u8* const seen = PSI_PTRCAST(psi_u8*, calloc(psiTestContext.numCoverage + 8, 1));
+    psi_u8* const input = PSI_PTRCAST(psi_u8*, malloc(maxLength + 1));
+    psi_ull size = 0;
+    psi_u64 numRuns = 0;
+    psi_u64 numEdges = 0;
+    psi_u64 numFeatures = 0;
+    psi_ull numFiles = 0;
+    char** files;
+    psiRngStruct rng;
+    psi_u64 entropy = start ^ PSI_PTRCAST(psi_uptr, &rng);
+    psi_bool hasFailed = psi_false;
+    const psi_ull rootLength = psiFuzzCorpusDir_(&dir, name, sourceFile);
+
+    psiRngSeed(&rng, psiSplitMix64(&entropy));
+    dir.data[rootLength] = PSI_NULLCHAR;
+    if(!psiMakeDirectory(dir.data) || (dir.data[rootLength] = '/', !psiMakeDirectory(dir.data))) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "Could not create the corpus directory %s\n", dir.data);
+        psiThreadContext.hasCurrentTestFailed = 1;
+        free(seen);
+        free(input);
+        free(dir.data);
+        return;
+    }
+    if(psiTestContext.numCoverage == 0) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+        psiTerminalPrintf("No coverage to go by, so the inputs are only mutated at random. Build the code under "
+                          "test with -fsanitize-coverage=trace-pc-guard, and #define PSI_FUZZ_COVERAGE before "
+                          "including psi/psi.h where PSI_MAIN() is\n");
+    }
+    // What the new inputs are saved as, before their hash
+    psiBufferAppend(&prefix, dir.data, strlen(dir.data));
+    psiBufferAppend(&prefix, "/", 2);
+    psiFuzzSetHandlers_(psi_true);
+
+    // Run the corpus first, keeping the inputs that reach code no other did: they're what the mutants start from
+    files = psiListFiles(dir.data, &numFiles);
+    for(psi_ull i = 0; i <= numFiles && !hasFailed; i++) {
+        psi_ull mappedSize = 0;
+        const char* const data = i == 0 ? "" : psiMapFile(files[i - 1], &mappedSize);
+        if(PSI_NONE(data))
+            continue;
+        size = psiFuzzMin_(mappedSize, maxLength);
+        memcpy(input, data, size);
+        if(i > 0)
+            psiUnmapFile(data, mappedSize);
+
+        const psi_u64 numNew = psiFuzzRun_(target, input, size, seen, &numEdges, tracksAllocs);
+        numRuns++;
+        numFeatures += numNew;
+        hasFailed = psiThreadContext.hasCurrentTestFailed != 0;
+        if(numNew > 0 || numCorpus == 0)
+            psiFuzzAddInput_(&corpus, &numCorpus, &capacity, input, size);
+    }
+    for(psi_ull i = 0; i < numFiles; i++)
+        free(files[i]);
+    free(PSI_PTRCAST(void*, files));
+    psiFuzzReport_("INITED", numRuns, numEdges, numFeatures, numCorpus, start);
+
+    while(!hasFailed) {
+        const psiFuzzInputStruct* const base = &corpus[psiRngNext(&rng) % numCorpus];
+        const psi_u64 numMutations = 1 + psiRngNext(&rng) % PSI_FUZZ_MAX_MUTATIONS_;
+        psi_u64 numNew;
+#ifdef PSI_UNIX_
+        if(psiFuzzShouldStop_)
+            break;
+#endif // PSI_UNIX_
+        if(psiTestContext.fuzzRuns > 0 && numRuns >= psiTestContext.fuzzRuns)
+            break;
+        if(psiTestContext.fuzzTime > 0 && numRuns % PSI_FUZZ_CLOCK_INTERVAL_ == 0 &&
+           psiClockRead(PSI_TIMER_REAL_) - start >= psiTestContext.fuzzTime)
+            break;
+
+        size = psiFuzzMin_(base->size, maxLength);
+        memcpy(input, base->data, size);
+        for(psi_u64 m = 0; m < numMutations; m++)
+            size = psiFuzzMutate_(&rng, input, size, maxLength, corpus, numCorpus);
+        numNew = psiFuzzRun_(target, input, size, seen, &numEdges, tracksAllocs);
+        numFeatures += numNew;
+        numRuns++;
+
+        if(psiThreadContext.hasCurrentTestFailed) {
+            hasFailed = psi_true;
+        } else if(numNew > 0) {
+            psiFuzzAddInput_(&corpus, &numCorpus, &capacity, input, size);
+            psiFuzzSave_(&path, prefix.data, input, size);
+            psiFuzzReport_("NEW", numRuns, numEdges, numFeatures, numCorpus, start);
+        } else if((numRuns & (numRuns - 1)) == 0 && numRuns >= 1024) {
+            psiFuzzReport_("pulse", numRuns, numEdges, numFeatures, numCorpus, start);
+        }
+    }
+    psiFuzzSetHandlers_(psi_false);
+
+    if(hasFailed) {
+        psiFuzzSave_(&path, "crash-", input, size);
+        psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "The fuzz target failed on the input saved as %s\n", path.data);
+    }
+    psiFuzzReport_("DONE", numRuns, numEdges, numFeatures, numCorpus, start);
+
+    for(psi_ull i = 0; i < numCorpus; i++)
+        free(corpus[i].data);
+    free(corpus);
+    free(seen);
+    free(input);
+    free(path.data);
+    free(prefix.data);
+    free(dir.data);
+}
+
+// Runs the target on the empty input and on every input of its corpus
+static void psiRunFuzzCorpus_(const psiFuzzFunc target, const char* const name, const char* const sourceFile,
+                              const int tracksAllocs) {
+    psiBufferStruct dir = {PSI_NULL, 0, 0};
+    psi_ull numFiles = 0;
+    char** files;
+    psiFuzzCorpusDir_(&dir, name, sourceFile);
+    files = psiListFiles(dir.data, &numFiles);
+
+    psiResumeAllocTracking_(tracksAllocs);
+    target(PSI_PTRCAST(const psi_u8*, ""), 0);
+    psiPauseAllocTracking_();
+    psiThreadContext.shouldAbortTest = 0;
+    for(psi_ull i = 0; i < numFiles; i++) {
+        psi_ull size = 0;
+        const char* const data = psiMapFile(files[i], &size);
+        const int hasFailed = psiThreadContext.hasCurrentTestFailed;
+        if(PSI_NONE(data)) {
+            psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+            psiTerminalPrintf("Could not read %s\n", files[i]);
+            free(files[i]);
+            continue;
+        }
+
+        psiThreadContext.hasCurrentTestFailed = 0;
+        psiResumeAllocTracking_(tracksAllocs);
+        target(PSI_PTRCAST(const psi_u8*, data), PSI_CAST(size_t, size));
+        psiPauseAllocTracking_();
+        if(psiThreadContext.hasCurrentTestFailed)
+            psiPrintf("     Input : %s\n", files[i]);
+        psiThreadContext.hasCurrentTestFailed |= hasFailed;
+        psiThreadContext.shouldAbortTest = 0;
+        psiUnmapFile(data, size);
+        free(files[i]);
+    }
+    free(PSI_PTRCAST(void*, files));
+    free(dir.data);
+}
+
+// What `PSI_FUZZ` runs as its test
+static void psiRunFuzzTarget_(const psiFuzzFunc target, const char* const name, const char* const sourceFile) {
+    const int tracksAllocs = psiPauseAllocTracking_();
+    if(psiTestContext.fuzzTarget && strcmp(psiTestContext.fuzzTarget, name) == 0)
+        psiFuzz_(target, name, sourceFile, tracksAllocs);
+    else
+        psiRunFuzzCorpus_(target, name, sourceFile, tracksAllocs);
+    psiResumeAllocTracking_(tracksAllocs);
+}
+
+#define PSI_FUZZ(TESTSUITE, TESTNAME)                                                          \
+    static void _PSI_FUZZ_FUNC_##TESTSUITE##_##TESTNAME(const psi_u8* data, size_t size);      \
+    TEST(TESTSUITE, TESTNAME) {                                                                \
+        psiRunFuzzTarget_(&_PSI_FUZZ_FUNC_##TESTSUITE##_##TESTNAME, #TESTSUITE "." #TESTNAME, __FILE__); \
+    }                                                                                          \
+    static void _PSI_FUZZ_FUNC_##TESTSUITE##_##TESTNAME
 
-#define TEST_F_TEARDOWN(FIXTURE)                                               \
-    static void __PSI_TEST_FIXTURE_TEARDOWN_##FIXTURE(struct FIXTURE* const psi)
+// Triggers and runs all unit tests
+static void psiRunTests() {
+    // The positions (in `psiTestContext.tests`) of the tests that pass the filter, in registration order
+    psi_ull* const order = PSI_PTRCAST(psi_ull*, malloc(sizeof(psi_ull) * (psiTestContext.numTestSuites + 1)));
+    psi_ull numTests = 0;
 
-#define TEST_F(FIXTURE, NAME)                                                                            \
-    PSI_EXTERN psiTestStateStruct psiTestContext;                                                        \
-    static void __PSI_TEST_FIXTURE_SETUP_##FIXTURE(struct FIXTURE* const);                               \
-    static void __PSI_TEST_FIXTURE_TEARDOWN_##FIXTURE(struct FIXTURE* const);                            \
-    static void __PSI_TEST_FIXTURE_RUN_##FIXTURE##_##NAME(struct FIXTURE* const);                        \
-                                                                                                         \
-    static void __PSI_TEST_FIXTURE_##FIXTURE##_##NAME() {                                                \
-        struct FIXTURE fixture;                                                                          \
-        memset(&fixture, 0, sizeof(fixture));                                                            \
-        __PSI_TEST_FIXTURE_SETUP_##FIXTURE(&fixture);                                                    \
-        if(hasCurrentTestFailed == 1) {                                                                  \
-            return;                                                                                      \
-        }                                                                                                \
-                                                                                                         \
-        __PSI_TEST_FIXTURE_RUN_##FIXTURE##_##NAME(&fixture);                                             \
-        __PSI_TEST_FIXTURE_TEARDOWN_##FIXTURE(&fixture);                                                 \
-    }                                                                                                    \
-                                                                                                         \
-    PSI_TEST_INITIALIZER(psi_register_##FIXTURE##_##NAME) {                                              \
-        const psi_ull index = psiTestContext.numTestSuites++;                                            \
-        const char* const namePart = #FIXTURE "." #NAME;                                                 \
-        const psi_ull nameSize = strlen(namePart) + 1;                                                   \
-        char* name = PSI_PTRCAST(char* , malloc(nameSize));                                              \
-        psiTestContext.tests = PSI_PTRCAST(                                                              \
-                                    psiTestSuiteStruct*,                                                 \
-                                    psi_realloc(PSI_PTRCAST(void*, psiTestContext.tests),                \
-                                                                sizeof(psiTestSuiteStruct) *             \
-                                                                        psiTestContext.numTestSuites));  \
-        psiTestContext.tests[index].func = &__PSI_TEST_FIXTURE_##FIXTURE##_##NAME;                       \
-        psiTestContext.tests[index].name = name;                                                         \
-        PSI_SNPRINTF(name, nameSize, "%s", namePart);                                                    \
-    }                                                                                                    \
-    static void __PSI_TEST_FIXTURE_RUN_##FIXTURE##_##NAME(struct FIXTURE* const psi)
+    for(psi_ull i = 0; i < psiTestContext.numTestSuites; i++) {
+        if(psiShouldRunTest(i))
+            order[numTests++] = i;
+    }
 
+    psiStatsTestDurations = PSI_PTRCAST(double*, malloc(sizeof(double) * (psiTestContext.numTestSuites + 1)));
+    for(psi_ull i = 0; i < psiTestContext.numTestSuites; i++)
+        psiStatsTestDurations[i] = -1;
+    if(psiCollectUsage)
+        psiStatsTestUsage = PSI_PTRCAST(psiUsageStruct*, calloc(psiTestContext.numTestSuites + 1, sizeof(psiUsageStruct)));
+
+    // The same positions, slowest test (as of the last run) first
+    psi_ull* const byDuration = PSI_PTRCAST(psi_ull*, malloc(sizeof(psi_ull) * (numTests + 1)));
+    psiExpectedDurationStruct* const expected = PSI_PTRCAST(psiExpectedDurationStruct*,
+                                                      malloc(sizeof(psiExpectedDurationStruct) * (numTests + 1)));
+    for(psi_ull i = 0; i < numTests; i++) {
+        expected[i].duration = psiCachedDurations ? psiCachedDurations[order[i]] : -1;
+        expected[i].position = i;
+    }
+    qsort(expected, numTests, sizeof(psiExpectedDurationStruct), psiCompareExpectedDurations);
+    for(psi_ull i = 0; i < numTests; i++)
+        byDuration[i] = expected[i].position;
+    free(expected);
 
-static int psiShouldFilterTest(const char* const filter, const char* const testcase);
-static int psiShouldFilterTest(const char* const filter, const char* const testcase) {
-    if(PSI_SOME(filter)) {
-        const char* filter_curr = filter;
-        const char* testcase_curr = testcase;
-        const char* filter_wildcard = PSI_NULL;
+    if(psiTracePath)
+        psiTraceBegin(psiNumJobs < 2 || numTests < 2 ? 0 : (psiNumJobs < numTests ? psiNumJobs : numTests));
 
-        while ((*filter_curr != PSI_NULLCHAR) && (*testcase_curr != PSI_NULLCHAR)) {
-            if(*filter_curr == '*') {
-                // store the position of the wildcard
-                filter_wildcard = filter_curr;
+    if(psiNumJobs < 2 || numTests < 2)
+        psiRunTestsSerially(order, numTests);
+#ifdef PSI_UNIX_
+    else if(!psiUseThreads)
+        psiRunTestsInWorkers(order, byDuration, numTests);
+#endif // PSI_UNIX_
+#ifdef PSI_HAS_THREADS_
+    else
+        psiRunTestsInThreads(order, byDuration, numTests);
+#else
+    else
+        psiRunTestsSerially(order, numTests);
+#endif // PSI_HAS_THREADS_
+
+    if(psiCachedDurations)
+        psiSaveTimingCache(psiTimingCachePath, psiCachedDurations);
+    psiTraceEnd();
+    free(byDuration);
+    free(order);
+    psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[==========] ");
+    psiColouredPrintf(PSI_COLOUR_DEFAULT_, "%" PSI_PRIu64 " test suites ran\n", psiStatsTestsRan);
+}
 
-                // skip the wildcard character
-                filter_curr++;
 
-                while ((*filter_curr != PSI_NULLCHAR) && (*testcase_curr != PSI_NULLCHAR)) {
-                    if(*filter_curr == '*') {
-                        // Found another wildcard (filter is something like *foo*), so exit the current loop,
-                        // and return to the parent loop to handle the wildcard case
-                        break;
-                    } else if(*filter_curr != *testcase_curr) {
-                        // otherwise our filter didn't match, so reset it
-                        filter_curr = filter_wildcard;
-                    }
+/**
+    Benchmark Runner (`--benchmark`)
+    Benchmarks always run one at a time in this process, whatever `--jobs` says: anything running next to them
+    would only add noise.
+*/
+typedef struct psiBenchmarkResultStruct {
+    psi_u64 iterations;     // Per sample
+    double* samples;        // Time per iteration of every sample, in ns
+    psi_ull numSamples;
+    double mean;
+    double median;
+    double stddev;
+    double min;
+    double max;
+    // Per iteration, over all samples, if the `--perf-counters` could be read for every one of them
+    int hasPerfCounts;
+    double perfCounts[PSI_MAX_PERF_COUNTERS_];
+} psiBenchmarkResultStruct;
+
+// Enough for every power of 2 a `psi_u64` can hold
+#define PSI_MAX_BENCHMARK_SIZES_    65
+
+// Runs `state->iterations` of the benchmark, and returns how long its loop (or, without one, its body) took in ns
+static psi_u64 psiRunBenchmarkBatch(const psiBenchmarkStruct* const benchmark, psiBenchmarkStateStruct* const state) {
+    state->clock = &psiClock;
+    state->isTimed = 0;
+    state->start = 0;
+    state->stop = 0;
+
+    psiThreadContext.checkIsInsideTestSuite = 1;
+    // For the allocation budgets
+    psiThreadContext.allocs.isTracking = psiTestContext.tracksAllocs;
+    // `BENCHMARK_LOOP` restarts the counters, so that they only count the loop
+    psiPerfStart_();
+    const psi_u64 start = psiClock();
+    benchmark->func(state);
+    const psi_u64 stop = psiClock();
+    psiPerfStop_();
+    psiThreadContext.allocs.isTracking = 0;
+    psiThreadContext.checkIsInsideTestSuite = 0;
+
+    return state->isTimed ? state->stop - state->start : stop - start;
+}
 
-                    // move testcase along
-                    testcase_curr++;
+/**
+    Finds how many iterations a sample needs to take at least `psiBenchmarkMinTime`. Its last round already runs
+    that many, so it doubles as the warmup.
+    A benchmark without a `BENCHMARK_LOOP` can't run more than one iteration per call, so it gets 1.
+*/
+static psi_u64 psiCalibrateBenchmark(const psiBenchmarkStruct* const benchmark, const psi_u64 n) {
+    psiBenchmarkStateStruct state;
+    state.iterations = 1;
+    state.n = n;
+
+    for(;;) {
+        const psi_u64 elapsed = psiRunBenchmarkBatch(benchmark, &state);
+        if(!state.isTimed || psiThreadContext.hasCurrentTestFailed || elapsed >= psiBenchmarkMinTime ||
+           state.iterations >= PSI_CAST(psi_u64, 1) << 40)
+            return state.isTimed ? state.iterations : 1;
+
+        // Aim a little past the target, but don't trust a very short measurement to grow more than 10x
+        double multiplier = elapsed > 0 ? 1.4 * PSI_CAST(double, psiBenchmarkMinTime) / PSI_CAST(double, elapsed) : 10;
+        if(multiplier > 10)
+            multiplier = 10;
+        const psi_u64 next = PSI_CAST(psi_u64, PSI_CAST(double, state.iterations) * multiplier);
+        state.iterations = next > state.iterations ? next : state.iterations + 1;
+    }
+}
 
-                    // move filter along
-                    filter_curr++;
-                }
+static int psiCompareDoubles(const void* const lhs, const void* const rhs) {
+    const double a = *PSI_CAST(const double*, lhs);
+    const double b = *PSI_CAST(const double*, rhs);
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
 
-                if((*filter_curr == PSI_NULLCHAR) && (*testcase_curr == PSI_NULLCHAR))
-                    return 0;
+static void psiSummarizeBenchmark(psiBenchmarkResultStruct* const result) {
+    const psi_ull n = result->numSamples;
+    double* const sorted = PSI_PTRCAST(double*, malloc(sizeof(double) * (n + 1)));
+    double sum = 0;
+    double squares = 0;
+
+    memcpy(sorted, result->samples, sizeof(double) * n);
+    qsort(sorted, n, sizeof(double), psiCompareDoubles);
+    for(psi_ull i = 0; i < n; i++)
+        sum += sorted[i];
+    result->mean = sum / PSI_CAST(double, n);
+    for(psi_ull i = 0; i < n; i++)
+        squares += (sorted[i] - result->mean) * (sorted[i] - result->mean);
+
+    result->stddev = n > 1 ? sqrt(squares / PSI_CAST(double, (n - 1))) : 0;
+    result->median = n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+    result->min = sorted[0];
+    result->max = sorted[n - 1];
+    free(sorted);
+}
 
-                // if the testcase has been exhausted, we don't have a match!
-                if(*testcase_curr == PSI_NULLCHAR)
-                    return 1;
-            } else {
-                if(*testcase_curr != *filter_curr) {
-                    // test case doesn't match filter
-                    return 1;
-                } else {
-                    // move our filter and testcase forward
-                    testcase_curr++;
-                    filter_curr++;
-                }
-            }
-        }
+// Like `psiClockPrintDuration`, but keeps the fractions of a nanosecond a single iteration can take
+static void psiPrintBenchmarkTime(const char* const label, const double nanoseconds) {
+    if(nanoseconds < 1000)
+        psiTerminalPrintf("%s %.2fns", label, nanoseconds);
+    else if(nanoseconds < 1000000)
+        psiTerminalPrintf("%s %.2fus", label, nanoseconds / 1000);
+    else if(nanoseconds < 1000000000)
+        psiTerminalPrintf("%s %.2fms", label, nanoseconds / 1000000);
+    else
+        psiTerminalPrintf("%s %.2fs", label, nanoseconds / 1000000000);
+}
 
-        if((*filter_curr != PSI_NULLCHAR) || ((*testcase_curr == PSI_NULLCHAR) && ((filter == filter_curr) ||
-            (filter_curr[-1] != '*')))) {
-            // We have a mismatch
-            return 1;
+// Returns whether the benchmark passed. `result->samples` has to have room for `psiBenchmarkSamples` samples.
+static psi_bool psiRunBenchmark(const psiBenchmarkStruct* const benchmark, const psi_u64 n,
+                                psiBenchmarkResultStruct* const result) {
+    psiThreadContext.hasCurrentTestFailed = 0;
+    psiThreadContext.shouldFailTest = 0;
+    psiThreadContext.shouldAbortTest = 0;
+
+    psiBenchmarkStateStruct state;
+    state.iterations = psiCalibrateBenchmark(benchmark, n);
+    state.n = n;
+    result->iterations = state.iterations;
+    result->numSamples = 0;
+    result->hasPerfCounts = psiThreadContext.numPerfFds > 0;
+    for(psi_ull i = 0; i < PSI_MAX_PERF_COUNTERS_; i++)
+        result->perfCounts[i] = 0;
+
+    while(result->numSamples < psiBenchmarkSamples && !psiThreadContext.hasCurrentTestFailed) {
+        psi_u64 counts[PSI_MAX_PERF_COUNTERS_];
+        const psi_u64 elapsed = psiRunBenchmarkBatch(benchmark, &state);
+        result->samples[result->numSamples++] = PSI_CAST(double, elapsed) / PSI_CAST(double, state.iterations);
+
+        if(result->hasPerfCounts && psiPerfRead(counts)) {
+            for(psi_ull i = 0; i < psiNumPerfCounters; i++)
+                result->perfCounts[i] += PSI_CAST(double, counts[i]);
+        } else {
+            result->hasPerfCounts = 0;
         }
     }
-    return 0;
+    for(psi_ull i = 0; i < psiNumPerfCounters; i++)
+        result->perfCounts[i] /= PSI_CAST(double, (state.iterations * result->numSamples));
+
+    if(psiThreadContext.hasCurrentTestFailed)
+        return psi_false;
+    psiSummarizeBenchmark(result);
+    return psi_true;
 }
 
-static inline FILE* psi_fopen(const char* const filename, const char* const mode) {
-#ifdef _MSC_VER
-    FILE* file;
-    if(fopen_s(&file, filename, mode) == 0) {
-        return file;
+// Prints one line of timings, and adds them to the report as properties. `suffix` is `/<n>` for a range, or "".
+static void psiPrintBenchmarkResult(const psiBenchmarkResultStruct* const result, const psi_u64 n,
+                                    const char* const suffix) {
+    if(*suffix != PSI_NULLCHAR) {
+        psiTerminalPrintf("             n=%" PSI_PRIu64 ":", n);
     } else {
-        return PSI_NULL;
+        psiTerminalPrintf("            ");
     }
-#else
-    return fopen(filename, mode);
-#endif // _MSC_VER
+    psiPrintBenchmarkTime(" mean", result->mean);
+    psiPrintBenchmarkTime(", median", result->median);
+    psiPrintBenchmarkTime(", stddev", result->stddev);
+    psiPrintBenchmarkTime(", min", result->min);
+    psiPrintBenchmarkTime(", max", result->max);
+    psiTerminalPrintf(" (%" PSI_PRIu64 " samples x %" PSI_PRIu64 " iterations)\n",
+                      PSI_CAST(psi_u64, result->numSamples), result->iterations);
+    if(result->hasPerfCounts) {
+        psiTerminalPrintf("             per iteration:");
+        for(psi_ull i = 0; i < psiNumPerfCounters; i++) {
+            psiTerminalPrintf("%s %.2f %s", i > 0 ? "," : "", result->perfCounts[i], psiPerfCounterName(i));
+            psiReportPrintf("<property name=\"%s%s\" value=\"%.3f\"/>", psiPerfCounterName(i), suffix,
+                            result->perfCounts[i]);
+        }
+        psiTerminalPrintf("\n");
+    }
+    psiReportPrintf("<property name=\"iterations%s\" value=\"%" PSI_PRIu64 "\"/>"
+                    "<property name=\"mean_ns%s\" value=\"%.3f\"/><property name=\"median_ns%s\" value=\"%.3f\"/>"
+                    "<property name=\"stddev_ns%s\" value=\"%.3f\"/><property name=\"min_ns%s\" value=\"%.3f\"/>"
+                    "<property name=\"max_ns%s\" value=\"%.3f\"/>",
+                    suffix, result->iterations, suffix, result->mean, suffix, result->median,
+                    suffix, result->stddev, suffix, result->min, suffix, result->max);
 }
 
+// The complexities `BENCHMARK_RANGE` fits against
+static double psiComplexityConstant_(const double n) { (void)n; return 1; }
+static double psiComplexityLog_(const double n) { return log(n); }
+static double psiComplexityLinear_(const double n) { return n; }
+static double psiComplexityLinearithmic_(const double n) { return n * log(n); }
+static double psiComplexityQuadratic_(const double n) { return n * n; }
+
+typedef struct psiComplexityStruct {
+    const char* name;
+    double (*f)(const double);
+} psiComplexityStruct;
+
+static const psiComplexityStruct psiComplexities[] = {
+    {"O(1)", &psiComplexityConstant_},
+    {"O(log n)", &psiComplexityLog_},
+    {"O(n)", &psiComplexityLinear_},
+    {"O(n log n)", &psiComplexityLinearithmic_},
+    {"O(n^2)", &psiComplexityQuadratic_}
+};
 
-static void psi_help_() {
-    printf("Usage: %s [options] [test...]\n", psi_argv0_);
-    printf("\n");
-    printf("Run the specified unit tests; or if the option '--skip' is used, run all\n");
-    printf("tests in the suite but those listed. By default, if no tests are specified\n");
-    printf("on the command line, all unit tests in the suite are run.\n");
-    printf("\n");
-    printf("Options:\n");
-    printf("  --failed-output-only     Output only failed Test Suites");
-    printf("  --filter=<filter>        Filter the test suites to run (e.g: Suite1*.a\n");
-    printf("                             would run Suite1Case.a but not Suite1Case.b}\n");
-#if defined(PSI_WIN_)
-    printf("  --time                   Measure test duration\n");
-#elif defined(PSI_HAS_POSIX_TIMER_)
-    printf("  --time                   Measure test duration (real time)\n");
-    printf("  --time=TIMER             Measure test duration, using given timer\n");
-    printf("                               (TIMER is one of 'real', 'cpu')\n");
-#endif // PSI_WIN_
-    printf("  --no-summary             Suppress printing of test results summary\n");
-    printf("  --output=<FILE>          Write an XUnit XML file to Enable XUnit output\n");
-    printf("                             to the given file\n");
-    printf("  --list                   List unit tests in the suite and exit\n");
-    printf("  --no-color               Disable coloured output\n");
-    printf("  --help                   Display this help and exit\n");
+/**
+    Least-squares fits `times = c * f(n)` for each of `psiComplexities`, and returns the one with the lowest RMS
+    error. `rms` is that error relative to the mean time, so that it means the same whatever the units.
+*/
+static const psiComplexityStruct* psiFitComplexity(const double* const ns, const double* const times,
+                                                   const psi_ull count, double* const rms) {
+    const psiComplexityStruct* best = PSI_NULL;
+    double mean = 0;
+    for(psi_ull i = 0; i < count; i++)
+        mean += times[i];
+    mean /= PSI_CAST(double, count);
+
+    for(psi_ull c = 0; c < sizeof(psiComplexities) / sizeof(psiComplexities[0]); c++) {
+        double sumFF = 0;
+        double sumTF = 0;
+        double error = 0;
+        for(psi_ull i = 0; i < count; i++) {
+            const double f = psiComplexities[c].f(ns[i]);
+            sumFF += f * f;
+            sumTF += times[i] * f;
+        }
+        if(sumFF <= 0)
+            continue;
+
+        const double coefficient = sumTF / sumFF;
+        for(psi_ull i = 0; i < count; i++) {
+            const double residual = times[i] - coefficient * psiComplexities[c].f(ns[i]);
+            error += residual * residual;
+        }
+        error = mean > 0 ? sqrt(error / PSI_CAST(double, count)) / mean : 0;
+        if(PSI_NONE(best) || error < *rms) {
+            best = &psiComplexities[c];
+            *rms = error;
+        }
+    }
+    return best;
 }
 
+// The input sizes a benchmark runs with: `{0}` for a plain `BENCHMARK`. Returns how many were written to `ns`.
+static psi_ull psiBenchmarkSizes(const psiBenchmarkStruct* const benchmark, psi_u64* const ns, const psi_ull capacity) {
+    if(benchmark->rangeHi == 0) {
+        ns[0] = 0;
+        return 1;
+    }
 
-static psi_bool psiCmdLineRead(const int argc, const char* const * const argv) {
-    // Coloured output
-#ifdef PSI_UNIX_
-    psiShouldColourizeOutput = isatty(STDOUT_FILENO);
-#elif defined PSI_WIN_
-    #ifdef _BORLANDC_
-        psiShouldColourizeOutput = isatty(_fileno(stdout));
-    #else
-        psiShouldColourizeOutput = _isatty(_fileno(stdout));
-    #endif // _BORLANDC_
-#else
-    psiShouldColourizeOutput = isatty(STDOUT_FILENO);
-#endif // PSI_UNIX_
+    const psi_u64 multiplier = benchmark->rangeMultiplier < 2 ? 2 : benchmark->rangeMultiplier;
+    psi_ull count = 0;
+    for(psi_u64 n = benchmark->rangeLo < 1 ? 1 : benchmark->rangeLo;
+        n < benchmark->rangeHi && count < capacity - 1;
+        n = n > benchmark->rangeHi / multiplier ? benchmark->rangeHi : n * multiplier) {
+        ns[count++] = n;
+    }
+    ns[count++] = benchmark->rangeHi;
+    return count;
+}
 
-    // loop through all arguments looking for our options
-    for(psi_ull i = 1; i < PSI_CAST(psi_ull, argc); i++) {
-        /* Informational switches */
-        const char* const helpStr = "--help";
-        const char* const listStr = "--list";
-        const char* const colourStr = "--no-color";
-        const char* const summaryStr = "--no-summary";
-        const char* const onlyFailedOutput = "--failed-output-only";
-        /* Test config switches */
-        const char* const filterStr = "--filter=";
-        const char* const XUnitOutput = "--output=";
+/**
+    Baselines (`--benchmark-baseline=<file>`, `--benchmark-save=<file>`)
+    A line per benchmark (and per size of a `BENCHMARK_RANGE`, as `name/n`): its name, then the time per iteration
+    of each of its samples, in ns.
+*/
+typedef struct psiBaselineEntryStruct {
+    char* key;
+    double* samples;
+    psi_ull numSamples;
+} psiBaselineEntryStruct;
+
+// Returns every entry of the baseline at `path` (PSI_NULL and 0 entries if it can't be read)
+static psiBaselineEntryStruct* psiLoadBaseline(const char* const path, psi_ull* const numEntries) {
+    *numEntries = 0;
+    FILE* const file = psi_fopen(path, "r");
+    if(PSI_NONE(file))
+        return PSI_NULL;
 
-        // Help
-        if(strncmp(argv[i], helpStr, strlen(helpStr)) == 0) {
-            psi_help_();
-            return psi_false;
+    psi_ull capacity = 16;
+    psiBaselineEntryStruct* entries = PSI_PTRCAST(psiBaselineEntryStruct*,
+                                                  malloc(sizeof(psiBaselineEntryStruct) * capacity));
+    psiBufferStruct line = {PSI_NULL, 0, 0};
+    while(psiReadLine(file, &line)) {
+        char* const space = strchr(line.data, ' ');
+        if(PSI_NONE(space) || space == line.data)
+            continue;
+        *space = '\0';
+
+        psiBaselineEntryStruct entry;
+        psi_ull samplesCapacity = 16;
+        entry.samples = PSI_PTRCAST(double*, malloc(sizeof(double) * samplesCapacity));
+        entry.numSamples = 0;
+        const char* curr = space + 1;
+        for(;;) {
+            char* end = PSI_NULL;
+            const double sample = strtod(curr, &end);
+            if(end == curr)
+                break;
+            if(entry.numSamples == samplesCapacity) {
+                samplesCapacity *= 2;
+                entry.samples = PSI_PTRCAST(double*, psi_realloc(entry.samples, sizeof(double) * samplesCapacity));
+            }
+            entry.samples[entry.numSamples++] = sample;
+            curr = end;
+        }
+        if(entry.numSamples == 0) {
+            free(entry.samples);
+            continue;
         }
 
-        // Only failed output
-        else if(strncmp(argv[i], onlyFailedOutput, strlen(onlyFailedOutput)) == 0) {
-            psiDisplayOnlyFailedOutput = 1;
+        entry.key = PSI_PTRCAST(char*, malloc(strlen(line.data) + 1));
+        strcpy(entry.key, line.data);
+        if(*numEntries == capacity) {
+            capacity *= 2;
+            entries = PSI_PTRCAST(psiBaselineEntryStruct*,
+                                  psi_realloc(entries, sizeof(psiBaselineEntryStruct) * capacity));
         }
+        entries[(*numEntries)++] = entry;
+    }
 
-        // Filter tests
-        else if(strncmp(argv[i], filterStr, strlen(filterStr)) == 0)
-            // user wants to filter what test suites run!
-            cmd_filter = argv[i] + strlen(filterStr);
+    free(line.data);
+    fclose(file);
+    return entries;
+}
 
-        // Write XUnit XML file
-        else if(strncmp(argv[i], XUnitOutput, strlen(XUnitOutput)) == 0)
-            psiTestContext.foutput = psi_fopen(argv[i] + strlen(XUnitOutput), "w+");
+static const psiBaselineEntryStruct* psiFindBaseline(const psiBaselineEntryStruct* const entries,
+                                                     const psi_ull numEntries, const char* const key) {
+    for(psi_ull i = 0; i < numEntries; i++) {
+        if(strcmp(entries[i].key, key) == 0)
+            return &entries[i];
+    }
+    return PSI_NULL;
+}
 
-        // List tests
-        else if(strncmp(argv[i], listStr, strlen(listStr)) == 0) {
-            for (i = 0; i < psiTestContext.numTestSuites; i++)
-                psiPrintf("%s\n", psiTestContext.tests[i].name);
-            psiDisplayTests = 1;
+typedef struct psiRankedSampleStruct {
+    double value;
+    int isCurrent;
+} psiRankedSampleStruct;
+
+static int psiCompareRankedSamples(const void* const lhs, const void* const rhs) {
+    const psiRankedSampleStruct* const a = PSI_CAST(const psiRankedSampleStruct*, lhs);
+    const psiRankedSampleStruct* const b = PSI_CAST(const psiRankedSampleStruct*, rhs);
+    return a->value < b->value ? -1 : (a->value > b->value ? 1 : 0);
+}
+
+/**
+    Two-sided Mann-Whitney U test: the probability of the two sets of samples being at least this far apart if
+    they came from the same distribution. Uses the normal approximation (with a correction for ties and for
+    continuity), which holds up from about 8 samples a side - fewer only make it more conservative.
+*/
+static double psiMannWhitneyU(const double* const baseline, const psi_ull numBaseline,
+                              const double* const current, const psi_ull numCurrent) {
+    const psi_ull n = numBaseline + numCurrent;
+    psiRankedSampleStruct* const ranked = PSI_PTRCAST(psiRankedSampleStruct*,
+                                                      malloc(sizeof(psiRankedSampleStruct) * (n + 1)));
+    for(psi_ull i = 0; i < numBaseline; i++) {
+        ranked[i].value = baseline[i];
+        ranked[i].isCurrent = 0;
+    }
+    for(psi_ull i = 0; i < numCurrent; i++) {
+        ranked[numBaseline + i].value = current[i];
+        ranked[numBaseline + i].isCurrent = 1;
+    }
+    qsort(ranked, n, sizeof(psiRankedSampleStruct), psiCompareRankedSamples);
+
+    // Tied samples all get the average of their ranks
+    double rankSum = 0;
+    double ties = 0;
+    for(psi_ull i = 0; i < n;) {
+        psi_ull j = i;
+        while(j < n && ranked[j].value == ranked[i].value)
+            j++;
+        const double rank = PSI_CAST(double, (i + j + 1)) / 2;
+        const double numTied = PSI_CAST(double, (j - i));
+        for(psi_ull k = i; k < j; k++) {
+            if(ranked[k].isCurrent)
+                rankSum += rank;
         }
+        ties += numTied * numTied * numTied - numTied;
+        i = j;
+    }
+    free(ranked);
+
+    const double n1 = PSI_CAST(double, numCurrent);
+    const double n2 = PSI_CAST(double, numBaseline);
+    const double total = n1 + n2;
+    const double u = rankSum - n1 * (n1 + 1) / 2;
+    const double variance = n1 * n2 / 12 * ((total + 1) - ties / (total * (total - 1)));
+    if(n1 < 1 || n2 < 1 || variance <= 0)
+        return 1;
+
+    double z = (fabs(u - n1 * n2 / 2) - 0.5) / sqrt(variance);
+    if(z < 0)
+        z = 0;
+    return erfc(z / sqrt(2.0));
+}
 
-        // Disable colouring
-        else if(strncmp(argv[i], colourStr, strlen(colourStr)) == 0) {
-            psiShouldColourizeOutput = 0;
+// The significance level `psiMannWhitneyU` has to reach for a benchmark to count as slower or faster
+#define PSI_BENCHMARK_ALPHA_    0.05
+
+/**
+    Compares a benchmark's samples to its baseline, and prints the change in its median time. Returns whether
+    it got significantly slower by more than `psiBenchmarkThreshold`.
+*/
+static psi_bool psiCompareToBaseline(const psiBenchmarkResultStruct* const result,
+                                     const psiBaselineEntryStruct* const baseline, const char* const suffix) {
+    if(PSI_NONE(baseline)) {
+        psiTerminalPrintf("             no baseline\n");
+        return psi_false;
+    }
+
+    double* const sorted = PSI_PTRCAST(double*, malloc(sizeof(double) * (baseline->numSamples + 1)));
+    memcpy(sorted, baseline->samples, sizeof(double) * baseline->numSamples);
+    qsort(sorted, baseline->numSamples, sizeof(double), psiCompareDoubles);
+    const psi_ull half = baseline->numSamples / 2;
+    const double median = baseline->numSamples % 2 ? sorted[half] : (sorted[half - 1] + sorted[half]) / 2;
+    free(sorted);
+
+    const double change = median > 0 ? (result->median - median) / median * 100 : 0;
+    const double p = psiMannWhitneyU(baseline->samples, baseline->numSamples, result->samples, result->numSamples);
+    const psi_bool isSignificant = p < PSI_BENCHMARK_ALPHA_;
+    const psi_bool isSlower = isSignificant && change > psiBenchmarkThreshold;
+
+    psiTerminalPrintf("             vs baseline: median %+.1f%% (p=%.3g), ", change, p);
+    if(isSlower)
+        psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "slower\n");
+    else if(isSignificant && change < -psiBenchmarkThreshold)
+        psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "faster\n");
+    else
+        psiTerminalPrintf("no significant change\n");
+    psiReportPrintf("<property name=\"baseline_change%s\" value=\"%.2f\"/><property name=\"baseline_p%s\" value=\"%.4g\"/>",
+                    suffix, change, suffix, p);
+    return isSlower;
+}
+
+static void psiRunBenchmarks() {
+    psi_ull numBenchmarks = 0;
+    psi_ull numFailed = 0;
+    for(const psiBenchmarkStruct* benchmark = psiTestContext.benchmarks; PSI_SOME(benchmark); benchmark = benchmark->next)
+        numBenchmarks++;
+
+    // Registration order, leaving out the ones the filter doesn't match
+    const psiBenchmarkStruct** const benchmarks = PSI_PTRCAST(const psiBenchmarkStruct**,
+                                                        malloc(sizeof(psiBenchmarkStruct*) * (numBenchmarks + 1)));
+    const psiBenchmarkStruct** const failed = PSI_PTRCAST(const psiBenchmarkStruct**,
+                                                    malloc(sizeof(psiBenchmarkStruct*) * (numBenchmarks + 1)));
+    psi_ull numToRun = numBenchmarks;
+    for(const psiBenchmarkStruct* benchmark = psiTestContext.benchmarks; PSI_SOME(benchmark); benchmark = benchmark->next)
+        benchmarks[--numToRun] = benchmark;
+    for(psi_ull i = 0; i < numBenchmarks; i++) {
+        if(!psiShouldFilterTest(cmd_filter, benchmarks[i]->name))
+            benchmarks[numToRun++] = benchmarks[i];
+    }
+
+    psiBenchmarkResultStruct result;
+    result.samples = PSI_PTRCAST(double*, malloc(sizeof(double) * (psiBenchmarkSamples + 1)));
+    if(psiNumPerfCounters > 0)
+        psiPerfOpen();
+    psi_u64 sizes[PSI_MAX_BENCHMARK_SIZES_];
+    double sizesAsDoubles[PSI_MAX_BENCHMARK_SIZES_];
+    double medians[PSI_MAX_BENCHMARK_SIZES_];
+    char key[512];
+
+    psi_ull numBaselineEntries = 0;
+    psiBaselineEntryStruct* baseline = PSI_NULL;
+    if(PSI_SOME(psiBenchmarkBaselinePath)) {
+        baseline = psiLoadBaseline(psiBenchmarkBaselinePath, &numBaselineEntries);
+        if(PSI_NONE(baseline)) {
+            psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+            psiTerminalPrintf("Could not read the benchmark baseline from %s\n", psiBenchmarkBaselinePath);
         }
+    }
+    // Read the baseline first: it may well be the same file
+    FILE* const save = PSI_SOME(psiBenchmarkSavePath) ? psi_fopen(psiBenchmarkSavePath, "w") : PSI_NULL;
+    if(PSI_SOME(psiBenchmarkSavePath) && PSI_NONE(save)) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
+        psiTerminalPrintf("Could not save the benchmark samples to %s\n", psiBenchmarkSavePath);
+    }
 
-        // Disable Summary
-        else if(strncmp(argv[i], summaryStr, strlen(summaryStr))) {
-            psiDisableSummary = 1;
+    psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[==========] ");
+    psiColouredPrintf(PSI_COLOUR_BOLD_, "Running %" PSI_PRIu64 " benchmarks.\n", PSI_CAST(psi_u64, numToRun));
+    psiReportPrintf("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    psiReportPrintf("<testsuites tests=\"%" PSI_PRIu64 "\" name=\"All\">\n", PSI_CAST(psi_u64, numToRun));
+    psiReportPrintf("<testsuite name=\"Benchmarks\" tests=\"%" PSI_PRIu64 "\">\n", PSI_CAST(psi_u64, numToRun));
+
+    for(psi_ull i = 0; i < numToRun; i++) {
+        const psiBenchmarkStruct* const benchmark = benchmarks[i];
+        psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[ RUN      ] ");
+        psiColouredPrintf(PSI_COLOUR_DEFAULT_, "%s\n", benchmark->name);
+        psiReportPrintf("<testcase name=\"%s\">", benchmark->name);
+        // A benchmark takes a while: show which one is running
+        psiFlushOutput();
+
+        const psi_bool isRange = benchmark->rangeHi != 0;
+        const psi_ull numSizes = psiBenchmarkSizes(benchmark, sizes, PSI_MAX_BENCHMARK_SIZES_);
+        psi_bool passed = psi_true;
+        psi_bool isSlower = psi_false;
+        const psi_u64 start = psiClockRead(PSI_TIMER_REAL_);
+        psiReportPrintf("<properties>");
+        for(psi_ull j = 0; j < numSizes && passed; j++) {
+            passed = psiRunBenchmark(benchmark, sizes[j], &result);
+            if(passed) {
+                char suffix[32] = "";
+                if(isRange)
+                    PSI_SNPRINTF(suffix, sizeof(suffix), "/%" PSI_PRIu64, sizes[j]);
+                PSI_SNPRINTF(key, sizeof(key), "%s%s", benchmark->name, suffix);
+
+                psiPrintBenchmarkResult(&result, sizes[j], suffix);
+                sizesAsDoubles[j] = PSI_CAST(double, sizes[j]);
+                medians[j] = result.median;
+
+                if(PSI_SOME(baseline) &&
+                   psiCompareToBaseline(&result, psiFindBaseline(baseline, numBaselineEntries, key), suffix))
+                    isSlower = psi_true;
+                if(PSI_SOME(save)) {
+                    fprintf(save, "%s", key);
+                    for(psi_ull k = 0; k < result.numSamples; k++)
+                        fprintf(save, " %.3f", result.samples[k]);
+                    fprintf(save, "\n");
+                }
+            }
+            psiFlushOutput();
+        }
+        if(passed && isRange && numSizes > 1) {
+            double rms = 0;
+            const psiComplexityStruct* const complexity = psiFitComplexity(sizesAsDoubles, medians, numSizes, &rms);
+            if(PSI_SOME(complexity)) {
+                psiTerminalPrintf("             complexity: %s, RMS %.1f%%\n", complexity->name, rms * 100);
+                psiReportPrintf("<property name=\"complexity\" value=\"%s\"/>"
+                                "<property name=\"complexity_rms\" value=\"%.4f\"/>", complexity->name, rms);
+            }
         }
+        psiReportPrintf("</properties>");
+        const psi_u64 duration = psiClockRead(PSI_TIMER_REAL_) - start;
 
-        else {
-            printf("ERROR: Unrecognized option: %s", argv[i]);
-            return psi_false;
+        if(passed && !isSlower) {
+            psiReportPrintf("</testcase>\n");
+            psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[       OK ] ");
+        } else {
+            failed[numFailed++] = benchmark;
+            psiReportPrintf("<failure message=\"%s\"/></testcase>\n",
+                            passed ? "Slower than the baseline" : "Benchmark failed");
+            psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "[  FAILED  ] ");
         }
+        psiColouredPrintf(PSI_COLOUR_DEFAULT_, "%s (", benchmark->name);
+        psiClockPrintDuration(duration);
+        psiTerminalPrintf(")\n");
     }
 
-    return psi_true;
+    psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[==========] ");
+    psiColouredPrintf(PSI_COLOUR_DEFAULT_, "%" PSI_PRIu64 " benchmarks ran\n", PSI_CAST(psi_u64, numToRun));
+    psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[  PASSED  ] %" PSI_PRIu64 " %s\n",
+                            PSI_CAST(psi_u64, (numToRun - numFailed)),
+                            numToRun - numFailed == 1 ? "benchmark" : "benchmarks");
+    if(numFailed > 0) {
+        psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "[  FAILED  ] %" PSI_PRIu64 " %s\n",
+                                PSI_CAST(psi_u64, numFailed), numFailed == 1 ? "benchmark" : "benchmarks");
+        for(psi_ull i = 0; i < numFailed; i++)
+            psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "  [ FAILED ] %s\n", failed[i]->name);
+    }
+    psiReportPrintf("</testsuite>\n</testsuites>\n");
+
+    // The exit code
+    psiStatsNumTestsFailed += numFailed;
+    free(result.samples);
+    if(PSI_SOME(save))
+        fclose(save);
+    for(psi_ull i = 0; i < numBaselineEntries; i++) {
+        free(baseline[i].key);
+        free(baseline[i].samples);
+    }
+    free(baseline);
+    free(PSI_PTRCAST(void*, failed));
+    free(PSI_PTRCAST(void*, benchmarks));
 }
 
-static int psiCleanup() {
-    for (psi_ull i = 0; i < psiTestContext.numTestSuites; i++)
-        free(PSI_PTRCAST(void* , psiTestContext.tests[i].name));
-
-    free(PSI_PTRCAST(void* , psiStatsFailedTestSuites));
-    free(PSI_PTRCAST(void* , psiTestContext.tests));
 
-    if(psiTestContext.foutput)
-        fclose(psiTestContext.foutput);
+typedef struct psiRankedTestStruct {
+    double cost;
+    psi_ull index;
+} psiRankedTestStruct;
 
-    return PSI_CAST(int, psiStatsNumTestsFailed);
+// Most expensive first, then by name
+static int psiCompareRankedTests(const void* const lhs, const void* const rhs) {
+    const psiRankedTestStruct* const a = PSI_CAST(const psiRankedTestStruct*, lhs);
+    const psiRankedTestStruct* const b = PSI_CAST(const psiRankedTestStruct*, rhs);
+    if(a->cost != b->cost)
+        return a->cost > b->cost ? -1 : 1;
+    return strcmp(psiTestContext.tests[a->index].name, psiTestContext.tests[b->index].name);
 }
 
-// Triggers and runs all unit tests
-static void psiRunTests() {
-    // Run tests
+// The `--top` most expensive tests that ran, by `--sort-by`
+static void psiPrintTopTests() {
+    static const char* const keys[] = {"", "max RSS growth", "page faults", "duration"};
+    psiRankedTestStruct* const ranked = PSI_PTRCAST(psiRankedTestStruct*,
+                                                  malloc(sizeof(psiRankedTestStruct) * (psiTestContext.numTestSuites + 1)));
+    psi_ull numRanked = 0;
     for(psi_ull i = 0; i < psiTestContext.numTestSuites; i++) {
-        checkIsInsideTestSuite = 1;
-        hasCurrentTestFailed = 0;
-
-        if(psiShouldFilterTest(cmd_filter, psiTestContext.tests[i].name))
+        if(psiStatsTestDurations[i] < 0)
             continue;
 
-        if(!psiDisplayOnlyFailedOutput) {
-            psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[ RUN      ] ");
-            psiColouredPrintf(PSI_COLOUR_DEFAULT_, "%s\n", psiTestContext.tests[i].name);
+        const psiUsageStruct* const usage = &psiStatsTestUsage[i];
+        ranked[numRanked].index = i;
+        switch(psiSortBy) {
+            case PSI_SORT_BY_RSS_:      ranked[numRanked].cost = PSI_CAST(double, usage->rssGrowth); break;
+            case PSI_SORT_BY_FAULTS_:   ranked[numRanked].cost = PSI_CAST(double, (usage->minorFaults + usage->majorFaults)); break;
+            default:                    ranked[numRanked].cost = psiStatsTestDurations[i]; break;
         }
+        numRanked++;
+    }
+    qsort(ranked, numRanked, sizeof(psiRankedTestStruct), psiCompareRankedTests);
+
+    const psi_ull numToPrint = psiTopTests < numRanked ? psiTopTests : numRanked;
+    psiColouredPrintf(PSI_COLOUR_BOLD_, "\nTop %" PSI_PRIu64 " test suites by %s:\n",
+                      PSI_CAST(psi_u64, numToPrint), keys[psiSortBy]);
+    for(psi_ull i = 0; i < numToPrint; i++) {
+        const psi_ull index = ranked[i].index;
+        psiTerminalPrintf("    %s: ", psiTestContext.tests[index].name);
+        psiPrintUsage_(&psiStatsTestUsage[index]);
+        psiTerminalPrintf(", ");
+        psiClockPrintDuration(PSI_CAST(psi_u64, psiStatsTestDurations[index]));
+        psiTerminalPrintf("\n");
+    }
+    free(ranked);
+}
 
-        if(psiTestContext.foutput)
-            fprintf(psiTestContext.foutput, "<testcase name=\"%s\">", psiTestContext.tests[i].name);
+// Orders tests by their `Suite` part, so that each suite's tests are next to each other
+static int psiCompareTestSuites(const void* const lhs, const void* const rhs) {
+    const char* const a = psiTestContext.tests[PSI_CAST(const psiRankedTestStruct*, lhs)->index].name;
+    const char* const b = psiTestContext.tests[PSI_CAST(const psiRankedTestStruct*, rhs)->index].name;
+    const size_t aLength = strcspn(a, ".");
+    const size_t bLength = strcspn(b, ".");
+    const int order = strncmp(a, b, aLength < bLength ? aLength : bLength);
+    if(order != 0 || aLength == bLength)
+        return order;
+    return aLength < bLength ? -1 : 1;
+}
 
-        // Start the timer
-        const double start = psiClock();
+// Nearest-rank percentile of an ascending array
+static double psiPercentile(const double* const sorted, const psi_ull n, const double percent) {
+    psi_ull rank = PSI_CAST(psi_ull, ceil(percent / 100 * PSI_CAST(double, n)));
+    if(rank < 1)
+        rank = 1;
+    return sorted[rank - 1];
+}
 
-        // The actual test
-        psiTestContext.tests[i].func();
+// The `--durations` slowest tests, the time spent in each suite, and how the durations are spread
+static void psiPrintDurations() {
+    psiRankedTestStruct* const ranked = PSI_PTRCAST(psiRankedTestStruct*,
+                                                  malloc(sizeof(psiRankedTestStruct) * (psiTestContext.numTestSuites + 1)));
+    psiRankedTestStruct* const suites = PSI_PTRCAST(psiRankedTestStruct*,
+                                                  malloc(sizeof(psiRankedTestStruct) * (psiTestContext.numTestSuites + 1)));
+    double* const sorted = PSI_PTRCAST(double*, malloc(sizeof(double) * (psiTestContext.numTestSuites + 1)));
+    psi_ull numRanked = 0;
+    psi_ull numSuites = 0;
+    for(psi_ull i = 0; i < psiTestContext.numTestSuites; i++) {
+        if(psiStatsTestDurations[i] < 0)
+            continue;
 
-        // Stop the timer
-        const double duration = psiClock() - start;
+        ranked[numRanked].index = i;
+        ranked[numRanked].cost = psiStatsTestDurations[i];
+        sorted[numRanked] = psiStatsTestDurations[i];
+        numRanked++;
+    }
 
-        if(psiTestContext.foutput)
-            fprintf(psiTestContext.foutput, "</testcase>\n");
+    if(numRanked == 0) {
+        free(ranked);
+        free(suites);
+        free(sorted);
+        return;
+    }
 
-        if(hasCurrentTestFailed == 1) {
-            const psi_ull failed_testcase_index = psiStatsNumFailedTestSuites++;
-            psiStatsFailedTestSuites = PSI_PTRCAST(psi_ull*,
-                                            psi_realloc(PSI_PTRCAST(void*, psiStatsFailedTestSuites),
-                                                          sizeof(psi_ull) * psiStatsNumFailedTestSuites));
-            psiStatsFailedTestSuites[failed_testcase_index] = i;
-            psiStatsNumTestsFailed++;
-            psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "[  FAILED  ] ");
-            psiColouredPrintf(PSI_COLOUR_DEFAULT_, "%s (", psiTestContext.tests[i].name);
-            psiClockPrintDuration(duration);
-            printf(")\n");
-        } else {
-            if(!psiDisplayOnlyFailedOutput) {
-                psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[       OK ] ");
-                psiColouredPrintf(PSI_COLOUR_DEFAULT_, "%s (", psiTestContext.tests[i].name);
-                psiClockPrintDuration(duration);
-                printf(")\n");
-            }
+    // Sum the tests of each suite, keeping the first of them to name it by
+    qsort(ranked, numRanked, sizeof(psiRankedTestStruct), psiCompareTestSuites);
+    for(psi_ull i = 0; i < numRanked; i++) {
+        if(numSuites == 0 || psiCompareTestSuites(&suites[numSuites - 1], &ranked[i]) != 0) {
+            suites[numSuites] = ranked[i];
+            numSuites++;
         }
+        else
+            suites[numSuites - 1].cost += ranked[i].cost;
     }
-    psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[==========] ");
-    psiColouredPrintf(PSI_COLOUR_DEFAULT_, "%" PSI_PRIu64 " test suites ran\n", psiStatsTestsRan);
+    qsort(suites, numSuites, sizeof(psiRankedTestStruct), psiCompareRankedTests);
+    qsort(ranked, numRanked, sizeof(psiRankedTestStruct), psiCompareRankedTests);
+    qsort(sorted, numRanked, sizeof(double), psiCompareDoubles);
+
+    const psi_ull numToPrint = psiNumSlowestTests < numRanked ? psiNumSlowestTests : numRanked;
+    psiColouredPrintf(PSI_COLOUR_BOLD_, "\nSlowest %" PSI_PRIu64 " test suites:\n", PSI_CAST(psi_u64, numToPrint));
+    for(psi_ull i = 0; i < numToPrint; i++) {
+        psiTerminalPrintf("    ");
+        psiClockPrintDuration(PSI_CAST(psi_u64, ranked[i].cost));
+        psiTerminalPrintf("  %s\n", psiTestContext.tests[ranked[i].index].name);
+    }
+
+    psiColouredPrintf(PSI_COLOUR_BOLD_, "\nTime per suite:\n");
+    for(psi_ull i = 0; i < numSuites; i++) {
+        const char* const name = psiTestContext.tests[suites[i].index].name;
+        psiTerminalPrintf("    ");
+        psiClockPrintDuration(PSI_CAST(psi_u64, suites[i].cost));
+        psiTerminalPrintf("  %.*s\n", PSI_CAST(int, strcspn(name, ".")), name);
+    }
+
+    psiColouredPrintf(PSI_COLOUR_BOLD_, "\nDurations:\n");
+    psiTerminalPrintf("    p50 ");
+    psiClockPrintDuration(PSI_CAST(psi_u64, psiPercentile(sorted, numRanked, 50)));
+    psiTerminalPrintf(", p90 ");
+    psiClockPrintDuration(PSI_CAST(psi_u64, psiPercentile(sorted, numRanked, 90)));
+    psiTerminalPrintf(", p99 ");
+    psiClockPrintDuration(PSI_CAST(psi_u64, psiPercentile(sorted, numRanked, 99)));
+    psiTerminalPrintf(", max ");
+    psiClockPrintDuration(PSI_CAST(psi_u64, sorted[numRanked - 1]));
+    psiTerminalPrintf("\n");
+
+    free(ranked);
+    free(suites);
+    free(sorted);
 }
 
 
 static inline int psi_main(const int argc, const char* const * const argv);
 inline int psi_main(const int argc, const char* const * const argv) {
+    // Lay the registered tests out in registration order, after the ones in the linker section (if any)
+    psi_ull numInSection = 0;
+#ifdef PSI_HAS_SECTION_REGISTRY_
+    if(PSI_SOME(psiRegistryStart_))
+        numInSection = PSI_CAST(psi_ull, (psiRegistryStop_ - psiRegistryStart_));
+#endif // PSI_HAS_SECTION_REGISTRY_
+    psiTestContext.tests = PSI_PTRCAST(psiTestSuiteStruct*,
+                                  malloc(sizeof(psiTestSuiteStruct) *
+                                         (numInSection + psiTestContext.numTestSuites +
+                                          psiTestContext.numDynamicTests + 1)));
+#ifdef PSI_HAS_SECTION_REGISTRY_
+    for(psi_ull i = 0; i < numInSection; i++)
+        psiTestContext.tests[i] = *psiRegistryStart_[i];
+#endif // PSI_HAS_SECTION_REGISTRY_
+    psiTestContext.numTestSuites += numInSection;
+    psi_ull index = psiTestContext.numTestSuites;
+    for(const psiTestSuiteStruct* test = psiTestContext.registered; PSI_SOME(test); test = test->next)
+        psiTestContext.tests[--index] = *test;
+    // ...and then the ones added at runtime
+    if(psiTestContext.numDynamicTests > 0)
+        memcpy(psiTestContext.tests + psiTestContext.numTestSuites, psiTestContext.dynamicTests,
+               sizeof(psiTestSuiteStruct) * psiTestContext.numDynamicTests);
+    psiTestContext.numTestSuites += psiTestContext.numDynamicTests;
+    psiExpandParamTests();
+
     psiStatsTotalTestSuites = PSI_CAST(psi_u64, psiTestContext.numTestSuites);
     psi_argv0_ = argv[0];
-
-    // Start the entire Test Session timer
-    const double start = psiClock();
+#ifdef PSI_HAS_ALLOC_HOOKS_
+    psiTestContext.tracksAllocs = 1;
+#endif // PSI_HAS_ALLOC_HOOKS_
 
     const psi_bool wasCmdLineReadSuccessful = psiCmdLineRead(argc, argv);
     if (psiDisplayTests)
@@ -1172,32 +7403,43 @@ inline int psi_main(const int argc, const char* const * const argv) {
     if(!wasCmdLineReadSuccessful)
         return psiCleanup();
 
+    if(psiBenchmarkMode) {
+        psiRunBenchmarks();
+        return psiCleanup();
+    }
+
+    // Start the entire Test Session timer (always in real time, whatever `--time` measures the tests with)
+    const psi_u64 start = psiClockRead(PSI_TIMER_REAL_);
+
+    if(psiTimingCachePath)
+        psiCachedDurations = psiLoadTimingCache(psiTimingCachePath);
+    if(psiShardCount > 1)
+        psiAssignShards();
+
     for (psi_ull i = 0; i < psiTestContext.numTestSuites; i++) {
-        if(psiShouldFilterTest(cmd_filter, psiTestContext.tests[i].name))
+        if(!psiShouldRunTest(i))
             psiStatsSkippedTests++;
     }
 
     psiStatsTestsRan = psiStatsTotalTestSuites - psiStatsSkippedTests;
+    if(psiTestContext.fuzzTarget && psiStatsTestsRan == 0) {
+        psiTerminalPrintf("ERROR: No PSI_FUZZ target named %s\n", psiTestContext.fuzzTarget);
+        return psiCleanup();
+    }
 
     // Begin tests`
     psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[==========] ");
     psiColouredPrintf(PSI_COLOUR_BOLD_, "Running %" PSI_PRIu64 " test suites.\n", PSI_CAST(psi_u64, psiStatsTestsRan));
 
-    if(psiTestContext.foutput) {
-        fprintf(psiTestContext.foutput, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
-        fprintf(psiTestContext.foutput,
-                "<testsuites tests=\"%" PSI_PRIu64 "\" name=\"All\">\n",
-                PSI_CAST(psi_u64, psiStatsTestsRan));
-        fprintf(psiTestContext.foutput,
-                "<testsuite name=\"Tests\" tests=\"%" PSI_PRIu64 "\">\n",
-                PSI_CAST(psi_u64, psiStatsTestsRan));
-    }
+    psiReportPrintf("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    psiReportPrintf("<testsuites tests=\"%" PSI_PRIu64 "\" name=\"All\">\n", PSI_CAST(psi_u64, psiStatsTestsRan));
+    psiReportPrintf("<testsuite name=\"Tests\" tests=\"%" PSI_PRIu64 "\">\n", PSI_CAST(psi_u64, psiStatsTestsRan));
 
     // Run tests
     psiRunTests();
 
     // End the entire Test Session timer
-    const double duration = psiClock() - start;
+    const psi_u64 duration = psiClockRead(PSI_TIMER_REAL_) - start;
 
     // Write a Summary
     psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "[  PASSED  ] %" PSI_PRIu64 " %s\n",
@@ -1211,20 +7453,25 @@ inline int psi_main(const int argc, const char* const * const argv) {
     if(!psiDisableSummary) {
         psiColouredPrintf(PSI_COLOUR_BOLD_, "\nSummary:\n");
 
-        printf("    Total test suites:          %" PSI_PRIu64 "\n", psiStatsTotalTestSuites);
-        printf("    Total suites run:           %" PSI_PRIu64 "\n", psiStatsTestsRan);
-        printf("    Total warnings generated:   %" PSI_PRIu64 "\n", psiStatsNumWarnings);
-        printf("    Total suites skipped:       %" PSI_PRIu64 "\n", psiStatsSkippedTests);
-        printf("    Total suites failed:        %" PSI_PRIu64 "\n", psiStatsNumTestsFailed);
+        psiTerminalPrintf("    Total test suites:          %" PSI_PRIu64 "\n", psiStatsTotalTestSuites);
+        psiTerminalPrintf("    Total suites run:           %" PSI_PRIu64 "\n", psiStatsTestsRan);
+        psiTerminalPrintf("    Total warnings generated:   %" PSI_PRIu64 "\n", psiStatsNumWarnings);
+        psiTerminalPrintf("    Total suites skipped:       %" PSI_PRIu64 "\n", psiStatsSkippedTests);
+        psiTerminalPrintf("    Total suites failed:        %" PSI_PRIu64 "\n", psiStatsNumTestsFailed);
+
+        if(psiSortBy != PSI_SORT_BY_NONE_ && psiCollectUsage)
+            psiPrintTopTests();
+        if(psiNumSlowestTests > 0)
+            psiPrintDurations();
     }
 
     if(psiStatsNumTestsFailed > 0) {
         psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "FAILED: ");
-        printf("%" PSI_PRIu64 " failed, %" PSI_PRIu64 " passed in ",
+        psiTerminalPrintf("%" PSI_PRIu64 " failed, %" PSI_PRIu64 " passed in ",
                             psiStatsNumTestsFailed,
                             psiStatsTestsRan - psiStatsNumTestsFailed);
         psiClockPrintDuration(duration);
-        printf("\n");
+        psiTerminalPrintf("\n");
 
         for (psi_ull i = 0; i < psiStatsNumFailedTestSuites; i++) {
             psiColouredPrintf(PSI_COLOUR_BRIGHTRED_, "  [ FAILED ] %s\n",
@@ -1234,17 +7481,16 @@ inline int psi_main(const int argc, const char* const * const argv) {
     } else if(psiStatsNumTestsFailed == 0 && psiStatsTotalTestSuites > 0) {
         const psi_u64 total_tests_passed = psiStatsTestsRan - psiStatsNumTestsFailed;
         psiColouredPrintf(PSI_COLOUR_BRIGHTGREEN_, "SUCCESS: ");
-        printf("%" PSI_PRIu64 " test suites passed in ", total_tests_passed);
+        psiTerminalPrintf("%" PSI_PRIu64 " test suites passed in ", total_tests_passed);
         psiClockPrintDuration(duration);
-        printf("\n");
+        psiTerminalPrintf("\n");
     } else {
         psiColouredPrintf(PSI_COLOUR_BRIGHTYELLOW_, "WARNING: ");
-        printf("No test suites were found. If you think this was an error, please file an issue on Psi's Github repo.");
-        printf("\n");
+        psiTerminalPrintf("No test suites were found. If you think this was an error, please file an issue on Psi's Github repo.");
+        psiTerminalPrintf("\n");
     }
 
-    if(psiTestContext.foutput)
-        fprintf(psiTestContext.foutput, "</testsuite>\n</testsuites>\n");
+    psiReportPrintf("</testsuite>\n</testsuites>\n");
 
     return psiCleanup();
 }
@@ -1264,22 +7510,26 @@ inline int psi_main(const int argc, const char* const * const argv) {
     See: https://stackoverflow.com/questions/1856599/when-to-use-static-keyword-before-global-variables
 */
 #define PSI_ONLY_GLOBALS()                       \
-    volatile int checkIsInsideTestSuite = 0;     \
-    volatile int hasCurrentTestFailed = 0;       \
-    volatile int shouldFailTest = 0;             \
-    volatile int shouldAbortTest = 0;            \
     psi_u64 psiStatsNumWarnings = 0;
 
 // If a user wants to define their own `main()` function, this _must_ be at the very end of the functtion
-#define PSI_NO_MAIN()                                       \
-    psiTestStateStruct psiTestContext = {0, 0, 0};          \
-    PSI_ONLY_GLOBALS()
+#define PSI_NO_MAIN()                                                          \
+    psiTestStateStruct psiTestContext = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}; \
+    /* Zero-initialized, like every static: `{0}` would warn about the members it leaves out */ \
+    PSI_THREAD_LOCAL psiThreadContextStruct psiThreadContext;                  \
+    PSI_ONLY_GLOBALS()                                                         \
+    PSI_ALLOC_HOOKS_()                                                         \
+    PSI_COVERAGE_HOOKS_()
 
 // Define a main() function to call into psi.h and start executing tests.
 #define PSI_MAIN()                                                             \
     /* Define the global struct that will hold the data we need to run Psi. */ \
-    psiTestStateStruct psiTestContext = {0, 0, 0};                             \
+    psiTestStateStruct psiTestContext = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}; \
+    /* Zero-initialized, like every static: `{0}` would warn about the members it leaves out */ \
+    PSI_THREAD_LOCAL psiThreadContextStruct psiThreadContext;                  \
     PSI_ONLY_GLOBALS()                                                         \
+    PSI_ALLOC_HOOKS_()                                                         \
+    PSI_COVERAGE_HOOKS_()                                                      \
                                                                                \
     int main(const int argc, const char* const * const argv) {                 \
         return psi_main(argc, argv);                                           \
@@ -1287,13 +7537,6 @@ inline int psi_main(const int argc, const char* const * const argv) {
 
 #endif // PSI_NO_TESTING
 
-#ifdef PSI_NO_TESTING
-    volatile int checkIsInsideTestSuite = 0;
-    volatile int hasCurrentTestFailed = 0;
-    // volatile int shouldFailTest = 0;
-    // volatile int shouldAbortTest = 0;
-#endif // PSI_NO_TESTING
-
 PSI_DISABLE_DEBUG_WARNINGS_POP
 
 #endif // PSI_H_
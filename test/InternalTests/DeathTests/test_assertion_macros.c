@@ -0,0 +1,29 @@
+#include "psi/psi.h"
+
+TEST_P(gen_tests_c, DEATHTESTS_ASSERTION_MACROS, "random_integers.txt") {
+    const psi_i64 num1 = psiFieldToInt(&psiParam->fields[0]);
+    const psi_i64 num2 = psiFieldToInt(&psiParam->fields[1]);
+
+    if(num1 < num2) {
+        CHECK_LT(num1, num2);
+        REQUIRE_LT(num1, num2);
+        CHECK_GT(num2, num1);
+        REQUIRE_GT(num2, num1);
+        CHECK_LE(num1, num2);
+        REQUIRE_LE(num1, num2);
+    } else if(num1 > num2) {
+        CHECK_GT(num1, num2);
+        REQUIRE_GT(num1, num2);
+        CHECK_LT(num2, num1);
+        REQUIRE_LT(num2, num1);
+        CHECK_GE(num1, num2);
+        REQUIRE_GE(num1, num2);
+    } else {
+        CHECK_EQ(num1, num2);
+        REQUIRE_EQ(num1, num2);
+        CHECK_GE(num1, num2);
+        REQUIRE_GE(num1, num2);
+        CHECK_LE(num1, num2);
+        REQUIRE_LE(num1, num2);
+    }
+}
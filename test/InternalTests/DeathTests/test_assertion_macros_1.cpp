@@ -1,4499 +0,0 @@
-#include <tau/tau.h>
-
-TEST(gen_tests_cpp, DEATHTESTS_ASSERTION_MACROS_1) {
-    CHECK_LT(16195, 381692);
-    REQUIRE_LT(16195, 381692);
-    CHECK_GT(381692, 16195);
-    REQUIRE_GT(381692, 16195);
-    CHECK_LE(16195, 381692);
-    REQUIRE_LE(16195, 381692);
-    CHECK_LT(155904, 445338);
-    REQUIRE_LT(155904, 445338);
-    CHECK_GT(445338, 155904);
-    REQUIRE_GT(445338, 155904);
-    CHECK_LE(155904, 445338);
-    REQUIRE_LE(155904, 445338);
-    CHECK_GT(764242, 145944);
-    REQUIRE_GT(764242, 145944);
-    CHECK_LT(145944, 764242);
-    REQUIRE_LT(145944, 764242);
-    CHECK_GE(764242, 145944);
-    REQUIRE_GE(764242, 145944);
-    CHECK_LT(203780, 812666);
-    REQUIRE_LT(203780, 812666);
-    CHECK_GT(812666, 203780);
-    REQUIRE_GT(812666, 203780);
-    CHECK_LE(203780, 812666);
-    REQUIRE_LE(203780, 812666);
-    CHECK_LT(417068, 969421);
-    REQUIRE_LT(417068, 969421);
-    CHECK_GT(969421, 417068);
-    REQUIRE_GT(969421, 417068);
-    CHECK_LE(417068, 969421);
-    REQUIRE_LE(417068, 969421);
-    CHECK_LT(203750, 594207);
-    REQUIRE_LT(203750, 594207);
-    CHECK_GT(594207, 203750);
-    REQUIRE_GT(594207, 203750);
-    CHECK_LE(203750, 594207);
-    REQUIRE_LE(203750, 594207);
-    CHECK_GT(943848, 866964);
-    REQUIRE_GT(943848, 866964);
-    CHECK_LT(866964, 943848);
-    REQUIRE_LT(866964, 943848);
-    CHECK_GE(943848, 866964);
-    REQUIRE_GE(943848, 866964);
-    CHECK_GT(388490, 43814);
-    REQUIRE_GT(388490, 43814);
-    CHECK_LT(43814, 388490);
-    REQUIRE_LT(43814, 388490);
-    CHECK_GE(388490, 43814);
-    REQUIRE_GE(388490, 43814);
-    CHECK_GT(677041, 585208);
-    REQUIRE_GT(677041, 585208);
-    CHECK_LT(585208, 677041);
-    REQUIRE_LT(585208, 677041);
-    CHECK_GE(677041, 585208);
-    REQUIRE_GE(677041, 585208);
-    CHECK_GT(371669, 264338);
-    REQUIRE_GT(371669, 264338);
-    CHECK_LT(264338, 371669);
-    REQUIRE_LT(264338, 371669);
-    CHECK_GE(371669, 264338);
-    REQUIRE_GE(371669, 264338);
-    CHECK_LT(199378, 677449);
-    REQUIRE_LT(199378, 677449);
-    CHECK_GT(677449, 199378);
-    REQUIRE_GT(677449, 199378);
-    CHECK_LE(199378, 677449);
-    REQUIRE_LE(199378, 677449);
-    CHECK_LT(304143, 645910);
-    REQUIRE_LT(304143, 645910);
-    CHECK_GT(645910, 304143);
-    REQUIRE_GT(645910, 304143);
-    CHECK_LE(304143, 645910);
-    REQUIRE_LE(304143, 645910);
-    CHECK_GT(950373, 750799);
-    REQUIRE_GT(950373, 750799);
-    CHECK_LT(750799, 950373);
-    REQUIRE_LT(750799, 950373);
-    CHECK_GE(950373, 750799);
-    REQUIRE_GE(950373, 750799);
-    CHECK_GT(754745, 249683);
-    REQUIRE_GT(754745, 249683);
-    CHECK_LT(249683, 754745);
-    REQUIRE_LT(249683, 754745);
-    CHECK_GE(754745, 249683);
-    REQUIRE_GE(754745, 249683);
-    CHECK_LT(610208, 682882);
-    REQUIRE_LT(610208, 682882);
-    CHECK_GT(682882, 610208);
-    REQUIRE_GT(682882, 610208);
-    CHECK_LE(610208, 682882);
-    REQUIRE_LE(610208, 682882);
-    CHECK_GT(624879, 213039);
-    REQUIRE_GT(624879, 213039);
-    CHECK_LT(213039, 624879);
-    REQUIRE_LT(213039, 624879);
-    CHECK_GE(624879, 213039);
-    REQUIRE_GE(624879, 213039);
-    CHECK_GT(442623, 159501);
-    REQUIRE_GT(442623, 159501);
-    CHECK_LT(159501, 442623);
-    REQUIRE_LT(159501, 442623);
-    CHECK_GE(442623, 159501);
-    REQUIRE_GE(442623, 159501);
-    CHECK_LT(2293, 727212);
-    REQUIRE_LT(2293, 727212);
-    CHECK_GT(727212, 2293);
-    REQUIRE_GT(727212, 2293);
-    CHECK_LE(2293, 727212);
-    REQUIRE_LE(2293, 727212);
-    CHECK_GT(841820, 368002);
-    REQUIRE_GT(841820, 368002);
-    CHECK_LT(368002, 841820);
-    REQUIRE_LT(368002, 841820);
-    CHECK_GE(841820, 368002);
-    REQUIRE_GE(841820, 368002);
-    CHECK_LT(370485, 689110);
-    REQUIRE_LT(370485, 689110);
-    CHECK_GT(689110, 370485);
-    REQUIRE_GT(689110, 370485);
-    CHECK_LE(370485, 689110);
-    REQUIRE_LE(370485, 689110);
-    CHECK_LT(454495, 514200);
-    REQUIRE_LT(454495, 514200);
-    CHECK_GT(514200, 454495);
-    REQUIRE_GT(514200, 454495);
-    CHECK_LE(454495, 514200);
-    REQUIRE_LE(454495, 514200);
-    CHECK_LT(136049, 288685);
-    REQUIRE_LT(136049, 288685);
-    CHECK_GT(288685, 136049);
-    REQUIRE_GT(288685, 136049);
-    CHECK_LE(136049, 288685);
-    REQUIRE_LE(136049, 288685);
-    CHECK_LT(272624, 958528);
-    REQUIRE_LT(272624, 958528);
-    CHECK_GT(958528, 272624);
-    REQUIRE_GT(958528, 272624);
-    CHECK_LE(272624, 958528);
-    REQUIRE_LE(272624, 958528);
-    CHECK_LT(149675, 893134);
-    REQUIRE_LT(149675, 893134);
-    CHECK_GT(893134, 149675);
-    REQUIRE_GT(893134, 149675);
-    CHECK_LE(149675, 893134);
-    REQUIRE_LE(149675, 893134);
-    CHECK_LT(446225, 721219);
-    REQUIRE_LT(446225, 721219);
-    CHECK_GT(721219, 446225);
-    REQUIRE_GT(721219, 446225);
-    CHECK_LE(446225, 721219);
-    REQUIRE_LE(446225, 721219);
-    CHECK_GT(805262, 34074);
-    REQUIRE_GT(805262, 34074);
-    CHECK_LT(34074, 805262);
-    REQUIRE_LT(34074, 805262);
-    CHECK_GE(805262, 34074);
-    REQUIRE_GE(805262, 34074);
-    CHECK_LT(451055, 694194);
-    REQUIRE_LT(451055, 694194);
-    CHECK_GT(694194, 451055);
-    REQUIRE_GT(694194, 451055);
-    CHECK_LE(451055, 694194);
-    REQUIRE_LE(451055, 694194);
-    CHECK_GT(818026, 199288);
-    REQUIRE_GT(818026, 199288);
-    CHECK_LT(199288, 818026);
-    REQUIRE_LT(199288, 818026);
-    CHECK_GE(818026, 199288);
-    REQUIRE_GE(818026, 199288);
-    CHECK_GT(482061, 84007);
-    REQUIRE_GT(482061, 84007);
-    CHECK_LT(84007, 482061);
-    REQUIRE_LT(84007, 482061);
-    CHECK_GE(482061, 84007);
-    REQUIRE_GE(482061, 84007);
-    CHECK_LT(358619, 739351);
-    REQUIRE_LT(358619, 739351);
-    CHECK_GT(739351, 358619);
-    REQUIRE_GT(739351, 358619);
-    CHECK_LE(358619, 739351);
-    REQUIRE_LE(358619, 739351);
-    CHECK_LT(613160, 818283);
-    REQUIRE_LT(613160, 818283);
-    CHECK_GT(818283, 613160);
-    REQUIRE_GT(818283, 613160);
-    CHECK_LE(613160, 818283);
-    REQUIRE_LE(613160, 818283);
-    CHECK_GT(757325, 400994);
-    REQUIRE_GT(757325, 400994);
-    CHECK_LT(400994, 757325);
-    REQUIRE_LT(400994, 757325);
-    CHECK_GE(757325, 400994);
-    REQUIRE_GE(757325, 400994);
-    CHECK_LT(820082, 904545);
-    REQUIRE_LT(820082, 904545);
-    CHECK_GT(904545, 820082);
-    REQUIRE_GT(904545, 820082);
-    CHECK_LE(820082, 904545);
-    REQUIRE_LE(820082, 904545);
-    CHECK_GT(482541, 48863);
-    REQUIRE_GT(482541, 48863);
-    CHECK_LT(48863, 482541);
-    REQUIRE_LT(48863, 482541);
-    CHECK_GE(482541, 48863);
-    REQUIRE_GE(482541, 48863);
-    CHECK_LT(57081, 529819);
-    REQUIRE_LT(57081, 529819);
-    CHECK_GT(529819, 57081);
-    REQUIRE_GT(529819, 57081);
-    CHECK_LE(57081, 529819);
-    REQUIRE_LE(57081, 529819);
-    CHECK_LT(120452, 252664);
-    REQUIRE_LT(120452, 252664);
-    CHECK_GT(252664, 120452);
-    REQUIRE_GT(252664, 120452);
-    CHECK_LE(120452, 252664);
-    REQUIRE_LE(120452, 252664);
-    CHECK_GT(908263, 295422);
-    REQUIRE_GT(908263, 295422);
-    CHECK_LT(295422, 908263);
-    REQUIRE_LT(295422, 908263);
-    CHECK_GE(908263, 295422);
-    REQUIRE_GE(908263, 295422);
-    CHECK_GT(766687, 12225);
-    REQUIRE_GT(766687, 12225);
-    CHECK_LT(12225, 766687);
-    REQUIRE_LT(12225, 766687);
-    CHECK_GE(766687, 12225);
-    REQUIRE_GE(766687, 12225);
-    CHECK_GT(984622, 67353);
-    REQUIRE_GT(984622, 67353);
-    CHECK_LT(67353, 984622);
-    REQUIRE_LT(67353, 984622);
-    CHECK_GE(984622, 67353);
-    REQUIRE_GE(984622, 67353);
-    CHECK_LT(159595, 555923);
-    REQUIRE_LT(159595, 555923);
-    CHECK_GT(555923, 159595);
-    REQUIRE_GT(555923, 159595);
-    CHECK_LE(159595, 555923);
-    REQUIRE_LE(159595, 555923);
-    CHECK_GT(912586, 533023);
-    REQUIRE_GT(912586, 533023);
-    CHECK_LT(533023, 912586);
-    REQUIRE_LT(533023, 912586);
-    CHECK_GE(912586, 533023);
-    REQUIRE_GE(912586, 533023);
-    CHECK_GT(428662, 338337);
-    REQUIRE_GT(428662, 338337);
-    CHECK_LT(338337, 428662);
-    REQUIRE_LT(338337, 428662);
-    CHECK_GE(428662, 338337);
-    REQUIRE_GE(428662, 338337);
-    CHECK_LT(619223, 748378);
-    REQUIRE_LT(619223, 748378);
-    CHECK_GT(748378, 619223);
-    REQUIRE_GT(748378, 619223);
-    CHECK_LE(619223, 748378);
-    REQUIRE_LE(619223, 748378);
-    CHECK_LT(396056, 483992);
-    REQUIRE_LT(396056, 483992);
-    CHECK_GT(483992, 396056);
-    REQUIRE_GT(483992, 396056);
-    CHECK_LE(396056, 483992);
-    REQUIRE_LE(396056, 483992);
-    CHECK_GT(999789, 146987);
-    REQUIRE_GT(999789, 146987);
-    CHECK_LT(146987, 999789);
-    REQUIRE_LT(146987, 999789);
-    CHECK_GE(999789, 146987);
-    REQUIRE_GE(999789, 146987);
-    CHECK_GT(568862, 101024);
-    REQUIRE_GT(568862, 101024);
-    CHECK_LT(101024, 568862);
-    REQUIRE_LT(101024, 568862);
-    CHECK_GE(568862, 101024);
-    REQUIRE_GE(568862, 101024);
-    CHECK_LT(152322, 863206);
-    REQUIRE_LT(152322, 863206);
-    CHECK_GT(863206, 152322);
-    REQUIRE_GT(863206, 152322);
-    CHECK_LE(152322, 863206);
-    REQUIRE_LE(152322, 863206);
-    CHECK_GT(638263, 447603);
-    REQUIRE_GT(638263, 447603);
-    CHECK_LT(447603, 638263);
-    REQUIRE_LT(447603, 638263);
-    CHECK_GE(638263, 447603);
-    REQUIRE_GE(638263, 447603);
-    CHECK_GT(795049, 734232);
-    REQUIRE_GT(795049, 734232);
-    CHECK_LT(734232, 795049);
-    REQUIRE_LT(734232, 795049);
-    CHECK_GE(795049, 734232);
-    REQUIRE_GE(795049, 734232);
-    CHECK_LT(533201, 604476);
-    REQUIRE_LT(533201, 604476);
-    CHECK_GT(604476, 533201);
-    REQUIRE_GT(604476, 533201);
-    CHECK_LE(533201, 604476);
-    REQUIRE_LE(533201, 604476);
-    CHECK_GT(955973, 63816);
-    REQUIRE_GT(955973, 63816);
-    CHECK_LT(63816, 955973);
-    REQUIRE_LT(63816, 955973);
-    CHECK_GE(955973, 63816);
-    REQUIRE_GE(955973, 63816);
-    CHECK_GT(888104, 39707);
-    REQUIRE_GT(888104, 39707);
-    CHECK_LT(39707, 888104);
-    REQUIRE_LT(39707, 888104);
-    CHECK_GE(888104, 39707);
-    REQUIRE_GE(888104, 39707);
-    CHECK_LT(122684, 623982);
-    REQUIRE_LT(122684, 623982);
-    CHECK_GT(623982, 122684);
-    REQUIRE_GT(623982, 122684);
-    CHECK_LE(122684, 623982);
-    REQUIRE_LE(122684, 623982);
-    CHECK_LT(283374, 473845);
-    REQUIRE_LT(283374, 473845);
-    CHECK_GT(473845, 283374);
-    REQUIRE_GT(473845, 283374);
-    CHECK_LE(283374, 473845);
-    REQUIRE_LE(283374, 473845);
-    CHECK_LT(291380, 758393);
-    REQUIRE_LT(291380, 758393);
-    CHECK_GT(758393, 291380);
-    REQUIRE_GT(758393, 291380);
-    CHECK_LE(291380, 758393);
-    REQUIRE_LE(291380, 758393);
-    CHECK_GT(667417, 200539);
-    REQUIRE_GT(667417, 200539);
-    CHECK_LT(200539, 667417);
-    REQUIRE_LT(200539, 667417);
-    CHECK_GE(667417, 200539);
-    REQUIRE_GE(667417, 200539);
-    CHECK_GT(974415, 949542);
-    REQUIRE_GT(974415, 949542);
-    CHECK_LT(949542, 974415);
-    REQUIRE_LT(949542, 974415);
-    CHECK_GE(974415, 949542);
-    REQUIRE_GE(974415, 949542);
-    CHECK_GT(381369, 313713);
-    REQUIRE_GT(381369, 313713);
-    CHECK_LT(313713, 381369);
-    REQUIRE_LT(313713, 381369);
-    CHECK_GE(381369, 313713);
-    REQUIRE_GE(381369, 313713);
-    CHECK_LT(284297, 657394);
-    REQUIRE_LT(284297, 657394);
-    CHECK_GT(657394, 284297);
-    REQUIRE_GT(657394, 284297);
-    CHECK_LE(284297, 657394);
-    REQUIRE_LE(284297, 657394);
-    CHECK_GT(887257, 732644);
-    REQUIRE_GT(887257, 732644);
-    CHECK_LT(732644, 887257);
-    REQUIRE_LT(732644, 887257);
-    CHECK_GE(887257, 732644);
-    REQUIRE_GE(887257, 732644);
-    CHECK_LT(115581, 308092);
-    REQUIRE_LT(115581, 308092);
-    CHECK_GT(308092, 115581);
-    REQUIRE_GT(308092, 115581);
-    CHECK_LE(115581, 308092);
-    REQUIRE_LE(115581, 308092);
-    CHECK_GT(728453, 102174);
-    REQUIRE_GT(728453, 102174);
-    CHECK_LT(102174, 728453);
-    REQUIRE_LT(102174, 728453);
-    CHECK_GE(728453, 102174);
-    REQUIRE_GE(728453, 102174);
-    CHECK_LT(799366, 956942);
-    REQUIRE_LT(799366, 956942);
-    CHECK_GT(956942, 799366);
-    REQUIRE_GT(956942, 799366);
-    CHECK_LE(799366, 956942);
-    REQUIRE_LE(799366, 956942);
-    CHECK_GT(992070, 843961);
-    REQUIRE_GT(992070, 843961);
-    CHECK_LT(843961, 992070);
-    REQUIRE_LT(843961, 992070);
-    CHECK_GE(992070, 843961);
-    REQUIRE_GE(992070, 843961);
-    CHECK_LT(304858, 649132);
-    REQUIRE_LT(304858, 649132);
-    CHECK_GT(649132, 304858);
-    REQUIRE_GT(649132, 304858);
-    CHECK_LE(304858, 649132);
-    REQUIRE_LE(304858, 649132);
-    CHECK_GT(223327, 108477);
-    REQUIRE_GT(223327, 108477);
-    CHECK_LT(108477, 223327);
-    REQUIRE_LT(108477, 223327);
-    CHECK_GE(223327, 108477);
-    REQUIRE_GE(223327, 108477);
-    CHECK_GT(889654, 652833);
-    REQUIRE_GT(889654, 652833);
-    CHECK_LT(652833, 889654);
-    REQUIRE_LT(652833, 889654);
-    CHECK_GE(889654, 652833);
-    REQUIRE_GE(889654, 652833);
-    CHECK_GT(392210, 294138);
-    REQUIRE_GT(392210, 294138);
-    CHECK_LT(294138, 392210);
-    REQUIRE_LT(294138, 392210);
-    CHECK_GE(392210, 294138);
-    REQUIRE_GE(392210, 294138);
-    CHECK_LT(298827, 343430);
-    REQUIRE_LT(298827, 343430);
-    CHECK_GT(343430, 298827);
-    REQUIRE_GT(343430, 298827);
-    CHECK_LE(298827, 343430);
-    REQUIRE_LE(298827, 343430);
-    CHECK_GT(846488, 189187);
-    REQUIRE_GT(846488, 189187);
-    CHECK_LT(189187, 846488);
-    REQUIRE_LT(189187, 846488);
-    CHECK_GE(846488, 189187);
-    REQUIRE_GE(846488, 189187);
-    CHECK_GT(409255, 376923);
-    REQUIRE_GT(409255, 376923);
-    CHECK_LT(376923, 409255);
-    REQUIRE_LT(376923, 409255);
-    CHECK_GE(409255, 376923);
-    REQUIRE_GE(409255, 376923);
-    CHECK_GT(582700, 84157);
-    REQUIRE_GT(582700, 84157);
-    CHECK_LT(84157, 582700);
-    REQUIRE_LT(84157, 582700);
-    CHECK_GE(582700, 84157);
-    REQUIRE_GE(582700, 84157);
-    CHECK_LT(87760, 662149);
-    REQUIRE_LT(87760, 662149);
-    CHECK_GT(662149, 87760);
-    REQUIRE_GT(662149, 87760);
-    CHECK_LE(87760, 662149);
-    REQUIRE_LE(87760, 662149);
-    CHECK_LT(225287, 897667);
-    REQUIRE_LT(225287, 897667);
-    CHECK_GT(897667, 225287);
-    REQUIRE_GT(897667, 225287);
-    CHECK_LE(225287, 897667);
-    REQUIRE_LE(225287, 897667);
-    CHECK_LT(300062, 949783);
-    REQUIRE_LT(300062, 949783);
-    CHECK_GT(949783, 300062);
-    REQUIRE_GT(949783, 300062);
-    CHECK_LE(300062, 949783);
-    REQUIRE_LE(300062, 949783);
-    CHECK_GT(651511, 569138);
-    REQUIRE_GT(651511, 569138);
-    CHECK_LT(569138, 651511);
-    REQUIRE_LT(569138, 651511);
-    CHECK_GE(651511, 569138);
-    REQUIRE_GE(651511, 569138);
-    CHECK_LT(599104, 624883);
-    REQUIRE_LT(599104, 624883);
-    CHECK_GT(624883, 599104);
-    REQUIRE_GT(624883, 599104);
-    CHECK_LE(599104, 624883);
-    REQUIRE_LE(599104, 624883);
-    CHECK_LT(183184, 615965);
-    REQUIRE_LT(183184, 615965);
-    CHECK_GT(615965, 183184);
-    REQUIRE_GT(615965, 183184);
-    CHECK_LE(183184, 615965);
-    REQUIRE_LE(183184, 615965);
-    CHECK_LT(579572, 640252);
-    REQUIRE_LT(579572, 640252);
-    CHECK_GT(640252, 579572);
-    REQUIRE_GT(640252, 579572);
-    CHECK_LE(579572, 640252);
-    REQUIRE_LE(579572, 640252);
-    CHECK_GT(828592, 557954);
-    REQUIRE_GT(828592, 557954);
-    CHECK_LT(557954, 828592);
-    REQUIRE_LT(557954, 828592);
-    CHECK_GE(828592, 557954);
-    REQUIRE_GE(828592, 557954);
-    CHECK_LT(418968, 524320);
-    REQUIRE_LT(418968, 524320);
-    CHECK_GT(524320, 418968);
-    REQUIRE_GT(524320, 418968);
-    CHECK_LE(418968, 524320);
-    REQUIRE_LE(418968, 524320);
-    CHECK_LT(320307, 361311);
-    REQUIRE_LT(320307, 361311);
-    CHECK_GT(361311, 320307);
-    REQUIRE_GT(361311, 320307);
-    CHECK_LE(320307, 361311);
-    REQUIRE_LE(320307, 361311);
-    CHECK_GT(629371, 301433);
-    REQUIRE_GT(629371, 301433);
-    CHECK_LT(301433, 629371);
-    REQUIRE_LT(301433, 629371);
-    CHECK_GE(629371, 301433);
-    REQUIRE_GE(629371, 301433);
-    CHECK_GT(118482, 71033);
-    REQUIRE_GT(118482, 71033);
-    CHECK_LT(71033, 118482);
-    REQUIRE_LT(71033, 118482);
-    CHECK_GE(118482, 71033);
-    REQUIRE_GE(118482, 71033);
-    CHECK_GT(221688, 174971);
-    REQUIRE_GT(221688, 174971);
-    CHECK_LT(174971, 221688);
-    REQUIRE_LT(174971, 221688);
-    CHECK_GE(221688, 174971);
-    REQUIRE_GE(221688, 174971);
-    CHECK_LT(631033, 662872);
-    REQUIRE_LT(631033, 662872);
-    CHECK_GT(662872, 631033);
-    REQUIRE_GT(662872, 631033);
-    CHECK_LE(631033, 662872);
-    REQUIRE_LE(631033, 662872);
-    CHECK_LT(203488, 788513);
-    REQUIRE_LT(203488, 788513);
-    CHECK_GT(788513, 203488);
-    REQUIRE_GT(788513, 203488);
-    CHECK_LE(203488, 788513);
-    REQUIRE_LE(203488, 788513);
-    CHECK_LT(218828, 988438);
-    REQUIRE_LT(218828, 988438);
-    CHECK_GT(988438, 218828);
-    REQUIRE_GT(988438, 218828);
-    CHECK_LE(218828, 988438);
-    REQUIRE_LE(218828, 988438);
-    CHECK_GT(813926, 402604);
-    REQUIRE_GT(813926, 402604);
-    CHECK_LT(402604, 813926);
-    REQUIRE_LT(402604, 813926);
-    CHECK_GE(813926, 402604);
-    REQUIRE_GE(813926, 402604);
-    CHECK_LT(235066, 793882);
-    REQUIRE_LT(235066, 793882);
-    CHECK_GT(793882, 235066);
-    REQUIRE_GT(793882, 235066);
-    CHECK_LE(235066, 793882);
-    REQUIRE_LE(235066, 793882);
-    CHECK_LT(92346, 593715);
-    REQUIRE_LT(92346, 593715);
-    CHECK_GT(593715, 92346);
-    REQUIRE_GT(593715, 92346);
-    CHECK_LE(92346, 593715);
-    REQUIRE_LE(92346, 593715);
-    CHECK_LT(121670, 350845);
-    REQUIRE_LT(121670, 350845);
-    CHECK_GT(350845, 121670);
-    REQUIRE_GT(350845, 121670);
-    CHECK_LE(121670, 350845);
-    REQUIRE_LE(121670, 350845);
-    CHECK_LT(940, 157185);
-    REQUIRE_LT(940, 157185);
-    CHECK_GT(157185, 940);
-    REQUIRE_GT(157185, 940);
-    CHECK_LE(940, 157185);
-    REQUIRE_LE(940, 157185);
-    CHECK_LT(170490, 472050);
-    REQUIRE_LT(170490, 472050);
-    CHECK_GT(472050, 170490);
-    REQUIRE_GT(472050, 170490);
-    CHECK_LE(170490, 472050);
-    REQUIRE_LE(170490, 472050);
-    CHECK_LT(132766, 966940);
-    REQUIRE_LT(132766, 966940);
-    CHECK_GT(966940, 132766);
-    REQUIRE_GT(966940, 132766);
-    CHECK_LE(132766, 966940);
-    REQUIRE_LE(132766, 966940);
-    CHECK_LT(312466, 579500);
-    REQUIRE_LT(312466, 579500);
-    CHECK_GT(579500, 312466);
-    REQUIRE_GT(579500, 312466);
-    CHECK_LE(312466, 579500);
-    REQUIRE_LE(312466, 579500);
-    CHECK_GT(468372, 391091);
-    REQUIRE_GT(468372, 391091);
-    CHECK_LT(391091, 468372);
-    REQUIRE_LT(391091, 468372);
-    CHECK_GE(468372, 391091);
-    REQUIRE_GE(468372, 391091);
-    CHECK_GT(348195, 119526);
-    REQUIRE_GT(348195, 119526);
-    CHECK_LT(119526, 348195);
-    REQUIRE_LT(119526, 348195);
-    CHECK_GE(348195, 119526);
-    REQUIRE_GE(348195, 119526);
-    CHECK_LT(366124, 950482);
-    REQUIRE_LT(366124, 950482);
-    CHECK_GT(950482, 366124);
-    REQUIRE_GT(950482, 366124);
-    CHECK_LE(366124, 950482);
-    REQUIRE_LE(366124, 950482);
-    CHECK_LT(60224, 540732);
-    REQUIRE_LT(60224, 540732);
-    CHECK_GT(540732, 60224);
-    REQUIRE_GT(540732, 60224);
-    CHECK_LE(60224, 540732);
-    REQUIRE_LE(60224, 540732);
-    CHECK_LT(444364, 746857);
-    REQUIRE_LT(444364, 746857);
-    CHECK_GT(746857, 444364);
-    REQUIRE_GT(746857, 444364);
-    CHECK_LE(444364, 746857);
-    REQUIRE_LE(444364, 746857);
-    CHECK_GT(603843, 567494);
-    REQUIRE_GT(603843, 567494);
-    CHECK_LT(567494, 603843);
-    REQUIRE_LT(567494, 603843);
-    CHECK_GE(603843, 567494);
-    REQUIRE_GE(603843, 567494);
-    CHECK_GT(762735, 52654);
-    REQUIRE_GT(762735, 52654);
-    CHECK_LT(52654, 762735);
-    REQUIRE_LT(52654, 762735);
-    CHECK_GE(762735, 52654);
-    REQUIRE_GE(762735, 52654);
-    CHECK_GT(478896, 460724);
-    REQUIRE_GT(478896, 460724);
-    CHECK_LT(460724, 478896);
-    REQUIRE_LT(460724, 478896);
-    CHECK_GE(478896, 460724);
-    REQUIRE_GE(478896, 460724);
-    CHECK_GT(734863, 731338);
-    REQUIRE_GT(734863, 731338);
-    CHECK_LT(731338, 734863);
-    REQUIRE_LT(731338, 734863);
-    CHECK_GE(734863, 731338);
-    REQUIRE_GE(734863, 731338);
-    CHECK_LT(32932, 423375);
-    REQUIRE_LT(32932, 423375);
-    CHECK_GT(423375, 32932);
-    REQUIRE_GT(423375, 32932);
-    CHECK_LE(32932, 423375);
-    REQUIRE_LE(32932, 423375);
-    CHECK_LT(133445, 762991);
-    REQUIRE_LT(133445, 762991);
-    CHECK_GT(762991, 133445);
-    REQUIRE_GT(762991, 133445);
-    CHECK_LE(133445, 762991);
-    REQUIRE_LE(133445, 762991);
-    CHECK_GT(857913, 365382);
-    REQUIRE_GT(857913, 365382);
-    CHECK_LT(365382, 857913);
-    REQUIRE_LT(365382, 857913);
-    CHECK_GE(857913, 365382);
-    REQUIRE_GE(857913, 365382);
-    CHECK_GT(93114, 92221);
-    REQUIRE_GT(93114, 92221);
-    CHECK_LT(92221, 93114);
-    REQUIRE_LT(92221, 93114);
-    CHECK_GE(93114, 92221);
-    REQUIRE_GE(93114, 92221);
-    CHECK_GT(266748, 157671);
-    REQUIRE_GT(266748, 157671);
-    CHECK_LT(157671, 266748);
-    REQUIRE_LT(157671, 266748);
-    CHECK_GE(266748, 157671);
-    REQUIRE_GE(266748, 157671);
-    CHECK_GT(696398, 356596);
-    REQUIRE_GT(696398, 356596);
-    CHECK_LT(356596, 696398);
-    REQUIRE_LT(356596, 696398);
-    CHECK_GE(696398, 356596);
-    REQUIRE_GE(696398, 356596);
-    CHECK_GT(506006, 88269);
-    REQUIRE_GT(506006, 88269);
-    CHECK_LT(88269, 506006);
-    REQUIRE_LT(88269, 506006);
-    CHECK_GE(506006, 88269);
-    REQUIRE_GE(506006, 88269);
-    CHECK_LT(295112, 309654);
-    REQUIRE_LT(295112, 309654);
-    CHECK_GT(309654, 295112);
-    REQUIRE_GT(309654, 295112);
-    CHECK_LE(295112, 309654);
-    REQUIRE_LE(295112, 309654);
-    CHECK_LT(518137, 794762);
-    REQUIRE_LT(518137, 794762);
-    CHECK_GT(794762, 518137);
-    REQUIRE_GT(794762, 518137);
-    CHECK_LE(518137, 794762);
-    REQUIRE_LE(518137, 794762);
-    CHECK_GT(771520, 157852);
-    REQUIRE_GT(771520, 157852);
-    CHECK_LT(157852, 771520);
-    REQUIRE_LT(157852, 771520);
-    CHECK_GE(771520, 157852);
-    REQUIRE_GE(771520, 157852);
-    CHECK_LT(67227, 140148);
-    REQUIRE_LT(67227, 140148);
-    CHECK_GT(140148, 67227);
-    REQUIRE_GT(140148, 67227);
-    CHECK_LE(67227, 140148);
-    REQUIRE_LE(67227, 140148);
-    CHECK_GT(270408, 186509);
-    REQUIRE_GT(270408, 186509);
-    CHECK_LT(186509, 270408);
-    REQUIRE_LT(186509, 270408);
-    CHECK_GE(270408, 186509);
-    REQUIRE_GE(270408, 186509);
-    CHECK_GT(344647, 65804);
-    REQUIRE_GT(344647, 65804);
-    CHECK_LT(65804, 344647);
-    REQUIRE_LT(65804, 344647);
-    CHECK_GE(344647, 65804);
-    REQUIRE_GE(344647, 65804);
-    CHECK_GT(580647, 46506);
-    REQUIRE_GT(580647, 46506);
-    CHECK_LT(46506, 580647);
-    REQUIRE_LT(46506, 580647);
-    CHECK_GE(580647, 46506);
-    REQUIRE_GE(580647, 46506);
-    CHECK_GT(749252, 86053);
-    REQUIRE_GT(749252, 86053);
-    CHECK_LT(86053, 749252);
-    REQUIRE_LT(86053, 749252);
-    CHECK_GE(749252, 86053);
-    REQUIRE_GE(749252, 86053);
-    CHECK_LT(384341, 387678);
-    REQUIRE_LT(384341, 387678);
-    CHECK_GT(387678, 384341);
-    REQUIRE_GT(387678, 384341);
-    CHECK_LE(384341, 387678);
-    REQUIRE_LE(384341, 387678);
-    CHECK_LT(165997, 969005);
-    REQUIRE_LT(165997, 969005);
-    CHECK_GT(969005, 165997);
-    REQUIRE_GT(969005, 165997);
-    CHECK_LE(165997, 969005);
-    REQUIRE_LE(165997, 969005);
-    CHECK_GT(571082, 352288);
-    REQUIRE_GT(571082, 352288);
-    CHECK_LT(352288, 571082);
-    REQUIRE_LT(352288, 571082);
-    CHECK_GE(571082, 352288);
-    REQUIRE_GE(571082, 352288);
-    CHECK_LT(184660, 285428);
-    REQUIRE_LT(184660, 285428);
-    CHECK_GT(285428, 184660);
-    REQUIRE_GT(285428, 184660);
-    CHECK_LE(184660, 285428);
-    REQUIRE_LE(184660, 285428);
-    CHECK_GT(581879, 580030);
-    REQUIRE_GT(581879, 580030);
-    CHECK_LT(580030, 581879);
-    REQUIRE_LT(580030, 581879);
-    CHECK_GE(581879, 580030);
-    REQUIRE_GE(581879, 580030);
-    CHECK_LT(33755, 707149);
-    REQUIRE_LT(33755, 707149);
-    CHECK_GT(707149, 33755);
-    REQUIRE_GT(707149, 33755);
-    CHECK_LE(33755, 707149);
-    REQUIRE_LE(33755, 707149);
-    CHECK_GT(288633, 144467);
-    REQUIRE_GT(288633, 144467);
-    CHECK_LT(144467, 288633);
-    REQUIRE_LT(144467, 288633);
-    CHECK_GE(288633, 144467);
-    REQUIRE_GE(288633, 144467);
-    CHECK_LT(487159, 831572);
-    REQUIRE_LT(487159, 831572);
-    CHECK_GT(831572, 487159);
-    REQUIRE_GT(831572, 487159);
-    CHECK_LE(487159, 831572);
-    REQUIRE_LE(487159, 831572);
-    CHECK_GT(626356, 93776);
-    REQUIRE_GT(626356, 93776);
-    CHECK_LT(93776, 626356);
-    REQUIRE_LT(93776, 626356);
-    CHECK_GE(626356, 93776);
-    REQUIRE_GE(626356, 93776);
-    CHECK_GT(451480, 148793);
-    REQUIRE_GT(451480, 148793);
-    CHECK_LT(148793, 451480);
-    REQUIRE_LT(148793, 451480);
-    CHECK_GE(451480, 148793);
-    REQUIRE_GE(451480, 148793);
-    CHECK_GT(494891, 270263);
-    REQUIRE_GT(494891, 270263);
-    CHECK_LT(270263, 494891);
-    REQUIRE_LT(270263, 494891);
-    CHECK_GE(494891, 270263);
-    REQUIRE_GE(494891, 270263);
-    CHECK_GT(67053, 33781);
-    REQUIRE_GT(67053, 33781);
-    CHECK_LT(33781, 67053);
-    REQUIRE_LT(33781, 67053);
-    CHECK_GE(67053, 33781);
-    REQUIRE_GE(67053, 33781);
-    CHECK_LT(184015, 627979);
-    REQUIRE_LT(184015, 627979);
-    CHECK_GT(627979, 184015);
-    REQUIRE_GT(627979, 184015);
-    CHECK_LE(184015, 627979);
-    REQUIRE_LE(184015, 627979);
-    CHECK_GT(767871, 278775);
-    REQUIRE_GT(767871, 278775);
-    CHECK_LT(278775, 767871);
-    REQUIRE_LT(278775, 767871);
-    CHECK_GE(767871, 278775);
-    REQUIRE_GE(767871, 278775);
-    CHECK_GT(770001, 87947);
-    REQUIRE_GT(770001, 87947);
-    CHECK_LT(87947, 770001);
-    REQUIRE_LT(87947, 770001);
-    CHECK_GE(770001, 87947);
-    REQUIRE_GE(770001, 87947);
-    CHECK_GT(747564, 233442);
-    REQUIRE_GT(747564, 233442);
-    CHECK_LT(233442, 747564);
-    REQUIRE_LT(233442, 747564);
-    CHECK_GE(747564, 233442);
-    REQUIRE_GE(747564, 233442);
-    CHECK_LT(445046, 640881);
-    REQUIRE_LT(445046, 640881);
-    CHECK_GT(640881, 445046);
-    REQUIRE_GT(640881, 445046);
-    CHECK_LE(445046, 640881);
-    REQUIRE_LE(445046, 640881);
-    CHECK_LT(510469, 991561);
-    REQUIRE_LT(510469, 991561);
-    CHECK_GT(991561, 510469);
-    REQUIRE_GT(991561, 510469);
-    CHECK_LE(510469, 991561);
-    REQUIRE_LE(510469, 991561);
-    CHECK_LT(63559, 627305);
-    REQUIRE_LT(63559, 627305);
-    CHECK_GT(627305, 63559);
-    REQUIRE_GT(627305, 63559);
-    CHECK_LE(63559, 627305);
-    REQUIRE_LE(63559, 627305);
-    CHECK_LT(252370, 814913);
-    REQUIRE_LT(252370, 814913);
-    CHECK_GT(814913, 252370);
-    REQUIRE_GT(814913, 252370);
-    CHECK_LE(252370, 814913);
-    REQUIRE_LE(252370, 814913);
-    CHECK_LT(183194, 184162);
-    REQUIRE_LT(183194, 184162);
-    CHECK_GT(184162, 183194);
-    REQUIRE_GT(184162, 183194);
-    CHECK_LE(183194, 184162);
-    REQUIRE_LE(183194, 184162);
-    CHECK_GT(413492, 272419);
-    REQUIRE_GT(413492, 272419);
-    CHECK_LT(272419, 413492);
-    REQUIRE_LT(272419, 413492);
-    CHECK_GE(413492, 272419);
-    REQUIRE_GE(413492, 272419);
-    CHECK_LT(282961, 652350);
-    REQUIRE_LT(282961, 652350);
-    CHECK_GT(652350, 282961);
-    REQUIRE_GT(652350, 282961);
-    CHECK_LE(282961, 652350);
-    REQUIRE_LE(282961, 652350);
-    CHECK_LT(474315, 562264);
-    REQUIRE_LT(474315, 562264);
-    CHECK_GT(562264, 474315);
-    REQUIRE_GT(562264, 474315);
-    CHECK_LE(474315, 562264);
-    REQUIRE_LE(474315, 562264);
-    CHECK_GT(637305, 380147);
-    REQUIRE_GT(637305, 380147);
-    CHECK_LT(380147, 637305);
-    REQUIRE_LT(380147, 637305);
-    CHECK_GE(637305, 380147);
-    REQUIRE_GE(637305, 380147);
-    CHECK_GT(716162, 656701);
-    REQUIRE_GT(716162, 656701);
-    CHECK_LT(656701, 716162);
-    REQUIRE_LT(656701, 716162);
-    CHECK_GE(716162, 656701);
-    REQUIRE_GE(716162, 656701);
-    CHECK_LT(447809, 701560);
-    REQUIRE_LT(447809, 701560);
-    CHECK_GT(701560, 447809);
-    REQUIRE_GT(701560, 447809);
-    CHECK_LE(447809, 701560);
-    REQUIRE_LE(447809, 701560);
-    CHECK_LT(297490, 584206);
-    REQUIRE_LT(297490, 584206);
-    CHECK_GT(584206, 297490);
-    REQUIRE_GT(584206, 297490);
-    CHECK_LE(297490, 584206);
-    REQUIRE_LE(297490, 584206);
-    CHECK_GT(878269, 450484);
-    REQUIRE_GT(878269, 450484);
-    CHECK_LT(450484, 878269);
-    REQUIRE_LT(450484, 878269);
-    CHECK_GE(878269, 450484);
-    REQUIRE_GE(878269, 450484);
-    CHECK_LT(184170, 337797);
-    REQUIRE_LT(184170, 337797);
-    CHECK_GT(337797, 184170);
-    REQUIRE_GT(337797, 184170);
-    CHECK_LE(184170, 337797);
-    REQUIRE_LE(184170, 337797);
-    CHECK_GT(591495, 50550);
-    REQUIRE_GT(591495, 50550);
-    CHECK_LT(50550, 591495);
-    REQUIRE_LT(50550, 591495);
-    CHECK_GE(591495, 50550);
-    REQUIRE_GE(591495, 50550);
-    CHECK_GT(670546, 163502);
-    REQUIRE_GT(670546, 163502);
-    CHECK_LT(163502, 670546);
-    REQUIRE_LT(163502, 670546);
-    CHECK_GE(670546, 163502);
-    REQUIRE_GE(670546, 163502);
-    CHECK_LT(907252, 988535);
-    REQUIRE_LT(907252, 988535);
-    CHECK_GT(988535, 907252);
-    REQUIRE_GT(988535, 907252);
-    CHECK_LE(907252, 988535);
-    REQUIRE_LE(907252, 988535);
-    CHECK_GT(542435, 465369);
-    REQUIRE_GT(542435, 465369);
-    CHECK_LT(465369, 542435);
-    REQUIRE_LT(465369, 542435);
-    CHECK_GE(542435, 465369);
-    REQUIRE_GE(542435, 465369);
-    CHECK_GT(643076, 593762);
-    REQUIRE_GT(643076, 593762);
-    CHECK_LT(593762, 643076);
-    REQUIRE_LT(593762, 643076);
-    CHECK_GE(643076, 593762);
-    REQUIRE_GE(643076, 593762);
-    CHECK_LT(236778, 535664);
-    REQUIRE_LT(236778, 535664);
-    CHECK_GT(535664, 236778);
-    REQUIRE_GT(535664, 236778);
-    CHECK_LE(236778, 535664);
-    REQUIRE_LE(236778, 535664);
-    CHECK_LT(50999, 811470);
-    REQUIRE_LT(50999, 811470);
-    CHECK_GT(811470, 50999);
-    REQUIRE_GT(811470, 50999);
-    CHECK_LE(50999, 811470);
-    REQUIRE_LE(50999, 811470);
-    CHECK_GT(308834, 55490);
-    REQUIRE_GT(308834, 55490);
-    CHECK_LT(55490, 308834);
-    REQUIRE_LT(55490, 308834);
-    CHECK_GE(308834, 55490);
-    REQUIRE_GE(308834, 55490);
-    CHECK_GT(932701, 504493);
-    REQUIRE_GT(932701, 504493);
-    CHECK_LT(504493, 932701);
-    REQUIRE_LT(504493, 932701);
-    CHECK_GE(932701, 504493);
-    REQUIRE_GE(932701, 504493);
-    CHECK_GT(702066, 563259);
-    REQUIRE_GT(702066, 563259);
-    CHECK_LT(563259, 702066);
-    REQUIRE_LT(563259, 702066);
-    CHECK_GE(702066, 563259);
-    REQUIRE_GE(702066, 563259);
-    CHECK_GT(941643, 655706);
-    REQUIRE_GT(941643, 655706);
-    CHECK_LT(655706, 941643);
-    REQUIRE_LT(655706, 941643);
-    CHECK_GE(941643, 655706);
-    REQUIRE_GE(941643, 655706);
-    CHECK_GT(335612, 203685);
-    REQUIRE_GT(335612, 203685);
-    CHECK_LT(203685, 335612);
-    REQUIRE_LT(203685, 335612);
-    CHECK_GE(335612, 203685);
-    REQUIRE_GE(335612, 203685);
-    CHECK_LT(585573, 952820);
-    REQUIRE_LT(585573, 952820);
-    CHECK_GT(952820, 585573);
-    REQUIRE_GT(952820, 585573);
-    CHECK_LE(585573, 952820);
-    REQUIRE_LE(585573, 952820);
-    CHECK_GT(605916, 522997);
-    REQUIRE_GT(605916, 522997);
-    CHECK_LT(522997, 605916);
-    REQUIRE_LT(522997, 605916);
-    CHECK_GE(605916, 522997);
-    REQUIRE_GE(605916, 522997);
-    CHECK_LT(99027, 240528);
-    REQUIRE_LT(99027, 240528);
-    CHECK_GT(240528, 99027);
-    REQUIRE_GT(240528, 99027);
-    CHECK_LE(99027, 240528);
-    REQUIRE_LE(99027, 240528);
-    CHECK_GT(346250, 298667);
-    REQUIRE_GT(346250, 298667);
-    CHECK_LT(298667, 346250);
-    REQUIRE_LT(298667, 346250);
-    CHECK_GE(346250, 298667);
-    REQUIRE_GE(346250, 298667);
-    CHECK_LT(100198, 816171);
-    REQUIRE_LT(100198, 816171);
-    CHECK_GT(816171, 100198);
-    REQUIRE_GT(816171, 100198);
-    CHECK_LE(100198, 816171);
-    REQUIRE_LE(100198, 816171);
-    CHECK_LT(741349, 793188);
-    REQUIRE_LT(741349, 793188);
-    CHECK_GT(793188, 741349);
-    REQUIRE_GT(793188, 741349);
-    CHECK_LE(741349, 793188);
-    REQUIRE_LE(741349, 793188);
-    CHECK_LT(163886, 206202);
-    REQUIRE_LT(163886, 206202);
-    CHECK_GT(206202, 163886);
-    REQUIRE_GT(206202, 163886);
-    CHECK_LE(163886, 206202);
-    REQUIRE_LE(163886, 206202);
-    CHECK_LT(18238, 26140);
-    REQUIRE_LT(18238, 26140);
-    CHECK_GT(26140, 18238);
-    REQUIRE_GT(26140, 18238);
-    CHECK_LE(18238, 26140);
-    REQUIRE_LE(18238, 26140);
-    CHECK_LT(337561, 799827);
-    REQUIRE_LT(337561, 799827);
-    CHECK_GT(799827, 337561);
-    REQUIRE_GT(799827, 337561);
-    CHECK_LE(337561, 799827);
-    REQUIRE_LE(337561, 799827);
-    CHECK_GT(718368, 703203);
-    REQUIRE_GT(718368, 703203);
-    CHECK_LT(703203, 718368);
-    REQUIRE_LT(703203, 718368);
-    CHECK_GE(718368, 703203);
-    REQUIRE_GE(718368, 703203);
-    CHECK_GT(890494, 768812);
-    REQUIRE_GT(890494, 768812);
-    CHECK_LT(768812, 890494);
-    REQUIRE_LT(768812, 890494);
-    CHECK_GE(890494, 768812);
-    REQUIRE_GE(890494, 768812);
-    CHECK_LT(664219, 723533);
-    REQUIRE_LT(664219, 723533);
-    CHECK_GT(723533, 664219);
-    REQUIRE_GT(723533, 664219);
-    CHECK_LE(664219, 723533);
-    REQUIRE_LE(664219, 723533);
-    CHECK_GT(801912, 744221);
-    REQUIRE_GT(801912, 744221);
-    CHECK_LT(744221, 801912);
-    REQUIRE_LT(744221, 801912);
-    CHECK_GE(801912, 744221);
-    REQUIRE_GE(801912, 744221);
-    CHECK_GT(893440, 89806);
-    REQUIRE_GT(893440, 89806);
-    CHECK_LT(89806, 893440);
-    REQUIRE_LT(89806, 893440);
-    CHECK_GE(893440, 89806);
-    REQUIRE_GE(893440, 89806);
-    CHECK_GT(776247, 220212);
-    REQUIRE_GT(776247, 220212);
-    CHECK_LT(220212, 776247);
-    REQUIRE_LT(220212, 776247);
-    CHECK_GE(776247, 220212);
-    REQUIRE_GE(776247, 220212);
-    CHECK_LT(170357, 908710);
-    REQUIRE_LT(170357, 908710);
-    CHECK_GT(908710, 170357);
-    REQUIRE_GT(908710, 170357);
-    CHECK_LE(170357, 908710);
-    REQUIRE_LE(170357, 908710);
-    CHECK_GT(374711, 255217);
-    REQUIRE_GT(374711, 255217);
-    CHECK_LT(255217, 374711);
-    REQUIRE_LT(255217, 374711);
-    CHECK_GE(374711, 255217);
-    REQUIRE_GE(374711, 255217);
-    CHECK_LT(7083, 553669);
-    REQUIRE_LT(7083, 553669);
-    CHECK_GT(553669, 7083);
-    REQUIRE_GT(553669, 7083);
-    CHECK_LE(7083, 553669);
-    REQUIRE_LE(7083, 553669);
-    CHECK_GT(920766, 795780);
-    REQUIRE_GT(920766, 795780);
-    CHECK_LT(795780, 920766);
-    REQUIRE_LT(795780, 920766);
-    CHECK_GE(920766, 795780);
-    REQUIRE_GE(920766, 795780);
-    CHECK_GT(327478, 58324);
-    REQUIRE_GT(327478, 58324);
-    CHECK_LT(58324, 327478);
-    REQUIRE_LT(58324, 327478);
-    CHECK_GE(327478, 58324);
-    REQUIRE_GE(327478, 58324);
-    CHECK_GT(597923, 212623);
-    REQUIRE_GT(597923, 212623);
-    CHECK_LT(212623, 597923);
-    REQUIRE_LT(212623, 597923);
-    CHECK_GE(597923, 212623);
-    REQUIRE_GE(597923, 212623);
-    CHECK_LT(45842, 165260);
-    REQUIRE_LT(45842, 165260);
-    CHECK_GT(165260, 45842);
-    REQUIRE_GT(165260, 45842);
-    CHECK_LE(45842, 165260);
-    REQUIRE_LE(45842, 165260);
-    CHECK_GT(578601, 522342);
-    REQUIRE_GT(578601, 522342);
-    CHECK_LT(522342, 578601);
-    REQUIRE_LT(522342, 578601);
-    CHECK_GE(578601, 522342);
-    REQUIRE_GE(578601, 522342);
-    CHECK_LT(438395, 606284);
-    REQUIRE_LT(438395, 606284);
-    CHECK_GT(606284, 438395);
-    REQUIRE_GT(606284, 438395);
-    CHECK_LE(438395, 606284);
-    REQUIRE_LE(438395, 606284);
-    CHECK_GT(442862, 224554);
-    REQUIRE_GT(442862, 224554);
-    CHECK_LT(224554, 442862);
-    REQUIRE_LT(224554, 442862);
-    CHECK_GE(442862, 224554);
-    REQUIRE_GE(442862, 224554);
-    CHECK_GT(793654, 606245);
-    REQUIRE_GT(793654, 606245);
-    CHECK_LT(606245, 793654);
-    REQUIRE_LT(606245, 793654);
-    CHECK_GE(793654, 606245);
-    REQUIRE_GE(793654, 606245);
-    CHECK_LT(89592, 945672);
-    REQUIRE_LT(89592, 945672);
-    CHECK_GT(945672, 89592);
-    REQUIRE_GT(945672, 89592);
-    CHECK_LE(89592, 945672);
-    REQUIRE_LE(89592, 945672);
-    CHECK_LT(618569, 802192);
-    REQUIRE_LT(618569, 802192);
-    CHECK_GT(802192, 618569);
-    REQUIRE_GT(802192, 618569);
-    CHECK_LE(618569, 802192);
-    REQUIRE_LE(618569, 802192);
-    CHECK_GT(538140, 71260);
-    REQUIRE_GT(538140, 71260);
-    CHECK_LT(71260, 538140);
-    REQUIRE_LT(71260, 538140);
-    CHECK_GE(538140, 71260);
-    REQUIRE_GE(538140, 71260);
-    CHECK_GT(929920, 687342);
-    REQUIRE_GT(929920, 687342);
-    CHECK_LT(687342, 929920);
-    REQUIRE_LT(687342, 929920);
-    CHECK_GE(929920, 687342);
-    REQUIRE_GE(929920, 687342);
-    CHECK_GT(702885, 184407);
-    REQUIRE_GT(702885, 184407);
-    CHECK_LT(184407, 702885);
-    REQUIRE_LT(184407, 702885);
-    CHECK_GE(702885, 184407);
-    REQUIRE_GE(702885, 184407);
-    CHECK_LT(546932, 821964);
-    REQUIRE_LT(546932, 821964);
-    CHECK_GT(821964, 546932);
-    REQUIRE_GT(821964, 546932);
-    CHECK_LE(546932, 821964);
-    REQUIRE_LE(546932, 821964);
-    CHECK_LT(518315, 655908);
-    REQUIRE_LT(518315, 655908);
-    CHECK_GT(655908, 518315);
-    REQUIRE_GT(655908, 518315);
-    CHECK_LE(518315, 655908);
-    REQUIRE_LE(518315, 655908);
-    CHECK_LT(449600, 964426);
-    REQUIRE_LT(449600, 964426);
-    CHECK_GT(964426, 449600);
-    REQUIRE_GT(964426, 449600);
-    CHECK_LE(449600, 964426);
-    REQUIRE_LE(449600, 964426);
-    CHECK_LT(14155, 130380);
-    REQUIRE_LT(14155, 130380);
-    CHECK_GT(130380, 14155);
-    REQUIRE_GT(130380, 14155);
-    CHECK_LE(14155, 130380);
-    REQUIRE_LE(14155, 130380);
-    CHECK_GT(922067, 768820);
-    REQUIRE_GT(922067, 768820);
-    CHECK_LT(768820, 922067);
-    REQUIRE_LT(768820, 922067);
-    CHECK_GE(922067, 768820);
-    REQUIRE_GE(922067, 768820);
-    CHECK_LT(63803, 97739);
-    REQUIRE_LT(63803, 97739);
-    CHECK_GT(97739, 63803);
-    REQUIRE_GT(97739, 63803);
-    CHECK_LE(63803, 97739);
-    REQUIRE_LE(63803, 97739);
-    CHECK_GT(173678, 127536);
-    REQUIRE_GT(173678, 127536);
-    CHECK_LT(127536, 173678);
-    REQUIRE_LT(127536, 173678);
-    CHECK_GE(173678, 127536);
-    REQUIRE_GE(173678, 127536);
-    CHECK_GT(280024, 273334);
-    REQUIRE_GT(280024, 273334);
-    CHECK_LT(273334, 280024);
-    REQUIRE_LT(273334, 280024);
-    CHECK_GE(280024, 273334);
-    REQUIRE_GE(280024, 273334);
-    CHECK_LT(206550, 358649);
-    REQUIRE_LT(206550, 358649);
-    CHECK_GT(358649, 206550);
-    REQUIRE_GT(358649, 206550);
-    CHECK_LE(206550, 358649);
-    REQUIRE_LE(206550, 358649);
-    CHECK_GT(453551, 109757);
-    REQUIRE_GT(453551, 109757);
-    CHECK_LT(109757, 453551);
-    REQUIRE_LT(109757, 453551);
-    CHECK_GE(453551, 109757);
-    REQUIRE_GE(453551, 109757);
-    CHECK_GT(821669, 222129);
-    REQUIRE_GT(821669, 222129);
-    CHECK_LT(222129, 821669);
-    REQUIRE_LT(222129, 821669);
-    CHECK_GE(821669, 222129);
-    REQUIRE_GE(821669, 222129);
-    CHECK_GT(682164, 133656);
-    REQUIRE_GT(682164, 133656);
-    CHECK_LT(133656, 682164);
-    REQUIRE_LT(133656, 682164);
-    CHECK_GE(682164, 133656);
-    REQUIRE_GE(682164, 133656);
-    CHECK_LT(224744, 656546);
-    REQUIRE_LT(224744, 656546);
-    CHECK_GT(656546, 224744);
-    REQUIRE_GT(656546, 224744);
-    CHECK_LE(224744, 656546);
-    REQUIRE_LE(224744, 656546);
-    CHECK_GT(919761, 132814);
-    REQUIRE_GT(919761, 132814);
-    CHECK_LT(132814, 919761);
-    REQUIRE_LT(132814, 919761);
-    CHECK_GE(919761, 132814);
-    REQUIRE_GE(919761, 132814);
-    CHECK_GT(850904, 832177);
-    REQUIRE_GT(850904, 832177);
-    CHECK_LT(832177, 850904);
-    REQUIRE_LT(832177, 850904);
-    CHECK_GE(850904, 832177);
-    REQUIRE_GE(850904, 832177);
-    CHECK_LT(372276, 957527);
-    REQUIRE_LT(372276, 957527);
-    CHECK_GT(957527, 372276);
-    REQUIRE_GT(957527, 372276);
-    CHECK_LE(372276, 957527);
-    REQUIRE_LE(372276, 957527);
-    CHECK_LT(383446, 691454);
-    REQUIRE_LT(383446, 691454);
-    CHECK_GT(691454, 383446);
-    REQUIRE_GT(691454, 383446);
-    CHECK_LE(383446, 691454);
-    REQUIRE_LE(383446, 691454);
-    CHECK_GT(275644, 181322);
-    REQUIRE_GT(275644, 181322);
-    CHECK_LT(181322, 275644);
-    REQUIRE_LT(181322, 275644);
-    CHECK_GE(275644, 181322);
-    REQUIRE_GE(275644, 181322);
-    CHECK_GT(26155, 14473);
-    REQUIRE_GT(26155, 14473);
-    CHECK_LT(14473, 26155);
-    REQUIRE_LT(14473, 26155);
-    CHECK_GE(26155, 14473);
-    REQUIRE_GE(26155, 14473);
-    CHECK_LT(393541, 967448);
-    REQUIRE_LT(393541, 967448);
-    CHECK_GT(967448, 393541);
-    REQUIRE_GT(967448, 393541);
-    CHECK_LE(393541, 967448);
-    REQUIRE_LE(393541, 967448);
-    CHECK_LT(254907, 551667);
-    REQUIRE_LT(254907, 551667);
-    CHECK_GT(551667, 254907);
-    REQUIRE_GT(551667, 254907);
-    CHECK_LE(254907, 551667);
-    REQUIRE_LE(254907, 551667);
-    CHECK_GT(776068, 394852);
-    REQUIRE_GT(776068, 394852);
-    CHECK_LT(394852, 776068);
-    REQUIRE_LT(394852, 776068);
-    CHECK_GE(776068, 394852);
-    REQUIRE_GE(776068, 394852);
-    CHECK_GT(717712, 548387);
-    REQUIRE_GT(717712, 548387);
-    CHECK_LT(548387, 717712);
-    REQUIRE_LT(548387, 717712);
-    CHECK_GE(717712, 548387);
-    REQUIRE_GE(717712, 548387);
-    CHECK_LT(17750, 880039);
-    REQUIRE_LT(17750, 880039);
-    CHECK_GT(880039, 17750);
-    REQUIRE_GT(880039, 17750);
-    CHECK_LE(17750, 880039);
-    REQUIRE_LE(17750, 880039);
-    CHECK_LT(592187, 946747);
-    REQUIRE_LT(592187, 946747);
-    CHECK_GT(946747, 592187);
-    REQUIRE_GT(946747, 592187);
-    CHECK_LE(592187, 946747);
-    REQUIRE_LE(592187, 946747);
-    CHECK_LT(196229, 283654);
-    REQUIRE_LT(196229, 283654);
-    CHECK_GT(283654, 196229);
-    REQUIRE_GT(283654, 196229);
-    CHECK_LE(196229, 283654);
-    REQUIRE_LE(196229, 283654);
-    CHECK_GT(679353, 541270);
-    REQUIRE_GT(679353, 541270);
-    CHECK_LT(541270, 679353);
-    REQUIRE_LT(541270, 679353);
-    CHECK_GE(679353, 541270);
-    REQUIRE_GE(679353, 541270);
-    CHECK_LT(118334, 766614);
-    REQUIRE_LT(118334, 766614);
-    CHECK_GT(766614, 118334);
-    REQUIRE_GT(766614, 118334);
-    CHECK_LE(118334, 766614);
-    REQUIRE_LE(118334, 766614);
-    CHECK_LT(264603, 754451);
-    REQUIRE_LT(264603, 754451);
-    CHECK_GT(754451, 264603);
-    REQUIRE_GT(754451, 264603);
-    CHECK_LE(264603, 754451);
-    REQUIRE_LE(264603, 754451);
-    CHECK_GT(782037, 294498);
-    REQUIRE_GT(782037, 294498);
-    CHECK_LT(294498, 782037);
-    REQUIRE_LT(294498, 782037);
-    CHECK_GE(782037, 294498);
-    REQUIRE_GE(782037, 294498);
-    CHECK_LT(364442, 384019);
-    REQUIRE_LT(364442, 384019);
-    CHECK_GT(384019, 364442);
-    REQUIRE_GT(384019, 364442);
-    CHECK_LE(364442, 384019);
-    REQUIRE_LE(364442, 384019);
-    CHECK_LT(650908, 838354);
-    REQUIRE_LT(650908, 838354);
-    CHECK_GT(838354, 650908);
-    REQUIRE_GT(838354, 650908);
-    CHECK_LE(650908, 838354);
-    REQUIRE_LE(650908, 838354);
-    CHECK_GT(933108, 596993);
-    REQUIRE_GT(933108, 596993);
-    CHECK_LT(596993, 933108);
-    REQUIRE_LT(596993, 933108);
-    CHECK_GE(933108, 596993);
-    REQUIRE_GE(933108, 596993);
-    CHECK_LT(12244, 641798);
-    REQUIRE_LT(12244, 641798);
-    CHECK_GT(641798, 12244);
-    REQUIRE_GT(641798, 12244);
-    CHECK_LE(12244, 641798);
-    REQUIRE_LE(12244, 641798);
-    CHECK_LT(759999, 917956);
-    REQUIRE_LT(759999, 917956);
-    CHECK_GT(917956, 759999);
-    REQUIRE_GT(917956, 759999);
-    CHECK_LE(759999, 917956);
-    REQUIRE_LE(759999, 917956);
-    CHECK_GT(375876, 277353);
-    REQUIRE_GT(375876, 277353);
-    CHECK_LT(277353, 375876);
-    REQUIRE_LT(277353, 375876);
-    CHECK_GE(375876, 277353);
-    REQUIRE_GE(375876, 277353);
-    CHECK_GT(893001, 763337);
-    REQUIRE_GT(893001, 763337);
-    CHECK_LT(763337, 893001);
-    REQUIRE_LT(763337, 893001);
-    CHECK_GE(893001, 763337);
-    REQUIRE_GE(893001, 763337);
-    CHECK_LT(316680, 490010);
-    REQUIRE_LT(316680, 490010);
-    CHECK_GT(490010, 316680);
-    REQUIRE_GT(490010, 316680);
-    CHECK_LE(316680, 490010);
-    REQUIRE_LE(316680, 490010);
-    CHECK_GT(738261, 550369);
-    REQUIRE_GT(738261, 550369);
-    CHECK_LT(550369, 738261);
-    REQUIRE_LT(550369, 738261);
-    CHECK_GE(738261, 550369);
-    REQUIRE_GE(738261, 550369);
-    CHECK_GT(936375, 347132);
-    REQUIRE_GT(936375, 347132);
-    CHECK_LT(347132, 936375);
-    REQUIRE_LT(347132, 936375);
-    CHECK_GE(936375, 347132);
-    REQUIRE_GE(936375, 347132);
-    CHECK_LT(507921, 531324);
-    REQUIRE_LT(507921, 531324);
-    CHECK_GT(531324, 507921);
-    REQUIRE_GT(531324, 507921);
-    CHECK_LE(507921, 531324);
-    REQUIRE_LE(507921, 531324);
-    CHECK_LT(282059, 940499);
-    REQUIRE_LT(282059, 940499);
-    CHECK_GT(940499, 282059);
-    REQUIRE_GT(940499, 282059);
-    CHECK_LE(282059, 940499);
-    REQUIRE_LE(282059, 940499);
-    CHECK_GT(326107, 44346);
-    REQUIRE_GT(326107, 44346);
-    CHECK_LT(44346, 326107);
-    REQUIRE_LT(44346, 326107);
-    CHECK_GE(326107, 44346);
-    REQUIRE_GE(326107, 44346);
-    CHECK_GT(448608, 333024);
-    REQUIRE_GT(448608, 333024);
-    CHECK_LT(333024, 448608);
-    REQUIRE_LT(333024, 448608);
-    CHECK_GE(448608, 333024);
-    REQUIRE_GE(448608, 333024);
-    CHECK_LT(461243, 565613);
-    REQUIRE_LT(461243, 565613);
-    CHECK_GT(565613, 461243);
-    REQUIRE_GT(565613, 461243);
-    CHECK_LE(461243, 565613);
-    REQUIRE_LE(461243, 565613);
-    CHECK_LT(123776, 590388);
-    REQUIRE_LT(123776, 590388);
-    CHECK_GT(590388, 123776);
-    REQUIRE_GT(590388, 123776);
-    CHECK_LE(123776, 590388);
-    REQUIRE_LE(123776, 590388);
-    CHECK_LT(573327, 932234);
-    REQUIRE_LT(573327, 932234);
-    CHECK_GT(932234, 573327);
-    REQUIRE_GT(932234, 573327);
-    CHECK_LE(573327, 932234);
-    REQUIRE_LE(573327, 932234);
-    CHECK_GT(978087, 44822);
-    REQUIRE_GT(978087, 44822);
-    CHECK_LT(44822, 978087);
-    REQUIRE_LT(44822, 978087);
-    CHECK_GE(978087, 44822);
-    REQUIRE_GE(978087, 44822);
-    CHECK_LT(145477, 618965);
-    REQUIRE_LT(145477, 618965);
-    CHECK_GT(618965, 145477);
-    REQUIRE_GT(618965, 145477);
-    CHECK_LE(145477, 618965);
-    REQUIRE_LE(145477, 618965);
-    CHECK_LT(571458, 754987);
-    REQUIRE_LT(571458, 754987);
-    CHECK_GT(754987, 571458);
-    REQUIRE_GT(754987, 571458);
-    CHECK_LE(571458, 754987);
-    REQUIRE_LE(571458, 754987);
-    CHECK_LT(134171, 639301);
-    REQUIRE_LT(134171, 639301);
-    CHECK_GT(639301, 134171);
-    REQUIRE_GT(639301, 134171);
-    CHECK_LE(134171, 639301);
-    REQUIRE_LE(134171, 639301);
-    CHECK_LT(196254, 960077);
-    REQUIRE_LT(196254, 960077);
-    CHECK_GT(960077, 196254);
-    REQUIRE_GT(960077, 196254);
-    CHECK_LE(196254, 960077);
-    REQUIRE_LE(196254, 960077);
-    CHECK_LT(842460, 885717);
-    REQUIRE_LT(842460, 885717);
-    CHECK_GT(885717, 842460);
-    REQUIRE_GT(885717, 842460);
-    CHECK_LE(842460, 885717);
-    REQUIRE_LE(842460, 885717);
-    CHECK_GT(370413, 70708);
-    REQUIRE_GT(370413, 70708);
-    CHECK_LT(70708, 370413);
-    REQUIRE_LT(70708, 370413);
-    CHECK_GE(370413, 70708);
-    REQUIRE_GE(370413, 70708);
-    CHECK_GT(202064, 131823);
-    REQUIRE_GT(202064, 131823);
-    CHECK_LT(131823, 202064);
-    REQUIRE_LT(131823, 202064);
-    CHECK_GE(202064, 131823);
-    REQUIRE_GE(202064, 131823);
-    CHECK_LT(173776, 874515);
-    REQUIRE_LT(173776, 874515);
-    CHECK_GT(874515, 173776);
-    REQUIRE_GT(874515, 173776);
-    CHECK_LE(173776, 874515);
-    REQUIRE_LE(173776, 874515);
-    CHECK_GT(609180, 368157);
-    REQUIRE_GT(609180, 368157);
-    CHECK_LT(368157, 609180);
-    REQUIRE_LT(368157, 609180);
-    CHECK_GE(609180, 368157);
-    REQUIRE_GE(609180, 368157);
-    CHECK_GT(854898, 61628);
-    REQUIRE_GT(854898, 61628);
-    CHECK_LT(61628, 854898);
-    REQUIRE_LT(61628, 854898);
-    CHECK_GE(854898, 61628);
-    REQUIRE_GE(854898, 61628);
-    CHECK_GT(932383, 914353);
-    REQUIRE_GT(932383, 914353);
-    CHECK_LT(914353, 932383);
-    REQUIRE_LT(914353, 932383);
-    CHECK_GE(932383, 914353);
-    REQUIRE_GE(932383, 914353);
-    CHECK_LT(33378, 627380);
-    REQUIRE_LT(33378, 627380);
-    CHECK_GT(627380, 33378);
-    REQUIRE_GT(627380, 33378);
-    CHECK_LE(33378, 627380);
-    REQUIRE_LE(33378, 627380);
-    CHECK_LT(176603, 652500);
-    REQUIRE_LT(176603, 652500);
-    CHECK_GT(652500, 176603);
-    REQUIRE_GT(652500, 176603);
-    CHECK_LE(176603, 652500);
-    REQUIRE_LE(176603, 652500);
-    CHECK_GT(306585, 162289);
-    REQUIRE_GT(306585, 162289);
-    CHECK_LT(162289, 306585);
-    REQUIRE_LT(162289, 306585);
-    CHECK_GE(306585, 162289);
-    REQUIRE_GE(306585, 162289);
-    CHECK_GT(759739, 189079);
-    REQUIRE_GT(759739, 189079);
-    CHECK_LT(189079, 759739);
-    REQUIRE_LT(189079, 759739);
-    CHECK_GE(759739, 189079);
-    REQUIRE_GE(759739, 189079);
-    CHECK_GT(991556, 661471);
-    REQUIRE_GT(991556, 661471);
-    CHECK_LT(661471, 991556);
-    REQUIRE_LT(661471, 991556);
-    CHECK_GE(991556, 661471);
-    REQUIRE_GE(991556, 661471);
-    CHECK_GT(906945, 904543);
-    REQUIRE_GT(906945, 904543);
-    CHECK_LT(904543, 906945);
-    REQUIRE_LT(904543, 906945);
-    CHECK_GE(906945, 904543);
-    REQUIRE_GE(906945, 904543);
-    CHECK_LT(649922, 782217);
-    REQUIRE_LT(649922, 782217);
-    CHECK_GT(782217, 649922);
-    REQUIRE_GT(782217, 649922);
-    CHECK_LE(649922, 782217);
-    REQUIRE_LE(649922, 782217);
-    CHECK_LT(102307, 164140);
-    REQUIRE_LT(102307, 164140);
-    CHECK_GT(164140, 102307);
-    REQUIRE_GT(164140, 102307);
-    CHECK_LE(102307, 164140);
-    REQUIRE_LE(102307, 164140);
-    CHECK_LT(378494, 671567);
-    REQUIRE_LT(378494, 671567);
-    CHECK_GT(671567, 378494);
-    REQUIRE_GT(671567, 378494);
-    CHECK_LE(378494, 671567);
-    REQUIRE_LE(378494, 671567);
-    CHECK_GT(148699, 112477);
-    REQUIRE_GT(148699, 112477);
-    CHECK_LT(112477, 148699);
-    REQUIRE_LT(112477, 148699);
-    CHECK_GE(148699, 112477);
-    REQUIRE_GE(148699, 112477);
-    CHECK_GT(491355, 81793);
-    REQUIRE_GT(491355, 81793);
-    CHECK_LT(81793, 491355);
-    REQUIRE_LT(81793, 491355);
-    CHECK_GE(491355, 81793);
-    REQUIRE_GE(491355, 81793);
-    CHECK_LT(590089, 845825);
-    REQUIRE_LT(590089, 845825);
-    CHECK_GT(845825, 590089);
-    REQUIRE_GT(845825, 590089);
-    CHECK_LE(590089, 845825);
-    REQUIRE_LE(590089, 845825);
-    CHECK_GT(889886, 794397);
-    REQUIRE_GT(889886, 794397);
-    CHECK_LT(794397, 889886);
-    REQUIRE_LT(794397, 889886);
-    CHECK_GE(889886, 794397);
-    REQUIRE_GE(889886, 794397);
-    CHECK_GT(838192, 224363);
-    REQUIRE_GT(838192, 224363);
-    CHECK_LT(224363, 838192);
-    REQUIRE_LT(224363, 838192);
-    CHECK_GE(838192, 224363);
-    REQUIRE_GE(838192, 224363);
-    CHECK_GT(571916, 225407);
-    REQUIRE_GT(571916, 225407);
-    CHECK_LT(225407, 571916);
-    REQUIRE_LT(225407, 571916);
-    CHECK_GE(571916, 225407);
-    REQUIRE_GE(571916, 225407);
-    CHECK_LT(465648, 998694);
-    REQUIRE_LT(465648, 998694);
-    CHECK_GT(998694, 465648);
-    REQUIRE_GT(998694, 465648);
-    CHECK_LE(465648, 998694);
-    REQUIRE_LE(465648, 998694);
-    CHECK_LT(97602, 734662);
-    REQUIRE_LT(97602, 734662);
-    CHECK_GT(734662, 97602);
-    REQUIRE_GT(734662, 97602);
-    CHECK_LE(97602, 734662);
-    REQUIRE_LE(97602, 734662);
-    CHECK_GT(809067, 574844);
-    REQUIRE_GT(809067, 574844);
-    CHECK_LT(574844, 809067);
-    REQUIRE_LT(574844, 809067);
-    CHECK_GE(809067, 574844);
-    REQUIRE_GE(809067, 574844);
-    CHECK_LT(225731, 444631);
-    REQUIRE_LT(225731, 444631);
-    CHECK_GT(444631, 225731);
-    REQUIRE_GT(444631, 225731);
-    CHECK_LE(225731, 444631);
-    REQUIRE_LE(225731, 444631);
-    CHECK_GT(994580, 570566);
-    REQUIRE_GT(994580, 570566);
-    CHECK_LT(570566, 994580);
-    REQUIRE_LT(570566, 994580);
-    CHECK_GE(994580, 570566);
-    REQUIRE_GE(994580, 570566);
-    CHECK_LT(83000, 421550);
-    REQUIRE_LT(83000, 421550);
-    CHECK_GT(421550, 83000);
-    REQUIRE_GT(421550, 83000);
-    CHECK_LE(83000, 421550);
-    REQUIRE_LE(83000, 421550);
-    CHECK_LT(223153, 557491);
-    REQUIRE_LT(223153, 557491);
-    CHECK_GT(557491, 223153);
-    REQUIRE_GT(557491, 223153);
-    CHECK_LE(223153, 557491);
-    REQUIRE_LE(223153, 557491);
-    CHECK_GT(554086, 342612);
-    REQUIRE_GT(554086, 342612);
-    CHECK_LT(342612, 554086);
-    REQUIRE_LT(342612, 554086);
-    CHECK_GE(554086, 342612);
-    REQUIRE_GE(554086, 342612);
-    CHECK_LT(572921, 795764);
-    REQUIRE_LT(572921, 795764);
-    CHECK_GT(795764, 572921);
-    REQUIRE_GT(795764, 572921);
-    CHECK_LE(572921, 795764);
-    REQUIRE_LE(572921, 795764);
-    CHECK_LT(882834, 956655);
-    REQUIRE_LT(882834, 956655);
-    CHECK_GT(956655, 882834);
-    REQUIRE_GT(956655, 882834);
-    CHECK_LE(882834, 956655);
-    REQUIRE_LE(882834, 956655);
-    CHECK_GT(972026, 770272);
-    REQUIRE_GT(972026, 770272);
-    CHECK_LT(770272, 972026);
-    REQUIRE_LT(770272, 972026);
-    CHECK_GE(972026, 770272);
-    REQUIRE_GE(972026, 770272);
-    CHECK_LT(339211, 429899);
-    REQUIRE_LT(339211, 429899);
-    CHECK_GT(429899, 339211);
-    REQUIRE_GT(429899, 339211);
-    CHECK_LE(339211, 429899);
-    REQUIRE_LE(339211, 429899);
-    CHECK_GT(549451, 417549);
-    REQUIRE_GT(549451, 417549);
-    CHECK_LT(417549, 549451);
-    REQUIRE_LT(417549, 549451);
-    CHECK_GE(549451, 417549);
-    REQUIRE_GE(549451, 417549);
-    CHECK_LT(452770, 812313);
-    REQUIRE_LT(452770, 812313);
-    CHECK_GT(812313, 452770);
-    REQUIRE_GT(812313, 452770);
-    CHECK_LE(452770, 812313);
-    REQUIRE_LE(452770, 812313);
-    CHECK_GT(861837, 505776);
-    REQUIRE_GT(861837, 505776);
-    CHECK_LT(505776, 861837);
-    REQUIRE_LT(505776, 861837);
-    CHECK_GE(861837, 505776);
-    REQUIRE_GE(861837, 505776);
-    CHECK_LT(622443, 690278);
-    REQUIRE_LT(622443, 690278);
-    CHECK_GT(690278, 622443);
-    REQUIRE_GT(690278, 622443);
-    CHECK_LE(622443, 690278);
-    REQUIRE_LE(622443, 690278);
-    CHECK_GT(988398, 956106);
-    REQUIRE_GT(988398, 956106);
-    CHECK_LT(956106, 988398);
-    REQUIRE_LT(956106, 988398);
-    CHECK_GE(988398, 956106);
-    REQUIRE_GE(988398, 956106);
-    CHECK_LT(575160, 738612);
-    REQUIRE_LT(575160, 738612);
-    CHECK_GT(738612, 575160);
-    REQUIRE_GT(738612, 575160);
-    CHECK_LE(575160, 738612);
-    REQUIRE_LE(575160, 738612);
-    CHECK_LT(401675, 817743);
-    REQUIRE_LT(401675, 817743);
-    CHECK_GT(817743, 401675);
-    REQUIRE_GT(817743, 401675);
-    CHECK_LE(401675, 817743);
-    REQUIRE_LE(401675, 817743);
-    CHECK_GT(683488, 307629);
-    REQUIRE_GT(683488, 307629);
-    CHECK_LT(307629, 683488);
-    REQUIRE_LT(307629, 683488);
-    CHECK_GE(683488, 307629);
-    REQUIRE_GE(683488, 307629);
-    CHECK_LT(125244, 399300);
-    REQUIRE_LT(125244, 399300);
-    CHECK_GT(399300, 125244);
-    REQUIRE_GT(399300, 125244);
-    CHECK_LE(125244, 399300);
-    REQUIRE_LE(125244, 399300);
-    CHECK_GT(719380, 339645);
-    REQUIRE_GT(719380, 339645);
-    CHECK_LT(339645, 719380);
-    REQUIRE_LT(339645, 719380);
-    CHECK_GE(719380, 339645);
-    REQUIRE_GE(719380, 339645);
-    CHECK_LT(158344, 634700);
-    REQUIRE_LT(158344, 634700);
-    CHECK_GT(634700, 158344);
-    REQUIRE_GT(634700, 158344);
-    CHECK_LE(158344, 634700);
-    REQUIRE_LE(158344, 634700);
-    CHECK_GT(294139, 210531);
-    REQUIRE_GT(294139, 210531);
-    CHECK_LT(210531, 294139);
-    REQUIRE_LT(210531, 294139);
-    CHECK_GE(294139, 210531);
-    REQUIRE_GE(294139, 210531);
-    CHECK_LT(152672, 272003);
-    REQUIRE_LT(152672, 272003);
-    CHECK_GT(272003, 152672);
-    REQUIRE_GT(272003, 152672);
-    CHECK_LE(152672, 272003);
-    REQUIRE_LE(152672, 272003);
-    CHECK_LT(799828, 942365);
-    REQUIRE_LT(799828, 942365);
-    CHECK_GT(942365, 799828);
-    REQUIRE_GT(942365, 799828);
-    CHECK_LE(799828, 942365);
-    REQUIRE_LE(799828, 942365);
-    CHECK_LT(543810, 970208);
-    REQUIRE_LT(543810, 970208);
-    CHECK_GT(970208, 543810);
-    REQUIRE_GT(970208, 543810);
-    CHECK_LE(543810, 970208);
-    REQUIRE_LE(543810, 970208);
-    CHECK_LT(254580, 486438);
-    REQUIRE_LT(254580, 486438);
-    CHECK_GT(486438, 254580);
-    REQUIRE_GT(486438, 254580);
-    CHECK_LE(254580, 486438);
-    REQUIRE_LE(254580, 486438);
-    CHECK_GT(907827, 106795);
-    REQUIRE_GT(907827, 106795);
-    CHECK_LT(106795, 907827);
-    REQUIRE_LT(106795, 907827);
-    CHECK_GE(907827, 106795);
-    REQUIRE_GE(907827, 106795);
-    CHECK_LT(441114, 990604);
-    REQUIRE_LT(441114, 990604);
-    CHECK_GT(990604, 441114);
-    REQUIRE_GT(990604, 441114);
-    CHECK_LE(441114, 990604);
-    REQUIRE_LE(441114, 990604);
-    CHECK_LT(729013, 997916);
-    REQUIRE_LT(729013, 997916);
-    CHECK_GT(997916, 729013);
-    REQUIRE_GT(997916, 729013);
-    CHECK_LE(729013, 997916);
-    REQUIRE_LE(729013, 997916);
-    CHECK_GT(751406, 19981);
-    REQUIRE_GT(751406, 19981);
-    CHECK_LT(19981, 751406);
-    REQUIRE_LT(19981, 751406);
-    CHECK_GE(751406, 19981);
-    REQUIRE_GE(751406, 19981);
-    CHECK_GT(385821, 311773);
-    REQUIRE_GT(385821, 311773);
-    CHECK_LT(311773, 385821);
-    REQUIRE_LT(311773, 385821);
-    CHECK_GE(385821, 311773);
-    REQUIRE_GE(385821, 311773);
-    CHECK_LT(318903, 627669);
-    REQUIRE_LT(318903, 627669);
-    CHECK_GT(627669, 318903);
-    REQUIRE_GT(627669, 318903);
-    CHECK_LE(318903, 627669);
-    REQUIRE_LE(318903, 627669);
-    CHECK_LT(5146, 948027);
-    REQUIRE_LT(5146, 948027);
-    CHECK_GT(948027, 5146);
-    REQUIRE_GT(948027, 5146);
-    CHECK_LE(5146, 948027);
-    REQUIRE_LE(5146, 948027);
-    CHECK_GT(680120, 38253);
-    REQUIRE_GT(680120, 38253);
-    CHECK_LT(38253, 680120);
-    REQUIRE_LT(38253, 680120);
-    CHECK_GE(680120, 38253);
-    REQUIRE_GE(680120, 38253);
-    CHECK_LT(10382, 122265);
-    REQUIRE_LT(10382, 122265);
-    CHECK_GT(122265, 10382);
-    REQUIRE_GT(122265, 10382);
-    CHECK_LE(10382, 122265);
-    REQUIRE_LE(10382, 122265);
-    CHECK_GT(789453, 708330);
-    REQUIRE_GT(789453, 708330);
-    CHECK_LT(708330, 789453);
-    REQUIRE_LT(708330, 789453);
-    CHECK_GE(789453, 708330);
-    REQUIRE_GE(789453, 708330);
-    CHECK_LT(306498, 472284);
-    REQUIRE_LT(306498, 472284);
-    CHECK_GT(472284, 306498);
-    REQUIRE_GT(472284, 306498);
-    CHECK_LE(306498, 472284);
-    REQUIRE_LE(306498, 472284);
-    CHECK_LT(88334, 621319);
-    REQUIRE_LT(88334, 621319);
-    CHECK_GT(621319, 88334);
-    REQUIRE_GT(621319, 88334);
-    CHECK_LE(88334, 621319);
-    REQUIRE_LE(88334, 621319);
-    CHECK_LT(839924, 942512);
-    REQUIRE_LT(839924, 942512);
-    CHECK_GT(942512, 839924);
-    REQUIRE_GT(942512, 839924);
-    CHECK_LE(839924, 942512);
-    REQUIRE_LE(839924, 942512);
-    CHECK_GT(549761, 213773);
-    REQUIRE_GT(549761, 213773);
-    CHECK_LT(213773, 549761);
-    REQUIRE_LT(213773, 549761);
-    CHECK_GE(549761, 213773);
-    REQUIRE_GE(549761, 213773);
-    CHECK_LT(188853, 406403);
-    REQUIRE_LT(188853, 406403);
-    CHECK_GT(406403, 188853);
-    REQUIRE_GT(406403, 188853);
-    CHECK_LE(188853, 406403);
-    REQUIRE_LE(188853, 406403);
-    CHECK_LT(342503, 488455);
-    REQUIRE_LT(342503, 488455);
-    CHECK_GT(488455, 342503);
-    REQUIRE_GT(488455, 342503);
-    CHECK_LE(342503, 488455);
-    REQUIRE_LE(342503, 488455);
-    CHECK_GT(789920, 223637);
-    REQUIRE_GT(789920, 223637);
-    CHECK_LT(223637, 789920);
-    REQUIRE_LT(223637, 789920);
-    CHECK_GE(789920, 223637);
-    REQUIRE_GE(789920, 223637);
-    CHECK_GT(826736, 599591);
-    REQUIRE_GT(826736, 599591);
-    CHECK_LT(599591, 826736);
-    REQUIRE_LT(599591, 826736);
-    CHECK_GE(826736, 599591);
-    REQUIRE_GE(826736, 599591);
-    CHECK_LT(593974, 600758);
-    REQUIRE_LT(593974, 600758);
-    CHECK_GT(600758, 593974);
-    REQUIRE_GT(600758, 593974);
-    CHECK_LE(593974, 600758);
-    REQUIRE_LE(593974, 600758);
-    CHECK_LT(51547, 81078);
-    REQUIRE_LT(51547, 81078);
-    CHECK_GT(81078, 51547);
-    REQUIRE_GT(81078, 51547);
-    CHECK_LE(51547, 81078);
-    REQUIRE_LE(51547, 81078);
-    CHECK_GT(912413, 327570);
-    REQUIRE_GT(912413, 327570);
-    CHECK_LT(327570, 912413);
-    REQUIRE_LT(327570, 912413);
-    CHECK_GE(912413, 327570);
-    REQUIRE_GE(912413, 327570);
-    CHECK_LT(30205, 360901);
-    REQUIRE_LT(30205, 360901);
-    CHECK_GT(360901, 30205);
-    REQUIRE_GT(360901, 30205);
-    CHECK_LE(30205, 360901);
-    REQUIRE_LE(30205, 360901);
-    CHECK_GT(752075, 245706);
-    REQUIRE_GT(752075, 245706);
-    CHECK_LT(245706, 752075);
-    REQUIRE_LT(245706, 752075);
-    CHECK_GE(752075, 245706);
-    REQUIRE_GE(752075, 245706);
-    CHECK_GT(474245, 174178);
-    REQUIRE_GT(474245, 174178);
-    CHECK_LT(174178, 474245);
-    REQUIRE_LT(174178, 474245);
-    CHECK_GE(474245, 174178);
-    REQUIRE_GE(474245, 174178);
-    CHECK_LT(441768, 795020);
-    REQUIRE_LT(441768, 795020);
-    CHECK_GT(795020, 441768);
-    REQUIRE_GT(795020, 441768);
-    CHECK_LE(441768, 795020);
-    REQUIRE_LE(441768, 795020);
-    CHECK_LT(732036, 864816);
-    REQUIRE_LT(732036, 864816);
-    CHECK_GT(864816, 732036);
-    REQUIRE_GT(864816, 732036);
-    CHECK_LE(732036, 864816);
-    REQUIRE_LE(732036, 864816);
-    CHECK_GT(927674, 902374);
-    REQUIRE_GT(927674, 902374);
-    CHECK_LT(902374, 927674);
-    REQUIRE_LT(902374, 927674);
-    CHECK_GE(927674, 902374);
-    REQUIRE_GE(927674, 902374);
-    CHECK_LT(406888, 590662);
-    REQUIRE_LT(406888, 590662);
-    CHECK_GT(590662, 406888);
-    REQUIRE_GT(590662, 406888);
-    CHECK_LE(406888, 590662);
-    REQUIRE_LE(406888, 590662);
-    CHECK_GT(767649, 501889);
-    REQUIRE_GT(767649, 501889);
-    CHECK_LT(501889, 767649);
-    REQUIRE_LT(501889, 767649);
-    CHECK_GE(767649, 501889);
-    REQUIRE_GE(767649, 501889);
-    CHECK_GT(335576, 318098);
-    REQUIRE_GT(335576, 318098);
-    CHECK_LT(318098, 335576);
-    REQUIRE_LT(318098, 335576);
-    CHECK_GE(335576, 318098);
-    REQUIRE_GE(335576, 318098);
-    CHECK_LT(846647, 898775);
-    REQUIRE_LT(846647, 898775);
-    CHECK_GT(898775, 846647);
-    REQUIRE_GT(898775, 846647);
-    CHECK_LE(846647, 898775);
-    REQUIRE_LE(846647, 898775);
-    CHECK_LT(306006, 398549);
-    REQUIRE_LT(306006, 398549);
-    CHECK_GT(398549, 306006);
-    REQUIRE_GT(398549, 306006);
-    CHECK_LE(306006, 398549);
-    REQUIRE_LE(306006, 398549);
-    CHECK_GT(623889, 347561);
-    REQUIRE_GT(623889, 347561);
-    CHECK_LT(347561, 623889);
-    REQUIRE_LT(347561, 623889);
-    CHECK_GE(623889, 347561);
-    REQUIRE_GE(623889, 347561);
-    CHECK_LT(617791, 845010);
-    REQUIRE_LT(617791, 845010);
-    CHECK_GT(845010, 617791);
-    REQUIRE_GT(845010, 617791);
-    CHECK_LE(617791, 845010);
-    REQUIRE_LE(617791, 845010);
-    CHECK_LT(141481, 616772);
-    REQUIRE_LT(141481, 616772);
-    CHECK_GT(616772, 141481);
-    REQUIRE_GT(616772, 141481);
-    CHECK_LE(141481, 616772);
-    REQUIRE_LE(141481, 616772);
-    CHECK_GT(776538, 402275);
-    REQUIRE_GT(776538, 402275);
-    CHECK_LT(402275, 776538);
-    REQUIRE_LT(402275, 776538);
-    CHECK_GE(776538, 402275);
-    REQUIRE_GE(776538, 402275);
-    CHECK_GT(649107, 466837);
-    REQUIRE_GT(649107, 466837);
-    CHECK_LT(466837, 649107);
-    REQUIRE_LT(466837, 649107);
-    CHECK_GE(649107, 466837);
-    REQUIRE_GE(649107, 466837);
-    CHECK_LT(281484, 849302);
-    REQUIRE_LT(281484, 849302);
-    CHECK_GT(849302, 281484);
-    REQUIRE_GT(849302, 281484);
-    CHECK_LE(281484, 849302);
-    REQUIRE_LE(281484, 849302);
-    CHECK_LT(88291, 917514);
-    REQUIRE_LT(88291, 917514);
-    CHECK_GT(917514, 88291);
-    REQUIRE_GT(917514, 88291);
-    CHECK_LE(88291, 917514);
-    REQUIRE_LE(88291, 917514);
-    CHECK_LT(294399, 693745);
-    REQUIRE_LT(294399, 693745);
-    CHECK_GT(693745, 294399);
-    REQUIRE_GT(693745, 294399);
-    CHECK_LE(294399, 693745);
-    REQUIRE_LE(294399, 693745);
-    CHECK_GT(643977, 407534);
-    REQUIRE_GT(643977, 407534);
-    CHECK_LT(407534, 643977);
-    REQUIRE_LT(407534, 643977);
-    CHECK_GE(643977, 407534);
-    REQUIRE_GE(643977, 407534);
-    CHECK_GT(856243, 329330);
-    REQUIRE_GT(856243, 329330);
-    CHECK_LT(329330, 856243);
-    REQUIRE_LT(329330, 856243);
-    CHECK_GE(856243, 329330);
-    REQUIRE_GE(856243, 329330);
-    CHECK_GT(152532, 135112);
-    REQUIRE_GT(152532, 135112);
-    CHECK_LT(135112, 152532);
-    REQUIRE_LT(135112, 152532);
-    CHECK_GE(152532, 135112);
-    REQUIRE_GE(152532, 135112);
-    CHECK_GT(543759, 534284);
-    REQUIRE_GT(543759, 534284);
-    CHECK_LT(534284, 543759);
-    REQUIRE_LT(534284, 543759);
-    CHECK_GE(543759, 534284);
-    REQUIRE_GE(543759, 534284);
-    CHECK_GT(768141, 50650);
-    REQUIRE_GT(768141, 50650);
-    CHECK_LT(50650, 768141);
-    REQUIRE_LT(50650, 768141);
-    CHECK_GE(768141, 50650);
-    REQUIRE_GE(768141, 50650);
-    CHECK_GT(895340, 339549);
-    REQUIRE_GT(895340, 339549);
-    CHECK_LT(339549, 895340);
-    REQUIRE_LT(339549, 895340);
-    CHECK_GE(895340, 339549);
-    REQUIRE_GE(895340, 339549);
-    CHECK_LT(327438, 410224);
-    REQUIRE_LT(327438, 410224);
-    CHECK_GT(410224, 327438);
-    REQUIRE_GT(410224, 327438);
-    CHECK_LE(327438, 410224);
-    REQUIRE_LE(327438, 410224);
-    CHECK_GT(435048, 424880);
-    REQUIRE_GT(435048, 424880);
-    CHECK_LT(424880, 435048);
-    REQUIRE_LT(424880, 435048);
-    CHECK_GE(435048, 424880);
-    REQUIRE_GE(435048, 424880);
-    CHECK_LT(305596, 448867);
-    REQUIRE_LT(305596, 448867);
-    CHECK_GT(448867, 305596);
-    REQUIRE_GT(448867, 305596);
-    CHECK_LE(305596, 448867);
-    REQUIRE_LE(305596, 448867);
-    CHECK_LT(168429, 533486);
-    REQUIRE_LT(168429, 533486);
-    CHECK_GT(533486, 168429);
-    REQUIRE_GT(533486, 168429);
-    CHECK_LE(168429, 533486);
-    REQUIRE_LE(168429, 533486);
-    CHECK_GT(624446, 565855);
-    REQUIRE_GT(624446, 565855);
-    CHECK_LT(565855, 624446);
-    REQUIRE_LT(565855, 624446);
-    CHECK_GE(624446, 565855);
-    REQUIRE_GE(624446, 565855);
-    CHECK_LT(351368, 929550);
-    REQUIRE_LT(351368, 929550);
-    CHECK_GT(929550, 351368);
-    REQUIRE_GT(929550, 351368);
-    CHECK_LE(351368, 929550);
-    REQUIRE_LE(351368, 929550);
-    CHECK_GT(962987, 841905);
-    REQUIRE_GT(962987, 841905);
-    CHECK_LT(841905, 962987);
-    REQUIRE_LT(841905, 962987);
-    CHECK_GE(962987, 841905);
-    REQUIRE_GE(962987, 841905);
-    CHECK_LT(63249, 960432);
-    REQUIRE_LT(63249, 960432);
-    CHECK_GT(960432, 63249);
-    REQUIRE_GT(960432, 63249);
-    CHECK_LE(63249, 960432);
-    REQUIRE_LE(63249, 960432);
-    CHECK_LT(143985, 507378);
-    REQUIRE_LT(143985, 507378);
-    CHECK_GT(507378, 143985);
-    REQUIRE_GT(507378, 143985);
-    CHECK_LE(143985, 507378);
-    REQUIRE_LE(143985, 507378);
-    CHECK_GT(828834, 482951);
-    REQUIRE_GT(828834, 482951);
-    CHECK_LT(482951, 828834);
-    REQUIRE_LT(482951, 828834);
-    CHECK_GE(828834, 482951);
-    REQUIRE_GE(828834, 482951);
-    CHECK_GT(681461, 621193);
-    REQUIRE_GT(681461, 621193);
-    CHECK_LT(621193, 681461);
-    REQUIRE_LT(621193, 681461);
-    CHECK_GE(681461, 621193);
-    REQUIRE_GE(681461, 621193);
-    CHECK_LT(634530, 931517);
-    REQUIRE_LT(634530, 931517);
-    CHECK_GT(931517, 634530);
-    REQUIRE_GT(931517, 634530);
-    CHECK_LE(634530, 931517);
-    REQUIRE_LE(634530, 931517);
-    CHECK_GT(994515, 644551);
-    REQUIRE_GT(994515, 644551);
-    CHECK_LT(644551, 994515);
-    REQUIRE_LT(644551, 994515);
-    CHECK_GE(994515, 644551);
-    REQUIRE_GE(994515, 644551);
-    CHECK_LT(321817, 534932);
-    REQUIRE_LT(321817, 534932);
-    CHECK_GT(534932, 321817);
-    REQUIRE_GT(534932, 321817);
-    CHECK_LE(321817, 534932);
-    REQUIRE_LE(321817, 534932);
-    CHECK_LT(172319, 713315);
-    REQUIRE_LT(172319, 713315);
-    CHECK_GT(713315, 172319);
-    REQUIRE_GT(713315, 172319);
-    CHECK_LE(172319, 713315);
-    REQUIRE_LE(172319, 713315);
-    CHECK_GT(985331, 547420);
-    REQUIRE_GT(985331, 547420);
-    CHECK_LT(547420, 985331);
-    REQUIRE_LT(547420, 985331);
-    CHECK_GE(985331, 547420);
-    REQUIRE_GE(985331, 547420);
-    CHECK_LT(257753, 452970);
-    REQUIRE_LT(257753, 452970);
-    CHECK_GT(452970, 257753);
-    REQUIRE_GT(452970, 257753);
-    CHECK_LE(257753, 452970);
-    REQUIRE_LE(257753, 452970);
-    CHECK_GT(701990, 414816);
-    REQUIRE_GT(701990, 414816);
-    CHECK_LT(414816, 701990);
-    REQUIRE_LT(414816, 701990);
-    CHECK_GE(701990, 414816);
-    REQUIRE_GE(701990, 414816);
-    CHECK_LT(858545, 956104);
-    REQUIRE_LT(858545, 956104);
-    CHECK_GT(956104, 858545);
-    REQUIRE_GT(956104, 858545);
-    CHECK_LE(858545, 956104);
-    REQUIRE_LE(858545, 956104);
-    CHECK_GT(955643, 923121);
-    REQUIRE_GT(955643, 923121);
-    CHECK_LT(923121, 955643);
-    REQUIRE_LT(923121, 955643);
-    CHECK_GE(955643, 923121);
-    REQUIRE_GE(955643, 923121);
-    CHECK_GT(421407, 20673);
-    REQUIRE_GT(421407, 20673);
-    CHECK_LT(20673, 421407);
-    REQUIRE_LT(20673, 421407);
-    CHECK_GE(421407, 20673);
-    REQUIRE_GE(421407, 20673);
-    CHECK_LT(134334, 459903);
-    REQUIRE_LT(134334, 459903);
-    CHECK_GT(459903, 134334);
-    REQUIRE_GT(459903, 134334);
-    CHECK_LE(134334, 459903);
-    REQUIRE_LE(134334, 459903);
-    CHECK_GT(876710, 662274);
-    REQUIRE_GT(876710, 662274);
-    CHECK_LT(662274, 876710);
-    REQUIRE_LT(662274, 876710);
-    CHECK_GE(876710, 662274);
-    REQUIRE_GE(876710, 662274);
-    CHECK_GT(775311, 321322);
-    REQUIRE_GT(775311, 321322);
-    CHECK_LT(321322, 775311);
-    REQUIRE_LT(321322, 775311);
-    CHECK_GE(775311, 321322);
-    REQUIRE_GE(775311, 321322);
-    CHECK_LT(726476, 998952);
-    REQUIRE_LT(726476, 998952);
-    CHECK_GT(998952, 726476);
-    REQUIRE_GT(998952, 726476);
-    CHECK_LE(726476, 998952);
-    REQUIRE_LE(726476, 998952);
-    CHECK_GT(888159, 870682);
-    REQUIRE_GT(888159, 870682);
-    CHECK_LT(870682, 888159);
-    REQUIRE_LT(870682, 888159);
-    CHECK_GE(888159, 870682);
-    REQUIRE_GE(888159, 870682);
-    CHECK_LT(676650, 721465);
-    REQUIRE_LT(676650, 721465);
-    CHECK_GT(721465, 676650);
-    REQUIRE_GT(721465, 676650);
-    CHECK_LE(676650, 721465);
-    REQUIRE_LE(676650, 721465);
-    CHECK_GT(931305, 442189);
-    REQUIRE_GT(931305, 442189);
-    CHECK_LT(442189, 931305);
-    REQUIRE_LT(442189, 931305);
-    CHECK_GE(931305, 442189);
-    REQUIRE_GE(931305, 442189);
-    CHECK_GT(128243, 63563);
-    REQUIRE_GT(128243, 63563);
-    CHECK_LT(63563, 128243);
-    REQUIRE_LT(63563, 128243);
-    CHECK_GE(128243, 63563);
-    REQUIRE_GE(128243, 63563);
-    CHECK_LT(311480, 441536);
-    REQUIRE_LT(311480, 441536);
-    CHECK_GT(441536, 311480);
-    REQUIRE_GT(441536, 311480);
-    CHECK_LE(311480, 441536);
-    REQUIRE_LE(311480, 441536);
-    CHECK_LT(114125, 587754);
-    REQUIRE_LT(114125, 587754);
-    CHECK_GT(587754, 114125);
-    REQUIRE_GT(587754, 114125);
-    CHECK_LE(114125, 587754);
-    REQUIRE_LE(114125, 587754);
-    CHECK_GT(593651, 370597);
-    REQUIRE_GT(593651, 370597);
-    CHECK_LT(370597, 593651);
-    REQUIRE_LT(370597, 593651);
-    CHECK_GE(593651, 370597);
-    REQUIRE_GE(593651, 370597);
-    CHECK_GT(606512, 522431);
-    REQUIRE_GT(606512, 522431);
-    CHECK_LT(522431, 606512);
-    REQUIRE_LT(522431, 606512);
-    CHECK_GE(606512, 522431);
-    REQUIRE_GE(606512, 522431);
-    CHECK_LT(188826, 299633);
-    REQUIRE_LT(188826, 299633);
-    CHECK_GT(299633, 188826);
-    REQUIRE_GT(299633, 188826);
-    CHECK_LE(188826, 299633);
-    REQUIRE_LE(188826, 299633);
-    CHECK_GT(438676, 315465);
-    REQUIRE_GT(438676, 315465);
-    CHECK_LT(315465, 438676);
-    REQUIRE_LT(315465, 438676);
-    CHECK_GE(438676, 315465);
-    REQUIRE_GE(438676, 315465);
-    CHECK_LT(456158, 644077);
-    REQUIRE_LT(456158, 644077);
-    CHECK_GT(644077, 456158);
-    REQUIRE_GT(644077, 456158);
-    CHECK_LE(456158, 644077);
-    REQUIRE_LE(456158, 644077);
-    CHECK_GT(469510, 214446);
-    REQUIRE_GT(469510, 214446);
-    CHECK_LT(214446, 469510);
-    REQUIRE_LT(214446, 469510);
-    CHECK_GE(469510, 214446);
-    REQUIRE_GE(469510, 214446);
-    CHECK_LT(823591, 937813);
-    REQUIRE_LT(823591, 937813);
-    CHECK_GT(937813, 823591);
-    REQUIRE_GT(937813, 823591);
-    CHECK_LE(823591, 937813);
-    REQUIRE_LE(823591, 937813);
-    CHECK_GT(463301, 181896);
-    REQUIRE_GT(463301, 181896);
-    CHECK_LT(181896, 463301);
-    REQUIRE_LT(181896, 463301);
-    CHECK_GE(463301, 181896);
-    REQUIRE_GE(463301, 181896);
-    CHECK_GT(832444, 344275);
-    REQUIRE_GT(832444, 344275);
-    CHECK_LT(344275, 832444);
-    REQUIRE_LT(344275, 832444);
-    CHECK_GE(832444, 344275);
-    REQUIRE_GE(832444, 344275);
-    CHECK_GT(789099, 288235);
-    REQUIRE_GT(789099, 288235);
-    CHECK_LT(288235, 789099);
-    REQUIRE_LT(288235, 789099);
-    CHECK_GE(789099, 288235);
-    REQUIRE_GE(789099, 288235);
-    CHECK_GT(706118, 667160);
-    REQUIRE_GT(706118, 667160);
-    CHECK_LT(667160, 706118);
-    REQUIRE_LT(667160, 706118);
-    CHECK_GE(706118, 667160);
-    REQUIRE_GE(706118, 667160);
-    CHECK_LT(479681, 658287);
-    REQUIRE_LT(479681, 658287);
-    CHECK_GT(658287, 479681);
-    REQUIRE_GT(658287, 479681);
-    CHECK_LE(479681, 658287);
-    REQUIRE_LE(479681, 658287);
-    CHECK_LT(286204, 847297);
-    REQUIRE_LT(286204, 847297);
-    CHECK_GT(847297, 286204);
-    REQUIRE_GT(847297, 286204);
-    CHECK_LE(286204, 847297);
-    REQUIRE_LE(286204, 847297);
-    CHECK_LT(209518, 667465);
-    REQUIRE_LT(209518, 667465);
-    CHECK_GT(667465, 209518);
-    REQUIRE_GT(667465, 209518);
-    CHECK_LE(209518, 667465);
-    REQUIRE_LE(209518, 667465);
-    CHECK_LT(268626, 743831);
-    REQUIRE_LT(268626, 743831);
-    CHECK_GT(743831, 268626);
-    REQUIRE_GT(743831, 268626);
-    CHECK_LE(268626, 743831);
-    REQUIRE_LE(268626, 743831);
-    CHECK_LT(397890, 806660);
-    REQUIRE_LT(397890, 806660);
-    CHECK_GT(806660, 397890);
-    REQUIRE_GT(806660, 397890);
-    CHECK_LE(397890, 806660);
-    REQUIRE_LE(397890, 806660);
-    CHECK_LT(137753, 280183);
-    REQUIRE_LT(137753, 280183);
-    CHECK_GT(280183, 137753);
-    REQUIRE_GT(280183, 137753);
-    CHECK_LE(137753, 280183);
-    REQUIRE_LE(137753, 280183);
-    CHECK_GT(612790, 22777);
-    REQUIRE_GT(612790, 22777);
-    CHECK_LT(22777, 612790);
-    REQUIRE_LT(22777, 612790);
-    CHECK_GE(612790, 22777);
-    REQUIRE_GE(612790, 22777);
-    CHECK_LT(320439, 784454);
-    REQUIRE_LT(320439, 784454);
-    CHECK_GT(784454, 320439);
-    REQUIRE_GT(784454, 320439);
-    CHECK_LE(320439, 784454);
-    REQUIRE_LE(320439, 784454);
-    CHECK_GT(475848, 155878);
-    REQUIRE_GT(475848, 155878);
-    CHECK_LT(155878, 475848);
-    REQUIRE_LT(155878, 475848);
-    CHECK_GE(475848, 155878);
-    REQUIRE_GE(475848, 155878);
-    CHECK_GT(569240, 37792);
-    REQUIRE_GT(569240, 37792);
-    CHECK_LT(37792, 569240);
-    REQUIRE_LT(37792, 569240);
-    CHECK_GE(569240, 37792);
-    REQUIRE_GE(569240, 37792);
-    CHECK_LT(676777, 995671);
-    REQUIRE_LT(676777, 995671);
-    CHECK_GT(995671, 676777);
-    REQUIRE_GT(995671, 676777);
-    CHECK_LE(676777, 995671);
-    REQUIRE_LE(676777, 995671);
-    CHECK_LT(30567, 48323);
-    REQUIRE_LT(30567, 48323);
-    CHECK_GT(48323, 30567);
-    REQUIRE_GT(48323, 30567);
-    CHECK_LE(30567, 48323);
-    REQUIRE_LE(30567, 48323);
-    CHECK_GT(876855, 496260);
-    REQUIRE_GT(876855, 496260);
-    CHECK_LT(496260, 876855);
-    REQUIRE_LT(496260, 876855);
-    CHECK_GE(876855, 496260);
-    REQUIRE_GE(876855, 496260);
-    CHECK_GT(533868, 214427);
-    REQUIRE_GT(533868, 214427);
-    CHECK_LT(214427, 533868);
-    REQUIRE_LT(214427, 533868);
-    CHECK_GE(533868, 214427);
-    REQUIRE_GE(533868, 214427);
-    CHECK_GT(778354, 199861);
-    REQUIRE_GT(778354, 199861);
-    CHECK_LT(199861, 778354);
-    REQUIRE_LT(199861, 778354);
-    CHECK_GE(778354, 199861);
-    REQUIRE_GE(778354, 199861);
-    CHECK_GT(942412, 502249);
-    REQUIRE_GT(942412, 502249);
-    CHECK_LT(502249, 942412);
-    REQUIRE_LT(502249, 942412);
-    CHECK_GE(942412, 502249);
-    REQUIRE_GE(942412, 502249);
-    CHECK_LT(886756, 898044);
-    REQUIRE_LT(886756, 898044);
-    CHECK_GT(898044, 886756);
-    REQUIRE_GT(898044, 886756);
-    CHECK_LE(886756, 898044);
-    REQUIRE_LE(886756, 898044);
-    CHECK_LT(235836, 464161);
-    REQUIRE_LT(235836, 464161);
-    CHECK_GT(464161, 235836);
-    REQUIRE_GT(464161, 235836);
-    CHECK_LE(235836, 464161);
-    REQUIRE_LE(235836, 464161);
-    CHECK_LT(414839, 733251);
-    REQUIRE_LT(414839, 733251);
-    CHECK_GT(733251, 414839);
-    REQUIRE_GT(733251, 414839);
-    CHECK_LE(414839, 733251);
-    REQUIRE_LE(414839, 733251);
-    CHECK_LT(250970, 804639);
-    REQUIRE_LT(250970, 804639);
-    CHECK_GT(804639, 250970);
-    REQUIRE_GT(804639, 250970);
-    CHECK_LE(250970, 804639);
-    REQUIRE_LE(250970, 804639);
-    CHECK_LT(200046, 922170);
-    REQUIRE_LT(200046, 922170);
-    CHECK_GT(922170, 200046);
-    REQUIRE_GT(922170, 200046);
-    CHECK_LE(200046, 922170);
-    REQUIRE_LE(200046, 922170);
-    CHECK_LT(341583, 934272);
-    REQUIRE_LT(341583, 934272);
-    CHECK_GT(934272, 341583);
-    REQUIRE_GT(934272, 341583);
-    CHECK_LE(341583, 934272);
-    REQUIRE_LE(341583, 934272);
-    CHECK_LT(56996, 670019);
-    REQUIRE_LT(56996, 670019);
-    CHECK_GT(670019, 56996);
-    REQUIRE_GT(670019, 56996);
-    CHECK_LE(56996, 670019);
-    REQUIRE_LE(56996, 670019);
-    CHECK_LT(596523, 740464);
-    REQUIRE_LT(596523, 740464);
-    CHECK_GT(740464, 596523);
-    REQUIRE_GT(740464, 596523);
-    CHECK_LE(596523, 740464);
-    REQUIRE_LE(596523, 740464);
-    CHECK_GT(700435, 377162);
-    REQUIRE_GT(700435, 377162);
-    CHECK_LT(377162, 700435);
-    REQUIRE_LT(377162, 700435);
-    CHECK_GE(700435, 377162);
-    REQUIRE_GE(700435, 377162);
-    CHECK_LT(212766, 695128);
-    REQUIRE_LT(212766, 695128);
-    CHECK_GT(695128, 212766);
-    REQUIRE_GT(695128, 212766);
-    CHECK_LE(212766, 695128);
-    REQUIRE_LE(212766, 695128);
-    CHECK_GT(172445, 113040);
-    REQUIRE_GT(172445, 113040);
-    CHECK_LT(113040, 172445);
-    REQUIRE_LT(113040, 172445);
-    CHECK_GE(172445, 113040);
-    REQUIRE_GE(172445, 113040);
-    CHECK_LT(388186, 593243);
-    REQUIRE_LT(388186, 593243);
-    CHECK_GT(593243, 388186);
-    REQUIRE_GT(593243, 388186);
-    CHECK_LE(388186, 593243);
-    REQUIRE_LE(388186, 593243);
-    CHECK_GT(981351, 399174);
-    REQUIRE_GT(981351, 399174);
-    CHECK_LT(399174, 981351);
-    REQUIRE_LT(399174, 981351);
-    CHECK_GE(981351, 399174);
-    REQUIRE_GE(981351, 399174);
-    CHECK_GT(677023, 75180);
-    REQUIRE_GT(677023, 75180);
-    CHECK_LT(75180, 677023);
-    REQUIRE_LT(75180, 677023);
-    CHECK_GE(677023, 75180);
-    REQUIRE_GE(677023, 75180);
-    CHECK_LT(29961, 274893);
-    REQUIRE_LT(29961, 274893);
-    CHECK_GT(274893, 29961);
-    REQUIRE_GT(274893, 29961);
-    CHECK_LE(29961, 274893);
-    REQUIRE_LE(29961, 274893);
-    CHECK_LT(24402, 992825);
-    REQUIRE_LT(24402, 992825);
-    CHECK_GT(992825, 24402);
-    REQUIRE_GT(992825, 24402);
-    CHECK_LE(24402, 992825);
-    REQUIRE_LE(24402, 992825);
-    CHECK_LT(329396, 753015);
-    REQUIRE_LT(329396, 753015);
-    CHECK_GT(753015, 329396);
-    REQUIRE_GT(753015, 329396);
-    CHECK_LE(329396, 753015);
-    REQUIRE_LE(329396, 753015);
-    CHECK_GT(398639, 162314);
-    REQUIRE_GT(398639, 162314);
-    CHECK_LT(162314, 398639);
-    REQUIRE_LT(162314, 398639);
-    CHECK_GE(398639, 162314);
-    REQUIRE_GE(398639, 162314);
-    CHECK_GT(297600, 293462);
-    REQUIRE_GT(297600, 293462);
-    CHECK_LT(293462, 297600);
-    REQUIRE_LT(293462, 297600);
-    CHECK_GE(297600, 293462);
-    REQUIRE_GE(297600, 293462);
-    CHECK_LT(512701, 855300);
-    REQUIRE_LT(512701, 855300);
-    CHECK_GT(855300, 512701);
-    REQUIRE_GT(855300, 512701);
-    CHECK_LE(512701, 855300);
-    REQUIRE_LE(512701, 855300);
-    CHECK_GT(375171, 65088);
-    REQUIRE_GT(375171, 65088);
-    CHECK_LT(65088, 375171);
-    REQUIRE_LT(65088, 375171);
-    CHECK_GE(375171, 65088);
-    REQUIRE_GE(375171, 65088);
-    CHECK_GT(235629, 233330);
-    REQUIRE_GT(235629, 233330);
-    CHECK_LT(233330, 235629);
-    REQUIRE_LT(233330, 235629);
-    CHECK_GE(235629, 233330);
-    REQUIRE_GE(235629, 233330);
-    CHECK_LT(735, 618133);
-    REQUIRE_LT(735, 618133);
-    CHECK_GT(618133, 735);
-    REQUIRE_GT(618133, 735);
-    CHECK_LE(735, 618133);
-    REQUIRE_LE(735, 618133);
-    CHECK_LT(164958, 819793);
-    REQUIRE_LT(164958, 819793);
-    CHECK_GT(819793, 164958);
-    REQUIRE_GT(819793, 164958);
-    CHECK_LE(164958, 819793);
-    REQUIRE_LE(164958, 819793);
-    CHECK_LT(340369, 795542);
-    REQUIRE_LT(340369, 795542);
-    CHECK_GT(795542, 340369);
-    REQUIRE_GT(795542, 340369);
-    CHECK_LE(340369, 795542);
-    REQUIRE_LE(340369, 795542);
-    CHECK_GT(862835, 90357);
-    REQUIRE_GT(862835, 90357);
-    CHECK_LT(90357, 862835);
-    REQUIRE_LT(90357, 862835);
-    CHECK_GE(862835, 90357);
-    REQUIRE_GE(862835, 90357);
-    CHECK_LT(16459, 619654);
-    REQUIRE_LT(16459, 619654);
-    CHECK_GT(619654, 16459);
-    REQUIRE_GT(619654, 16459);
-    CHECK_LE(16459, 619654);
-    REQUIRE_LE(16459, 619654);
-    CHECK_GT(987555, 713705);
-    REQUIRE_GT(987555, 713705);
-    CHECK_LT(713705, 987555);
-    REQUIRE_LT(713705, 987555);
-    CHECK_GE(987555, 713705);
-    REQUIRE_GE(987555, 713705);
-    CHECK_LT(201107, 750123);
-    REQUIRE_LT(201107, 750123);
-    CHECK_GT(750123, 201107);
-    REQUIRE_GT(750123, 201107);
-    CHECK_LE(201107, 750123);
-    REQUIRE_LE(201107, 750123);
-    CHECK_LT(484035, 784546);
-    REQUIRE_LT(484035, 784546);
-    CHECK_GT(784546, 484035);
-    REQUIRE_GT(784546, 484035);
-    CHECK_LE(484035, 784546);
-    REQUIRE_LE(484035, 784546);
-    CHECK_GT(561174, 492599);
-    REQUIRE_GT(561174, 492599);
-    CHECK_LT(492599, 561174);
-    REQUIRE_LT(492599, 561174);
-    CHECK_GE(561174, 492599);
-    REQUIRE_GE(561174, 492599);
-    CHECK_LT(695479, 949658);
-    REQUIRE_LT(695479, 949658);
-    CHECK_GT(949658, 695479);
-    REQUIRE_GT(949658, 695479);
-    CHECK_LE(695479, 949658);
-    REQUIRE_LE(695479, 949658);
-    CHECK_LT(640600, 929286);
-    REQUIRE_LT(640600, 929286);
-    CHECK_GT(929286, 640600);
-    REQUIRE_GT(929286, 640600);
-    CHECK_LE(640600, 929286);
-    REQUIRE_LE(640600, 929286);
-    CHECK_LT(576129, 656960);
-    REQUIRE_LT(576129, 656960);
-    CHECK_GT(656960, 576129);
-    REQUIRE_GT(656960, 576129);
-    CHECK_LE(576129, 656960);
-    REQUIRE_LE(576129, 656960);
-    CHECK_GT(333773, 105920);
-    REQUIRE_GT(333773, 105920);
-    CHECK_LT(105920, 333773);
-    REQUIRE_LT(105920, 333773);
-    CHECK_GE(333773, 105920);
-    REQUIRE_GE(333773, 105920);
-    CHECK_LT(65220, 452077);
-    REQUIRE_LT(65220, 452077);
-    CHECK_GT(452077, 65220);
-    REQUIRE_GT(452077, 65220);
-    CHECK_LE(65220, 452077);
-    REQUIRE_LE(65220, 452077);
-    CHECK_LT(324068, 462464);
-    REQUIRE_LT(324068, 462464);
-    CHECK_GT(462464, 324068);
-    REQUIRE_GT(462464, 324068);
-    CHECK_LE(324068, 462464);
-    REQUIRE_LE(324068, 462464);
-    CHECK_LT(510230, 675300);
-    REQUIRE_LT(510230, 675300);
-    CHECK_GT(675300, 510230);
-    REQUIRE_GT(675300, 510230);
-    CHECK_LE(510230, 675300);
-    REQUIRE_LE(510230, 675300);
-    CHECK_GT(411840, 270010);
-    REQUIRE_GT(411840, 270010);
-    CHECK_LT(270010, 411840);
-    REQUIRE_LT(270010, 411840);
-    CHECK_GE(411840, 270010);
-    REQUIRE_GE(411840, 270010);
-    CHECK_LT(396311, 665208);
-    REQUIRE_LT(396311, 665208);
-    CHECK_GT(665208, 396311);
-    REQUIRE_GT(665208, 396311);
-    CHECK_LE(396311, 665208);
-    REQUIRE_LE(396311, 665208);
-    CHECK_LT(72929, 246346);
-    REQUIRE_LT(72929, 246346);
-    CHECK_GT(246346, 72929);
-    REQUIRE_GT(246346, 72929);
-    CHECK_LE(72929, 246346);
-    REQUIRE_LE(72929, 246346);
-    CHECK_GT(498574, 42040);
-    REQUIRE_GT(498574, 42040);
-    CHECK_LT(42040, 498574);
-    REQUIRE_LT(42040, 498574);
-    CHECK_GE(498574, 42040);
-    REQUIRE_GE(498574, 42040);
-    CHECK_GT(921596, 544783);
-    REQUIRE_GT(921596, 544783);
-    CHECK_LT(544783, 921596);
-    REQUIRE_LT(544783, 921596);
-    CHECK_GE(921596, 544783);
-    REQUIRE_GE(921596, 544783);
-    CHECK_GT(673308, 350545);
-    REQUIRE_GT(673308, 350545);
-    CHECK_LT(350545, 673308);
-    REQUIRE_LT(350545, 673308);
-    CHECK_GE(673308, 350545);
-    REQUIRE_GE(673308, 350545);
-    CHECK_LT(40556, 453463);
-    REQUIRE_LT(40556, 453463);
-    CHECK_GT(453463, 40556);
-    REQUIRE_GT(453463, 40556);
-    CHECK_LE(40556, 453463);
-    REQUIRE_LE(40556, 453463);
-    CHECK_GT(173110, 12628);
-    REQUIRE_GT(173110, 12628);
-    CHECK_LT(12628, 173110);
-    REQUIRE_LT(12628, 173110);
-    CHECK_GE(173110, 12628);
-    REQUIRE_GE(173110, 12628);
-    CHECK_GT(575192, 563873);
-    REQUIRE_GT(575192, 563873);
-    CHECK_LT(563873, 575192);
-    REQUIRE_LT(563873, 575192);
-    CHECK_GE(575192, 563873);
-    REQUIRE_GE(575192, 563873);
-    CHECK_LT(41821, 374603);
-    REQUIRE_LT(41821, 374603);
-    CHECK_GT(374603, 41821);
-    REQUIRE_GT(374603, 41821);
-    CHECK_LE(41821, 374603);
-    REQUIRE_LE(41821, 374603);
-    CHECK_GT(472732, 358410);
-    REQUIRE_GT(472732, 358410);
-    CHECK_LT(358410, 472732);
-    REQUIRE_LT(358410, 472732);
-    CHECK_GE(472732, 358410);
-    REQUIRE_GE(472732, 358410);
-    CHECK_GT(956567, 454784);
-    REQUIRE_GT(956567, 454784);
-    CHECK_LT(454784, 956567);
-    REQUIRE_LT(454784, 956567);
-    CHECK_GE(956567, 454784);
-    REQUIRE_GE(956567, 454784);
-    CHECK_LT(659957, 711048);
-    REQUIRE_LT(659957, 711048);
-    CHECK_GT(711048, 659957);
-    REQUIRE_GT(711048, 659957);
-    CHECK_LE(659957, 711048);
-    REQUIRE_LE(659957, 711048);
-    CHECK_GT(826364, 26352);
-    REQUIRE_GT(826364, 26352);
-    CHECK_LT(26352, 826364);
-    REQUIRE_LT(26352, 826364);
-    CHECK_GE(826364, 26352);
-    REQUIRE_GE(826364, 26352);
-    CHECK_GT(808731, 568988);
-    REQUIRE_GT(808731, 568988);
-    CHECK_LT(568988, 808731);
-    REQUIRE_LT(568988, 808731);
-    CHECK_GE(808731, 568988);
-    REQUIRE_GE(808731, 568988);
-    CHECK_GT(417156, 133430);
-    REQUIRE_GT(417156, 133430);
-    CHECK_LT(133430, 417156);
-    REQUIRE_LT(133430, 417156);
-    CHECK_GE(417156, 133430);
-    REQUIRE_GE(417156, 133430);
-    CHECK_GT(386227, 272643);
-    REQUIRE_GT(386227, 272643);
-    CHECK_LT(272643, 386227);
-    REQUIRE_LT(272643, 386227);
-    CHECK_GE(386227, 272643);
-    REQUIRE_GE(386227, 272643);
-    CHECK_LT(659555, 827860);
-    REQUIRE_LT(659555, 827860);
-    CHECK_GT(827860, 659555);
-    REQUIRE_GT(827860, 659555);
-    CHECK_LE(659555, 827860);
-    REQUIRE_LE(659555, 827860);
-    CHECK_GT(941176, 550518);
-    REQUIRE_GT(941176, 550518);
-    CHECK_LT(550518, 941176);
-    REQUIRE_LT(550518, 941176);
-    CHECK_GE(941176, 550518);
-    REQUIRE_GE(941176, 550518);
-    CHECK_LT(474163, 879235);
-    REQUIRE_LT(474163, 879235);
-    CHECK_GT(879235, 474163);
-    REQUIRE_GT(879235, 474163);
-    CHECK_LE(474163, 879235);
-    REQUIRE_LE(474163, 879235);
-    CHECK_LT(219783, 259918);
-    REQUIRE_LT(219783, 259918);
-    CHECK_GT(259918, 219783);
-    REQUIRE_GT(259918, 219783);
-    CHECK_LE(219783, 259918);
-    REQUIRE_LE(219783, 259918);
-    CHECK_LT(689290, 965331);
-    REQUIRE_LT(689290, 965331);
-    CHECK_GT(965331, 689290);
-    REQUIRE_GT(965331, 689290);
-    CHECK_LE(689290, 965331);
-    REQUIRE_LE(689290, 965331);
-    CHECK_GT(843402, 354822);
-    REQUIRE_GT(843402, 354822);
-    CHECK_LT(354822, 843402);
-    REQUIRE_LT(354822, 843402);
-    CHECK_GE(843402, 354822);
-    REQUIRE_GE(843402, 354822);
-    CHECK_GT(995561, 828834);
-    REQUIRE_GT(995561, 828834);
-    CHECK_LT(828834, 995561);
-    REQUIRE_LT(828834, 995561);
-    CHECK_GE(995561, 828834);
-    REQUIRE_GE(995561, 828834);
-    CHECK_LT(30718, 351077);
-    REQUIRE_LT(30718, 351077);
-    CHECK_GT(351077, 30718);
-    REQUIRE_GT(351077, 30718);
-    CHECK_LE(30718, 351077);
-    REQUIRE_LE(30718, 351077);
-    CHECK_LT(443837, 517369);
-    REQUIRE_LT(443837, 517369);
-    CHECK_GT(517369, 443837);
-    REQUIRE_GT(517369, 443837);
-    CHECK_LE(443837, 517369);
-    REQUIRE_LE(443837, 517369);
-    CHECK_GT(660394, 404601);
-    REQUIRE_GT(660394, 404601);
-    CHECK_LT(404601, 660394);
-    REQUIRE_LT(404601, 660394);
-    CHECK_GE(660394, 404601);
-    REQUIRE_GE(660394, 404601);
-    CHECK_LT(371911, 487759);
-    REQUIRE_LT(371911, 487759);
-    CHECK_GT(487759, 371911);
-    REQUIRE_GT(487759, 371911);
-    CHECK_LE(371911, 487759);
-    REQUIRE_LE(371911, 487759);
-    CHECK_LT(314325, 564439);
-    REQUIRE_LT(314325, 564439);
-    CHECK_GT(564439, 314325);
-    REQUIRE_GT(564439, 314325);
-    CHECK_LE(314325, 564439);
-    REQUIRE_LE(314325, 564439);
-    CHECK_GT(994261, 923195);
-    REQUIRE_GT(994261, 923195);
-    CHECK_LT(923195, 994261);
-    REQUIRE_LT(923195, 994261);
-    CHECK_GE(994261, 923195);
-    REQUIRE_GE(994261, 923195);
-    CHECK_GT(560757, 542689);
-    REQUIRE_GT(560757, 542689);
-    CHECK_LT(542689, 560757);
-    REQUIRE_LT(542689, 560757);
-    CHECK_GE(560757, 542689);
-    REQUIRE_GE(560757, 542689);
-    CHECK_LT(406617, 991264);
-    REQUIRE_LT(406617, 991264);
-    CHECK_GT(991264, 406617);
-    REQUIRE_GT(991264, 406617);
-    CHECK_LE(406617, 991264);
-    REQUIRE_LE(406617, 991264);
-    CHECK_LT(403033, 727218);
-    REQUIRE_LT(403033, 727218);
-    CHECK_GT(727218, 403033);
-    REQUIRE_GT(727218, 403033);
-    CHECK_LE(403033, 727218);
-    REQUIRE_LE(403033, 727218);
-    CHECK_GT(267566, 49704);
-    REQUIRE_GT(267566, 49704);
-    CHECK_LT(49704, 267566);
-    REQUIRE_LT(49704, 267566);
-    CHECK_GE(267566, 49704);
-    REQUIRE_GE(267566, 49704);
-    CHECK_LT(112740, 578360);
-    REQUIRE_LT(112740, 578360);
-    CHECK_GT(578360, 112740);
-    REQUIRE_GT(578360, 112740);
-    CHECK_LE(112740, 578360);
-    REQUIRE_LE(112740, 578360);
-    CHECK_GT(473358, 325961);
-    REQUIRE_GT(473358, 325961);
-    CHECK_LT(325961, 473358);
-    REQUIRE_LT(325961, 473358);
-    CHECK_GE(473358, 325961);
-    REQUIRE_GE(473358, 325961);
-    CHECK_GT(715214, 3786);
-    REQUIRE_GT(715214, 3786);
-    CHECK_LT(3786, 715214);
-    REQUIRE_LT(3786, 715214);
-    CHECK_GE(715214, 3786);
-    REQUIRE_GE(715214, 3786);
-    CHECK_GT(619171, 520814);
-    REQUIRE_GT(619171, 520814);
-    CHECK_LT(520814, 619171);
-    REQUIRE_LT(520814, 619171);
-    CHECK_GE(619171, 520814);
-    REQUIRE_GE(619171, 520814);
-    CHECK_LT(591029, 789009);
-    REQUIRE_LT(591029, 789009);
-    CHECK_GT(789009, 591029);
-    REQUIRE_GT(789009, 591029);
-    CHECK_LE(591029, 789009);
-    REQUIRE_LE(591029, 789009);
-    CHECK_LT(554977, 865494);
-    REQUIRE_LT(554977, 865494);
-    CHECK_GT(865494, 554977);
-    REQUIRE_GT(865494, 554977);
-    CHECK_LE(554977, 865494);
-    REQUIRE_LE(554977, 865494);
-    CHECK_GT(922952, 538581);
-    REQUIRE_GT(922952, 538581);
-    CHECK_LT(538581, 922952);
-    REQUIRE_LT(538581, 922952);
-    CHECK_GE(922952, 538581);
-    REQUIRE_GE(922952, 538581);
-    CHECK_GT(929709, 398294);
-    REQUIRE_GT(929709, 398294);
-    CHECK_LT(398294, 929709);
-    REQUIRE_LT(398294, 929709);
-    CHECK_GE(929709, 398294);
-    REQUIRE_GE(929709, 398294);
-    CHECK_GT(415546, 24413);
-    REQUIRE_GT(415546, 24413);
-    CHECK_LT(24413, 415546);
-    REQUIRE_LT(24413, 415546);
-    CHECK_GE(415546, 24413);
-    REQUIRE_GE(415546, 24413);
-    CHECK_LT(109039, 217241);
-    REQUIRE_LT(109039, 217241);
-    CHECK_GT(217241, 109039);
-    REQUIRE_GT(217241, 109039);
-    CHECK_LE(109039, 217241);
-    REQUIRE_LE(109039, 217241);
-    CHECK_LT(148218, 679151);
-    REQUIRE_LT(148218, 679151);
-    CHECK_GT(679151, 148218);
-    REQUIRE_GT(679151, 148218);
-    CHECK_LE(148218, 679151);
-    REQUIRE_LE(148218, 679151);
-    CHECK_LT(130173, 787882);
-    REQUIRE_LT(130173, 787882);
-    CHECK_GT(787882, 130173);
-    REQUIRE_GT(787882, 130173);
-    CHECK_LE(130173, 787882);
-    REQUIRE_LE(130173, 787882);
-    CHECK_LT(738919, 845801);
-    REQUIRE_LT(738919, 845801);
-    CHECK_GT(845801, 738919);
-    REQUIRE_GT(845801, 738919);
-    CHECK_LE(738919, 845801);
-    REQUIRE_LE(738919, 845801);
-    CHECK_GT(606846, 420064);
-    REQUIRE_GT(606846, 420064);
-    CHECK_LT(420064, 606846);
-    REQUIRE_LT(420064, 606846);
-    CHECK_GE(606846, 420064);
-    REQUIRE_GE(606846, 420064);
-    CHECK_LT(52642, 82400);
-    REQUIRE_LT(52642, 82400);
-    CHECK_GT(82400, 52642);
-    REQUIRE_GT(82400, 52642);
-    CHECK_LE(52642, 82400);
-    REQUIRE_LE(52642, 82400);
-    CHECK_LT(30629, 650984);
-    REQUIRE_LT(30629, 650984);
-    CHECK_GT(650984, 30629);
-    REQUIRE_GT(650984, 30629);
-    CHECK_LE(30629, 650984);
-    REQUIRE_LE(30629, 650984);
-    CHECK_LT(105469, 316652);
-    REQUIRE_LT(105469, 316652);
-    CHECK_GT(316652, 105469);
-    REQUIRE_GT(316652, 105469);
-    CHECK_LE(105469, 316652);
-    REQUIRE_LE(105469, 316652);
-    CHECK_GT(882045, 104120);
-    REQUIRE_GT(882045, 104120);
-    CHECK_LT(104120, 882045);
-    REQUIRE_LT(104120, 882045);
-    CHECK_GE(882045, 104120);
-    REQUIRE_GE(882045, 104120);
-    CHECK_LT(60656, 270577);
-    REQUIRE_LT(60656, 270577);
-    CHECK_GT(270577, 60656);
-    REQUIRE_GT(270577, 60656);
-    CHECK_LE(60656, 270577);
-    REQUIRE_LE(60656, 270577);
-    CHECK_GT(700699, 230351);
-    REQUIRE_GT(700699, 230351);
-    CHECK_LT(230351, 700699);
-    REQUIRE_LT(230351, 700699);
-    CHECK_GE(700699, 230351);
-    REQUIRE_GE(700699, 230351);
-    CHECK_GT(838497, 215553);
-    REQUIRE_GT(838497, 215553);
-    CHECK_LT(215553, 838497);
-    REQUIRE_LT(215553, 838497);
-    CHECK_GE(838497, 215553);
-    REQUIRE_GE(838497, 215553);
-    CHECK_LT(230728, 838359);
-    REQUIRE_LT(230728, 838359);
-    CHECK_GT(838359, 230728);
-    REQUIRE_GT(838359, 230728);
-    CHECK_LE(230728, 838359);
-    REQUIRE_LE(230728, 838359);
-    CHECK_GT(407999, 261637);
-    REQUIRE_GT(407999, 261637);
-    CHECK_LT(261637, 407999);
-    REQUIRE_LT(261637, 407999);
-    CHECK_GE(407999, 261637);
-    REQUIRE_GE(407999, 261637);
-    CHECK_LT(23632, 678963);
-    REQUIRE_LT(23632, 678963);
-    CHECK_GT(678963, 23632);
-    REQUIRE_GT(678963, 23632);
-    CHECK_LE(23632, 678963);
-    REQUIRE_LE(23632, 678963);
-    CHECK_LT(63612, 784837);
-    REQUIRE_LT(63612, 784837);
-    CHECK_GT(784837, 63612);
-    REQUIRE_GT(784837, 63612);
-    CHECK_LE(63612, 784837);
-    REQUIRE_LE(63612, 784837);
-    CHECK_GT(916431, 202199);
-    REQUIRE_GT(916431, 202199);
-    CHECK_LT(202199, 916431);
-    REQUIRE_LT(202199, 916431);
-    CHECK_GE(916431, 202199);
-    REQUIRE_GE(916431, 202199);
-    CHECK_LT(278473, 629814);
-    REQUIRE_LT(278473, 629814);
-    CHECK_GT(629814, 278473);
-    REQUIRE_GT(629814, 278473);
-    CHECK_LE(278473, 629814);
-    REQUIRE_LE(278473, 629814);
-    CHECK_GT(843029, 236030);
-    REQUIRE_GT(843029, 236030);
-    CHECK_LT(236030, 843029);
-    REQUIRE_LT(236030, 843029);
-    CHECK_GE(843029, 236030);
-    REQUIRE_GE(843029, 236030);
-    CHECK_GT(880362, 464866);
-    REQUIRE_GT(880362, 464866);
-    CHECK_LT(464866, 880362);
-    REQUIRE_LT(464866, 880362);
-    CHECK_GE(880362, 464866);
-    REQUIRE_GE(880362, 464866);
-    CHECK_GT(713525, 332548);
-    REQUIRE_GT(713525, 332548);
-    CHECK_LT(332548, 713525);
-    REQUIRE_LT(332548, 713525);
-    CHECK_GE(713525, 332548);
-    REQUIRE_GE(713525, 332548);
-    CHECK_LT(546503, 823869);
-    REQUIRE_LT(546503, 823869);
-    CHECK_GT(823869, 546503);
-    REQUIRE_GT(823869, 546503);
-    CHECK_LE(546503, 823869);
-    REQUIRE_LE(546503, 823869);
-    CHECK_GT(896657, 373126);
-    REQUIRE_GT(896657, 373126);
-    CHECK_LT(373126, 896657);
-    REQUIRE_LT(373126, 896657);
-    CHECK_GE(896657, 373126);
-    REQUIRE_GE(896657, 373126);
-    CHECK_LT(61016, 762778);
-    REQUIRE_LT(61016, 762778);
-    CHECK_GT(762778, 61016);
-    REQUIRE_GT(762778, 61016);
-    CHECK_LE(61016, 762778);
-    REQUIRE_LE(61016, 762778);
-    CHECK_LT(673604, 894313);
-    REQUIRE_LT(673604, 894313);
-    CHECK_GT(894313, 673604);
-    REQUIRE_GT(894313, 673604);
-    CHECK_LE(673604, 894313);
-    REQUIRE_LE(673604, 894313);
-    CHECK_LT(90743, 869731);
-    REQUIRE_LT(90743, 869731);
-    CHECK_GT(869731, 90743);
-    REQUIRE_GT(869731, 90743);
-    CHECK_LE(90743, 869731);
-    REQUIRE_LE(90743, 869731);
-    CHECK_LT(278581, 842900);
-    REQUIRE_LT(278581, 842900);
-    CHECK_GT(842900, 278581);
-    REQUIRE_GT(842900, 278581);
-    CHECK_LE(278581, 842900);
-    REQUIRE_LE(278581, 842900);
-    CHECK_LT(76760, 888752);
-    REQUIRE_LT(76760, 888752);
-    CHECK_GT(888752, 76760);
-    REQUIRE_GT(888752, 76760);
-    CHECK_LE(76760, 888752);
-    REQUIRE_LE(76760, 888752);
-    CHECK_LT(216240, 637579);
-    REQUIRE_LT(216240, 637579);
-    CHECK_GT(637579, 216240);
-    REQUIRE_GT(637579, 216240);
-    CHECK_LE(216240, 637579);
-    REQUIRE_LE(216240, 637579);
-    CHECK_GT(825642, 713637);
-    REQUIRE_GT(825642, 713637);
-    CHECK_LT(713637, 825642);
-    REQUIRE_LT(713637, 825642);
-    CHECK_GE(825642, 713637);
-    REQUIRE_GE(825642, 713637);
-    CHECK_GT(294087, 187446);
-    REQUIRE_GT(294087, 187446);
-    CHECK_LT(187446, 294087);
-    REQUIRE_LT(187446, 294087);
-    CHECK_GE(294087, 187446);
-    REQUIRE_GE(294087, 187446);
-    CHECK_GT(713309, 407708);
-    REQUIRE_GT(713309, 407708);
-    CHECK_LT(407708, 713309);
-    REQUIRE_LT(407708, 713309);
-    CHECK_GE(713309, 407708);
-    REQUIRE_GE(713309, 407708);
-    CHECK_GT(274067, 43574);
-    REQUIRE_GT(274067, 43574);
-    CHECK_LT(43574, 274067);
-    REQUIRE_LT(43574, 274067);
-    CHECK_GE(274067, 43574);
-    REQUIRE_GE(274067, 43574);
-    CHECK_GT(645157, 32651);
-    REQUIRE_GT(645157, 32651);
-    CHECK_LT(32651, 645157);
-    REQUIRE_LT(32651, 645157);
-    CHECK_GE(645157, 32651);
-    REQUIRE_GE(645157, 32651);
-    CHECK_LT(612112, 721051);
-    REQUIRE_LT(612112, 721051);
-    CHECK_GT(721051, 612112);
-    REQUIRE_GT(721051, 612112);
-    CHECK_LE(612112, 721051);
-    REQUIRE_LE(612112, 721051);
-    CHECK_GT(664105, 432093);
-    REQUIRE_GT(664105, 432093);
-    CHECK_LT(432093, 664105);
-    REQUIRE_LT(432093, 664105);
-    CHECK_GE(664105, 432093);
-    REQUIRE_GE(664105, 432093);
-    CHECK_LT(720328, 870977);
-    REQUIRE_LT(720328, 870977);
-    CHECK_GT(870977, 720328);
-    REQUIRE_GT(870977, 720328);
-    CHECK_LE(720328, 870977);
-    REQUIRE_LE(720328, 870977);
-    CHECK_LT(384332, 556924);
-    REQUIRE_LT(384332, 556924);
-    CHECK_GT(556924, 384332);
-    REQUIRE_GT(556924, 384332);
-    CHECK_LE(384332, 556924);
-    REQUIRE_LE(384332, 556924);
-    CHECK_GT(890501, 81709);
-    REQUIRE_GT(890501, 81709);
-    CHECK_LT(81709, 890501);
-    REQUIRE_LT(81709, 890501);
-    CHECK_GE(890501, 81709);
-    REQUIRE_GE(890501, 81709);
-    CHECK_GT(997389, 430691);
-    REQUIRE_GT(997389, 430691);
-    CHECK_LT(430691, 997389);
-    REQUIRE_LT(430691, 997389);
-    CHECK_GE(997389, 430691);
-    REQUIRE_GE(997389, 430691);
-    CHECK_GT(218487, 36052);
-    REQUIRE_GT(218487, 36052);
-    CHECK_LT(36052, 218487);
-    REQUIRE_LT(36052, 218487);
-    CHECK_GE(218487, 36052);
-    REQUIRE_GE(218487, 36052);
-    CHECK_GT(916314, 302595);
-    REQUIRE_GT(916314, 302595);
-    CHECK_LT(302595, 916314);
-    REQUIRE_LT(302595, 916314);
-    CHECK_GE(916314, 302595);
-    REQUIRE_GE(916314, 302595);
-    CHECK_LT(428950, 501551);
-    REQUIRE_LT(428950, 501551);
-    CHECK_GT(501551, 428950);
-    REQUIRE_GT(501551, 428950);
-    CHECK_LE(428950, 501551);
-    REQUIRE_LE(428950, 501551);
-    CHECK_GT(773533, 204114);
-    REQUIRE_GT(773533, 204114);
-    CHECK_LT(204114, 773533);
-    REQUIRE_LT(204114, 773533);
-    CHECK_GE(773533, 204114);
-    REQUIRE_GE(773533, 204114);
-    CHECK_LT(130929, 283282);
-    REQUIRE_LT(130929, 283282);
-    CHECK_GT(283282, 130929);
-    REQUIRE_GT(283282, 130929);
-    CHECK_LE(130929, 283282);
-    REQUIRE_LE(130929, 283282);
-    CHECK_LT(241086, 975927);
-    REQUIRE_LT(241086, 975927);
-    CHECK_GT(975927, 241086);
-    REQUIRE_GT(975927, 241086);
-    CHECK_LE(241086, 975927);
-    REQUIRE_LE(241086, 975927);
-    CHECK_LT(516246, 541781);
-    REQUIRE_LT(516246, 541781);
-    CHECK_GT(541781, 516246);
-    REQUIRE_GT(541781, 516246);
-    CHECK_LE(516246, 541781);
-    REQUIRE_LE(516246, 541781);
-    CHECK_LT(412400, 806257);
-    REQUIRE_LT(412400, 806257);
-    CHECK_GT(806257, 412400);
-    REQUIRE_GT(806257, 412400);
-    CHECK_LE(412400, 806257);
-    REQUIRE_LE(412400, 806257);
-    CHECK_GT(923845, 626909);
-    REQUIRE_GT(923845, 626909);
-    CHECK_LT(626909, 923845);
-    REQUIRE_LT(626909, 923845);
-    CHECK_GE(923845, 626909);
-    REQUIRE_GE(923845, 626909);
-    CHECK_LT(647648, 957364);
-    REQUIRE_LT(647648, 957364);
-    CHECK_GT(957364, 647648);
-    REQUIRE_GT(957364, 647648);
-    CHECK_LE(647648, 957364);
-    REQUIRE_LE(647648, 957364);
-    CHECK_LT(37439, 260279);
-    REQUIRE_LT(37439, 260279);
-    CHECK_GT(260279, 37439);
-    REQUIRE_GT(260279, 37439);
-    CHECK_LE(37439, 260279);
-    REQUIRE_LE(37439, 260279);
-    CHECK_GT(744341, 433894);
-    REQUIRE_GT(744341, 433894);
-    CHECK_LT(433894, 744341);
-    REQUIRE_LT(433894, 744341);
-    CHECK_GE(744341, 433894);
-    REQUIRE_GE(744341, 433894);
-    CHECK_LT(70277, 138952);
-    REQUIRE_LT(70277, 138952);
-    CHECK_GT(138952, 70277);
-    REQUIRE_GT(138952, 70277);
-    CHECK_LE(70277, 138952);
-    REQUIRE_LE(70277, 138952);
-    CHECK_LT(88288, 372585);
-    REQUIRE_LT(88288, 372585);
-    CHECK_GT(372585, 88288);
-    REQUIRE_GT(372585, 88288);
-    CHECK_LE(88288, 372585);
-    REQUIRE_LE(88288, 372585);
-    CHECK_GT(117145, 97026);
-    REQUIRE_GT(117145, 97026);
-    CHECK_LT(97026, 117145);
-    REQUIRE_LT(97026, 117145);
-    CHECK_GE(117145, 97026);
-    REQUIRE_GE(117145, 97026);
-    CHECK_GT(980988, 97423);
-    REQUIRE_GT(980988, 97423);
-    CHECK_LT(97423, 980988);
-    REQUIRE_LT(97423, 980988);
-    CHECK_GE(980988, 97423);
-    REQUIRE_GE(980988, 97423);
-    CHECK_LT(406273, 597101);
-    REQUIRE_LT(406273, 597101);
-    CHECK_GT(597101, 406273);
-    REQUIRE_GT(597101, 406273);
-    CHECK_LE(406273, 597101);
-    REQUIRE_LE(406273, 597101);
-    CHECK_GT(748663, 120387);
-    REQUIRE_GT(748663, 120387);
-    CHECK_LT(120387, 748663);
-    REQUIRE_LT(120387, 748663);
-    CHECK_GE(748663, 120387);
-    REQUIRE_GE(748663, 120387);
-    CHECK_LT(3692, 790025);
-    REQUIRE_LT(3692, 790025);
-    CHECK_GT(790025, 3692);
-    REQUIRE_GT(790025, 3692);
-    CHECK_LE(3692, 790025);
-    REQUIRE_LE(3692, 790025);
-    CHECK_GT(638335, 598433);
-    REQUIRE_GT(638335, 598433);
-    CHECK_LT(598433, 638335);
-    REQUIRE_LT(598433, 638335);
-    CHECK_GE(638335, 598433);
-    REQUIRE_GE(638335, 598433);
-    CHECK_LT(913677, 988018);
-    REQUIRE_LT(913677, 988018);
-    CHECK_GT(988018, 913677);
-    REQUIRE_GT(988018, 913677);
-    CHECK_LE(913677, 988018);
-    REQUIRE_LE(913677, 988018);
-    CHECK_LT(127242, 355471);
-    REQUIRE_LT(127242, 355471);
-    CHECK_GT(355471, 127242);
-    REQUIRE_GT(355471, 127242);
-    CHECK_LE(127242, 355471);
-    REQUIRE_LE(127242, 355471);
-    CHECK_GT(872737, 567776);
-    REQUIRE_GT(872737, 567776);
-    CHECK_LT(567776, 872737);
-    REQUIRE_LT(567776, 872737);
-    CHECK_GE(872737, 567776);
-    REQUIRE_GE(872737, 567776);
-    CHECK_LT(605484, 644822);
-    REQUIRE_LT(605484, 644822);
-    CHECK_GT(644822, 605484);
-    REQUIRE_GT(644822, 605484);
-    CHECK_LE(605484, 644822);
-    REQUIRE_LE(605484, 644822);
-    CHECK_LT(54605, 512865);
-    REQUIRE_LT(54605, 512865);
-    CHECK_GT(512865, 54605);
-    REQUIRE_GT(512865, 54605);
-    CHECK_LE(54605, 512865);
-    REQUIRE_LE(54605, 512865);
-    CHECK_GT(773432, 347191);
-    REQUIRE_GT(773432, 347191);
-    CHECK_LT(347191, 773432);
-    REQUIRE_LT(347191, 773432);
-    CHECK_GE(773432, 347191);
-    REQUIRE_GE(773432, 347191);
-    CHECK_LT(195135, 822532);
-    REQUIRE_LT(195135, 822532);
-    CHECK_GT(822532, 195135);
-    REQUIRE_GT(822532, 195135);
-    CHECK_LE(195135, 822532);
-    REQUIRE_LE(195135, 822532);
-    CHECK_GT(379806, 102123);
-    REQUIRE_GT(379806, 102123);
-    CHECK_LT(102123, 379806);
-    REQUIRE_LT(102123, 379806);
-    CHECK_GE(379806, 102123);
-    REQUIRE_GE(379806, 102123);
-    CHECK_LT(859399, 965606);
-    REQUIRE_LT(859399, 965606);
-    CHECK_GT(965606, 859399);
-    REQUIRE_GT(965606, 859399);
-    CHECK_LE(859399, 965606);
-    REQUIRE_LE(859399, 965606);
-    CHECK_GT(540267, 108853);
-    REQUIRE_GT(540267, 108853);
-    CHECK_LT(108853, 540267);
-    REQUIRE_LT(108853, 540267);
-    CHECK_GE(540267, 108853);
-    REQUIRE_GE(540267, 108853);
-    CHECK_GT(550879, 470722);
-    REQUIRE_GT(550879, 470722);
-    CHECK_LT(470722, 550879);
-    REQUIRE_LT(470722, 550879);
-    CHECK_GE(550879, 470722);
-    REQUIRE_GE(550879, 470722);
-    CHECK_GT(726015, 493071);
-    REQUIRE_GT(726015, 493071);
-    CHECK_LT(493071, 726015);
-    REQUIRE_LT(493071, 726015);
-    CHECK_GE(726015, 493071);
-    REQUIRE_GE(726015, 493071);
-    CHECK_LT(514486, 879141);
-    REQUIRE_LT(514486, 879141);
-    CHECK_GT(879141, 514486);
-    REQUIRE_GT(879141, 514486);
-    CHECK_LE(514486, 879141);
-    REQUIRE_LE(514486, 879141);
-    CHECK_LT(162495, 722262);
-    REQUIRE_LT(162495, 722262);
-    CHECK_GT(722262, 162495);
-    REQUIRE_GT(722262, 162495);
-    CHECK_LE(162495, 722262);
-    REQUIRE_LE(162495, 722262);
-    CHECK_GT(666632, 625093);
-    REQUIRE_GT(666632, 625093);
-    CHECK_LT(625093, 666632);
-    REQUIRE_LT(625093, 666632);
-    CHECK_GE(666632, 625093);
-    REQUIRE_GE(666632, 625093);
-    CHECK_LT(389581, 883972);
-    REQUIRE_LT(389581, 883972);
-    CHECK_GT(883972, 389581);
-    REQUIRE_GT(883972, 389581);
-    CHECK_LE(389581, 883972);
-    REQUIRE_LE(389581, 883972);
-    CHECK_GT(869316, 276498);
-    REQUIRE_GT(869316, 276498);
-    CHECK_LT(276498, 869316);
-    REQUIRE_LT(276498, 869316);
-    CHECK_GE(869316, 276498);
-    REQUIRE_GE(869316, 276498);
-    CHECK_GT(545646, 220518);
-    REQUIRE_GT(545646, 220518);
-    CHECK_LT(220518, 545646);
-    REQUIRE_LT(220518, 545646);
-    CHECK_GE(545646, 220518);
-    REQUIRE_GE(545646, 220518);
-    CHECK_LT(285408, 338979);
-    REQUIRE_LT(285408, 338979);
-    CHECK_GT(338979, 285408);
-    REQUIRE_GT(338979, 285408);
-    CHECK_LE(285408, 338979);
-    REQUIRE_LE(285408, 338979);
-    CHECK_LT(700841, 941711);
-    REQUIRE_LT(700841, 941711);
-    CHECK_GT(941711, 700841);
-    REQUIRE_GT(941711, 700841);
-    CHECK_LE(700841, 941711);
-    REQUIRE_LE(700841, 941711);
-    CHECK_GT(928721, 553613);
-    REQUIRE_GT(928721, 553613);
-    CHECK_LT(553613, 928721);
-    REQUIRE_LT(553613, 928721);
-    CHECK_GE(928721, 553613);
-    REQUIRE_GE(928721, 553613);
-    CHECK_LT(326745, 890930);
-    REQUIRE_LT(326745, 890930);
-    CHECK_GT(890930, 326745);
-    REQUIRE_GT(890930, 326745);
-    CHECK_LE(326745, 890930);
-    REQUIRE_LE(326745, 890930);
-    CHECK_LT(4442, 291731);
-    REQUIRE_LT(4442, 291731);
-    CHECK_GT(291731, 4442);
-    REQUIRE_GT(291731, 4442);
-    CHECK_LE(4442, 291731);
-    REQUIRE_LE(4442, 291731);
-    CHECK_LT(200691, 874702);
-    REQUIRE_LT(200691, 874702);
-    CHECK_GT(874702, 200691);
-    REQUIRE_GT(874702, 200691);
-    CHECK_LE(200691, 874702);
-    REQUIRE_LE(200691, 874702);
-    CHECK_GT(727380, 265690);
-    REQUIRE_GT(727380, 265690);
-    CHECK_LT(265690, 727380);
-    REQUIRE_LT(265690, 727380);
-    CHECK_GE(727380, 265690);
-    REQUIRE_GE(727380, 265690);
-    CHECK_LT(288132, 529068);
-    REQUIRE_LT(288132, 529068);
-    CHECK_GT(529068, 288132);
-    REQUIRE_GT(529068, 288132);
-    CHECK_LE(288132, 529068);
-    REQUIRE_LE(288132, 529068);
-    CHECK_GT(118241, 71332);
-    REQUIRE_GT(118241, 71332);
-    CHECK_LT(71332, 118241);
-    REQUIRE_LT(71332, 118241);
-    CHECK_GE(118241, 71332);
-    REQUIRE_GE(118241, 71332);
-    CHECK_GT(779797, 54764);
-    REQUIRE_GT(779797, 54764);
-    CHECK_LT(54764, 779797);
-    REQUIRE_LT(54764, 779797);
-    CHECK_GE(779797, 54764);
-    REQUIRE_GE(779797, 54764);
-    CHECK_LT(167975, 599686);
-    REQUIRE_LT(167975, 599686);
-    CHECK_GT(599686, 167975);
-    REQUIRE_GT(599686, 167975);
-    CHECK_LE(167975, 599686);
-    REQUIRE_LE(167975, 599686);
-    CHECK_LT(302887, 365782);
-    REQUIRE_LT(302887, 365782);
-    CHECK_GT(365782, 302887);
-    REQUIRE_GT(365782, 302887);
-    CHECK_LE(302887, 365782);
-    REQUIRE_LE(302887, 365782);
-    CHECK_GT(683911, 325274);
-    REQUIRE_GT(683911, 325274);
-    CHECK_LT(325274, 683911);
-    REQUIRE_LT(325274, 683911);
-    CHECK_GE(683911, 325274);
-    REQUIRE_GE(683911, 325274);
-    CHECK_GT(924880, 398060);
-    REQUIRE_GT(924880, 398060);
-    CHECK_LT(398060, 924880);
-    REQUIRE_LT(398060, 924880);
-    CHECK_GE(924880, 398060);
-    REQUIRE_GE(924880, 398060);
-    CHECK_GT(692753, 618992);
-    REQUIRE_GT(692753, 618992);
-    CHECK_LT(618992, 692753);
-    REQUIRE_LT(618992, 692753);
-    CHECK_GE(692753, 618992);
-    REQUIRE_GE(692753, 618992);
-    CHECK_GT(843128, 161383);
-    REQUIRE_GT(843128, 161383);
-    CHECK_LT(161383, 843128);
-    REQUIRE_LT(161383, 843128);
-    CHECK_GE(843128, 161383);
-    REQUIRE_GE(843128, 161383);
-    CHECK_LT(623432, 965887);
-    REQUIRE_LT(623432, 965887);
-    CHECK_GT(965887, 623432);
-    REQUIRE_GT(965887, 623432);
-    CHECK_LE(623432, 965887);
-    REQUIRE_LE(623432, 965887);
-    CHECK_LT(351559, 866738);
-    REQUIRE_LT(351559, 866738);
-    CHECK_GT(866738, 351559);
-    REQUIRE_GT(866738, 351559);
-    CHECK_LE(351559, 866738);
-    REQUIRE_LE(351559, 866738);
-    CHECK_LT(48973, 610890);
-    REQUIRE_LT(48973, 610890);
-    CHECK_GT(610890, 48973);
-    REQUIRE_GT(610890, 48973);
-    CHECK_LE(48973, 610890);
-    REQUIRE_LE(48973, 610890);
-    CHECK_GT(814312, 477659);
-    REQUIRE_GT(814312, 477659);
-    CHECK_LT(477659, 814312);
-    REQUIRE_LT(477659, 814312);
-    CHECK_GE(814312, 477659);
-    REQUIRE_GE(814312, 477659);
-    CHECK_GT(808283, 166908);
-    REQUIRE_GT(808283, 166908);
-    CHECK_LT(166908, 808283);
-    REQUIRE_LT(166908, 808283);
-    CHECK_GE(808283, 166908);
-    REQUIRE_GE(808283, 166908);
-    CHECK_GT(241251, 208032);
-    REQUIRE_GT(241251, 208032);
-    CHECK_LT(208032, 241251);
-    REQUIRE_LT(208032, 241251);
-    CHECK_GE(241251, 208032);
-    REQUIRE_GE(241251, 208032);
-    CHECK_LT(511467, 963627);
-    REQUIRE_LT(511467, 963627);
-    CHECK_GT(963627, 511467);
-    REQUIRE_GT(963627, 511467);
-    CHECK_LE(511467, 963627);
-    REQUIRE_LE(511467, 963627);
-    CHECK_GT(972556, 968560);
-    REQUIRE_GT(972556, 968560);
-    CHECK_LT(968560, 972556);
-    REQUIRE_LT(968560, 972556);
-    CHECK_GE(972556, 968560);
-    REQUIRE_GE(972556, 968560);
-    CHECK_GT(141320, 97030);
-    REQUIRE_GT(141320, 97030);
-    CHECK_LT(97030, 141320);
-    REQUIRE_LT(97030, 141320);
-    CHECK_GE(141320, 97030);
-    REQUIRE_GE(141320, 97030);
-    CHECK_LT(529635, 580549);
-    REQUIRE_LT(529635, 580549);
-    CHECK_GT(580549, 529635);
-    REQUIRE_GT(580549, 529635);
-    CHECK_LE(529635, 580549);
-    REQUIRE_LE(529635, 580549);
-    CHECK_GT(588215, 6177);
-    REQUIRE_GT(588215, 6177);
-    CHECK_LT(6177, 588215);
-    REQUIRE_LT(6177, 588215);
-    CHECK_GE(588215, 6177);
-    REQUIRE_GE(588215, 6177);
-    CHECK_LT(42621, 216574);
-    REQUIRE_LT(42621, 216574);
-    CHECK_GT(216574, 42621);
-    REQUIRE_GT(216574, 42621);
-    CHECK_LE(42621, 216574);
-    REQUIRE_LE(42621, 216574);
-    CHECK_LT(910273, 974416);
-    REQUIRE_LT(910273, 974416);
-    CHECK_GT(974416, 910273);
-    REQUIRE_GT(974416, 910273);
-    CHECK_LE(910273, 974416);
-    REQUIRE_LE(910273, 974416);
-    CHECK_LT(506076, 576905);
-    REQUIRE_LT(506076, 576905);
-    CHECK_GT(576905, 506076);
-    REQUIRE_GT(576905, 506076);
-    CHECK_LE(506076, 576905);
-    REQUIRE_LE(506076, 576905);
-    CHECK_GT(819397, 662210);
-    REQUIRE_GT(819397, 662210);
-    CHECK_LT(662210, 819397);
-    REQUIRE_LT(662210, 819397);
-    CHECK_GE(819397, 662210);
-    REQUIRE_GE(819397, 662210);
-    CHECK_LT(299018, 873889);
-    REQUIRE_LT(299018, 873889);
-    CHECK_GT(873889, 299018);
-    REQUIRE_GT(873889, 299018);
-    CHECK_LE(299018, 873889);
-    REQUIRE_LE(299018, 873889);
-    CHECK_LT(514633, 878324);
-    REQUIRE_LT(514633, 878324);
-    CHECK_GT(878324, 514633);
-    REQUIRE_GT(878324, 514633);
-    CHECK_LE(514633, 878324);
-    REQUIRE_LE(514633, 878324);
-    CHECK_GT(735863, 674503);
-    REQUIRE_GT(735863, 674503);
-    CHECK_LT(674503, 735863);
-    REQUIRE_LT(674503, 735863);
-    CHECK_GE(735863, 674503);
-    REQUIRE_GE(735863, 674503);
-    CHECK_GT(726756, 50904);
-    REQUIRE_GT(726756, 50904);
-    CHECK_LT(50904, 726756);
-    REQUIRE_LT(50904, 726756);
-    CHECK_GE(726756, 50904);
-    REQUIRE_GE(726756, 50904);
-    CHECK_LT(260147, 869332);
-    REQUIRE_LT(260147, 869332);
-    CHECK_GT(869332, 260147);
-    REQUIRE_GT(869332, 260147);
-    CHECK_LE(260147, 869332);
-    REQUIRE_LE(260147, 869332);
-    CHECK_GT(364498, 236606);
-    REQUIRE_GT(364498, 236606);
-    CHECK_LT(236606, 364498);
-    REQUIRE_LT(236606, 364498);
-    CHECK_GE(364498, 236606);
-    REQUIRE_GE(364498, 236606);
-    CHECK_GT(466734, 8564);
-    REQUIRE_GT(466734, 8564);
-    CHECK_LT(8564, 466734);
-    REQUIRE_LT(8564, 466734);
-    CHECK_GE(466734, 8564);
-    REQUIRE_GE(466734, 8564);
-    CHECK_LT(194717, 280443);
-    REQUIRE_LT(194717, 280443);
-    CHECK_GT(280443, 194717);
-    REQUIRE_GT(280443, 194717);
-    CHECK_LE(194717, 280443);
-    REQUIRE_LE(194717, 280443);
-    CHECK_LT(152230, 596420);
-    REQUIRE_LT(152230, 596420);
-    CHECK_GT(596420, 152230);
-    REQUIRE_GT(596420, 152230);
-    CHECK_LE(152230, 596420);
-    REQUIRE_LE(152230, 596420);
-    CHECK_LT(327756, 495296);
-    REQUIRE_LT(327756, 495296);
-    CHECK_GT(495296, 327756);
-    REQUIRE_GT(495296, 327756);
-    CHECK_LE(327756, 495296);
-    REQUIRE_LE(327756, 495296);
-    CHECK_GT(714039, 356949);
-    REQUIRE_GT(714039, 356949);
-    CHECK_LT(356949, 714039);
-    REQUIRE_LT(356949, 714039);
-    CHECK_GE(714039, 356949);
-    REQUIRE_GE(714039, 356949);
-    CHECK_GT(677267, 293040);
-    REQUIRE_GT(677267, 293040);
-    CHECK_LT(293040, 677267);
-    REQUIRE_LT(293040, 677267);
-    CHECK_GE(677267, 293040);
-    REQUIRE_GE(677267, 293040);
-    CHECK_GT(945994, 587348);
-    REQUIRE_GT(945994, 587348);
-    CHECK_LT(587348, 945994);
-    REQUIRE_LT(587348, 945994);
-    CHECK_GE(945994, 587348);
-    REQUIRE_GE(945994, 587348);
-    CHECK_GT(802701, 302882);
-    REQUIRE_GT(802701, 302882);
-    CHECK_LT(302882, 802701);
-    REQUIRE_LT(302882, 802701);
-    CHECK_GE(802701, 302882);
-    REQUIRE_GE(802701, 302882);
-    CHECK_LT(126552, 778846);
-    REQUIRE_LT(126552, 778846);
-    CHECK_GT(778846, 126552);
-    REQUIRE_GT(778846, 126552);
-    CHECK_LE(126552, 778846);
-    REQUIRE_LE(126552, 778846);
-    CHECK_LT(311143, 405057);
-    REQUIRE_LT(311143, 405057);
-    CHECK_GT(405057, 311143);
-    REQUIRE_GT(405057, 311143);
-    CHECK_LE(311143, 405057);
-    REQUIRE_LE(311143, 405057);
-    CHECK_LT(618717, 902405);
-    REQUIRE_LT(618717, 902405);
-    CHECK_GT(902405, 618717);
-    REQUIRE_GT(902405, 618717);
-    CHECK_LE(618717, 902405);
-    REQUIRE_LE(618717, 902405);
-    CHECK_LT(340007, 350916);
-    REQUIRE_LT(340007, 350916);
-    CHECK_GT(350916, 340007);
-    REQUIRE_GT(350916, 340007);
-    CHECK_LE(340007, 350916);
-    REQUIRE_LE(340007, 350916);
-    CHECK_LT(207109, 629195);
-    REQUIRE_LT(207109, 629195);
-    CHECK_GT(629195, 207109);
-    REQUIRE_GT(629195, 207109);
-    CHECK_LE(207109, 629195);
-    REQUIRE_LE(207109, 629195);
-    CHECK_GT(989681, 672590);
-    REQUIRE_GT(989681, 672590);
-    CHECK_LT(672590, 989681);
-    REQUIRE_LT(672590, 989681);
-    CHECK_GE(989681, 672590);
-    REQUIRE_GE(989681, 672590);
-    CHECK_LT(122085, 709445);
-    REQUIRE_LT(122085, 709445);
-    CHECK_GT(709445, 122085);
-    REQUIRE_GT(709445, 122085);
-    CHECK_LE(122085, 709445);
-    REQUIRE_LE(122085, 709445);
-    CHECK_LT(67784, 528317);
-    REQUIRE_LT(67784, 528317);
-    CHECK_GT(528317, 67784);
-    REQUIRE_GT(528317, 67784);
-    CHECK_LE(67784, 528317);
-    REQUIRE_LE(67784, 528317);
-    CHECK_LT(643516, 772254);
-    REQUIRE_LT(643516, 772254);
-    CHECK_GT(772254, 643516);
-    REQUIRE_GT(772254, 643516);
-    CHECK_LE(643516, 772254);
-    REQUIRE_LE(643516, 772254);
-    CHECK_LT(480298, 684930);
-    REQUIRE_LT(480298, 684930);
-    CHECK_GT(684930, 480298);
-    REQUIRE_GT(684930, 480298);
-    CHECK_LE(480298, 684930);
-    REQUIRE_LE(480298, 684930);
-    CHECK_LT(132252, 763728);
-    REQUIRE_LT(132252, 763728);
-    CHECK_GT(763728, 132252);
-    REQUIRE_GT(763728, 132252);
-    CHECK_LE(132252, 763728);
-    REQUIRE_LE(132252, 763728);
-    CHECK_GT(976945, 805828);
-    REQUIRE_GT(976945, 805828);
-    CHECK_LT(805828, 976945);
-    REQUIRE_LT(805828, 976945);
-    CHECK_GE(976945, 805828);
-    REQUIRE_GE(976945, 805828);
-    CHECK_GT(961245, 488527);
-    REQUIRE_GT(961245, 488527);
-    CHECK_LT(488527, 961245);
-    REQUIRE_LT(488527, 961245);
-    CHECK_GE(961245, 488527);
-    REQUIRE_GE(961245, 488527);
-    CHECK_LT(79770, 989093);
-    REQUIRE_LT(79770, 989093);
-    CHECK_GT(989093, 79770);
-    REQUIRE_GT(989093, 79770);
-    CHECK_LE(79770, 989093);
-    REQUIRE_LE(79770, 989093);
-    CHECK_GT(754593, 492286);
-    REQUIRE_GT(754593, 492286);
-    CHECK_LT(492286, 754593);
-    REQUIRE_LT(492286, 754593);
-    CHECK_GE(754593, 492286);
-    REQUIRE_GE(754593, 492286);
-    CHECK_LT(418494, 699189);
-    REQUIRE_LT(418494, 699189);
-    CHECK_GT(699189, 418494);
-    REQUIRE_GT(699189, 418494);
-    CHECK_LE(418494, 699189);
-    REQUIRE_LE(418494, 699189);
-    CHECK_LT(72485, 405702);
-    REQUIRE_LT(72485, 405702);
-    CHECK_GT(405702, 72485);
-    REQUIRE_GT(405702, 72485);
-    CHECK_LE(72485, 405702);
-    REQUIRE_LE(72485, 405702);
-    CHECK_LT(682112, 913503);
-    REQUIRE_LT(682112, 913503);
-    CHECK_GT(913503, 682112);
-    REQUIRE_GT(913503, 682112);
-    CHECK_LE(682112, 913503);
-    REQUIRE_LE(682112, 913503);
-    CHECK_LT(417979, 482469);
-    REQUIRE_LT(417979, 482469);
-    CHECK_GT(482469, 417979);
-    REQUIRE_GT(482469, 417979);
-    CHECK_LE(417979, 482469);
-    REQUIRE_LE(417979, 482469);
-    CHECK_GT(570253, 162139);
-    REQUIRE_GT(570253, 162139);
-    CHECK_LT(162139, 570253);
-    REQUIRE_LT(162139, 570253);
-    CHECK_GE(570253, 162139);
-    REQUIRE_GE(570253, 162139);
-    CHECK_LT(210938, 743087);
-    REQUIRE_LT(210938, 743087);
-    CHECK_GT(743087, 210938);
-    REQUIRE_GT(743087, 210938);
-    CHECK_LE(210938, 743087);
-    REQUIRE_LE(210938, 743087);
-    CHECK_LT(109220, 628231);
-    REQUIRE_LT(109220, 628231);
-    CHECK_GT(628231, 109220);
-    REQUIRE_GT(628231, 109220);
-    CHECK_LE(109220, 628231);
-    REQUIRE_LE(109220, 628231);
-    CHECK_GT(698548, 13327);
-    REQUIRE_GT(698548, 13327);
-    CHECK_LT(13327, 698548);
-    REQUIRE_LT(13327, 698548);
-    CHECK_GE(698548, 13327);
-    REQUIRE_GE(698548, 13327);
-    CHECK_GT(544315, 377662);
-    REQUIRE_GT(544315, 377662);
-    CHECK_LT(377662, 544315);
-    REQUIRE_LT(377662, 544315);
-    CHECK_GE(544315, 377662);
-    REQUIRE_GE(544315, 377662);
-    CHECK_LT(423344, 429496);
-    REQUIRE_LT(423344, 429496);
-    CHECK_GT(429496, 423344);
-    REQUIRE_GT(429496, 423344);
-    CHECK_LE(423344, 429496);
-    REQUIRE_LE(423344, 429496);
-    CHECK_LT(815282, 850915);
-    REQUIRE_LT(815282, 850915);
-    CHECK_GT(850915, 815282);
-    REQUIRE_GT(850915, 815282);
-    CHECK_LE(815282, 850915);
-    REQUIRE_LE(815282, 850915);
-    CHECK_LT(473711, 567795);
-    REQUIRE_LT(473711, 567795);
-    CHECK_GT(567795, 473711);
-    REQUIRE_GT(567795, 473711);
-    CHECK_LE(473711, 567795);
-    REQUIRE_LE(473711, 567795);
-    CHECK_GT(953671, 625307);
-    REQUIRE_GT(953671, 625307);
-    CHECK_LT(625307, 953671);
-    REQUIRE_LT(625307, 953671);
-    CHECK_GE(953671, 625307);
-    REQUIRE_GE(953671, 625307);
-    CHECK_LT(124434, 781480);
-    REQUIRE_LT(124434, 781480);
-    CHECK_GT(781480, 124434);
-    REQUIRE_GT(781480, 124434);
-    CHECK_LE(124434, 781480);
-    REQUIRE_LE(124434, 781480);
-    CHECK_GT(935583, 782077);
-    REQUIRE_GT(935583, 782077);
-    CHECK_LT(782077, 935583);
-    REQUIRE_LT(782077, 935583);
-    CHECK_GE(935583, 782077);
-    REQUIRE_GE(935583, 782077);
-    CHECK_GT(571366, 434001);
-    REQUIRE_GT(571366, 434001);
-    CHECK_LT(434001, 571366);
-    REQUIRE_LT(434001, 571366);
-    CHECK_GE(571366, 434001);
-    REQUIRE_GE(571366, 434001);
-    CHECK_GT(441666, 63697);
-    REQUIRE_GT(441666, 63697);
-    CHECK_LT(63697, 441666);
-    REQUIRE_LT(63697, 441666);
-    CHECK_GE(441666, 63697);
-    REQUIRE_GE(441666, 63697);
-    CHECK_GT(395129, 257552);
-    REQUIRE_GT(395129, 257552);
-    CHECK_LT(257552, 395129);
-    REQUIRE_LT(257552, 395129);
-    CHECK_GE(395129, 257552);
-    REQUIRE_GE(395129, 257552);
-    CHECK_LT(651732, 682379);
-    REQUIRE_LT(651732, 682379);
-    CHECK_GT(682379, 651732);
-    REQUIRE_GT(682379, 651732);
-    CHECK_LE(651732, 682379);
-    REQUIRE_LE(651732, 682379);
-    CHECK_LT(47706, 150999);
-    REQUIRE_LT(47706, 150999);
-    CHECK_GT(150999, 47706);
-    REQUIRE_GT(150999, 47706);
-    CHECK_LE(47706, 150999);
-    REQUIRE_LE(47706, 150999);
-    CHECK_GT(665420, 393029);
-    REQUIRE_GT(665420, 393029);
-    CHECK_LT(393029, 665420);
-    REQUIRE_LT(393029, 665420);
-    CHECK_GE(665420, 393029);
-    REQUIRE_GE(665420, 393029);
-    CHECK_LT(944328, 947576);
-    REQUIRE_LT(944328, 947576);
-    CHECK_GT(947576, 944328);
-    REQUIRE_GT(947576, 944328);
-    CHECK_LE(944328, 947576);
-    REQUIRE_LE(944328, 947576);
-    CHECK_GT(906118, 453264);
-    REQUIRE_GT(906118, 453264);
-    CHECK_LT(453264, 906118);
-    REQUIRE_LT(453264, 906118);
-    CHECK_GE(906118, 453264);
-    REQUIRE_GE(906118, 453264);
-    CHECK_GT(651102, 312893);
-    REQUIRE_GT(651102, 312893);
-    CHECK_LT(312893, 651102);
-    REQUIRE_LT(312893, 651102);
-    CHECK_GE(651102, 312893);
-    REQUIRE_GE(651102, 312893);
-    CHECK_GT(157521, 82522);
-    REQUIRE_GT(157521, 82522);
-    CHECK_LT(82522, 157521);
-    REQUIRE_LT(82522, 157521);
-    CHECK_GE(157521, 82522);
-    REQUIRE_GE(157521, 82522);
-    CHECK_GT(971543, 730621);
-    REQUIRE_GT(971543, 730621);
-    CHECK_LT(730621, 971543);
-    REQUIRE_LT(730621, 971543);
-    CHECK_GE(971543, 730621);
-    REQUIRE_GE(971543, 730621);
-    CHECK_GT(466563, 300231);
-    REQUIRE_GT(466563, 300231);
-    CHECK_LT(300231, 466563);
-    REQUIRE_LT(300231, 466563);
-    CHECK_GE(466563, 300231);
-    REQUIRE_GE(466563, 300231);
-    CHECK_LT(622770, 645119);
-    REQUIRE_LT(622770, 645119);
-    CHECK_GT(645119, 622770);
-    REQUIRE_GT(645119, 622770);
-    CHECK_LE(622770, 645119);
-    REQUIRE_LE(622770, 645119);
-    CHECK_GT(456977, 283420);
-    REQUIRE_GT(456977, 283420);
-    CHECK_LT(283420, 456977);
-    REQUIRE_LT(283420, 456977);
-    CHECK_GE(456977, 283420);
-    REQUIRE_GE(456977, 283420);
-    CHECK_LT(143491, 531452);
-    REQUIRE_LT(143491, 531452);
-    CHECK_GT(531452, 143491);
-    REQUIRE_GT(531452, 143491);
-    CHECK_LE(143491, 531452);
-    REQUIRE_LE(143491, 531452);
-    CHECK_LT(117218, 141797);
-    REQUIRE_LT(117218, 141797);
-    CHECK_GT(141797, 117218);
-    REQUIRE_GT(141797, 117218);
-    CHECK_LE(117218, 141797);
-    REQUIRE_LE(117218, 141797);
-    CHECK_GT(752286, 241947);
-    REQUIRE_GT(752286, 241947);
-    CHECK_LT(241947, 752286);
-    REQUIRE_LT(241947, 752286);
-    CHECK_GE(752286, 241947);
-    REQUIRE_GE(752286, 241947);
-    CHECK_LT(171563, 544248);
-    REQUIRE_LT(171563, 544248);
-    CHECK_GT(544248, 171563);
-    REQUIRE_GT(544248, 171563);
-    CHECK_LE(171563, 544248);
-    REQUIRE_LE(171563, 544248);
-    CHECK_GT(889878, 517396);
-    REQUIRE_GT(889878, 517396);
-    CHECK_LT(517396, 889878);
-    REQUIRE_LT(517396, 889878);
-    CHECK_GE(889878, 517396);
-    REQUIRE_GE(889878, 517396);
-    CHECK_GT(256563, 91467);
-    REQUIRE_GT(256563, 91467);
-    CHECK_LT(91467, 256563);
-    REQUIRE_LT(91467, 256563);
-    CHECK_GE(256563, 91467);
-    REQUIRE_GE(256563, 91467);
-    CHECK_LT(896132, 934677);
-    REQUIRE_LT(896132, 934677);
-    CHECK_GT(934677, 896132);
-    REQUIRE_GT(934677, 896132);
-    CHECK_LE(896132, 934677);
-    REQUIRE_LE(896132, 934677);
-    CHECK_LT(375725, 438952);
-    REQUIRE_LT(375725, 438952);
-    CHECK_GT(438952, 375725);
-    REQUIRE_GT(438952, 375725);
-    CHECK_LE(375725, 438952);
-    REQUIRE_LE(375725, 438952);
-    CHECK_LT(333667, 787494);
-    REQUIRE_LT(333667, 787494);
-    CHECK_GT(787494, 333667);
-    REQUIRE_GT(787494, 333667);
-    CHECK_LE(333667, 787494);
-    REQUIRE_LE(333667, 787494);
-    CHECK_GT(786001, 247588);
-    REQUIRE_GT(786001, 247588);
-    CHECK_LT(247588, 786001);
-    REQUIRE_LT(247588, 786001);
-    CHECK_GE(786001, 247588);
-    REQUIRE_GE(786001, 247588);
-    CHECK_LT(21463, 278305);
-    REQUIRE_LT(21463, 278305);
-    CHECK_GT(278305, 21463);
-    REQUIRE_GT(278305, 21463);
-    CHECK_LE(21463, 278305);
-    REQUIRE_LE(21463, 278305);
-    CHECK_GT(975315, 471029);
-    REQUIRE_GT(975315, 471029);
-    CHECK_LT(471029, 975315);
-    REQUIRE_LT(471029, 975315);
-    CHECK_GE(975315, 471029);
-    REQUIRE_GE(975315, 471029);
-    CHECK_GT(594128, 235839);
-    REQUIRE_GT(594128, 235839);
-    CHECK_LT(235839, 594128);
-    REQUIRE_LT(235839, 594128);
-    CHECK_GE(594128, 235839);
-    REQUIRE_GE(594128, 235839);
-    CHECK_GT(827320, 518149);
-    REQUIRE_GT(827320, 518149);
-    CHECK_LT(518149, 827320);
-    REQUIRE_LT(518149, 827320);
-    CHECK_GE(827320, 518149);
-    REQUIRE_GE(827320, 518149);
-    CHECK_GT(714292, 142101);
-    REQUIRE_GT(714292, 142101);
-    CHECK_LT(142101, 714292);
-    REQUIRE_LT(142101, 714292);
-    CHECK_GE(714292, 142101);
-    REQUIRE_GE(714292, 142101);
-    CHECK_GT(696111, 564673);
-    REQUIRE_GT(696111, 564673);
-    CHECK_LT(564673, 696111);
-    REQUIRE_LT(564673, 696111);
-    CHECK_GE(696111, 564673);
-    REQUIRE_GE(696111, 564673);
-    CHECK_GT(872660, 843385);
-    REQUIRE_GT(872660, 843385);
-    CHECK_LT(843385, 872660);
-    REQUIRE_LT(843385, 872660);
-    CHECK_GE(872660, 843385);
-    REQUIRE_GE(872660, 843385);
-    CHECK_LT(678201, 685305);
-    REQUIRE_LT(678201, 685305);
-    CHECK_GT(685305, 678201);
-    REQUIRE_GT(685305, 678201);
-    CHECK_LE(678201, 685305);
-    REQUIRE_LE(678201, 685305);
-    CHECK_LT(85719, 781909);
-    REQUIRE_LT(85719, 781909);
-    CHECK_GT(781909, 85719);
-    REQUIRE_GT(781909, 85719);
-    CHECK_LE(85719, 781909);
-    REQUIRE_LE(85719, 781909);
-    CHECK_LT(797916, 981628);
-    REQUIRE_LT(797916, 981628);
-    CHECK_GT(981628, 797916);
-    REQUIRE_GT(981628, 797916);
-    CHECK_LE(797916, 981628);
-    REQUIRE_LE(797916, 981628);
-    CHECK_LT(105364, 556118);
-    REQUIRE_LT(105364, 556118);
-    CHECK_GT(556118, 105364);
-    REQUIRE_GT(556118, 105364);
-    CHECK_LE(105364, 556118);
-    REQUIRE_LE(105364, 556118);
-    CHECK_LT(10435, 753194);
-    REQUIRE_LT(10435, 753194);
-    CHECK_GT(753194, 10435);
-    REQUIRE_GT(753194, 10435);
-    CHECK_LE(10435, 753194);
-    REQUIRE_LE(10435, 753194);
-    CHECK_GT(877187, 254699);
-    REQUIRE_GT(877187, 254699);
-    CHECK_LT(254699, 877187);
-    REQUIRE_LT(254699, 877187);
-    CHECK_GE(877187, 254699);
-    REQUIRE_GE(877187, 254699);
-    CHECK_GT(896558, 557978);
-    REQUIRE_GT(896558, 557978);
-    CHECK_LT(557978, 896558);
-    REQUIRE_LT(557978, 896558);
-    CHECK_GE(896558, 557978);
-    REQUIRE_GE(896558, 557978);
-    CHECK_GT(466913, 95887);
-    REQUIRE_GT(466913, 95887);
-    CHECK_LT(95887, 466913);
-    REQUIRE_LT(95887, 466913);
-    CHECK_GE(466913, 95887);
-    REQUIRE_GE(466913, 95887);
-    CHECK_LT(573752, 853108);
-    REQUIRE_LT(573752, 853108);
-    CHECK_GT(853108, 573752);
-    REQUIRE_GT(853108, 573752);
-    CHECK_LE(573752, 853108);
-    REQUIRE_LE(573752, 853108);
-    CHECK_LT(361553, 400556);
-    REQUIRE_LT(361553, 400556);
-    CHECK_GT(400556, 361553);
-    REQUIRE_GT(400556, 361553);
-    CHECK_LE(361553, 400556);
-    REQUIRE_LE(361553, 400556);
-    CHECK_GT(757053, 636922);
-    REQUIRE_GT(757053, 636922);
-    CHECK_LT(636922, 757053);
-    REQUIRE_LT(636922, 757053);
-    CHECK_GE(757053, 636922);
-    REQUIRE_GE(757053, 636922);
-    CHECK_LT(607833, 626219);
-    REQUIRE_LT(607833, 626219);
-    CHECK_GT(626219, 607833);
-    REQUIRE_GT(626219, 607833);
-    CHECK_LE(607833, 626219);
-    REQUIRE_LE(607833, 626219);
-    CHECK_GT(758409, 96945);
-    REQUIRE_GT(758409, 96945);
-    CHECK_LT(96945, 758409);
-    REQUIRE_LT(96945, 758409);
-    CHECK_GE(758409, 96945);
-    REQUIRE_GE(758409, 96945);
-    CHECK_LT(220468, 432430);
-    REQUIRE_LT(220468, 432430);
-    CHECK_GT(432430, 220468);
-    REQUIRE_GT(432430, 220468);
-    CHECK_LE(220468, 432430);
-    REQUIRE_LE(220468, 432430);
-    CHECK_GT(983251, 429362);
-    REQUIRE_GT(983251, 429362);
-    CHECK_LT(429362, 983251);
-    REQUIRE_LT(429362, 983251);
-    CHECK_GE(983251, 429362);
-    REQUIRE_GE(983251, 429362);
-    CHECK_LT(411622, 766008);
-    REQUIRE_LT(411622, 766008);
-    CHECK_GT(766008, 411622);
-    REQUIRE_GT(766008, 411622);
-    CHECK_LE(411622, 766008);
-    REQUIRE_LE(411622, 766008);
-    CHECK_LT(98314, 838982);
-    REQUIRE_LT(98314, 838982);
-    CHECK_GT(838982, 98314);
-    REQUIRE_GT(838982, 98314);
-    CHECK_LE(98314, 838982);
-    REQUIRE_LE(98314, 838982);
-    CHECK_LT(120191, 401312);
-    REQUIRE_LT(120191, 401312);
-    CHECK_GT(401312, 120191);
-    REQUIRE_GT(401312, 120191);
-    CHECK_LE(120191, 401312);
-    REQUIRE_LE(120191, 401312);
-    CHECK_LT(54556, 925745);
-    REQUIRE_LT(54556, 925745);
-    CHECK_GT(925745, 54556);
-    REQUIRE_GT(925745, 54556);
-    CHECK_LE(54556, 925745);
-    REQUIRE_LE(54556, 925745);
-    CHECK_LT(102783, 649987);
-    REQUIRE_LT(102783, 649987);
-    CHECK_GT(649987, 102783);
-    REQUIRE_GT(649987, 102783);
-    CHECK_LE(102783, 649987);
-    REQUIRE_LE(102783, 649987);
-    CHECK_LT(136167, 399969);
-    REQUIRE_LT(136167, 399969);
-    CHECK_GT(399969, 136167);
-    REQUIRE_GT(399969, 136167);
-    CHECK_LE(136167, 399969);
-    REQUIRE_LE(136167, 399969);
-    CHECK_GT(362115, 35159);
-    REQUIRE_GT(362115, 35159);
-    CHECK_LT(35159, 362115);
-    REQUIRE_LT(35159, 362115);
-    CHECK_GE(362115, 35159);
-    REQUIRE_GE(362115, 35159);
-    CHECK_LT(358862, 802831);
-    REQUIRE_LT(358862, 802831);
-    CHECK_GT(802831, 358862);
-    REQUIRE_GT(802831, 358862);
-    CHECK_LE(358862, 802831);
-    REQUIRE_LE(358862, 802831);
-    CHECK_GT(485349, 365044);
-    REQUIRE_GT(485349, 365044);
-    CHECK_LT(365044, 485349);
-    REQUIRE_LT(365044, 485349);
-    CHECK_GE(485349, 365044);
-    REQUIRE_GE(485349, 365044);
-    CHECK_GT(916327, 783519);
-    REQUIRE_GT(916327, 783519);
-    CHECK_LT(783519, 916327);
-    REQUIRE_LT(783519, 916327);
-    CHECK_GE(916327, 783519);
-    REQUIRE_GE(916327, 783519);
-    CHECK_GT(400851, 314751);
-    REQUIRE_GT(400851, 314751);
-    CHECK_LT(314751, 400851);
-    REQUIRE_LT(314751, 400851);
-    CHECK_GE(400851, 314751);
-    REQUIRE_GE(400851, 314751);
-    CHECK_GT(829480, 435777);
-    REQUIRE_GT(829480, 435777);
-    CHECK_LT(435777, 829480);
-    REQUIRE_LT(435777, 829480);
-    CHECK_GE(829480, 435777);
-    REQUIRE_GE(829480, 435777);
-    CHECK_GT(687804, 306052);
-    REQUIRE_GT(687804, 306052);
-    CHECK_LT(306052, 687804);
-    REQUIRE_LT(306052, 687804);
-    CHECK_GE(687804, 306052);
-    REQUIRE_GE(687804, 306052);
-    CHECK_LT(635239, 720603);
-    REQUIRE_LT(635239, 720603);
-    CHECK_GT(720603, 635239);
-    REQUIRE_GT(720603, 635239);
-    CHECK_LE(635239, 720603);
-    REQUIRE_LE(635239, 720603);
-    CHECK_LT(210171, 360960);
-    REQUIRE_LT(210171, 360960);
-    CHECK_GT(360960, 210171);
-    REQUIRE_GT(360960, 210171);
-    CHECK_LE(210171, 360960);
-    REQUIRE_LE(210171, 360960);
-    CHECK_GT(436278, 107945);
-    REQUIRE_GT(436278, 107945);
-    CHECK_LT(107945, 436278);
-    REQUIRE_LT(107945, 436278);
-    CHECK_GE(436278, 107945);
-    REQUIRE_GE(436278, 107945);
-    CHECK_LT(273551, 981967);
-    REQUIRE_LT(273551, 981967);
-    CHECK_GT(981967, 273551);
-    REQUIRE_GT(981967, 273551);
-    CHECK_LE(273551, 981967);
-    REQUIRE_LE(273551, 981967);
-    CHECK_GT(782408, 255623);
-    REQUIRE_GT(782408, 255623);
-    CHECK_LT(255623, 782408);
-    REQUIRE_LT(255623, 782408);
-    CHECK_GE(782408, 255623);
-    REQUIRE_GE(782408, 255623);
-    CHECK_GT(335595, 253543);
-    REQUIRE_GT(335595, 253543);
-    CHECK_LT(253543, 335595);
-    REQUIRE_LT(253543, 335595);
-    CHECK_GE(335595, 253543);
-    REQUIRE_GE(335595, 253543);
-    CHECK_LT(181853, 899479);
-    REQUIRE_LT(181853, 899479);
-    CHECK_GT(899479, 181853);
-    REQUIRE_GT(899479, 181853);
-    CHECK_LE(181853, 899479);
-    REQUIRE_LE(181853, 899479);
-    CHECK_LT(547259, 963952);
-    REQUIRE_LT(547259, 963952);
-    CHECK_GT(963952, 547259);
-    REQUIRE_GT(963952, 547259);
-    CHECK_LE(547259, 963952);
-    REQUIRE_LE(547259, 963952);
-    CHECK_LT(240755, 799167);
-    REQUIRE_LT(240755, 799167);
-    CHECK_GT(799167, 240755);
-    REQUIRE_GT(799167, 240755);
-    CHECK_LE(240755, 799167);
-    REQUIRE_LE(240755, 799167);
-    CHECK_LT(397693, 998672);
-    REQUIRE_LT(397693, 998672);
-    CHECK_GT(998672, 397693);
-    REQUIRE_GT(998672, 397693);
-    CHECK_LE(397693, 998672);
-    REQUIRE_LE(397693, 998672);
-    CHECK_GT(349434, 144682);
-    REQUIRE_GT(349434, 144682);
-    CHECK_LT(144682, 349434);
-    REQUIRE_LT(144682, 349434);
-    CHECK_GE(349434, 144682);
-    REQUIRE_GE(349434, 144682);
-    CHECK_LT(499346, 938115);
-    REQUIRE_LT(499346, 938115);
-    CHECK_GT(938115, 499346);
-    REQUIRE_GT(938115, 499346);
-    CHECK_LE(499346, 938115);
-    REQUIRE_LE(499346, 938115);
-    CHECK_GT(103226, 14575);
-    REQUIRE_GT(103226, 14575);
-    CHECK_LT(14575, 103226);
-    REQUIRE_LT(14575, 103226);
-    CHECK_GE(103226, 14575);
-    REQUIRE_GE(103226, 14575);
-    CHECK_LT(736507, 958897);
-    REQUIRE_LT(736507, 958897);
-    CHECK_GT(958897, 736507);
-    REQUIRE_GT(958897, 736507);
-    CHECK_LE(736507, 958897);
-    REQUIRE_LE(736507, 958897);
-    CHECK_LT(85168, 686815);
-    REQUIRE_LT(85168, 686815);
-    CHECK_GT(686815, 85168);
-    REQUIRE_GT(686815, 85168);
-    CHECK_LE(85168, 686815);
-    REQUIRE_LE(85168, 686815);
-    CHECK_GT(721152, 291432);
-    REQUIRE_GT(721152, 291432);
-    CHECK_LT(291432, 721152);
-    REQUIRE_LT(291432, 721152);
-    CHECK_GE(721152, 291432);
-    REQUIRE_GE(721152, 291432);
-    CHECK_GT(987315, 521607);
-    REQUIRE_GT(987315, 521607);
-    CHECK_LT(521607, 987315);
-    REQUIRE_LT(521607, 987315);
-    CHECK_GE(987315, 521607);
-    REQUIRE_GE(987315, 521607);
-    CHECK_GT(934853, 237267);
-    REQUIRE_GT(934853, 237267);
-    CHECK_LT(237267, 934853);
-    REQUIRE_LT(237267, 934853);
-    CHECK_GE(934853, 237267);
-    REQUIRE_GE(934853, 237267);
-    CHECK_GT(864075, 131209);
-    REQUIRE_GT(864075, 131209);
-    CHECK_LT(131209, 864075);
-    REQUIRE_LT(131209, 864075);
-    CHECK_GE(864075, 131209);
-    REQUIRE_GE(864075, 131209);
-    CHECK_GT(922558, 720306);
-    REQUIRE_GT(922558, 720306);
-    CHECK_LT(720306, 922558);
-    REQUIRE_LT(720306, 922558);
-    CHECK_GE(922558, 720306);
-    REQUIRE_GE(922558, 720306);
-    CHECK_GT(305916, 88766);
-    REQUIRE_GT(305916, 88766);
-    CHECK_LT(88766, 305916);
-    REQUIRE_LT(88766, 305916);
-    CHECK_GE(305916, 88766);
-    REQUIRE_GE(305916, 88766);
-    CHECK_LT(181211, 195169);
-    REQUIRE_LT(181211, 195169);
-    CHECK_GT(195169, 181211);
-    REQUIRE_GT(195169, 181211);
-    CHECK_LE(181211, 195169);
-    REQUIRE_LE(181211, 195169);
-    CHECK_GT(775569, 148046);
-    REQUIRE_GT(775569, 148046);
-    CHECK_LT(148046, 775569);
-    REQUIRE_LT(148046, 775569);
-    CHECK_GE(775569, 148046);
-    REQUIRE_GE(775569, 148046);
-    CHECK_LT(23694, 836766);
-    REQUIRE_LT(23694, 836766);
-    CHECK_GT(836766, 23694);
-    REQUIRE_GT(836766, 23694);
-    CHECK_LE(23694, 836766);
-    REQUIRE_LE(23694, 836766);
-    CHECK_GT(895097, 250906);
-    REQUIRE_GT(895097, 250906);
-    CHECK_LT(250906, 895097);
-    REQUIRE_LT(250906, 895097);
-    CHECK_GE(895097, 250906);
-    REQUIRE_GE(895097, 250906);
-    CHECK_GT(386130, 364714);
-    REQUIRE_GT(386130, 364714);
-    CHECK_LT(364714, 386130);
-    REQUIRE_LT(364714, 386130);
-    CHECK_GE(386130, 364714);
-    REQUIRE_GE(386130, 364714);
-    CHECK_LT(830332, 896421);
-    REQUIRE_LT(830332, 896421);
-    CHECK_GT(896421, 830332);
-    REQUIRE_GT(896421, 830332);
-    CHECK_LE(830332, 896421);
-    REQUIRE_LE(830332, 896421);
-    CHECK_GT(675653, 626892);
-    REQUIRE_GT(675653, 626892);
-    CHECK_LT(626892, 675653);
-    REQUIRE_LT(626892, 675653);
-    CHECK_GE(675653, 626892);
-    REQUIRE_GE(675653, 626892);
-    CHECK_LT(259588, 834941);
-    REQUIRE_LT(259588, 834941);
-    CHECK_GT(834941, 259588);
-    REQUIRE_GT(834941, 259588);
-    CHECK_LE(259588, 834941);
-    REQUIRE_LE(259588, 834941);
-    CHECK_GT(943331, 618333);
-    REQUIRE_GT(943331, 618333);
-    CHECK_LT(618333, 943331);
-    REQUIRE_LT(618333, 943331);
-    CHECK_GE(943331, 618333);
-    REQUIRE_GE(943331, 618333);
-    CHECK_GT(224313, 33975);
-    REQUIRE_GT(224313, 33975);
-    CHECK_LT(33975, 224313);
-    REQUIRE_LT(33975, 224313);
-    CHECK_GE(224313, 33975);
-    REQUIRE_GE(224313, 33975);
-    CHECK_LT(319560, 831814);
-    REQUIRE_LT(319560, 831814);
-    CHECK_GT(831814, 319560);
-    REQUIRE_GT(831814, 319560);
-    CHECK_LE(319560, 831814);
-    REQUIRE_LE(319560, 831814);
-    CHECK_LT(156685, 455641);
-    REQUIRE_LT(156685, 455641);
-    CHECK_GT(455641, 156685);
-    REQUIRE_GT(455641, 156685);
-    CHECK_LE(156685, 455641);
-    REQUIRE_LE(156685, 455641);
-    CHECK_GT(258797, 245647);
-    REQUIRE_GT(258797, 245647);
-    CHECK_LT(245647, 258797);
-    REQUIRE_LT(245647, 258797);
-    CHECK_GE(258797, 245647);
-    REQUIRE_GE(258797, 245647);
-    CHECK_GT(247144, 9646);
-    REQUIRE_GT(247144, 9646);
-    CHECK_LT(9646, 247144);
-    REQUIRE_LT(9646, 247144);
-    CHECK_GE(247144, 9646);
-    REQUIRE_GE(247144, 9646);
-    CHECK_GT(527705, 504357);
-    REQUIRE_GT(527705, 504357);
-    CHECK_LT(504357, 527705);
-    REQUIRE_LT(504357, 527705);
-    CHECK_GE(527705, 504357);
-    REQUIRE_GE(527705, 504357);
-    CHECK_LT(295429, 988252);
-    REQUIRE_LT(295429, 988252);
-    CHECK_GT(988252, 295429);
-    REQUIRE_GT(988252, 295429);
-    CHECK_LE(295429, 988252);
-    REQUIRE_LE(295429, 988252);
-    CHECK_LT(374163, 782813);
-    REQUIRE_LT(374163, 782813);
-    CHECK_GT(782813, 374163);
-    REQUIRE_GT(782813, 374163);
-    CHECK_LE(374163, 782813);
-    REQUIRE_LE(374163, 782813);
-    CHECK_GT(597383, 196611);
-    REQUIRE_GT(597383, 196611);
-    CHECK_LT(196611, 597383);
-    REQUIRE_LT(196611, 597383);
-    CHECK_GE(597383, 196611);
-    REQUIRE_GE(597383, 196611);
-    CHECK_GT(212403, 20913);
-    REQUIRE_GT(212403, 20913);
-    CHECK_LT(20913, 212403);
-    REQUIRE_LT(20913, 212403);
-    CHECK_GE(212403, 20913);
-    REQUIRE_GE(212403, 20913);
-    CHECK_LT(566087, 895302);
-    REQUIRE_LT(566087, 895302);
-    CHECK_GT(895302, 566087);
-    REQUIRE_GT(895302, 566087);
-    CHECK_LE(566087, 895302);
-    REQUIRE_LE(566087, 895302);
-    CHECK_GT(950120, 213222);
-    REQUIRE_GT(950120, 213222);
-    CHECK_LT(213222, 950120);
-    REQUIRE_LT(213222, 950120);
-    CHECK_GE(950120, 213222);
-    REQUIRE_GE(950120, 213222);
-    CHECK_GT(770998, 114450);
-    REQUIRE_GT(770998, 114450);
-    CHECK_LT(114450, 770998);
-    REQUIRE_LT(114450, 770998);
-    CHECK_GE(770998, 114450);
-    REQUIRE_GE(770998, 114450);
-    CHECK_LT(148069, 625047);
-    REQUIRE_LT(148069, 625047);
-    CHECK_GT(625047, 148069);
-    REQUIRE_GT(625047, 148069);
-    CHECK_LE(148069, 625047);
-    REQUIRE_LE(148069, 625047);
-    CHECK_GT(502724, 255535);
-    REQUIRE_GT(502724, 255535);
-    CHECK_LT(255535, 502724);
-    REQUIRE_LT(255535, 502724);
-    CHECK_GE(502724, 255535);
-    REQUIRE_GE(502724, 255535);
-    CHECK_LT(605337, 656721);
-    REQUIRE_LT(605337, 656721);
-    CHECK_GT(656721, 605337);
-    REQUIRE_GT(656721, 605337);
-    CHECK_LE(605337, 656721);
-    REQUIRE_LE(605337, 656721);
-    CHECK_GT(962301, 515341);
-    REQUIRE_GT(962301, 515341);
-    CHECK_LT(515341, 962301);
-    REQUIRE_LT(515341, 962301);
-    CHECK_GE(962301, 515341);
-    REQUIRE_GE(962301, 515341);
-    CHECK_LT(145307, 969860);
-    REQUIRE_LT(145307, 969860);
-    CHECK_GT(969860, 145307);
-    REQUIRE_GT(969860, 145307);
-    CHECK_LE(145307, 969860);
-    REQUIRE_LE(145307, 969860);
-    CHECK_GT(816012, 646439);
-    REQUIRE_GT(816012, 646439);
-    CHECK_LT(646439, 816012);
-    REQUIRE_LT(646439, 816012);
-    CHECK_GE(816012, 646439);
-    REQUIRE_GE(816012, 646439);
-    CHECK_GT(430799, 76893);
-    REQUIRE_GT(430799, 76893);
-    CHECK_LT(76893, 430799);
-    REQUIRE_LT(76893, 430799);
-    CHECK_GE(430799, 76893);
-    REQUIRE_GE(430799, 76893);
-    CHECK_GT(151170, 77221);
-    REQUIRE_GT(151170, 77221);
-    CHECK_LT(77221, 151170);
-    REQUIRE_LT(77221, 151170);
-    CHECK_GE(151170, 77221);
-    REQUIRE_GE(151170, 77221);
-    CHECK_LT(711828, 934654);
-    REQUIRE_LT(711828, 934654);
-    CHECK_GT(934654, 711828);
-    REQUIRE_GT(934654, 711828);
-    CHECK_LE(711828, 934654);
-    REQUIRE_LE(711828, 934654);
-    CHECK_LT(638056, 817542);
-    REQUIRE_LT(638056, 817542);
-    CHECK_GT(817542, 638056);
-    REQUIRE_GT(817542, 638056);
-    CHECK_LE(638056, 817542);
-    REQUIRE_LE(638056, 817542);
-    CHECK_LT(303639, 309863);
-    REQUIRE_LT(303639, 309863);
-    CHECK_GT(309863, 303639);
-    REQUIRE_GT(309863, 303639);
-    CHECK_LE(303639, 309863);
-    REQUIRE_LE(303639, 309863);
-    CHECK_LT(116395, 173236);
-    REQUIRE_LT(116395, 173236);
-    CHECK_GT(173236, 116395);
-    REQUIRE_GT(173236, 116395);
-    CHECK_LE(116395, 173236);
-    REQUIRE_LE(116395, 173236);
-    CHECK_GT(244890, 170211);
-    REQUIRE_GT(244890, 170211);
-    CHECK_LT(170211, 244890);
-    REQUIRE_LT(170211, 244890);
-    CHECK_GE(244890, 170211);
-    REQUIRE_GE(244890, 170211);
-    CHECK_GT(191024, 65931);
-    REQUIRE_GT(191024, 65931);
-    CHECK_LT(65931, 191024);
-    REQUIRE_LT(65931, 191024);
-    CHECK_GE(191024, 65931);
-    REQUIRE_GE(191024, 65931);
-}
-
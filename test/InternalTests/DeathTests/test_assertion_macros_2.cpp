@@ -1,4511 +0,0 @@
-#include <tau/tau.h>
-
-TEST(gen_tests_cpp, DEATHTESTS_ASSERTION_MACROS_2) {
-    CHECK_LT(71082, 597971);
-    REQUIRE_LT(71082, 597971);
-    CHECK_GT(597971, 71082);
-    REQUIRE_GT(597971, 71082);
-    CHECK_LE(71082, 597971);
-    REQUIRE_LE(71082, 597971);
-    CHECK_LT(988074, 998531);
-    REQUIRE_LT(988074, 998531);
-    CHECK_GT(998531, 988074);
-    REQUIRE_GT(998531, 988074);
-    CHECK_LE(988074, 998531);
-    REQUIRE_LE(988074, 998531);
-    CHECK_LT(724862, 971638);
-    REQUIRE_LT(724862, 971638);
-    CHECK_GT(971638, 724862);
-    REQUIRE_GT(971638, 724862);
-    CHECK_LE(724862, 971638);
-    REQUIRE_LE(724862, 971638);
-    CHECK_LT(564485, 634162);
-    REQUIRE_LT(564485, 634162);
-    CHECK_GT(634162, 564485);
-    REQUIRE_GT(634162, 564485);
-    CHECK_LE(564485, 634162);
-    REQUIRE_LE(564485, 634162);
-    CHECK_LT(437144, 441012);
-    REQUIRE_LT(437144, 441012);
-    CHECK_GT(441012, 437144);
-    REQUIRE_GT(441012, 437144);
-    CHECK_LE(437144, 441012);
-    REQUIRE_LE(437144, 441012);
-    CHECK_GT(643275, 495397);
-    REQUIRE_GT(643275, 495397);
-    CHECK_LT(495397, 643275);
-    REQUIRE_LT(495397, 643275);
-    CHECK_GE(643275, 495397);
-    REQUIRE_GE(643275, 495397);
-    CHECK_GT(500148, 177480);
-    REQUIRE_GT(500148, 177480);
-    CHECK_LT(177480, 500148);
-    REQUIRE_LT(177480, 500148);
-    CHECK_GE(500148, 177480);
-    REQUIRE_GE(500148, 177480);
-    CHECK_GT(995227, 396946);
-    REQUIRE_GT(995227, 396946);
-    CHECK_LT(396946, 995227);
-    REQUIRE_LT(396946, 995227);
-    CHECK_GE(995227, 396946);
-    REQUIRE_GE(995227, 396946);
-    CHECK_LT(25697, 941740);
-    REQUIRE_LT(25697, 941740);
-    CHECK_GT(941740, 25697);
-    REQUIRE_GT(941740, 25697);
-    CHECK_LE(25697, 941740);
-    REQUIRE_LE(25697, 941740);
-    CHECK_LT(92570, 358133);
-    REQUIRE_LT(92570, 358133);
-    CHECK_GT(358133, 92570);
-    REQUIRE_GT(358133, 92570);
-    CHECK_LE(92570, 358133);
-    REQUIRE_LE(92570, 358133);
-    CHECK_GT(939585, 404780);
-    REQUIRE_GT(939585, 404780);
-    CHECK_LT(404780, 939585);
-    REQUIRE_LT(404780, 939585);
-    CHECK_GE(939585, 404780);
-    REQUIRE_GE(939585, 404780);
-    CHECK_LT(495575, 994250);
-    REQUIRE_LT(495575, 994250);
-    CHECK_GT(994250, 495575);
-    REQUIRE_GT(994250, 495575);
-    CHECK_LE(495575, 994250);
-    REQUIRE_LE(495575, 994250);
-    CHECK_GT(481726, 312673);
-    REQUIRE_GT(481726, 312673);
-    CHECK_LT(312673, 481726);
-    REQUIRE_LT(312673, 481726);
-    CHECK_GE(481726, 312673);
-    REQUIRE_GE(481726, 312673);
-    CHECK_GT(445900, 25574);
-    REQUIRE_GT(445900, 25574);
-    CHECK_LT(25574, 445900);
-    REQUIRE_LT(25574, 445900);
-    CHECK_GE(445900, 25574);
-    REQUIRE_GE(445900, 25574);
-    CHECK_GT(576246, 284372);
-    REQUIRE_GT(576246, 284372);
-    CHECK_LT(284372, 576246);
-    REQUIRE_LT(284372, 576246);
-    CHECK_GE(576246, 284372);
-    REQUIRE_GE(576246, 284372);
-    CHECK_LT(974140, 982194);
-    REQUIRE_LT(974140, 982194);
-    CHECK_GT(982194, 974140);
-    REQUIRE_GT(982194, 974140);
-    CHECK_LE(974140, 982194);
-    REQUIRE_LE(974140, 982194);
-    CHECK_GT(326023, 185986);
-    REQUIRE_GT(326023, 185986);
-    CHECK_LT(185986, 326023);
-    REQUIRE_LT(185986, 326023);
-    CHECK_GE(326023, 185986);
-    REQUIRE_GE(326023, 185986);
-    CHECK_LT(430572, 771963);
-    REQUIRE_LT(430572, 771963);
-    CHECK_GT(771963, 430572);
-    REQUIRE_GT(771963, 430572);
-    CHECK_LE(430572, 771963);
-    REQUIRE_LE(430572, 771963);
-    CHECK_LT(755933, 952574);
-    REQUIRE_LT(755933, 952574);
-    CHECK_GT(952574, 755933);
-    REQUIRE_GT(952574, 755933);
-    CHECK_LE(755933, 952574);
-    REQUIRE_LE(755933, 952574);
-    CHECK_LT(526748, 566381);
-    REQUIRE_LT(526748, 566381);
-    CHECK_GT(566381, 526748);
-    REQUIRE_GT(566381, 526748);
-    CHECK_LE(526748, 566381);
-    REQUIRE_LE(526748, 566381);
-    CHECK_GT(902089, 674182);
-    REQUIRE_GT(902089, 674182);
-    CHECK_LT(674182, 902089);
-    REQUIRE_LT(674182, 902089);
-    CHECK_GE(902089, 674182);
-    REQUIRE_GE(902089, 674182);
-    CHECK_GT(334202, 151786);
-    REQUIRE_GT(334202, 151786);
-    CHECK_LT(151786, 334202);
-    REQUIRE_LT(151786, 334202);
-    CHECK_GE(334202, 151786);
-    REQUIRE_GE(334202, 151786);
-    CHECK_GT(515459, 497073);
-    REQUIRE_GT(515459, 497073);
-    CHECK_LT(497073, 515459);
-    REQUIRE_LT(497073, 515459);
-    CHECK_GE(515459, 497073);
-    REQUIRE_GE(515459, 497073);
-    CHECK_GT(747452, 568738);
-    REQUIRE_GT(747452, 568738);
-    CHECK_LT(568738, 747452);
-    REQUIRE_LT(568738, 747452);
-    CHECK_GE(747452, 568738);
-    REQUIRE_GE(747452, 568738);
-    CHECK_LT(198278, 203395);
-    REQUIRE_LT(198278, 203395);
-    CHECK_GT(203395, 198278);
-    REQUIRE_GT(203395, 198278);
-    CHECK_LE(198278, 203395);
-    REQUIRE_LE(198278, 203395);
-    CHECK_GT(671932, 230873);
-    REQUIRE_GT(671932, 230873);
-    CHECK_LT(230873, 671932);
-    REQUIRE_LT(230873, 671932);
-    CHECK_GE(671932, 230873);
-    REQUIRE_GE(671932, 230873);
-    CHECK_LT(46812, 324608);
-    REQUIRE_LT(46812, 324608);
-    CHECK_GT(324608, 46812);
-    REQUIRE_GT(324608, 46812);
-    CHECK_LE(46812, 324608);
-    REQUIRE_LE(46812, 324608);
-    CHECK_GT(780574, 327426);
-    REQUIRE_GT(780574, 327426);
-    CHECK_LT(327426, 780574);
-    REQUIRE_LT(327426, 780574);
-    CHECK_GE(780574, 327426);
-    REQUIRE_GE(780574, 327426);
-    CHECK_GT(792437, 568680);
-    REQUIRE_GT(792437, 568680);
-    CHECK_LT(568680, 792437);
-    REQUIRE_LT(568680, 792437);
-    CHECK_GE(792437, 568680);
-    REQUIRE_GE(792437, 568680);
-    CHECK_GT(961938, 547832);
-    REQUIRE_GT(961938, 547832);
-    CHECK_LT(547832, 961938);
-    REQUIRE_LT(547832, 961938);
-    CHECK_GE(961938, 547832);
-    REQUIRE_GE(961938, 547832);
-    CHECK_LT(456252, 987585);
-    REQUIRE_LT(456252, 987585);
-    CHECK_GT(987585, 456252);
-    REQUIRE_GT(987585, 456252);
-    CHECK_LE(456252, 987585);
-    REQUIRE_LE(456252, 987585);
-    CHECK_GT(56125, 41536);
-    REQUIRE_GT(56125, 41536);
-    CHECK_LT(41536, 56125);
-    REQUIRE_LT(41536, 56125);
-    CHECK_GE(56125, 41536);
-    REQUIRE_GE(56125, 41536);
-    CHECK_LT(158809, 468521);
-    REQUIRE_LT(158809, 468521);
-    CHECK_GT(468521, 158809);
-    REQUIRE_GT(468521, 158809);
-    CHECK_LE(158809, 468521);
-    REQUIRE_LE(158809, 468521);
-    CHECK_LT(65669, 593519);
-    REQUIRE_LT(65669, 593519);
-    CHECK_GT(593519, 65669);
-    REQUIRE_GT(593519, 65669);
-    CHECK_LE(65669, 593519);
-    REQUIRE_LE(65669, 593519);
-    CHECK_GT(938612, 501336);
-    REQUIRE_GT(938612, 501336);
-    CHECK_LT(501336, 938612);
-    REQUIRE_LT(501336, 938612);
-    CHECK_GE(938612, 501336);
-    REQUIRE_GE(938612, 501336);
-    CHECK_GT(906132, 672188);
-    REQUIRE_GT(906132, 672188);
-    CHECK_LT(672188, 906132);
-    REQUIRE_LT(672188, 906132);
-    CHECK_GE(906132, 672188);
-    REQUIRE_GE(906132, 672188);
-    CHECK_LT(482515, 602610);
-    REQUIRE_LT(482515, 602610);
-    CHECK_GT(602610, 482515);
-    REQUIRE_GT(602610, 482515);
-    CHECK_LE(482515, 602610);
-    REQUIRE_LE(482515, 602610);
-    CHECK_GT(839582, 455698);
-    REQUIRE_GT(839582, 455698);
-    CHECK_LT(455698, 839582);
-    REQUIRE_LT(455698, 839582);
-    CHECK_GE(839582, 455698);
-    REQUIRE_GE(839582, 455698);
-    CHECK_LT(5838, 317608);
-    REQUIRE_LT(5838, 317608);
-    CHECK_GT(317608, 5838);
-    REQUIRE_GT(317608, 5838);
-    CHECK_LE(5838, 317608);
-    REQUIRE_LE(5838, 317608);
-    CHECK_LT(426915, 651661);
-    REQUIRE_LT(426915, 651661);
-    CHECK_GT(651661, 426915);
-    REQUIRE_GT(651661, 426915);
-    CHECK_LE(426915, 651661);
-    REQUIRE_LE(426915, 651661);
-    CHECK_GT(600830, 33184);
-    REQUIRE_GT(600830, 33184);
-    CHECK_LT(33184, 600830);
-    REQUIRE_LT(33184, 600830);
-    CHECK_GE(600830, 33184);
-    REQUIRE_GE(600830, 33184);
-    CHECK_GT(997062, 869981);
-    REQUIRE_GT(997062, 869981);
-    CHECK_LT(869981, 997062);
-    REQUIRE_LT(869981, 997062);
-    CHECK_GE(997062, 869981);
-    REQUIRE_GE(997062, 869981);
-    CHECK_GT(422929, 356487);
-    REQUIRE_GT(422929, 356487);
-    CHECK_LT(356487, 422929);
-    REQUIRE_LT(356487, 422929);
-    CHECK_GE(422929, 356487);
-    REQUIRE_GE(422929, 356487);
-    CHECK_LT(87840, 305943);
-    REQUIRE_LT(87840, 305943);
-    CHECK_GT(305943, 87840);
-    REQUIRE_GT(305943, 87840);
-    CHECK_LE(87840, 305943);
-    REQUIRE_LE(87840, 305943);
-    CHECK_GT(110746, 109437);
-    REQUIRE_GT(110746, 109437);
-    CHECK_LT(109437, 110746);
-    REQUIRE_LT(109437, 110746);
-    CHECK_GE(110746, 109437);
-    REQUIRE_GE(110746, 109437);
-    CHECK_GT(586107, 488288);
-    REQUIRE_GT(586107, 488288);
-    CHECK_LT(488288, 586107);
-    REQUIRE_LT(488288, 586107);
-    CHECK_GE(586107, 488288);
-    REQUIRE_GE(586107, 488288);
-    CHECK_LT(95946, 196514);
-    REQUIRE_LT(95946, 196514);
-    CHECK_GT(196514, 95946);
-    REQUIRE_GT(196514, 95946);
-    CHECK_LE(95946, 196514);
-    REQUIRE_LE(95946, 196514);
-    CHECK_GT(358827, 179478);
-    REQUIRE_GT(358827, 179478);
-    CHECK_LT(179478, 358827);
-    REQUIRE_LT(179478, 358827);
-    CHECK_GE(358827, 179478);
-    REQUIRE_GE(358827, 179478);
-    CHECK_LT(408668, 441304);
-    REQUIRE_LT(408668, 441304);
-    CHECK_GT(441304, 408668);
-    REQUIRE_GT(441304, 408668);
-    CHECK_LE(408668, 441304);
-    REQUIRE_LE(408668, 441304);
-    CHECK_LT(192332, 841841);
-    REQUIRE_LT(192332, 841841);
-    CHECK_GT(841841, 192332);
-    REQUIRE_GT(841841, 192332);
-    CHECK_LE(192332, 841841);
-    REQUIRE_LE(192332, 841841);
-    CHECK_GT(453452, 216038);
-    REQUIRE_GT(453452, 216038);
-    CHECK_LT(216038, 453452);
-    REQUIRE_LT(216038, 453452);
-    CHECK_GE(453452, 216038);
-    REQUIRE_GE(453452, 216038);
-    CHECK_GT(420133, 92458);
-    REQUIRE_GT(420133, 92458);
-    CHECK_LT(92458, 420133);
-    REQUIRE_LT(92458, 420133);
-    CHECK_GE(420133, 92458);
-    REQUIRE_GE(420133, 92458);
-    CHECK_LT(197578, 796440);
-    REQUIRE_LT(197578, 796440);
-    CHECK_GT(796440, 197578);
-    REQUIRE_GT(796440, 197578);
-    CHECK_LE(197578, 796440);
-    REQUIRE_LE(197578, 796440);
-    CHECK_GT(741744, 51413);
-    REQUIRE_GT(741744, 51413);
-    CHECK_LT(51413, 741744);
-    REQUIRE_LT(51413, 741744);
-    CHECK_GE(741744, 51413);
-    REQUIRE_GE(741744, 51413);
-    CHECK_GT(557991, 327968);
-    REQUIRE_GT(557991, 327968);
-    CHECK_LT(327968, 557991);
-    REQUIRE_LT(327968, 557991);
-    CHECK_GE(557991, 327968);
-    REQUIRE_GE(557991, 327968);
-    CHECK_GT(249970, 230137);
-    REQUIRE_GT(249970, 230137);
-    CHECK_LT(230137, 249970);
-    REQUIRE_LT(230137, 249970);
-    CHECK_GE(249970, 230137);
-    REQUIRE_GE(249970, 230137);
-    CHECK_GT(702781, 679009);
-    REQUIRE_GT(702781, 679009);
-    CHECK_LT(679009, 702781);
-    REQUIRE_LT(679009, 702781);
-    CHECK_GE(702781, 679009);
-    REQUIRE_GE(702781, 679009);
-    CHECK_LT(7557, 603091);
-    REQUIRE_LT(7557, 603091);
-    CHECK_GT(603091, 7557);
-    REQUIRE_GT(603091, 7557);
-    CHECK_LE(7557, 603091);
-    REQUIRE_LE(7557, 603091);
-    CHECK_GT(917026, 551771);
-    REQUIRE_GT(917026, 551771);
-    CHECK_LT(551771, 917026);
-    REQUIRE_LT(551771, 917026);
-    CHECK_GE(917026, 551771);
-    REQUIRE_GE(917026, 551771);
-    CHECK_GT(670722, 189711);
-    REQUIRE_GT(670722, 189711);
-    CHECK_LT(189711, 670722);
-    REQUIRE_LT(189711, 670722);
-    CHECK_GE(670722, 189711);
-    REQUIRE_GE(670722, 189711);
-    CHECK_LT(132550, 592494);
-    REQUIRE_LT(132550, 592494);
-    CHECK_GT(592494, 132550);
-    REQUIRE_GT(592494, 132550);
-    CHECK_LE(132550, 592494);
-    REQUIRE_LE(132550, 592494);
-    CHECK_LT(95689, 829826);
-    REQUIRE_LT(95689, 829826);
-    CHECK_GT(829826, 95689);
-    REQUIRE_GT(829826, 95689);
-    CHECK_LE(95689, 829826);
-    REQUIRE_LE(95689, 829826);
-    CHECK_LT(73234, 804627);
-    REQUIRE_LT(73234, 804627);
-    CHECK_GT(804627, 73234);
-    REQUIRE_GT(804627, 73234);
-    CHECK_LE(73234, 804627);
-    REQUIRE_LE(73234, 804627);
-    CHECK_GT(390354, 192782);
-    REQUIRE_GT(390354, 192782);
-    CHECK_LT(192782, 390354);
-    REQUIRE_LT(192782, 390354);
-    CHECK_GE(390354, 192782);
-    REQUIRE_GE(390354, 192782);
-    CHECK_GT(869827, 264929);
-    REQUIRE_GT(869827, 264929);
-    CHECK_LT(264929, 869827);
-    REQUIRE_LT(264929, 869827);
-    CHECK_GE(869827, 264929);
-    REQUIRE_GE(869827, 264929);
-    CHECK_GT(744214, 487853);
-    REQUIRE_GT(744214, 487853);
-    CHECK_LT(487853, 744214);
-    REQUIRE_LT(487853, 744214);
-    CHECK_GE(744214, 487853);
-    REQUIRE_GE(744214, 487853);
-    CHECK_LT(313266, 729760);
-    REQUIRE_LT(313266, 729760);
-    CHECK_GT(729760, 313266);
-    REQUIRE_GT(729760, 313266);
-    CHECK_LE(313266, 729760);
-    REQUIRE_LE(313266, 729760);
-    CHECK_LT(23510, 394354);
-    REQUIRE_LT(23510, 394354);
-    CHECK_GT(394354, 23510);
-    REQUIRE_GT(394354, 23510);
-    CHECK_LE(23510, 394354);
-    REQUIRE_LE(23510, 394354);
-    CHECK_GT(439915, 320073);
-    REQUIRE_GT(439915, 320073);
-    CHECK_LT(320073, 439915);
-    REQUIRE_LT(320073, 439915);
-    CHECK_GE(439915, 320073);
-    REQUIRE_GE(439915, 320073);
-    CHECK_GT(991260, 124159);
-    REQUIRE_GT(991260, 124159);
-    CHECK_LT(124159, 991260);
-    REQUIRE_LT(124159, 991260);
-    CHECK_GE(991260, 124159);
-    REQUIRE_GE(991260, 124159);
-    CHECK_GT(359931, 254599);
-    REQUIRE_GT(359931, 254599);
-    CHECK_LT(254599, 359931);
-    REQUIRE_LT(254599, 359931);
-    CHECK_GE(359931, 254599);
-    REQUIRE_GE(359931, 254599);
-    CHECK_GT(852707, 702937);
-    REQUIRE_GT(852707, 702937);
-    CHECK_LT(702937, 852707);
-    REQUIRE_LT(702937, 852707);
-    CHECK_GE(852707, 702937);
-    REQUIRE_GE(852707, 702937);
-    CHECK_LT(195036, 943104);
-    REQUIRE_LT(195036, 943104);
-    CHECK_GT(943104, 195036);
-    REQUIRE_GT(943104, 195036);
-    CHECK_LE(195036, 943104);
-    REQUIRE_LE(195036, 943104);
-    CHECK_GT(888819, 551963);
-    REQUIRE_GT(888819, 551963);
-    CHECK_LT(551963, 888819);
-    REQUIRE_LT(551963, 888819);
-    CHECK_GE(888819, 551963);
-    REQUIRE_GE(888819, 551963);
-    CHECK_LT(81748, 401307);
-    REQUIRE_LT(81748, 401307);
-    CHECK_GT(401307, 81748);
-    REQUIRE_GT(401307, 81748);
-    CHECK_LE(81748, 401307);
-    REQUIRE_LE(81748, 401307);
-    CHECK_GT(933059, 391546);
-    REQUIRE_GT(933059, 391546);
-    CHECK_LT(391546, 933059);
-    REQUIRE_LT(391546, 933059);
-    CHECK_GE(933059, 391546);
-    REQUIRE_GE(933059, 391546);
-    CHECK_LT(524669, 690341);
-    REQUIRE_LT(524669, 690341);
-    CHECK_GT(690341, 524669);
-    REQUIRE_GT(690341, 524669);
-    CHECK_LE(524669, 690341);
-    REQUIRE_LE(524669, 690341);
-    CHECK_LT(654664, 928691);
-    REQUIRE_LT(654664, 928691);
-    CHECK_GT(928691, 654664);
-    REQUIRE_GT(928691, 654664);
-    CHECK_LE(654664, 928691);
-    REQUIRE_LE(654664, 928691);
-    CHECK_GT(882180, 451085);
-    REQUIRE_GT(882180, 451085);
-    CHECK_LT(451085, 882180);
-    REQUIRE_LT(451085, 882180);
-    CHECK_GE(882180, 451085);
-    REQUIRE_GE(882180, 451085);
-    CHECK_GT(732435, 174108);
-    REQUIRE_GT(732435, 174108);
-    CHECK_LT(174108, 732435);
-    REQUIRE_LT(174108, 732435);
-    CHECK_GE(732435, 174108);
-    REQUIRE_GE(732435, 174108);
-    CHECK_GT(949520, 875139);
-    REQUIRE_GT(949520, 875139);
-    CHECK_LT(875139, 949520);
-    REQUIRE_LT(875139, 949520);
-    CHECK_GE(949520, 875139);
-    REQUIRE_GE(949520, 875139);
-    CHECK_LT(350916, 779532);
-    REQUIRE_LT(350916, 779532);
-    CHECK_GT(779532, 350916);
-    REQUIRE_GT(779532, 350916);
-    CHECK_LE(350916, 779532);
-    REQUIRE_LE(350916, 779532);
-    CHECK_GT(208500, 199847);
-    REQUIRE_GT(208500, 199847);
-    CHECK_LT(199847, 208500);
-    REQUIRE_LT(199847, 208500);
-    CHECK_GE(208500, 199847);
-    REQUIRE_GE(208500, 199847);
-    CHECK_LT(529636, 755818);
-    REQUIRE_LT(529636, 755818);
-    CHECK_GT(755818, 529636);
-    REQUIRE_GT(755818, 529636);
-    CHECK_LE(529636, 755818);
-    REQUIRE_LE(529636, 755818);
-    CHECK_LT(117267, 611913);
-    REQUIRE_LT(117267, 611913);
-    CHECK_GT(611913, 117267);
-    REQUIRE_GT(611913, 117267);
-    CHECK_LE(117267, 611913);
-    REQUIRE_LE(117267, 611913);
-    CHECK_LT(263417, 719727);
-    REQUIRE_LT(263417, 719727);
-    CHECK_GT(719727, 263417);
-    REQUIRE_GT(719727, 263417);
-    CHECK_LE(263417, 719727);
-    REQUIRE_LE(263417, 719727);
-    CHECK_GT(655289, 425069);
-    REQUIRE_GT(655289, 425069);
-    CHECK_LT(425069, 655289);
-    REQUIRE_LT(425069, 655289);
-    CHECK_GE(655289, 425069);
-    REQUIRE_GE(655289, 425069);
-    CHECK_LT(240718, 380253);
-    REQUIRE_LT(240718, 380253);
-    CHECK_GT(380253, 240718);
-    REQUIRE_GT(380253, 240718);
-    CHECK_LE(240718, 380253);
-    REQUIRE_LE(240718, 380253);
-    CHECK_GT(656200, 234594);
-    REQUIRE_GT(656200, 234594);
-    CHECK_LT(234594, 656200);
-    REQUIRE_LT(234594, 656200);
-    CHECK_GE(656200, 234594);
-    REQUIRE_GE(656200, 234594);
-    CHECK_LT(815705, 875183);
-    REQUIRE_LT(815705, 875183);
-    CHECK_GT(875183, 815705);
-    REQUIRE_GT(875183, 815705);
-    CHECK_LE(815705, 875183);
-    REQUIRE_LE(815705, 875183);
-    CHECK_GT(667293, 501085);
-    REQUIRE_GT(667293, 501085);
-    CHECK_LT(501085, 667293);
-    REQUIRE_LT(501085, 667293);
-    CHECK_GE(667293, 501085);
-    REQUIRE_GE(667293, 501085);
-    CHECK_GT(826312, 663665);
-    REQUIRE_GT(826312, 663665);
-    CHECK_LT(663665, 826312);
-    REQUIRE_LT(663665, 826312);
-    CHECK_GE(826312, 663665);
-    REQUIRE_GE(826312, 663665);
-    CHECK_GT(556887, 211163);
-    REQUIRE_GT(556887, 211163);
-    CHECK_LT(211163, 556887);
-    REQUIRE_LT(211163, 556887);
-    CHECK_GE(556887, 211163);
-    REQUIRE_GE(556887, 211163);
-    CHECK_GT(572788, 513308);
-    REQUIRE_GT(572788, 513308);
-    CHECK_LT(513308, 572788);
-    REQUIRE_LT(513308, 572788);
-    CHECK_GE(572788, 513308);
-    REQUIRE_GE(572788, 513308);
-    CHECK_GT(488339, 159020);
-    REQUIRE_GT(488339, 159020);
-    CHECK_LT(159020, 488339);
-    REQUIRE_LT(159020, 488339);
-    CHECK_GE(488339, 159020);
-    REQUIRE_GE(488339, 159020);
-    CHECK_LT(625913, 728429);
-    REQUIRE_LT(625913, 728429);
-    CHECK_GT(728429, 625913);
-    REQUIRE_GT(728429, 625913);
-    CHECK_LE(625913, 728429);
-    REQUIRE_LE(625913, 728429);
-    CHECK_LT(375690, 889093);
-    REQUIRE_LT(375690, 889093);
-    CHECK_GT(889093, 375690);
-    REQUIRE_GT(889093, 375690);
-    CHECK_LE(375690, 889093);
-    REQUIRE_LE(375690, 889093);
-    CHECK_LT(445862, 711625);
-    REQUIRE_LT(445862, 711625);
-    CHECK_GT(711625, 445862);
-    REQUIRE_GT(711625, 445862);
-    CHECK_LE(445862, 711625);
-    REQUIRE_LE(445862, 711625);
-    CHECK_GT(841705, 460676);
-    REQUIRE_GT(841705, 460676);
-    CHECK_LT(460676, 841705);
-    REQUIRE_LT(460676, 841705);
-    CHECK_GE(841705, 460676);
-    REQUIRE_GE(841705, 460676);
-    CHECK_LT(666304, 833213);
-    REQUIRE_LT(666304, 833213);
-    CHECK_GT(833213, 666304);
-    REQUIRE_GT(833213, 666304);
-    CHECK_LE(666304, 833213);
-    REQUIRE_LE(666304, 833213);
-    CHECK_GT(562081, 399588);
-    REQUIRE_GT(562081, 399588);
-    CHECK_LT(399588, 562081);
-    REQUIRE_LT(399588, 562081);
-    CHECK_GE(562081, 399588);
-    REQUIRE_GE(562081, 399588);
-    CHECK_LT(470720, 748712);
-    REQUIRE_LT(470720, 748712);
-    CHECK_GT(748712, 470720);
-    REQUIRE_GT(748712, 470720);
-    CHECK_LE(470720, 748712);
-    REQUIRE_LE(470720, 748712);
-    CHECK_GT(730309, 586771);
-    REQUIRE_GT(730309, 586771);
-    CHECK_LT(586771, 730309);
-    REQUIRE_LT(586771, 730309);
-    CHECK_GE(730309, 586771);
-    REQUIRE_GE(730309, 586771);
-    CHECK_GT(135386, 76597);
-    REQUIRE_GT(135386, 76597);
-    CHECK_LT(76597, 135386);
-    REQUIRE_LT(76597, 135386);
-    CHECK_GE(135386, 76597);
-    REQUIRE_GE(135386, 76597);
-    CHECK_LT(411245, 980244);
-    REQUIRE_LT(411245, 980244);
-    CHECK_GT(980244, 411245);
-    REQUIRE_GT(980244, 411245);
-    CHECK_LE(411245, 980244);
-    REQUIRE_LE(411245, 980244);
-    CHECK_LT(445157, 721064);
-    REQUIRE_LT(445157, 721064);
-    CHECK_GT(721064, 445157);
-    REQUIRE_GT(721064, 445157);
-    CHECK_LE(445157, 721064);
-    REQUIRE_LE(445157, 721064);
-    CHECK_GT(910755, 84572);
-    REQUIRE_GT(910755, 84572);
-    CHECK_LT(84572, 910755);
-    REQUIRE_LT(84572, 910755);
-    CHECK_GE(910755, 84572);
-    REQUIRE_GE(910755, 84572);
-    CHECK_LT(713852, 931172);
-    REQUIRE_LT(713852, 931172);
-    CHECK_GT(931172, 713852);
-    REQUIRE_GT(931172, 713852);
-    CHECK_LE(713852, 931172);
-    REQUIRE_LE(713852, 931172);
-    CHECK_LT(345352, 546376);
-    REQUIRE_LT(345352, 546376);
-    CHECK_GT(546376, 345352);
-    REQUIRE_GT(546376, 345352);
-    CHECK_LE(345352, 546376);
-    REQUIRE_LE(345352, 546376);
-    CHECK_GT(186657, 23887);
-    REQUIRE_GT(186657, 23887);
-    CHECK_LT(23887, 186657);
-    REQUIRE_LT(23887, 186657);
-    CHECK_GE(186657, 23887);
-    REQUIRE_GE(186657, 23887);
-    CHECK_LT(715581, 718540);
-    REQUIRE_LT(715581, 718540);
-    CHECK_GT(718540, 715581);
-    REQUIRE_GT(718540, 715581);
-    CHECK_LE(715581, 718540);
-    REQUIRE_LE(715581, 718540);
-    CHECK_GT(900470, 343549);
-    REQUIRE_GT(900470, 343549);
-    CHECK_LT(343549, 900470);
-    REQUIRE_LT(343549, 900470);
-    CHECK_GE(900470, 343549);
-    REQUIRE_GE(900470, 343549);
-    CHECK_LT(93501, 440200);
-    REQUIRE_LT(93501, 440200);
-    CHECK_GT(440200, 93501);
-    REQUIRE_GT(440200, 93501);
-    CHECK_LE(93501, 440200);
-    REQUIRE_LE(93501, 440200);
-    CHECK_GT(237582, 122818);
-    REQUIRE_GT(237582, 122818);
-    CHECK_LT(122818, 237582);
-    REQUIRE_LT(122818, 237582);
-    CHECK_GE(237582, 122818);
-    REQUIRE_GE(237582, 122818);
-    CHECK_LT(722129, 933151);
-    REQUIRE_LT(722129, 933151);
-    CHECK_GT(933151, 722129);
-    REQUIRE_GT(933151, 722129);
-    CHECK_LE(722129, 933151);
-    REQUIRE_LE(722129, 933151);
-    CHECK_LT(226820, 882191);
-    REQUIRE_LT(226820, 882191);
-    CHECK_GT(882191, 226820);
-    REQUIRE_GT(882191, 226820);
-    CHECK_LE(226820, 882191);
-    REQUIRE_LE(226820, 882191);
-    CHECK_GT(695693, 50319);
-    REQUIRE_GT(695693, 50319);
-    CHECK_LT(50319, 695693);
-    REQUIRE_LT(50319, 695693);
-    CHECK_GE(695693, 50319);
-    REQUIRE_GE(695693, 50319);
-    CHECK_LT(802474, 926809);
-    REQUIRE_LT(802474, 926809);
-    CHECK_GT(926809, 802474);
-    REQUIRE_GT(926809, 802474);
-    CHECK_LE(802474, 926809);
-    REQUIRE_LE(802474, 926809);
-    CHECK_GT(760449, 634031);
-    REQUIRE_GT(760449, 634031);
-    CHECK_LT(634031, 760449);
-    REQUIRE_LT(634031, 760449);
-    CHECK_GE(760449, 634031);
-    REQUIRE_GE(760449, 634031);
-    CHECK_LT(162604, 670191);
-    REQUIRE_LT(162604, 670191);
-    CHECK_GT(670191, 162604);
-    REQUIRE_GT(670191, 162604);
-    CHECK_LE(162604, 670191);
-    REQUIRE_LE(162604, 670191);
-    CHECK_GT(908801, 613624);
-    REQUIRE_GT(908801, 613624);
-    CHECK_LT(613624, 908801);
-    REQUIRE_LT(613624, 908801);
-    CHECK_GE(908801, 613624);
-    REQUIRE_GE(908801, 613624);
-    CHECK_GT(287156, 273038);
-    REQUIRE_GT(287156, 273038);
-    CHECK_LT(273038, 287156);
-    REQUIRE_LT(273038, 287156);
-    CHECK_GE(287156, 273038);
-    REQUIRE_GE(287156, 273038);
-    CHECK_LT(35266, 959324);
-    REQUIRE_LT(35266, 959324);
-    CHECK_GT(959324, 35266);
-    REQUIRE_GT(959324, 35266);
-    CHECK_LE(35266, 959324);
-    REQUIRE_LE(35266, 959324);
-    CHECK_GT(895891, 214984);
-    REQUIRE_GT(895891, 214984);
-    CHECK_LT(214984, 895891);
-    REQUIRE_LT(214984, 895891);
-    CHECK_GE(895891, 214984);
-    REQUIRE_GE(895891, 214984);
-    CHECK_LT(129878, 526667);
-    REQUIRE_LT(129878, 526667);
-    CHECK_GT(526667, 129878);
-    REQUIRE_GT(526667, 129878);
-    CHECK_LE(129878, 526667);
-    REQUIRE_LE(129878, 526667);
-    CHECK_GT(579614, 299858);
-    REQUIRE_GT(579614, 299858);
-    CHECK_LT(299858, 579614);
-    REQUIRE_LT(299858, 579614);
-    CHECK_GE(579614, 299858);
-    REQUIRE_GE(579614, 299858);
-    CHECK_GT(594100, 95008);
-    REQUIRE_GT(594100, 95008);
-    CHECK_LT(95008, 594100);
-    REQUIRE_LT(95008, 594100);
-    CHECK_GE(594100, 95008);
-    REQUIRE_GE(594100, 95008);
-    CHECK_LT(393827, 938552);
-    REQUIRE_LT(393827, 938552);
-    CHECK_GT(938552, 393827);
-    REQUIRE_GT(938552, 393827);
-    CHECK_LE(393827, 938552);
-    REQUIRE_LE(393827, 938552);
-    CHECK_LT(357152, 487236);
-    REQUIRE_LT(357152, 487236);
-    CHECK_GT(487236, 357152);
-    REQUIRE_GT(487236, 357152);
-    CHECK_LE(357152, 487236);
-    REQUIRE_LE(357152, 487236);
-    CHECK_LT(415758, 498756);
-    REQUIRE_LT(415758, 498756);
-    CHECK_GT(498756, 415758);
-    REQUIRE_GT(498756, 415758);
-    CHECK_LE(415758, 498756);
-    REQUIRE_LE(415758, 498756);
-    CHECK_GT(509345, 224277);
-    REQUIRE_GT(509345, 224277);
-    CHECK_LT(224277, 509345);
-    REQUIRE_LT(224277, 509345);
-    CHECK_GE(509345, 224277);
-    REQUIRE_GE(509345, 224277);
-    CHECK_LT(100213, 638299);
-    REQUIRE_LT(100213, 638299);
-    CHECK_GT(638299, 100213);
-    REQUIRE_GT(638299, 100213);
-    CHECK_LE(100213, 638299);
-    REQUIRE_LE(100213, 638299);
-    CHECK_LT(218221, 477859);
-    REQUIRE_LT(218221, 477859);
-    CHECK_GT(477859, 218221);
-    REQUIRE_GT(477859, 218221);
-    CHECK_LE(218221, 477859);
-    REQUIRE_LE(218221, 477859);
-    CHECK_GT(309761, 185634);
-    REQUIRE_GT(309761, 185634);
-    CHECK_LT(185634, 309761);
-    REQUIRE_LT(185634, 309761);
-    CHECK_GE(309761, 185634);
-    REQUIRE_GE(309761, 185634);
-    CHECK_LT(470696, 876745);
-    REQUIRE_LT(470696, 876745);
-    CHECK_GT(876745, 470696);
-    REQUIRE_GT(876745, 470696);
-    CHECK_LE(470696, 876745);
-    REQUIRE_LE(470696, 876745);
-    CHECK_GT(206319, 153064);
-    REQUIRE_GT(206319, 153064);
-    CHECK_LT(153064, 206319);
-    REQUIRE_LT(153064, 206319);
-    CHECK_GE(206319, 153064);
-    REQUIRE_GE(206319, 153064);
-    CHECK_GT(381395, 123145);
-    REQUIRE_GT(381395, 123145);
-    CHECK_LT(123145, 381395);
-    REQUIRE_LT(123145, 381395);
-    CHECK_GE(381395, 123145);
-    REQUIRE_GE(381395, 123145);
-    CHECK_LT(405767, 751040);
-    REQUIRE_LT(405767, 751040);
-    CHECK_GT(751040, 405767);
-    REQUIRE_GT(751040, 405767);
-    CHECK_LE(405767, 751040);
-    REQUIRE_LE(405767, 751040);
-    CHECK_LT(85778, 633722);
-    REQUIRE_LT(85778, 633722);
-    CHECK_GT(633722, 85778);
-    REQUIRE_GT(633722, 85778);
-    CHECK_LE(85778, 633722);
-    REQUIRE_LE(85778, 633722);
-    CHECK_LT(315190, 895781);
-    REQUIRE_LT(315190, 895781);
-    CHECK_GT(895781, 315190);
-    REQUIRE_GT(895781, 315190);
-    CHECK_LE(315190, 895781);
-    REQUIRE_LE(315190, 895781);
-    CHECK_LT(435314, 994159);
-    REQUIRE_LT(435314, 994159);
-    CHECK_GT(994159, 435314);
-    REQUIRE_GT(994159, 435314);
-    CHECK_LE(435314, 994159);
-    REQUIRE_LE(435314, 994159);
-    CHECK_LT(220402, 268248);
-    REQUIRE_LT(220402, 268248);
-    CHECK_GT(268248, 220402);
-    REQUIRE_GT(268248, 220402);
-    CHECK_LE(220402, 268248);
-    REQUIRE_LE(220402, 268248);
-    CHECK_LT(698731, 832252);
-    REQUIRE_LT(698731, 832252);
-    CHECK_GT(832252, 698731);
-    REQUIRE_GT(832252, 698731);
-    CHECK_LE(698731, 832252);
-    REQUIRE_LE(698731, 832252);
-    CHECK_GT(663185, 253274);
-    REQUIRE_GT(663185, 253274);
-    CHECK_LT(253274, 663185);
-    REQUIRE_LT(253274, 663185);
-    CHECK_GE(663185, 253274);
-    REQUIRE_GE(663185, 253274);
-    CHECK_GT(578908, 388960);
-    REQUIRE_GT(578908, 388960);
-    CHECK_LT(388960, 578908);
-    REQUIRE_LT(388960, 578908);
-    CHECK_GE(578908, 388960);
-    REQUIRE_GE(578908, 388960);
-    CHECK_LT(109915, 862531);
-    REQUIRE_LT(109915, 862531);
-    CHECK_GT(862531, 109915);
-    REQUIRE_GT(862531, 109915);
-    CHECK_LE(109915, 862531);
-    REQUIRE_LE(109915, 862531);
-    CHECK_GT(362947, 55003);
-    REQUIRE_GT(362947, 55003);
-    CHECK_LT(55003, 362947);
-    REQUIRE_LT(55003, 362947);
-    CHECK_GE(362947, 55003);
-    REQUIRE_GE(362947, 55003);
-    CHECK_GT(845800, 817432);
-    REQUIRE_GT(845800, 817432);
-    CHECK_LT(817432, 845800);
-    REQUIRE_LT(817432, 845800);
-    CHECK_GE(845800, 817432);
-    REQUIRE_GE(845800, 817432);
-    CHECK_GT(822827, 504740);
-    REQUIRE_GT(822827, 504740);
-    CHECK_LT(504740, 822827);
-    REQUIRE_LT(504740, 822827);
-    CHECK_GE(822827, 504740);
-    REQUIRE_GE(822827, 504740);
-    CHECK_LT(35251, 90189);
-    REQUIRE_LT(35251, 90189);
-    CHECK_GT(90189, 35251);
-    REQUIRE_GT(90189, 35251);
-    CHECK_LE(35251, 90189);
-    REQUIRE_LE(35251, 90189);
-    CHECK_LT(416810, 746687);
-    REQUIRE_LT(416810, 746687);
-    CHECK_GT(746687, 416810);
-    REQUIRE_GT(746687, 416810);
-    CHECK_LE(416810, 746687);
-    REQUIRE_LE(416810, 746687);
-    CHECK_LT(253896, 479296);
-    REQUIRE_LT(253896, 479296);
-    CHECK_GT(479296, 253896);
-    REQUIRE_GT(479296, 253896);
-    CHECK_LE(253896, 479296);
-    REQUIRE_LE(253896, 479296);
-    CHECK_GT(915822, 123086);
-    REQUIRE_GT(915822, 123086);
-    CHECK_LT(123086, 915822);
-    REQUIRE_LT(123086, 915822);
-    CHECK_GE(915822, 123086);
-    REQUIRE_GE(915822, 123086);
-    CHECK_LT(81039, 378966);
-    REQUIRE_LT(81039, 378966);
-    CHECK_GT(378966, 81039);
-    REQUIRE_GT(378966, 81039);
-    CHECK_LE(81039, 378966);
-    REQUIRE_LE(81039, 378966);
-    CHECK_LT(43163, 68361);
-    REQUIRE_LT(43163, 68361);
-    CHECK_GT(68361, 43163);
-    REQUIRE_GT(68361, 43163);
-    CHECK_LE(43163, 68361);
-    REQUIRE_LE(43163, 68361);
-    CHECK_GT(852512, 69811);
-    REQUIRE_GT(852512, 69811);
-    CHECK_LT(69811, 852512);
-    REQUIRE_LT(69811, 852512);
-    CHECK_GE(852512, 69811);
-    REQUIRE_GE(852512, 69811);
-    CHECK_GT(905831, 631237);
-    REQUIRE_GT(905831, 631237);
-    CHECK_LT(631237, 905831);
-    REQUIRE_LT(631237, 905831);
-    CHECK_GE(905831, 631237);
-    REQUIRE_GE(905831, 631237);
-    CHECK_LT(837793, 864724);
-    REQUIRE_LT(837793, 864724);
-    CHECK_GT(864724, 837793);
-    REQUIRE_GT(864724, 837793);
-    CHECK_LE(837793, 864724);
-    REQUIRE_LE(837793, 864724);
-    CHECK_GT(686724, 44481);
-    REQUIRE_GT(686724, 44481);
-    CHECK_LT(44481, 686724);
-    REQUIRE_LT(44481, 686724);
-    CHECK_GE(686724, 44481);
-    REQUIRE_GE(686724, 44481);
-    CHECK_LT(377769, 534725);
-    REQUIRE_LT(377769, 534725);
-    CHECK_GT(534725, 377769);
-    REQUIRE_GT(534725, 377769);
-    CHECK_LE(377769, 534725);
-    REQUIRE_LE(377769, 534725);
-    CHECK_GT(846814, 794115);
-    REQUIRE_GT(846814, 794115);
-    CHECK_LT(794115, 846814);
-    REQUIRE_LT(794115, 846814);
-    CHECK_GE(846814, 794115);
-    REQUIRE_GE(846814, 794115);
-    CHECK_GT(827383, 785776);
-    REQUIRE_GT(827383, 785776);
-    CHECK_LT(785776, 827383);
-    REQUIRE_LT(785776, 827383);
-    CHECK_GE(827383, 785776);
-    REQUIRE_GE(827383, 785776);
-    CHECK_GT(819735, 635916);
-    REQUIRE_GT(819735, 635916);
-    CHECK_LT(635916, 819735);
-    REQUIRE_LT(635916, 819735);
-    CHECK_GE(819735, 635916);
-    REQUIRE_GE(819735, 635916);
-    CHECK_GT(565083, 514311);
-    REQUIRE_GT(565083, 514311);
-    CHECK_LT(514311, 565083);
-    REQUIRE_LT(514311, 565083);
-    CHECK_GE(565083, 514311);
-    REQUIRE_GE(565083, 514311);
-    CHECK_LT(421276, 516216);
-    REQUIRE_LT(421276, 516216);
-    CHECK_GT(516216, 421276);
-    REQUIRE_GT(516216, 421276);
-    CHECK_LE(421276, 516216);
-    REQUIRE_LE(421276, 516216);
-    CHECK_LT(156284, 384831);
-    REQUIRE_LT(156284, 384831);
-    CHECK_GT(384831, 156284);
-    REQUIRE_GT(384831, 156284);
-    CHECK_LE(156284, 384831);
-    REQUIRE_LE(156284, 384831);
-    CHECK_GT(591452, 109272);
-    REQUIRE_GT(591452, 109272);
-    CHECK_LT(109272, 591452);
-    REQUIRE_LT(109272, 591452);
-    CHECK_GE(591452, 109272);
-    REQUIRE_GE(591452, 109272);
-    CHECK_LT(89180, 513610);
-    REQUIRE_LT(89180, 513610);
-    CHECK_GT(513610, 89180);
-    REQUIRE_GT(513610, 89180);
-    CHECK_LE(89180, 513610);
-    REQUIRE_LE(89180, 513610);
-    CHECK_LT(441008, 446026);
-    REQUIRE_LT(441008, 446026);
-    CHECK_GT(446026, 441008);
-    REQUIRE_GT(446026, 441008);
-    CHECK_LE(441008, 446026);
-    REQUIRE_LE(441008, 446026);
-    CHECK_GT(782462, 337954);
-    REQUIRE_GT(782462, 337954);
-    CHECK_LT(337954, 782462);
-    REQUIRE_LT(337954, 782462);
-    CHECK_GE(782462, 337954);
-    REQUIRE_GE(782462, 337954);
-    CHECK_GT(936951, 569930);
-    REQUIRE_GT(936951, 569930);
-    CHECK_LT(569930, 936951);
-    REQUIRE_LT(569930, 936951);
-    CHECK_GE(936951, 569930);
-    REQUIRE_GE(936951, 569930);
-    CHECK_GT(811514, 323515);
-    REQUIRE_GT(811514, 323515);
-    CHECK_LT(323515, 811514);
-    REQUIRE_LT(323515, 811514);
-    CHECK_GE(811514, 323515);
-    REQUIRE_GE(811514, 323515);
-    CHECK_LT(38537, 86827);
-    REQUIRE_LT(38537, 86827);
-    CHECK_GT(86827, 38537);
-    REQUIRE_GT(86827, 38537);
-    CHECK_LE(38537, 86827);
-    REQUIRE_LE(38537, 86827);
-    CHECK_LT(288592, 335962);
-    REQUIRE_LT(288592, 335962);
-    CHECK_GT(335962, 288592);
-    REQUIRE_GT(335962, 288592);
-    CHECK_LE(288592, 335962);
-    REQUIRE_LE(288592, 335962);
-    CHECK_LT(622665, 999526);
-    REQUIRE_LT(622665, 999526);
-    CHECK_GT(999526, 622665);
-    REQUIRE_GT(999526, 622665);
-    CHECK_LE(622665, 999526);
-    REQUIRE_LE(622665, 999526);
-    CHECK_GT(573499, 80963);
-    REQUIRE_GT(573499, 80963);
-    CHECK_LT(80963, 573499);
-    REQUIRE_LT(80963, 573499);
-    CHECK_GE(573499, 80963);
-    REQUIRE_GE(573499, 80963);
-    CHECK_LT(235313, 788712);
-    REQUIRE_LT(235313, 788712);
-    CHECK_GT(788712, 235313);
-    REQUIRE_GT(788712, 235313);
-    CHECK_LE(235313, 788712);
-    REQUIRE_LE(235313, 788712);
-    CHECK_LT(913234, 933212);
-    REQUIRE_LT(913234, 933212);
-    CHECK_GT(933212, 913234);
-    REQUIRE_GT(933212, 913234);
-    CHECK_LE(913234, 933212);
-    REQUIRE_LE(913234, 933212);
-    CHECK_GT(994733, 762749);
-    REQUIRE_GT(994733, 762749);
-    CHECK_LT(762749, 994733);
-    REQUIRE_LT(762749, 994733);
-    CHECK_GE(994733, 762749);
-    REQUIRE_GE(994733, 762749);
-    CHECK_GT(371106, 155035);
-    REQUIRE_GT(371106, 155035);
-    CHECK_LT(155035, 371106);
-    REQUIRE_LT(155035, 371106);
-    CHECK_GE(371106, 155035);
-    REQUIRE_GE(371106, 155035);
-    CHECK_GT(721837, 636439);
-    REQUIRE_GT(721837, 636439);
-    CHECK_LT(636439, 721837);
-    REQUIRE_LT(636439, 721837);
-    CHECK_GE(721837, 636439);
-    REQUIRE_GE(721837, 636439);
-    CHECK_LT(179511, 572932);
-    REQUIRE_LT(179511, 572932);
-    CHECK_GT(572932, 179511);
-    REQUIRE_GT(572932, 179511);
-    CHECK_LE(179511, 572932);
-    REQUIRE_LE(179511, 572932);
-    CHECK_GT(806912, 62555);
-    REQUIRE_GT(806912, 62555);
-    CHECK_LT(62555, 806912);
-    REQUIRE_LT(62555, 806912);
-    CHECK_GE(806912, 62555);
-    REQUIRE_GE(806912, 62555);
-    CHECK_LT(188709, 852839);
-    REQUIRE_LT(188709, 852839);
-    CHECK_GT(852839, 188709);
-    REQUIRE_GT(852839, 188709);
-    CHECK_LE(188709, 852839);
-    REQUIRE_LE(188709, 852839);
-    CHECK_LT(225116, 283020);
-    REQUIRE_LT(225116, 283020);
-    CHECK_GT(283020, 225116);
-    REQUIRE_GT(283020, 225116);
-    CHECK_LE(225116, 283020);
-    REQUIRE_LE(225116, 283020);
-    CHECK_LT(354282, 675728);
-    REQUIRE_LT(354282, 675728);
-    CHECK_GT(675728, 354282);
-    REQUIRE_GT(675728, 354282);
-    CHECK_LE(354282, 675728);
-    REQUIRE_LE(354282, 675728);
-    CHECK_GT(756811, 571569);
-    REQUIRE_GT(756811, 571569);
-    CHECK_LT(571569, 756811);
-    REQUIRE_LT(571569, 756811);
-    CHECK_GE(756811, 571569);
-    REQUIRE_GE(756811, 571569);
-    CHECK_GT(789251, 275745);
-    REQUIRE_GT(789251, 275745);
-    CHECK_LT(275745, 789251);
-    REQUIRE_LT(275745, 789251);
-    CHECK_GE(789251, 275745);
-    REQUIRE_GE(789251, 275745);
-    CHECK_LT(408546, 429583);
-    REQUIRE_LT(408546, 429583);
-    CHECK_GT(429583, 408546);
-    REQUIRE_GT(429583, 408546);
-    CHECK_LE(408546, 429583);
-    REQUIRE_LE(408546, 429583);
-    CHECK_LT(378217, 460915);
-    REQUIRE_LT(378217, 460915);
-    CHECK_GT(460915, 378217);
-    REQUIRE_GT(460915, 378217);
-    CHECK_LE(378217, 460915);
-    REQUIRE_LE(378217, 460915);
-    CHECK_GT(920950, 504140);
-    REQUIRE_GT(920950, 504140);
-    CHECK_LT(504140, 920950);
-    REQUIRE_LT(504140, 920950);
-    CHECK_GE(920950, 504140);
-    REQUIRE_GE(920950, 504140);
-    CHECK_GT(729316, 565038);
-    REQUIRE_GT(729316, 565038);
-    CHECK_LT(565038, 729316);
-    REQUIRE_LT(565038, 729316);
-    CHECK_GE(729316, 565038);
-    REQUIRE_GE(729316, 565038);
-    CHECK_GT(863655, 583042);
-    REQUIRE_GT(863655, 583042);
-    CHECK_LT(583042, 863655);
-    REQUIRE_LT(583042, 863655);
-    CHECK_GE(863655, 583042);
-    REQUIRE_GE(863655, 583042);
-    CHECK_GT(958290, 213408);
-    REQUIRE_GT(958290, 213408);
-    CHECK_LT(213408, 958290);
-    REQUIRE_LT(213408, 958290);
-    CHECK_GE(958290, 213408);
-    REQUIRE_GE(958290, 213408);
-    CHECK_LT(113851, 688337);
-    REQUIRE_LT(113851, 688337);
-    CHECK_GT(688337, 113851);
-    REQUIRE_GT(688337, 113851);
-    CHECK_LE(113851, 688337);
-    REQUIRE_LE(113851, 688337);
-    CHECK_GT(281358, 47920);
-    REQUIRE_GT(281358, 47920);
-    CHECK_LT(47920, 281358);
-    REQUIRE_LT(47920, 281358);
-    CHECK_GE(281358, 47920);
-    REQUIRE_GE(281358, 47920);
-    CHECK_LT(296808, 943451);
-    REQUIRE_LT(296808, 943451);
-    CHECK_GT(943451, 296808);
-    REQUIRE_GT(943451, 296808);
-    CHECK_LE(296808, 943451);
-    REQUIRE_LE(296808, 943451);
-    CHECK_GT(591019, 257144);
-    REQUIRE_GT(591019, 257144);
-    CHECK_LT(257144, 591019);
-    REQUIRE_LT(257144, 591019);
-    CHECK_GE(591019, 257144);
-    REQUIRE_GE(591019, 257144);
-    CHECK_GT(856683, 813420);
-    REQUIRE_GT(856683, 813420);
-    CHECK_LT(813420, 856683);
-    REQUIRE_LT(813420, 856683);
-    CHECK_GE(856683, 813420);
-    REQUIRE_GE(856683, 813420);
-    CHECK_GT(720942, 185727);
-    REQUIRE_GT(720942, 185727);
-    CHECK_LT(185727, 720942);
-    REQUIRE_LT(185727, 720942);
-    CHECK_GE(720942, 185727);
-    REQUIRE_GE(720942, 185727);
-    CHECK_LT(439013, 620563);
-    REQUIRE_LT(439013, 620563);
-    CHECK_GT(620563, 439013);
-    REQUIRE_GT(620563, 439013);
-    CHECK_LE(439013, 620563);
-    REQUIRE_LE(439013, 620563);
-    CHECK_GT(903554, 849374);
-    REQUIRE_GT(903554, 849374);
-    CHECK_LT(849374, 903554);
-    REQUIRE_LT(849374, 903554);
-    CHECK_GE(903554, 849374);
-    REQUIRE_GE(903554, 849374);
-    CHECK_LT(522420, 610072);
-    REQUIRE_LT(522420, 610072);
-    CHECK_GT(610072, 522420);
-    REQUIRE_GT(610072, 522420);
-    CHECK_LE(522420, 610072);
-    REQUIRE_LE(522420, 610072);
-    CHECK_GT(227282, 142563);
-    REQUIRE_GT(227282, 142563);
-    CHECK_LT(142563, 227282);
-    REQUIRE_LT(142563, 227282);
-    CHECK_GE(227282, 142563);
-    REQUIRE_GE(227282, 142563);
-    CHECK_GT(432535, 289597);
-    REQUIRE_GT(432535, 289597);
-    CHECK_LT(289597, 432535);
-    REQUIRE_LT(289597, 432535);
-    CHECK_GE(432535, 289597);
-    REQUIRE_GE(432535, 289597);
-    CHECK_GT(895194, 392603);
-    REQUIRE_GT(895194, 392603);
-    CHECK_LT(392603, 895194);
-    REQUIRE_LT(392603, 895194);
-    CHECK_GE(895194, 392603);
-    REQUIRE_GE(895194, 392603);
-    CHECK_LT(486889, 974510);
-    REQUIRE_LT(486889, 974510);
-    CHECK_GT(974510, 486889);
-    REQUIRE_GT(974510, 486889);
-    CHECK_LE(486889, 974510);
-    REQUIRE_LE(486889, 974510);
-    CHECK_GT(498064, 33539);
-    REQUIRE_GT(498064, 33539);
-    CHECK_LT(33539, 498064);
-    REQUIRE_LT(33539, 498064);
-    CHECK_GE(498064, 33539);
-    REQUIRE_GE(498064, 33539);
-    CHECK_GT(947987, 45201);
-    REQUIRE_GT(947987, 45201);
-    CHECK_LT(45201, 947987);
-    REQUIRE_LT(45201, 947987);
-    CHECK_GE(947987, 45201);
-    REQUIRE_GE(947987, 45201);
-    CHECK_LT(2025, 623237);
-    REQUIRE_LT(2025, 623237);
-    CHECK_GT(623237, 2025);
-    REQUIRE_GT(623237, 2025);
-    CHECK_LE(2025, 623237);
-    REQUIRE_LE(2025, 623237);
-    CHECK_LT(558626, 979508);
-    REQUIRE_LT(558626, 979508);
-    CHECK_GT(979508, 558626);
-    REQUIRE_GT(979508, 558626);
-    CHECK_LE(558626, 979508);
-    REQUIRE_LE(558626, 979508);
-    CHECK_GT(834223, 192015);
-    REQUIRE_GT(834223, 192015);
-    CHECK_LT(192015, 834223);
-    REQUIRE_LT(192015, 834223);
-    CHECK_GE(834223, 192015);
-    REQUIRE_GE(834223, 192015);
-    CHECK_GT(262466, 11486);
-    REQUIRE_GT(262466, 11486);
-    CHECK_LT(11486, 262466);
-    REQUIRE_LT(11486, 262466);
-    CHECK_GE(262466, 11486);
-    REQUIRE_GE(262466, 11486);
-    CHECK_GT(470848, 332703);
-    REQUIRE_GT(470848, 332703);
-    CHECK_LT(332703, 470848);
-    REQUIRE_LT(332703, 470848);
-    CHECK_GE(470848, 332703);
-    REQUIRE_GE(470848, 332703);
-    CHECK_LT(330137, 344725);
-    REQUIRE_LT(330137, 344725);
-    CHECK_GT(344725, 330137);
-    REQUIRE_GT(344725, 330137);
-    CHECK_LE(330137, 344725);
-    REQUIRE_LE(330137, 344725);
-    CHECK_LT(173282, 556352);
-    REQUIRE_LT(173282, 556352);
-    CHECK_GT(556352, 173282);
-    REQUIRE_GT(556352, 173282);
-    CHECK_LE(173282, 556352);
-    REQUIRE_LE(173282, 556352);
-    CHECK_LT(218314, 249359);
-    REQUIRE_LT(218314, 249359);
-    CHECK_GT(249359, 218314);
-    REQUIRE_GT(249359, 218314);
-    CHECK_LE(218314, 249359);
-    REQUIRE_LE(218314, 249359);
-    CHECK_LT(249873, 595577);
-    REQUIRE_LT(249873, 595577);
-    CHECK_GT(595577, 249873);
-    REQUIRE_GT(595577, 249873);
-    CHECK_LE(249873, 595577);
-    REQUIRE_LE(249873, 595577);
-    CHECK_GT(818812, 48102);
-    REQUIRE_GT(818812, 48102);
-    CHECK_LT(48102, 818812);
-    REQUIRE_LT(48102, 818812);
-    CHECK_GE(818812, 48102);
-    REQUIRE_GE(818812, 48102);
-    CHECK_LT(137470, 491991);
-    REQUIRE_LT(137470, 491991);
-    CHECK_GT(491991, 137470);
-    REQUIRE_GT(491991, 137470);
-    CHECK_LE(137470, 491991);
-    REQUIRE_LE(137470, 491991);
-    CHECK_GT(998642, 353318);
-    REQUIRE_GT(998642, 353318);
-    CHECK_LT(353318, 998642);
-    REQUIRE_LT(353318, 998642);
-    CHECK_GE(998642, 353318);
-    REQUIRE_GE(998642, 353318);
-    CHECK_LT(401202, 885341);
-    REQUIRE_LT(401202, 885341);
-    CHECK_GT(885341, 401202);
-    REQUIRE_GT(885341, 401202);
-    CHECK_LE(401202, 885341);
-    REQUIRE_LE(401202, 885341);
-    CHECK_LT(26302, 201042);
-    REQUIRE_LT(26302, 201042);
-    CHECK_GT(201042, 26302);
-    REQUIRE_GT(201042, 26302);
-    CHECK_LE(26302, 201042);
-    REQUIRE_LE(26302, 201042);
-    CHECK_GT(842311, 640014);
-    REQUIRE_GT(842311, 640014);
-    CHECK_LT(640014, 842311);
-    REQUIRE_LT(640014, 842311);
-    CHECK_GE(842311, 640014);
-    REQUIRE_GE(842311, 640014);
-    CHECK_LT(154529, 973215);
-    REQUIRE_LT(154529, 973215);
-    CHECK_GT(973215, 154529);
-    REQUIRE_GT(973215, 154529);
-    CHECK_LE(154529, 973215);
-    REQUIRE_LE(154529, 973215);
-    CHECK_GT(881772, 216092);
-    REQUIRE_GT(881772, 216092);
-    CHECK_LT(216092, 881772);
-    REQUIRE_LT(216092, 881772);
-    CHECK_GE(881772, 216092);
-    REQUIRE_GE(881772, 216092);
-    CHECK_LT(445786, 895895);
-    REQUIRE_LT(445786, 895895);
-    CHECK_GT(895895, 445786);
-    REQUIRE_GT(895895, 445786);
-    CHECK_LE(445786, 895895);
-    REQUIRE_LE(445786, 895895);
-    CHECK_GT(310775, 37568);
-    REQUIRE_GT(310775, 37568);
-    CHECK_LT(37568, 310775);
-    REQUIRE_LT(37568, 310775);
-    CHECK_GE(310775, 37568);
-    REQUIRE_GE(310775, 37568);
-    CHECK_LT(174724, 815562);
-    REQUIRE_LT(174724, 815562);
-    CHECK_GT(815562, 174724);
-    REQUIRE_GT(815562, 174724);
-    CHECK_LE(174724, 815562);
-    REQUIRE_LE(174724, 815562);
-    CHECK_GT(639235, 153517);
-    REQUIRE_GT(639235, 153517);
-    CHECK_LT(153517, 639235);
-    REQUIRE_LT(153517, 639235);
-    CHECK_GE(639235, 153517);
-    REQUIRE_GE(639235, 153517);
-    CHECK_GT(684186, 239529);
-    REQUIRE_GT(684186, 239529);
-    CHECK_LT(239529, 684186);
-    REQUIRE_LT(239529, 684186);
-    CHECK_GE(684186, 239529);
-    REQUIRE_GE(684186, 239529);
-    CHECK_GT(502948, 171903);
-    REQUIRE_GT(502948, 171903);
-    CHECK_LT(171903, 502948);
-    REQUIRE_LT(171903, 502948);
-    CHECK_GE(502948, 171903);
-    REQUIRE_GE(502948, 171903);
-    CHECK_GT(270899, 250952);
-    REQUIRE_GT(270899, 250952);
-    CHECK_LT(250952, 270899);
-    REQUIRE_LT(250952, 270899);
-    CHECK_GE(270899, 250952);
-    REQUIRE_GE(270899, 250952);
-    CHECK_GT(273019, 15650);
-    REQUIRE_GT(273019, 15650);
-    CHECK_LT(15650, 273019);
-    REQUIRE_LT(15650, 273019);
-    CHECK_GE(273019, 15650);
-    REQUIRE_GE(273019, 15650);
-    CHECK_GT(959615, 20654);
-    REQUIRE_GT(959615, 20654);
-    CHECK_LT(20654, 959615);
-    REQUIRE_LT(20654, 959615);
-    CHECK_GE(959615, 20654);
-    REQUIRE_GE(959615, 20654);
-    CHECK_GT(772978, 731523);
-    REQUIRE_GT(772978, 731523);
-    CHECK_LT(731523, 772978);
-    REQUIRE_LT(731523, 772978);
-    CHECK_GE(772978, 731523);
-    REQUIRE_GE(772978, 731523);
-    CHECK_LT(303164, 754323);
-    REQUIRE_LT(303164, 754323);
-    CHECK_GT(754323, 303164);
-    REQUIRE_GT(754323, 303164);
-    CHECK_LE(303164, 754323);
-    REQUIRE_LE(303164, 754323);
-    CHECK_GT(788535, 388988);
-    REQUIRE_GT(788535, 388988);
-    CHECK_LT(388988, 788535);
-    REQUIRE_LT(388988, 788535);
-    CHECK_GE(788535, 388988);
-    REQUIRE_GE(788535, 388988);
-    CHECK_LT(167372, 926013);
-    REQUIRE_LT(167372, 926013);
-    CHECK_GT(926013, 167372);
-    REQUIRE_GT(926013, 167372);
-    CHECK_LE(167372, 926013);
-    REQUIRE_LE(167372, 926013);
-    CHECK_LT(53169, 860995);
-    REQUIRE_LT(53169, 860995);
-    CHECK_GT(860995, 53169);
-    REQUIRE_GT(860995, 53169);
-    CHECK_LE(53169, 860995);
-    REQUIRE_LE(53169, 860995);
-    CHECK_GT(844942, 19894);
-    REQUIRE_GT(844942, 19894);
-    CHECK_LT(19894, 844942);
-    REQUIRE_LT(19894, 844942);
-    CHECK_GE(844942, 19894);
-    REQUIRE_GE(844942, 19894);
-    CHECK_LT(536586, 870687);
-    REQUIRE_LT(536586, 870687);
-    CHECK_GT(870687, 536586);
-    REQUIRE_GT(870687, 536586);
-    CHECK_LE(536586, 870687);
-    REQUIRE_LE(536586, 870687);
-    CHECK_GT(951864, 487586);
-    REQUIRE_GT(951864, 487586);
-    CHECK_LT(487586, 951864);
-    REQUIRE_LT(487586, 951864);
-    CHECK_GE(951864, 487586);
-    REQUIRE_GE(951864, 487586);
-    CHECK_GT(425810, 317533);
-    REQUIRE_GT(425810, 317533);
-    CHECK_LT(317533, 425810);
-    REQUIRE_LT(317533, 425810);
-    CHECK_GE(425810, 317533);
-    REQUIRE_GE(425810, 317533);
-    CHECK_GT(972558, 764740);
-    REQUIRE_GT(972558, 764740);
-    CHECK_LT(764740, 972558);
-    REQUIRE_LT(764740, 972558);
-    CHECK_GE(972558, 764740);
-    REQUIRE_GE(972558, 764740);
-    CHECK_GT(838762, 518886);
-    REQUIRE_GT(838762, 518886);
-    CHECK_LT(518886, 838762);
-    REQUIRE_LT(518886, 838762);
-    CHECK_GE(838762, 518886);
-    REQUIRE_GE(838762, 518886);
-    CHECK_GT(635473, 507945);
-    REQUIRE_GT(635473, 507945);
-    CHECK_LT(507945, 635473);
-    REQUIRE_LT(507945, 635473);
-    CHECK_GE(635473, 507945);
-    REQUIRE_GE(635473, 507945);
-    CHECK_GT(682395, 182284);
-    REQUIRE_GT(682395, 182284);
-    CHECK_LT(182284, 682395);
-    REQUIRE_LT(182284, 682395);
-    CHECK_GE(682395, 182284);
-    REQUIRE_GE(682395, 182284);
-    CHECK_LT(66705, 818892);
-    REQUIRE_LT(66705, 818892);
-    CHECK_GT(818892, 66705);
-    REQUIRE_GT(818892, 66705);
-    CHECK_LE(66705, 818892);
-    REQUIRE_LE(66705, 818892);
-    CHECK_GT(760574, 329658);
-    REQUIRE_GT(760574, 329658);
-    CHECK_LT(329658, 760574);
-    REQUIRE_LT(329658, 760574);
-    CHECK_GE(760574, 329658);
-    REQUIRE_GE(760574, 329658);
-    CHECK_LT(634525, 640402);
-    REQUIRE_LT(634525, 640402);
-    CHECK_GT(640402, 634525);
-    REQUIRE_GT(640402, 634525);
-    CHECK_LE(634525, 640402);
-    REQUIRE_LE(634525, 640402);
-    CHECK_LT(240138, 588069);
-    REQUIRE_LT(240138, 588069);
-    CHECK_GT(588069, 240138);
-    REQUIRE_GT(588069, 240138);
-    CHECK_LE(240138, 588069);
-    REQUIRE_LE(240138, 588069);
-    CHECK_LT(285631, 836265);
-    REQUIRE_LT(285631, 836265);
-    CHECK_GT(836265, 285631);
-    REQUIRE_GT(836265, 285631);
-    CHECK_LE(285631, 836265);
-    REQUIRE_LE(285631, 836265);
-    CHECK_LT(806057, 942089);
-    REQUIRE_LT(806057, 942089);
-    CHECK_GT(942089, 806057);
-    REQUIRE_GT(942089, 806057);
-    CHECK_LE(806057, 942089);
-    REQUIRE_LE(806057, 942089);
-    CHECK_LT(46921, 154168);
-    REQUIRE_LT(46921, 154168);
-    CHECK_GT(154168, 46921);
-    REQUIRE_GT(154168, 46921);
-    CHECK_LE(46921, 154168);
-    REQUIRE_LE(46921, 154168);
-    CHECK_LT(598420, 719210);
-    REQUIRE_LT(598420, 719210);
-    CHECK_GT(719210, 598420);
-    REQUIRE_GT(719210, 598420);
-    CHECK_LE(598420, 719210);
-    REQUIRE_LE(598420, 719210);
-    CHECK_LT(382215, 464541);
-    REQUIRE_LT(382215, 464541);
-    CHECK_GT(464541, 382215);
-    REQUIRE_GT(464541, 382215);
-    CHECK_LE(382215, 464541);
-    REQUIRE_LE(382215, 464541);
-    CHECK_LT(19450, 594849);
-    REQUIRE_LT(19450, 594849);
-    CHECK_GT(594849, 19450);
-    REQUIRE_GT(594849, 19450);
-    CHECK_LE(19450, 594849);
-    REQUIRE_LE(19450, 594849);
-    CHECK_LT(667728, 877495);
-    REQUIRE_LT(667728, 877495);
-    CHECK_GT(877495, 667728);
-    REQUIRE_GT(877495, 667728);
-    CHECK_LE(667728, 877495);
-    REQUIRE_LE(667728, 877495);
-    CHECK_GT(539817, 150167);
-    REQUIRE_GT(539817, 150167);
-    CHECK_LT(150167, 539817);
-    REQUIRE_LT(150167, 539817);
-    CHECK_GE(539817, 150167);
-    REQUIRE_GE(539817, 150167);
-    CHECK_GT(89588, 85252);
-    REQUIRE_GT(89588, 85252);
-    CHECK_LT(85252, 89588);
-    REQUIRE_LT(85252, 89588);
-    CHECK_GE(89588, 85252);
-    REQUIRE_GE(89588, 85252);
-    CHECK_GT(645133, 257618);
-    REQUIRE_GT(645133, 257618);
-    CHECK_LT(257618, 645133);
-    REQUIRE_LT(257618, 645133);
-    CHECK_GE(645133, 257618);
-    REQUIRE_GE(645133, 257618);
-    CHECK_GT(531832, 402133);
-    REQUIRE_GT(531832, 402133);
-    CHECK_LT(402133, 531832);
-    REQUIRE_LT(402133, 531832);
-    CHECK_GE(531832, 402133);
-    REQUIRE_GE(531832, 402133);
-    CHECK_GT(407073, 364327);
-    REQUIRE_GT(407073, 364327);
-    CHECK_LT(364327, 407073);
-    REQUIRE_LT(364327, 407073);
-    CHECK_GE(407073, 364327);
-    REQUIRE_GE(407073, 364327);
-    CHECK_LT(264137, 391885);
-    REQUIRE_LT(264137, 391885);
-    CHECK_GT(391885, 264137);
-    REQUIRE_GT(391885, 264137);
-    CHECK_LE(264137, 391885);
-    REQUIRE_LE(264137, 391885);
-    CHECK_LT(654926, 860181);
-    REQUIRE_LT(654926, 860181);
-    CHECK_GT(860181, 654926);
-    REQUIRE_GT(860181, 654926);
-    CHECK_LE(654926, 860181);
-    REQUIRE_LE(654926, 860181);
-    CHECK_GT(567137, 330405);
-    REQUIRE_GT(567137, 330405);
-    CHECK_LT(330405, 567137);
-    REQUIRE_LT(330405, 567137);
-    CHECK_GE(567137, 330405);
-    REQUIRE_GE(567137, 330405);
-    CHECK_GT(659972, 61976);
-    REQUIRE_GT(659972, 61976);
-    CHECK_LT(61976, 659972);
-    REQUIRE_LT(61976, 659972);
-    CHECK_GE(659972, 61976);
-    REQUIRE_GE(659972, 61976);
-    CHECK_GT(962724, 779541);
-    REQUIRE_GT(962724, 779541);
-    CHECK_LT(779541, 962724);
-    REQUIRE_LT(779541, 962724);
-    CHECK_GE(962724, 779541);
-    REQUIRE_GE(962724, 779541);
-    CHECK_LT(205790, 456164);
-    REQUIRE_LT(205790, 456164);
-    CHECK_GT(456164, 205790);
-    REQUIRE_GT(456164, 205790);
-    CHECK_LE(205790, 456164);
-    REQUIRE_LE(205790, 456164);
-    CHECK_LT(64159, 496621);
-    REQUIRE_LT(64159, 496621);
-    CHECK_GT(496621, 64159);
-    REQUIRE_GT(496621, 64159);
-    CHECK_LE(64159, 496621);
-    REQUIRE_LE(64159, 496621);
-    CHECK_GT(86163, 55459);
-    REQUIRE_GT(86163, 55459);
-    CHECK_LT(55459, 86163);
-    REQUIRE_LT(55459, 86163);
-    CHECK_GE(86163, 55459);
-    REQUIRE_GE(86163, 55459);
-    CHECK_LT(481248, 857681);
-    REQUIRE_LT(481248, 857681);
-    CHECK_GT(857681, 481248);
-    REQUIRE_GT(857681, 481248);
-    CHECK_LE(481248, 857681);
-    REQUIRE_LE(481248, 857681);
-    CHECK_LT(277637, 503476);
-    REQUIRE_LT(277637, 503476);
-    CHECK_GT(503476, 277637);
-    REQUIRE_GT(503476, 277637);
-    CHECK_LE(277637, 503476);
-    REQUIRE_LE(277637, 503476);
-    CHECK_GT(959527, 195855);
-    REQUIRE_GT(959527, 195855);
-    CHECK_LT(195855, 959527);
-    REQUIRE_LT(195855, 959527);
-    CHECK_GE(959527, 195855);
-    REQUIRE_GE(959527, 195855);
-    CHECK_LT(141615, 299403);
-    REQUIRE_LT(141615, 299403);
-    CHECK_GT(299403, 141615);
-    REQUIRE_GT(299403, 141615);
-    CHECK_LE(141615, 299403);
-    REQUIRE_LE(141615, 299403);
-    CHECK_GT(495231, 245204);
-    REQUIRE_GT(495231, 245204);
-    CHECK_LT(245204, 495231);
-    REQUIRE_LT(245204, 495231);
-    CHECK_GE(495231, 245204);
-    REQUIRE_GE(495231, 245204);
-    CHECK_GT(817380, 771170);
-    REQUIRE_GT(817380, 771170);
-    CHECK_LT(771170, 817380);
-    REQUIRE_LT(771170, 817380);
-    CHECK_GE(817380, 771170);
-    REQUIRE_GE(817380, 771170);
-    CHECK_LT(264705, 656549);
-    REQUIRE_LT(264705, 656549);
-    CHECK_GT(656549, 264705);
-    REQUIRE_GT(656549, 264705);
-    CHECK_LE(264705, 656549);
-    REQUIRE_LE(264705, 656549);
-    CHECK_LT(824247, 853494);
-    REQUIRE_LT(824247, 853494);
-    CHECK_GT(853494, 824247);
-    REQUIRE_GT(853494, 824247);
-    CHECK_LE(824247, 853494);
-    REQUIRE_LE(824247, 853494);
-    CHECK_LT(447250, 449882);
-    REQUIRE_LT(447250, 449882);
-    CHECK_GT(449882, 447250);
-    REQUIRE_GT(449882, 447250);
-    CHECK_LE(447250, 449882);
-    REQUIRE_LE(447250, 449882);
-    CHECK_LT(300985, 983333);
-    REQUIRE_LT(300985, 983333);
-    CHECK_GT(983333, 300985);
-    REQUIRE_GT(983333, 300985);
-    CHECK_LE(300985, 983333);
-    REQUIRE_LE(300985, 983333);
-    CHECK_LT(913386, 926957);
-    REQUIRE_LT(913386, 926957);
-    CHECK_GT(926957, 913386);
-    REQUIRE_GT(926957, 913386);
-    CHECK_LE(913386, 926957);
-    REQUIRE_LE(913386, 926957);
-    CHECK_LT(198520, 384370);
-    REQUIRE_LT(198520, 384370);
-    CHECK_GT(384370, 198520);
-    REQUIRE_GT(384370, 198520);
-    CHECK_LE(198520, 384370);
-    REQUIRE_LE(198520, 384370);
-    CHECK_LT(145976, 150336);
-    REQUIRE_LT(145976, 150336);
-    CHECK_GT(150336, 145976);
-    REQUIRE_GT(150336, 145976);
-    CHECK_LE(145976, 150336);
-    REQUIRE_LE(145976, 150336);
-    CHECK_LT(91461, 702185);
-    REQUIRE_LT(91461, 702185);
-    CHECK_GT(702185, 91461);
-    REQUIRE_GT(702185, 91461);
-    CHECK_LE(91461, 702185);
-    REQUIRE_LE(91461, 702185);
-    CHECK_GT(604966, 442078);
-    REQUIRE_GT(604966, 442078);
-    CHECK_LT(442078, 604966);
-    REQUIRE_LT(442078, 604966);
-    CHECK_GE(604966, 442078);
-    REQUIRE_GE(604966, 442078);
-    CHECK_GT(790658, 681504);
-    REQUIRE_GT(790658, 681504);
-    CHECK_LT(681504, 790658);
-    REQUIRE_LT(681504, 790658);
-    CHECK_GE(790658, 681504);
-    REQUIRE_GE(790658, 681504);
-    CHECK_GT(896493, 856467);
-    REQUIRE_GT(896493, 856467);
-    CHECK_LT(856467, 896493);
-    REQUIRE_LT(856467, 896493);
-    CHECK_GE(896493, 856467);
-    REQUIRE_GE(896493, 856467);
-    CHECK_LT(164730, 166774);
-    REQUIRE_LT(164730, 166774);
-    CHECK_GT(166774, 164730);
-    REQUIRE_GT(166774, 164730);
-    CHECK_LE(164730, 166774);
-    REQUIRE_LE(164730, 166774);
-    CHECK_LT(477269, 546293);
-    REQUIRE_LT(477269, 546293);
-    CHECK_GT(546293, 477269);
-    REQUIRE_GT(546293, 477269);
-    CHECK_LE(477269, 546293);
-    REQUIRE_LE(477269, 546293);
-    CHECK_GT(681059, 284306);
-    REQUIRE_GT(681059, 284306);
-    CHECK_LT(284306, 681059);
-    REQUIRE_LT(284306, 681059);
-    CHECK_GE(681059, 284306);
-    REQUIRE_GE(681059, 284306);
-    CHECK_GT(755750, 645901);
-    REQUIRE_GT(755750, 645901);
-    CHECK_LT(645901, 755750);
-    REQUIRE_LT(645901, 755750);
-    CHECK_GE(755750, 645901);
-    REQUIRE_GE(755750, 645901);
-    CHECK_GT(964921, 735335);
-    REQUIRE_GT(964921, 735335);
-    CHECK_LT(735335, 964921);
-    REQUIRE_LT(735335, 964921);
-    CHECK_GE(964921, 735335);
-    REQUIRE_GE(964921, 735335);
-    CHECK_GT(605347, 599278);
-    REQUIRE_GT(605347, 599278);
-    CHECK_LT(599278, 605347);
-    REQUIRE_LT(599278, 605347);
-    CHECK_GE(605347, 599278);
-    REQUIRE_GE(605347, 599278);
-    CHECK_LT(311245, 592556);
-    REQUIRE_LT(311245, 592556);
-    CHECK_GT(592556, 311245);
-    REQUIRE_GT(592556, 311245);
-    CHECK_LE(311245, 592556);
-    REQUIRE_LE(311245, 592556);
-    CHECK_GT(737532, 476453);
-    REQUIRE_GT(737532, 476453);
-    CHECK_LT(476453, 737532);
-    REQUIRE_LT(476453, 737532);
-    CHECK_GE(737532, 476453);
-    REQUIRE_GE(737532, 476453);
-    CHECK_LT(397143, 414965);
-    REQUIRE_LT(397143, 414965);
-    CHECK_GT(414965, 397143);
-    REQUIRE_GT(414965, 397143);
-    CHECK_LE(397143, 414965);
-    REQUIRE_LE(397143, 414965);
-    CHECK_GT(999619, 797765);
-    REQUIRE_GT(999619, 797765);
-    CHECK_LT(797765, 999619);
-    REQUIRE_LT(797765, 999619);
-    CHECK_GE(999619, 797765);
-    REQUIRE_GE(999619, 797765);
-    CHECK_GT(771189, 264694);
-    REQUIRE_GT(771189, 264694);
-    CHECK_LT(264694, 771189);
-    REQUIRE_LT(264694, 771189);
-    CHECK_GE(771189, 264694);
-    REQUIRE_GE(771189, 264694);
-    CHECK_GT(910911, 833235);
-    REQUIRE_GT(910911, 833235);
-    CHECK_LT(833235, 910911);
-    REQUIRE_LT(833235, 910911);
-    CHECK_GE(910911, 833235);
-    REQUIRE_GE(910911, 833235);
-    CHECK_LT(734454, 886750);
-    REQUIRE_LT(734454, 886750);
-    CHECK_GT(886750, 734454);
-    REQUIRE_GT(886750, 734454);
-    CHECK_LE(734454, 886750);
-    REQUIRE_LE(734454, 886750);
-    CHECK_LT(101836, 585889);
-    REQUIRE_LT(101836, 585889);
-    CHECK_GT(585889, 101836);
-    REQUIRE_GT(585889, 101836);
-    CHECK_LE(101836, 585889);
-    REQUIRE_LE(101836, 585889);
-    CHECK_LT(700218, 852174);
-    REQUIRE_LT(700218, 852174);
-    CHECK_GT(852174, 700218);
-    REQUIRE_GT(852174, 700218);
-    CHECK_LE(700218, 852174);
-    REQUIRE_LE(700218, 852174);
-    CHECK_LT(157476, 713941);
-    REQUIRE_LT(157476, 713941);
-    CHECK_GT(713941, 157476);
-    REQUIRE_GT(713941, 157476);
-    CHECK_LE(157476, 713941);
-    REQUIRE_LE(157476, 713941);
-    CHECK_LT(337680, 353019);
-    REQUIRE_LT(337680, 353019);
-    CHECK_GT(353019, 337680);
-    REQUIRE_GT(353019, 337680);
-    CHECK_LE(337680, 353019);
-    REQUIRE_LE(337680, 353019);
-    CHECK_GT(609351, 468058);
-    REQUIRE_GT(609351, 468058);
-    CHECK_LT(468058, 609351);
-    REQUIRE_LT(468058, 609351);
-    CHECK_GE(609351, 468058);
-    REQUIRE_GE(609351, 468058);
-    CHECK_GT(823858, 304014);
-    REQUIRE_GT(823858, 304014);
-    CHECK_LT(304014, 823858);
-    REQUIRE_LT(304014, 823858);
-    CHECK_GE(823858, 304014);
-    REQUIRE_GE(823858, 304014);
-    CHECK_GT(752564, 672206);
-    REQUIRE_GT(752564, 672206);
-    CHECK_LT(672206, 752564);
-    REQUIRE_LT(672206, 752564);
-    CHECK_GE(752564, 672206);
-    REQUIRE_GE(752564, 672206);
-    CHECK_GT(839795, 155728);
-    REQUIRE_GT(839795, 155728);
-    CHECK_LT(155728, 839795);
-    REQUIRE_LT(155728, 839795);
-    CHECK_GE(839795, 155728);
-    REQUIRE_GE(839795, 155728);
-    CHECK_LT(462260, 655672);
-    REQUIRE_LT(462260, 655672);
-    CHECK_GT(655672, 462260);
-    REQUIRE_GT(655672, 462260);
-    CHECK_LE(462260, 655672);
-    REQUIRE_LE(462260, 655672);
-    CHECK_LT(101574, 728293);
-    REQUIRE_LT(101574, 728293);
-    CHECK_GT(728293, 101574);
-    REQUIRE_GT(728293, 101574);
-    CHECK_LE(101574, 728293);
-    REQUIRE_LE(101574, 728293);
-    CHECK_LT(461305, 977138);
-    REQUIRE_LT(461305, 977138);
-    CHECK_GT(977138, 461305);
-    REQUIRE_GT(977138, 461305);
-    CHECK_LE(461305, 977138);
-    REQUIRE_LE(461305, 977138);
-    CHECK_GT(584532, 540479);
-    REQUIRE_GT(584532, 540479);
-    CHECK_LT(540479, 584532);
-    REQUIRE_LT(540479, 584532);
-    CHECK_GE(584532, 540479);
-    REQUIRE_GE(584532, 540479);
-    CHECK_GT(625589, 125844);
-    REQUIRE_GT(625589, 125844);
-    CHECK_LT(125844, 625589);
-    REQUIRE_LT(125844, 625589);
-    CHECK_GE(625589, 125844);
-    REQUIRE_GE(625589, 125844);
-    CHECK_LT(412670, 625279);
-    REQUIRE_LT(412670, 625279);
-    CHECK_GT(625279, 412670);
-    REQUIRE_GT(625279, 412670);
-    CHECK_LE(412670, 625279);
-    REQUIRE_LE(412670, 625279);
-    CHECK_LT(185201, 587439);
-    REQUIRE_LT(185201, 587439);
-    CHECK_GT(587439, 185201);
-    REQUIRE_GT(587439, 185201);
-    CHECK_LE(185201, 587439);
-    REQUIRE_LE(185201, 587439);
-    CHECK_LT(693022, 968693);
-    REQUIRE_LT(693022, 968693);
-    CHECK_GT(968693, 693022);
-    REQUIRE_GT(968693, 693022);
-    CHECK_LE(693022, 968693);
-    REQUIRE_LE(693022, 968693);
-    CHECK_LT(145589, 230393);
-    REQUIRE_LT(145589, 230393);
-    CHECK_GT(230393, 145589);
-    REQUIRE_GT(230393, 145589);
-    CHECK_LE(145589, 230393);
-    REQUIRE_LE(145589, 230393);
-    CHECK_GT(965632, 802540);
-    REQUIRE_GT(965632, 802540);
-    CHECK_LT(802540, 965632);
-    REQUIRE_LT(802540, 965632);
-    CHECK_GE(965632, 802540);
-    REQUIRE_GE(965632, 802540);
-    CHECK_LT(18714, 229308);
-    REQUIRE_LT(18714, 229308);
-    CHECK_GT(229308, 18714);
-    REQUIRE_GT(229308, 18714);
-    CHECK_LE(18714, 229308);
-    REQUIRE_LE(18714, 229308);
-    CHECK_LT(442268, 454122);
-    REQUIRE_LT(442268, 454122);
-    CHECK_GT(454122, 442268);
-    REQUIRE_GT(454122, 442268);
-    CHECK_LE(442268, 454122);
-    REQUIRE_LE(442268, 454122);
-    CHECK_LT(466160, 780918);
-    REQUIRE_LT(466160, 780918);
-    CHECK_GT(780918, 466160);
-    REQUIRE_GT(780918, 466160);
-    CHECK_LE(466160, 780918);
-    REQUIRE_LE(466160, 780918);
-    CHECK_LT(715025, 914326);
-    REQUIRE_LT(715025, 914326);
-    CHECK_GT(914326, 715025);
-    REQUIRE_GT(914326, 715025);
-    CHECK_LE(715025, 914326);
-    REQUIRE_LE(715025, 914326);
-    CHECK_GT(671955, 177890);
-    REQUIRE_GT(671955, 177890);
-    CHECK_LT(177890, 671955);
-    REQUIRE_LT(177890, 671955);
-    CHECK_GE(671955, 177890);
-    REQUIRE_GE(671955, 177890);
-    CHECK_LT(157101, 869672);
-    REQUIRE_LT(157101, 869672);
-    CHECK_GT(869672, 157101);
-    REQUIRE_GT(869672, 157101);
-    CHECK_LE(157101, 869672);
-    REQUIRE_LE(157101, 869672);
-    CHECK_GT(372089, 343768);
-    REQUIRE_GT(372089, 343768);
-    CHECK_LT(343768, 372089);
-    REQUIRE_LT(343768, 372089);
-    CHECK_GE(372089, 343768);
-    REQUIRE_GE(372089, 343768);
-    CHECK_GT(635266, 216791);
-    REQUIRE_GT(635266, 216791);
-    CHECK_LT(216791, 635266);
-    REQUIRE_LT(216791, 635266);
-    CHECK_GE(635266, 216791);
-    REQUIRE_GE(635266, 216791);
-    CHECK_GT(792195, 535304);
-    REQUIRE_GT(792195, 535304);
-    CHECK_LT(535304, 792195);
-    REQUIRE_LT(535304, 792195);
-    CHECK_GE(792195, 535304);
-    REQUIRE_GE(792195, 535304);
-    CHECK_LT(690310, 881046);
-    REQUIRE_LT(690310, 881046);
-    CHECK_GT(881046, 690310);
-    REQUIRE_GT(881046, 690310);
-    CHECK_LE(690310, 881046);
-    REQUIRE_LE(690310, 881046);
-    CHECK_GT(754980, 59897);
-    REQUIRE_GT(754980, 59897);
-    CHECK_LT(59897, 754980);
-    REQUIRE_LT(59897, 754980);
-    CHECK_GE(754980, 59897);
-    REQUIRE_GE(754980, 59897);
-    CHECK_GT(786781, 592372);
-    REQUIRE_GT(786781, 592372);
-    CHECK_LT(592372, 786781);
-    REQUIRE_LT(592372, 786781);
-    CHECK_GE(786781, 592372);
-    REQUIRE_GE(786781, 592372);
-    CHECK_LT(21707, 369356);
-    REQUIRE_LT(21707, 369356);
-    CHECK_GT(369356, 21707);
-    REQUIRE_GT(369356, 21707);
-    CHECK_LE(21707, 369356);
-    REQUIRE_LE(21707, 369356);
-    CHECK_GT(738495, 294129);
-    REQUIRE_GT(738495, 294129);
-    CHECK_LT(294129, 738495);
-    REQUIRE_LT(294129, 738495);
-    CHECK_GE(738495, 294129);
-    REQUIRE_GE(738495, 294129);
-    CHECK_LT(465560, 524640);
-    REQUIRE_LT(465560, 524640);
-    CHECK_GT(524640, 465560);
-    REQUIRE_GT(524640, 465560);
-    CHECK_LE(465560, 524640);
-    REQUIRE_LE(465560, 524640);
-    CHECK_LT(568444, 840530);
-    REQUIRE_LT(568444, 840530);
-    CHECK_GT(840530, 568444);
-    REQUIRE_GT(840530, 568444);
-    CHECK_LE(568444, 840530);
-    REQUIRE_LE(568444, 840530);
-    CHECK_GT(827431, 483036);
-    REQUIRE_GT(827431, 483036);
-    CHECK_LT(483036, 827431);
-    REQUIRE_LT(483036, 827431);
-    CHECK_GE(827431, 483036);
-    REQUIRE_GE(827431, 483036);
-    CHECK_GT(972855, 266451);
-    REQUIRE_GT(972855, 266451);
-    CHECK_LT(266451, 972855);
-    REQUIRE_LT(266451, 972855);
-    CHECK_GE(972855, 266451);
-    REQUIRE_GE(972855, 266451);
-    CHECK_LT(96827, 325761);
-    REQUIRE_LT(96827, 325761);
-    CHECK_GT(325761, 96827);
-    REQUIRE_GT(325761, 96827);
-    CHECK_LE(96827, 325761);
-    REQUIRE_LE(96827, 325761);
-    CHECK_GT(667296, 598689);
-    REQUIRE_GT(667296, 598689);
-    CHECK_LT(598689, 667296);
-    REQUIRE_LT(598689, 667296);
-    CHECK_GE(667296, 598689);
-    REQUIRE_GE(667296, 598689);
-    CHECK_GT(958144, 221375);
-    REQUIRE_GT(958144, 221375);
-    CHECK_LT(221375, 958144);
-    REQUIRE_LT(221375, 958144);
-    CHECK_GE(958144, 221375);
-    REQUIRE_GE(958144, 221375);
-    CHECK_GT(678487, 426400);
-    REQUIRE_GT(678487, 426400);
-    CHECK_LT(426400, 678487);
-    REQUIRE_LT(426400, 678487);
-    CHECK_GE(678487, 426400);
-    REQUIRE_GE(678487, 426400);
-    CHECK_LT(837058, 947321);
-    REQUIRE_LT(837058, 947321);
-    CHECK_GT(947321, 837058);
-    REQUIRE_GT(947321, 837058);
-    CHECK_LE(837058, 947321);
-    REQUIRE_LE(837058, 947321);
-    CHECK_GT(946877, 293186);
-    REQUIRE_GT(946877, 293186);
-    CHECK_LT(293186, 946877);
-    REQUIRE_LT(293186, 946877);
-    CHECK_GE(946877, 293186);
-    REQUIRE_GE(946877, 293186);
-    CHECK_GT(964212, 957642);
-    REQUIRE_GT(964212, 957642);
-    CHECK_LT(957642, 964212);
-    REQUIRE_LT(957642, 964212);
-    CHECK_GE(964212, 957642);
-    REQUIRE_GE(964212, 957642);
-    CHECK_LT(9694, 397193);
-    REQUIRE_LT(9694, 397193);
-    CHECK_GT(397193, 9694);
-    REQUIRE_GT(397193, 9694);
-    CHECK_LE(9694, 397193);
-    REQUIRE_LE(9694, 397193);
-    CHECK_LT(194975, 887706);
-    REQUIRE_LT(194975, 887706);
-    CHECK_GT(887706, 194975);
-    REQUIRE_GT(887706, 194975);
-    CHECK_LE(194975, 887706);
-    REQUIRE_LE(194975, 887706);
-    CHECK_LT(195995, 358141);
-    REQUIRE_LT(195995, 358141);
-    CHECK_GT(358141, 195995);
-    REQUIRE_GT(358141, 195995);
-    CHECK_LE(195995, 358141);
-    REQUIRE_LE(195995, 358141);
-    CHECK_GT(211086, 155622);
-    REQUIRE_GT(211086, 155622);
-    CHECK_LT(155622, 211086);
-    REQUIRE_LT(155622, 211086);
-    CHECK_GE(211086, 155622);
-    REQUIRE_GE(211086, 155622);
-    CHECK_GT(808469, 102663);
-    REQUIRE_GT(808469, 102663);
-    CHECK_LT(102663, 808469);
-    REQUIRE_LT(102663, 808469);
-    CHECK_GE(808469, 102663);
-    REQUIRE_GE(808469, 102663);
-    CHECK_LT(663860, 963561);
-    REQUIRE_LT(663860, 963561);
-    CHECK_GT(963561, 663860);
-    REQUIRE_GT(963561, 663860);
-    CHECK_LE(663860, 963561);
-    REQUIRE_LE(663860, 963561);
-    CHECK_GT(554638, 49953);
-    REQUIRE_GT(554638, 49953);
-    CHECK_LT(49953, 554638);
-    REQUIRE_LT(49953, 554638);
-    CHECK_GE(554638, 49953);
-    REQUIRE_GE(554638, 49953);
-    CHECK_LT(15309, 781943);
-    REQUIRE_LT(15309, 781943);
-    CHECK_GT(781943, 15309);
-    REQUIRE_GT(781943, 15309);
-    CHECK_LE(15309, 781943);
-    REQUIRE_LE(15309, 781943);
-    CHECK_LT(296450, 899234);
-    REQUIRE_LT(296450, 899234);
-    CHECK_GT(899234, 296450);
-    REQUIRE_GT(899234, 296450);
-    CHECK_LE(296450, 899234);
-    REQUIRE_LE(296450, 899234);
-    CHECK_LT(206053, 667252);
-    REQUIRE_LT(206053, 667252);
-    CHECK_GT(667252, 206053);
-    REQUIRE_GT(667252, 206053);
-    CHECK_LE(206053, 667252);
-    REQUIRE_LE(206053, 667252);
-    CHECK_LT(687743, 712660);
-    REQUIRE_LT(687743, 712660);
-    CHECK_GT(712660, 687743);
-    REQUIRE_GT(712660, 687743);
-    CHECK_LE(687743, 712660);
-    REQUIRE_LE(687743, 712660);
-    CHECK_GT(337631, 280201);
-    REQUIRE_GT(337631, 280201);
-    CHECK_LT(280201, 337631);
-    REQUIRE_LT(280201, 337631);
-    CHECK_GE(337631, 280201);
-    REQUIRE_GE(337631, 280201);
-    CHECK_LT(852821, 916787);
-    REQUIRE_LT(852821, 916787);
-    CHECK_GT(916787, 852821);
-    REQUIRE_GT(916787, 852821);
-    CHECK_LE(852821, 916787);
-    REQUIRE_LE(852821, 916787);
-    CHECK_GT(775842, 9309);
-    REQUIRE_GT(775842, 9309);
-    CHECK_LT(9309, 775842);
-    REQUIRE_LT(9309, 775842);
-    CHECK_GE(775842, 9309);
-    REQUIRE_GE(775842, 9309);
-    CHECK_LT(241654, 461330);
-    REQUIRE_LT(241654, 461330);
-    CHECK_GT(461330, 241654);
-    REQUIRE_GT(461330, 241654);
-    CHECK_LE(241654, 461330);
-    REQUIRE_LE(241654, 461330);
-    CHECK_LT(146716, 588973);
-    REQUIRE_LT(146716, 588973);
-    CHECK_GT(588973, 146716);
-    REQUIRE_GT(588973, 146716);
-    CHECK_LE(146716, 588973);
-    REQUIRE_LE(146716, 588973);
-    CHECK_LT(47477, 645008);
-    REQUIRE_LT(47477, 645008);
-    CHECK_GT(645008, 47477);
-    REQUIRE_GT(645008, 47477);
-    CHECK_LE(47477, 645008);
-    REQUIRE_LE(47477, 645008);
-    CHECK_GT(208770, 195447);
-    REQUIRE_GT(208770, 195447);
-    CHECK_LT(195447, 208770);
-    REQUIRE_LT(195447, 208770);
-    CHECK_GE(208770, 195447);
-    REQUIRE_GE(208770, 195447);
-    CHECK_GT(730517, 267140);
-    REQUIRE_GT(730517, 267140);
-    CHECK_LT(267140, 730517);
-    REQUIRE_LT(267140, 730517);
-    CHECK_GE(730517, 267140);
-    REQUIRE_GE(730517, 267140);
-    CHECK_LT(95616, 732116);
-    REQUIRE_LT(95616, 732116);
-    CHECK_GT(732116, 95616);
-    REQUIRE_GT(732116, 95616);
-    CHECK_LE(95616, 732116);
-    REQUIRE_LE(95616, 732116);
-    CHECK_GT(514274, 179571);
-    REQUIRE_GT(514274, 179571);
-    CHECK_LT(179571, 514274);
-    REQUIRE_LT(179571, 514274);
-    CHECK_GE(514274, 179571);
-    REQUIRE_GE(514274, 179571);
-    CHECK_GT(696191, 439524);
-    REQUIRE_GT(696191, 439524);
-    CHECK_LT(439524, 696191);
-    REQUIRE_LT(439524, 696191);
-    CHECK_GE(696191, 439524);
-    REQUIRE_GE(696191, 439524);
-    CHECK_GT(927158, 47995);
-    REQUIRE_GT(927158, 47995);
-    CHECK_LT(47995, 927158);
-    REQUIRE_LT(47995, 927158);
-    CHECK_GE(927158, 47995);
-    REQUIRE_GE(927158, 47995);
-    CHECK_LT(872772, 905697);
-    REQUIRE_LT(872772, 905697);
-    CHECK_GT(905697, 872772);
-    REQUIRE_GT(905697, 872772);
-    CHECK_LE(872772, 905697);
-    REQUIRE_LE(872772, 905697);
-    CHECK_GT(359977, 107519);
-    REQUIRE_GT(359977, 107519);
-    CHECK_LT(107519, 359977);
-    REQUIRE_LT(107519, 359977);
-    CHECK_GE(359977, 107519);
-    REQUIRE_GE(359977, 107519);
-    CHECK_GT(515750, 91724);
-    REQUIRE_GT(515750, 91724);
-    CHECK_LT(91724, 515750);
-    REQUIRE_LT(91724, 515750);
-    CHECK_GE(515750, 91724);
-    REQUIRE_GE(515750, 91724);
-    CHECK_LT(235442, 704242);
-    REQUIRE_LT(235442, 704242);
-    CHECK_GT(704242, 235442);
-    REQUIRE_GT(704242, 235442);
-    CHECK_LE(235442, 704242);
-    REQUIRE_LE(235442, 704242);
-    CHECK_LT(47191, 115327);
-    REQUIRE_LT(47191, 115327);
-    CHECK_GT(115327, 47191);
-    REQUIRE_GT(115327, 47191);
-    CHECK_LE(47191, 115327);
-    REQUIRE_LE(47191, 115327);
-    CHECK_GT(499095, 57198);
-    REQUIRE_GT(499095, 57198);
-    CHECK_LT(57198, 499095);
-    REQUIRE_LT(57198, 499095);
-    CHECK_GE(499095, 57198);
-    REQUIRE_GE(499095, 57198);
-    CHECK_GT(894672, 160061);
-    REQUIRE_GT(894672, 160061);
-    CHECK_LT(160061, 894672);
-    REQUIRE_LT(160061, 894672);
-    CHECK_GE(894672, 160061);
-    REQUIRE_GE(894672, 160061);
-    CHECK_LT(113478, 474944);
-    REQUIRE_LT(113478, 474944);
-    CHECK_GT(474944, 113478);
-    REQUIRE_GT(474944, 113478);
-    CHECK_LE(113478, 474944);
-    REQUIRE_LE(113478, 474944);
-    CHECK_GT(962310, 486975);
-    REQUIRE_GT(962310, 486975);
-    CHECK_LT(486975, 962310);
-    REQUIRE_LT(486975, 962310);
-    CHECK_GE(962310, 486975);
-    REQUIRE_GE(962310, 486975);
-    CHECK_GT(554888, 179819);
-    REQUIRE_GT(554888, 179819);
-    CHECK_LT(179819, 554888);
-    REQUIRE_LT(179819, 554888);
-    CHECK_GE(554888, 179819);
-    REQUIRE_GE(554888, 179819);
-    CHECK_GT(722174, 243522);
-    REQUIRE_GT(722174, 243522);
-    CHECK_LT(243522, 722174);
-    REQUIRE_LT(243522, 722174);
-    CHECK_GE(722174, 243522);
-    REQUIRE_GE(722174, 243522);
-    CHECK_GT(603184, 333706);
-    REQUIRE_GT(603184, 333706);
-    CHECK_LT(333706, 603184);
-    REQUIRE_LT(333706, 603184);
-    CHECK_GE(603184, 333706);
-    REQUIRE_GE(603184, 333706);
-    CHECK_LT(80262, 381411);
-    REQUIRE_LT(80262, 381411);
-    CHECK_GT(381411, 80262);
-    REQUIRE_GT(381411, 80262);
-    CHECK_LE(80262, 381411);
-    REQUIRE_LE(80262, 381411);
-    CHECK_LT(158378, 860729);
-    REQUIRE_LT(158378, 860729);
-    CHECK_GT(860729, 158378);
-    REQUIRE_GT(860729, 158378);
-    CHECK_LE(158378, 860729);
-    REQUIRE_LE(158378, 860729);
-    CHECK_LT(781867, 978543);
-    REQUIRE_LT(781867, 978543);
-    CHECK_GT(978543, 781867);
-    REQUIRE_GT(978543, 781867);
-    CHECK_LE(781867, 978543);
-    REQUIRE_LE(781867, 978543);
-    CHECK_LT(106163, 885154);
-    REQUIRE_LT(106163, 885154);
-    CHECK_GT(885154, 106163);
-    REQUIRE_GT(885154, 106163);
-    CHECK_LE(106163, 885154);
-    REQUIRE_LE(106163, 885154);
-    CHECK_LT(19822, 540485);
-    REQUIRE_LT(19822, 540485);
-    CHECK_GT(540485, 19822);
-    REQUIRE_GT(540485, 19822);
-    CHECK_LE(19822, 540485);
-    REQUIRE_LE(19822, 540485);
-    CHECK_GT(90976, 12797);
-    REQUIRE_GT(90976, 12797);
-    CHECK_LT(12797, 90976);
-    REQUIRE_LT(12797, 90976);
-    CHECK_GE(90976, 12797);
-    REQUIRE_GE(90976, 12797);
-    CHECK_GT(713479, 108751);
-    REQUIRE_GT(713479, 108751);
-    CHECK_LT(108751, 713479);
-    REQUIRE_LT(108751, 713479);
-    CHECK_GE(713479, 108751);
-    REQUIRE_GE(713479, 108751);
-    CHECK_GT(561650, 161251);
-    REQUIRE_GT(561650, 161251);
-    CHECK_LT(161251, 561650);
-    REQUIRE_LT(161251, 561650);
-    CHECK_GE(561650, 161251);
-    REQUIRE_GE(561650, 161251);
-    CHECK_GT(852376, 632385);
-    REQUIRE_GT(852376, 632385);
-    CHECK_LT(632385, 852376);
-    REQUIRE_LT(632385, 852376);
-    CHECK_GE(852376, 632385);
-    REQUIRE_GE(852376, 632385);
-    CHECK_LT(315083, 431941);
-    REQUIRE_LT(315083, 431941);
-    CHECK_GT(431941, 315083);
-    REQUIRE_GT(431941, 315083);
-    CHECK_LE(315083, 431941);
-    REQUIRE_LE(315083, 431941);
-    CHECK_LT(59043, 758980);
-    REQUIRE_LT(59043, 758980);
-    CHECK_GT(758980, 59043);
-    REQUIRE_GT(758980, 59043);
-    CHECK_LE(59043, 758980);
-    REQUIRE_LE(59043, 758980);
-    CHECK_GT(887552, 74118);
-    REQUIRE_GT(887552, 74118);
-    CHECK_LT(74118, 887552);
-    REQUIRE_LT(74118, 887552);
-    CHECK_GE(887552, 74118);
-    REQUIRE_GE(887552, 74118);
-    CHECK_GT(442690, 23893);
-    REQUIRE_GT(442690, 23893);
-    CHECK_LT(23893, 442690);
-    REQUIRE_LT(23893, 442690);
-    CHECK_GE(442690, 23893);
-    REQUIRE_GE(442690, 23893);
-    CHECK_LT(679691, 953833);
-    REQUIRE_LT(679691, 953833);
-    CHECK_GT(953833, 679691);
-    REQUIRE_GT(953833, 679691);
-    CHECK_LE(679691, 953833);
-    REQUIRE_LE(679691, 953833);
-    CHECK_GT(668412, 275767);
-    REQUIRE_GT(668412, 275767);
-    CHECK_LT(275767, 668412);
-    REQUIRE_LT(275767, 668412);
-    CHECK_GE(668412, 275767);
-    REQUIRE_GE(668412, 275767);
-    CHECK_LT(178958, 858238);
-    REQUIRE_LT(178958, 858238);
-    CHECK_GT(858238, 178958);
-    REQUIRE_GT(858238, 178958);
-    CHECK_LE(178958, 858238);
-    REQUIRE_LE(178958, 858238);
-    CHECK_GT(594793, 16625);
-    REQUIRE_GT(594793, 16625);
-    CHECK_LT(16625, 594793);
-    REQUIRE_LT(16625, 594793);
-    CHECK_GE(594793, 16625);
-    REQUIRE_GE(594793, 16625);
-    CHECK_LT(467751, 782899);
-    REQUIRE_LT(467751, 782899);
-    CHECK_GT(782899, 467751);
-    REQUIRE_GT(782899, 467751);
-    CHECK_LE(467751, 782899);
-    REQUIRE_LE(467751, 782899);
-    CHECK_GT(878963, 832766);
-    REQUIRE_GT(878963, 832766);
-    CHECK_LT(832766, 878963);
-    REQUIRE_LT(832766, 878963);
-    CHECK_GE(878963, 832766);
-    REQUIRE_GE(878963, 832766);
-    CHECK_LT(441736, 543718);
-    REQUIRE_LT(441736, 543718);
-    CHECK_GT(543718, 441736);
-    REQUIRE_GT(543718, 441736);
-    CHECK_LE(441736, 543718);
-    REQUIRE_LE(441736, 543718);
-    CHECK_LT(277157, 310260);
-    REQUIRE_LT(277157, 310260);
-    CHECK_GT(310260, 277157);
-    REQUIRE_GT(310260, 277157);
-    CHECK_LE(277157, 310260);
-    REQUIRE_LE(277157, 310260);
-    CHECK_GT(261911, 86304);
-    REQUIRE_GT(261911, 86304);
-    CHECK_LT(86304, 261911);
-    REQUIRE_LT(86304, 261911);
-    CHECK_GE(261911, 86304);
-    REQUIRE_GE(261911, 86304);
-    CHECK_LT(703699, 752029);
-    REQUIRE_LT(703699, 752029);
-    CHECK_GT(752029, 703699);
-    REQUIRE_GT(752029, 703699);
-    CHECK_LE(703699, 752029);
-    REQUIRE_LE(703699, 752029);
-    CHECK_LT(810110, 881415);
-    REQUIRE_LT(810110, 881415);
-    CHECK_GT(881415, 810110);
-    REQUIRE_GT(881415, 810110);
-    CHECK_LE(810110, 881415);
-    REQUIRE_LE(810110, 881415);
-    CHECK_GT(955679, 433938);
-    REQUIRE_GT(955679, 433938);
-    CHECK_LT(433938, 955679);
-    REQUIRE_LT(433938, 955679);
-    CHECK_GE(955679, 433938);
-    REQUIRE_GE(955679, 433938);
-    CHECK_GT(791965, 74271);
-    REQUIRE_GT(791965, 74271);
-    CHECK_LT(74271, 791965);
-    REQUIRE_LT(74271, 791965);
-    CHECK_GE(791965, 74271);
-    REQUIRE_GE(791965, 74271);
-    CHECK_GT(816991, 49995);
-    REQUIRE_GT(816991, 49995);
-    CHECK_LT(49995, 816991);
-    REQUIRE_LT(49995, 816991);
-    CHECK_GE(816991, 49995);
-    REQUIRE_GE(816991, 49995);
-    CHECK_LT(295632, 505249);
-    REQUIRE_LT(295632, 505249);
-    CHECK_GT(505249, 295632);
-    REQUIRE_GT(505249, 295632);
-    CHECK_LE(295632, 505249);
-    REQUIRE_LE(295632, 505249);
-    CHECK_GT(300138, 151772);
-    REQUIRE_GT(300138, 151772);
-    CHECK_LT(151772, 300138);
-    REQUIRE_LT(151772, 300138);
-    CHECK_GE(300138, 151772);
-    REQUIRE_GE(300138, 151772);
-    CHECK_GT(804348, 572055);
-    REQUIRE_GT(804348, 572055);
-    CHECK_LT(572055, 804348);
-    REQUIRE_LT(572055, 804348);
-    CHECK_GE(804348, 572055);
-    REQUIRE_GE(804348, 572055);
-    CHECK_GT(755511, 446808);
-    REQUIRE_GT(755511, 446808);
-    CHECK_LT(446808, 755511);
-    REQUIRE_LT(446808, 755511);
-    CHECK_GE(755511, 446808);
-    REQUIRE_GE(755511, 446808);
-    CHECK_GT(43206, 22810);
-    REQUIRE_GT(43206, 22810);
-    CHECK_LT(22810, 43206);
-    REQUIRE_LT(22810, 43206);
-    CHECK_GE(43206, 22810);
-    REQUIRE_GE(43206, 22810);
-    CHECK_LT(428291, 834040);
-    REQUIRE_LT(428291, 834040);
-    CHECK_GT(834040, 428291);
-    REQUIRE_GT(834040, 428291);
-    CHECK_LE(428291, 834040);
-    REQUIRE_LE(428291, 834040);
-    CHECK_GT(834170, 51222);
-    REQUIRE_GT(834170, 51222);
-    CHECK_LT(51222, 834170);
-    REQUIRE_LT(51222, 834170);
-    CHECK_GE(834170, 51222);
-    REQUIRE_GE(834170, 51222);
-    CHECK_GT(477550, 72068);
-    REQUIRE_GT(477550, 72068);
-    CHECK_LT(72068, 477550);
-    REQUIRE_LT(72068, 477550);
-    CHECK_GE(477550, 72068);
-    REQUIRE_GE(477550, 72068);
-    CHECK_GT(898834, 134386);
-    REQUIRE_GT(898834, 134386);
-    CHECK_LT(134386, 898834);
-    REQUIRE_LT(134386, 898834);
-    CHECK_GE(898834, 134386);
-    REQUIRE_GE(898834, 134386);
-    CHECK_LT(348248, 589651);
-    REQUIRE_LT(348248, 589651);
-    CHECK_GT(589651, 348248);
-    REQUIRE_GT(589651, 348248);
-    CHECK_LE(348248, 589651);
-    REQUIRE_LE(348248, 589651);
-    CHECK_LT(644499, 891953);
-    REQUIRE_LT(644499, 891953);
-    CHECK_GT(891953, 644499);
-    REQUIRE_GT(891953, 644499);
-    CHECK_LE(644499, 891953);
-    REQUIRE_LE(644499, 891953);
-    CHECK_LT(614, 214901);
-    REQUIRE_LT(614, 214901);
-    CHECK_GT(214901, 614);
-    REQUIRE_GT(214901, 614);
-    CHECK_LE(614, 214901);
-    REQUIRE_LE(614, 214901);
-    CHECK_GT(71379, 34916);
-    REQUIRE_GT(71379, 34916);
-    CHECK_LT(34916, 71379);
-    REQUIRE_LT(34916, 71379);
-    CHECK_GE(71379, 34916);
-    REQUIRE_GE(71379, 34916);
-    CHECK_LT(283953, 466723);
-    REQUIRE_LT(283953, 466723);
-    CHECK_GT(466723, 283953);
-    REQUIRE_GT(466723, 283953);
-    CHECK_LE(283953, 466723);
-    REQUIRE_LE(283953, 466723);
-    CHECK_GT(942636, 271119);
-    REQUIRE_GT(942636, 271119);
-    CHECK_LT(271119, 942636);
-    REQUIRE_LT(271119, 942636);
-    CHECK_GE(942636, 271119);
-    REQUIRE_GE(942636, 271119);
-    CHECK_GT(785867, 565216);
-    REQUIRE_GT(785867, 565216);
-    CHECK_LT(565216, 785867);
-    REQUIRE_LT(565216, 785867);
-    CHECK_GE(785867, 565216);
-    REQUIRE_GE(785867, 565216);
-    CHECK_GT(357512, 153485);
-    REQUIRE_GT(357512, 153485);
-    CHECK_LT(153485, 357512);
-    REQUIRE_LT(153485, 357512);
-    CHECK_GE(357512, 153485);
-    REQUIRE_GE(357512, 153485);
-    CHECK_LT(260301, 743995);
-    REQUIRE_LT(260301, 743995);
-    CHECK_GT(743995, 260301);
-    REQUIRE_GT(743995, 260301);
-    CHECK_LE(260301, 743995);
-    REQUIRE_LE(260301, 743995);
-    CHECK_LT(506124, 871861);
-    REQUIRE_LT(506124, 871861);
-    CHECK_GT(871861, 506124);
-    REQUIRE_GT(871861, 506124);
-    CHECK_LE(506124, 871861);
-    REQUIRE_LE(506124, 871861);
-    CHECK_LT(270659, 765215);
-    REQUIRE_LT(270659, 765215);
-    CHECK_GT(765215, 270659);
-    REQUIRE_GT(765215, 270659);
-    CHECK_LE(270659, 765215);
-    REQUIRE_LE(270659, 765215);
-    CHECK_GT(848487, 413035);
-    REQUIRE_GT(848487, 413035);
-    CHECK_LT(413035, 848487);
-    REQUIRE_LT(413035, 848487);
-    CHECK_GE(848487, 413035);
-    REQUIRE_GE(848487, 413035);
-    CHECK_GT(931610, 638082);
-    REQUIRE_GT(931610, 638082);
-    CHECK_LT(638082, 931610);
-    REQUIRE_LT(638082, 931610);
-    CHECK_GE(931610, 638082);
-    REQUIRE_GE(931610, 638082);
-    CHECK_LT(944577, 988208);
-    REQUIRE_LT(944577, 988208);
-    CHECK_GT(988208, 944577);
-    REQUIRE_GT(988208, 944577);
-    CHECK_LE(944577, 988208);
-    REQUIRE_LE(944577, 988208);
-    CHECK_GT(875701, 436363);
-    REQUIRE_GT(875701, 436363);
-    CHECK_LT(436363, 875701);
-    REQUIRE_LT(436363, 875701);
-    CHECK_GE(875701, 436363);
-    REQUIRE_GE(875701, 436363);
-    CHECK_GT(909993, 594701);
-    REQUIRE_GT(909993, 594701);
-    CHECK_LT(594701, 909993);
-    REQUIRE_LT(594701, 909993);
-    CHECK_GE(909993, 594701);
-    REQUIRE_GE(909993, 594701);
-    CHECK_LT(416723, 767851);
-    REQUIRE_LT(416723, 767851);
-    CHECK_GT(767851, 416723);
-    REQUIRE_GT(767851, 416723);
-    CHECK_LE(416723, 767851);
-    REQUIRE_LE(416723, 767851);
-    CHECK_GT(945058, 322819);
-    REQUIRE_GT(945058, 322819);
-    CHECK_LT(322819, 945058);
-    REQUIRE_LT(322819, 945058);
-    CHECK_GE(945058, 322819);
-    REQUIRE_GE(945058, 322819);
-    CHECK_GT(771748, 77317);
-    REQUIRE_GT(771748, 77317);
-    CHECK_LT(77317, 771748);
-    REQUIRE_LT(77317, 771748);
-    CHECK_GE(771748, 77317);
-    REQUIRE_GE(771748, 77317);
-    CHECK_LT(448592, 723808);
-    REQUIRE_LT(448592, 723808);
-    CHECK_GT(723808, 448592);
-    REQUIRE_GT(723808, 448592);
-    CHECK_LE(448592, 723808);
-    REQUIRE_LE(448592, 723808);
-    CHECK_GT(402002, 174970);
-    REQUIRE_GT(402002, 174970);
-    CHECK_LT(174970, 402002);
-    REQUIRE_LT(174970, 402002);
-    CHECK_GE(402002, 174970);
-    REQUIRE_GE(402002, 174970);
-    CHECK_LT(342149, 699156);
-    REQUIRE_LT(342149, 699156);
-    CHECK_GT(699156, 342149);
-    REQUIRE_GT(699156, 342149);
-    CHECK_LE(342149, 699156);
-    REQUIRE_LE(342149, 699156);
-    CHECK_LT(53517, 935243);
-    REQUIRE_LT(53517, 935243);
-    CHECK_GT(935243, 53517);
-    REQUIRE_GT(935243, 53517);
-    CHECK_LE(53517, 935243);
-    REQUIRE_LE(53517, 935243);
-    CHECK_LT(908799, 966348);
-    REQUIRE_LT(908799, 966348);
-    CHECK_GT(966348, 908799);
-    REQUIRE_GT(966348, 908799);
-    CHECK_LE(908799, 966348);
-    REQUIRE_LE(908799, 966348);
-    CHECK_LT(23998, 289058);
-    REQUIRE_LT(23998, 289058);
-    CHECK_GT(289058, 23998);
-    REQUIRE_GT(289058, 23998);
-    CHECK_LE(23998, 289058);
-    REQUIRE_LE(23998, 289058);
-    CHECK_LT(149934, 283110);
-    REQUIRE_LT(149934, 283110);
-    CHECK_GT(283110, 149934);
-    REQUIRE_GT(283110, 149934);
-    CHECK_LE(149934, 283110);
-    REQUIRE_LE(149934, 283110);
-    CHECK_GT(735062, 709089);
-    REQUIRE_GT(735062, 709089);
-    CHECK_LT(709089, 735062);
-    REQUIRE_LT(709089, 735062);
-    CHECK_GE(735062, 709089);
-    REQUIRE_GE(735062, 709089);
-    CHECK_LT(375348, 918513);
-    REQUIRE_LT(375348, 918513);
-    CHECK_GT(918513, 375348);
-    REQUIRE_GT(918513, 375348);
-    CHECK_LE(375348, 918513);
-    REQUIRE_LE(375348, 918513);
-    CHECK_GT(54577, 23712);
-    REQUIRE_GT(54577, 23712);
-    CHECK_LT(23712, 54577);
-    REQUIRE_LT(23712, 54577);
-    CHECK_GE(54577, 23712);
-    REQUIRE_GE(54577, 23712);
-    CHECK_LT(398895, 745839);
-    REQUIRE_LT(398895, 745839);
-    CHECK_GT(745839, 398895);
-    REQUIRE_GT(745839, 398895);
-    CHECK_LE(398895, 745839);
-    REQUIRE_LE(398895, 745839);
-    CHECK_GT(408650, 132293);
-    REQUIRE_GT(408650, 132293);
-    CHECK_LT(132293, 408650);
-    REQUIRE_LT(132293, 408650);
-    CHECK_GE(408650, 132293);
-    REQUIRE_GE(408650, 132293);
-    CHECK_LT(516172, 936591);
-    REQUIRE_LT(516172, 936591);
-    CHECK_GT(936591, 516172);
-    REQUIRE_GT(936591, 516172);
-    CHECK_LE(516172, 936591);
-    REQUIRE_LE(516172, 936591);
-    CHECK_GT(639905, 332563);
-    REQUIRE_GT(639905, 332563);
-    CHECK_LT(332563, 639905);
-    REQUIRE_LT(332563, 639905);
-    CHECK_GE(639905, 332563);
-    REQUIRE_GE(639905, 332563);
-    CHECK_LT(431732, 732654);
-    REQUIRE_LT(431732, 732654);
-    CHECK_GT(732654, 431732);
-    REQUIRE_GT(732654, 431732);
-    CHECK_LE(431732, 732654);
-    REQUIRE_LE(431732, 732654);
-    CHECK_LT(95276, 506138);
-    REQUIRE_LT(95276, 506138);
-    CHECK_GT(506138, 95276);
-    REQUIRE_GT(506138, 95276);
-    CHECK_LE(95276, 506138);
-    REQUIRE_LE(95276, 506138);
-    CHECK_LT(475036, 672754);
-    REQUIRE_LT(475036, 672754);
-    CHECK_GT(672754, 475036);
-    REQUIRE_GT(672754, 475036);
-    CHECK_LE(475036, 672754);
-    REQUIRE_LE(475036, 672754);
-    CHECK_GT(224920, 104188);
-    REQUIRE_GT(224920, 104188);
-    CHECK_LT(104188, 224920);
-    REQUIRE_LT(104188, 224920);
-    CHECK_GE(224920, 104188);
-    REQUIRE_GE(224920, 104188);
-    CHECK_GT(271940, 235532);
-    REQUIRE_GT(271940, 235532);
-    CHECK_LT(235532, 271940);
-    REQUIRE_LT(235532, 271940);
-    CHECK_GE(271940, 235532);
-    REQUIRE_GE(271940, 235532);
-    CHECK_LT(715021, 789353);
-    REQUIRE_LT(715021, 789353);
-    CHECK_GT(789353, 715021);
-    REQUIRE_GT(789353, 715021);
-    CHECK_LE(715021, 789353);
-    REQUIRE_LE(715021, 789353);
-    CHECK_LT(317883, 454984);
-    REQUIRE_LT(317883, 454984);
-    CHECK_GT(454984, 317883);
-    REQUIRE_GT(454984, 317883);
-    CHECK_LE(317883, 454984);
-    REQUIRE_LE(317883, 454984);
-    CHECK_GT(716972, 610746);
-    REQUIRE_GT(716972, 610746);
-    CHECK_LT(610746, 716972);
-    REQUIRE_LT(610746, 716972);
-    CHECK_GE(716972, 610746);
-    REQUIRE_GE(716972, 610746);
-    CHECK_GT(729997, 661152);
-    REQUIRE_GT(729997, 661152);
-    CHECK_LT(661152, 729997);
-    REQUIRE_LT(661152, 729997);
-    CHECK_GE(729997, 661152);
-    REQUIRE_GE(729997, 661152);
-    CHECK_LT(761580, 989512);
-    REQUIRE_LT(761580, 989512);
-    CHECK_GT(989512, 761580);
-    REQUIRE_GT(989512, 761580);
-    CHECK_LE(761580, 989512);
-    REQUIRE_LE(761580, 989512);
-    CHECK_LT(74827, 990375);
-    REQUIRE_LT(74827, 990375);
-    CHECK_GT(990375, 74827);
-    REQUIRE_GT(990375, 74827);
-    CHECK_LE(74827, 990375);
-    REQUIRE_LE(74827, 990375);
-    CHECK_GT(335036, 224911);
-    REQUIRE_GT(335036, 224911);
-    CHECK_LT(224911, 335036);
-    REQUIRE_LT(224911, 335036);
-    CHECK_GE(335036, 224911);
-    REQUIRE_GE(335036, 224911);
-    CHECK_GT(767893, 497303);
-    REQUIRE_GT(767893, 497303);
-    CHECK_LT(497303, 767893);
-    REQUIRE_LT(497303, 767893);
-    CHECK_GE(767893, 497303);
-    REQUIRE_GE(767893, 497303);
-    CHECK_LT(267252, 828259);
-    REQUIRE_LT(267252, 828259);
-    CHECK_GT(828259, 267252);
-    REQUIRE_GT(828259, 267252);
-    CHECK_LE(267252, 828259);
-    REQUIRE_LE(267252, 828259);
-    CHECK_LT(32810, 48406);
-    REQUIRE_LT(32810, 48406);
-    CHECK_GT(48406, 32810);
-    REQUIRE_GT(48406, 32810);
-    CHECK_LE(32810, 48406);
-    REQUIRE_LE(32810, 48406);
-    CHECK_LT(108394, 450669);
-    REQUIRE_LT(108394, 450669);
-    CHECK_GT(450669, 108394);
-    REQUIRE_GT(450669, 108394);
-    CHECK_LE(108394, 450669);
-    REQUIRE_LE(108394, 450669);
-    CHECK_GT(168920, 108306);
-    REQUIRE_GT(168920, 108306);
-    CHECK_LT(108306, 168920);
-    REQUIRE_LT(108306, 168920);
-    CHECK_GE(168920, 108306);
-    REQUIRE_GE(168920, 108306);
-    CHECK_LT(437572, 687728);
-    REQUIRE_LT(437572, 687728);
-    CHECK_GT(687728, 437572);
-    REQUIRE_GT(687728, 437572);
-    CHECK_LE(437572, 687728);
-    REQUIRE_LE(437572, 687728);
-    CHECK_LT(689162, 925947);
-    REQUIRE_LT(689162, 925947);
-    CHECK_GT(925947, 689162);
-    REQUIRE_GT(925947, 689162);
-    CHECK_LE(689162, 925947);
-    REQUIRE_LE(689162, 925947);
-    CHECK_LT(296089, 847134);
-    REQUIRE_LT(296089, 847134);
-    CHECK_GT(847134, 296089);
-    REQUIRE_GT(847134, 296089);
-    CHECK_LE(296089, 847134);
-    REQUIRE_LE(296089, 847134);
-    CHECK_GT(561870, 135229);
-    REQUIRE_GT(561870, 135229);
-    CHECK_LT(135229, 561870);
-    REQUIRE_LT(135229, 561870);
-    CHECK_GE(561870, 135229);
-    REQUIRE_GE(561870, 135229);
-    CHECK_GT(568614, 363150);
-    REQUIRE_GT(568614, 363150);
-    CHECK_LT(363150, 568614);
-    REQUIRE_LT(363150, 568614);
-    CHECK_GE(568614, 363150);
-    REQUIRE_GE(568614, 363150);
-    CHECK_LT(130604, 795864);
-    REQUIRE_LT(130604, 795864);
-    CHECK_GT(795864, 130604);
-    REQUIRE_GT(795864, 130604);
-    CHECK_LE(130604, 795864);
-    REQUIRE_LE(130604, 795864);
-    CHECK_GT(273210, 82932);
-    REQUIRE_GT(273210, 82932);
-    CHECK_LT(82932, 273210);
-    REQUIRE_LT(82932, 273210);
-    CHECK_GE(273210, 82932);
-    REQUIRE_GE(273210, 82932);
-    CHECK_LT(370608, 636930);
-    REQUIRE_LT(370608, 636930);
-    CHECK_GT(636930, 370608);
-    REQUIRE_GT(636930, 370608);
-    CHECK_LE(370608, 636930);
-    REQUIRE_LE(370608, 636930);
-    CHECK_GT(451619, 235255);
-    REQUIRE_GT(451619, 235255);
-    CHECK_LT(235255, 451619);
-    REQUIRE_LT(235255, 451619);
-    CHECK_GE(451619, 235255);
-    REQUIRE_GE(451619, 235255);
-    CHECK_LT(706639, 982008);
-    REQUIRE_LT(706639, 982008);
-    CHECK_GT(982008, 706639);
-    REQUIRE_GT(982008, 706639);
-    CHECK_LE(706639, 982008);
-    REQUIRE_LE(706639, 982008);
-    CHECK_GT(659004, 410558);
-    REQUIRE_GT(659004, 410558);
-    CHECK_LT(410558, 659004);
-    REQUIRE_LT(410558, 659004);
-    CHECK_GE(659004, 410558);
-    REQUIRE_GE(659004, 410558);
-    CHECK_GT(599956, 512694);
-    REQUIRE_GT(599956, 512694);
-    CHECK_LT(512694, 599956);
-    REQUIRE_LT(512694, 599956);
-    CHECK_GE(599956, 512694);
-    REQUIRE_GE(599956, 512694);
-    CHECK_LT(45829, 258502);
-    REQUIRE_LT(45829, 258502);
-    CHECK_GT(258502, 45829);
-    REQUIRE_GT(258502, 45829);
-    CHECK_LE(45829, 258502);
-    REQUIRE_LE(45829, 258502);
-    CHECK_LT(437866, 855905);
-    REQUIRE_LT(437866, 855905);
-    CHECK_GT(855905, 437866);
-    REQUIRE_GT(855905, 437866);
-    CHECK_LE(437866, 855905);
-    REQUIRE_LE(437866, 855905);
-    CHECK_GT(606849, 108672);
-    REQUIRE_GT(606849, 108672);
-    CHECK_LT(108672, 606849);
-    REQUIRE_LT(108672, 606849);
-    CHECK_GE(606849, 108672);
-    REQUIRE_GE(606849, 108672);
-    CHECK_GT(718697, 59117);
-    REQUIRE_GT(718697, 59117);
-    CHECK_LT(59117, 718697);
-    REQUIRE_LT(59117, 718697);
-    CHECK_GE(718697, 59117);
-    REQUIRE_GE(718697, 59117);
-    CHECK_LT(425717, 679949);
-    REQUIRE_LT(425717, 679949);
-    CHECK_GT(679949, 425717);
-    REQUIRE_GT(679949, 425717);
-    CHECK_LE(425717, 679949);
-    REQUIRE_LE(425717, 679949);
-    CHECK_GT(519028, 106702);
-    REQUIRE_GT(519028, 106702);
-    CHECK_LT(106702, 519028);
-    REQUIRE_LT(106702, 519028);
-    CHECK_GE(519028, 106702);
-    REQUIRE_GE(519028, 106702);
-    CHECK_LT(273698, 707820);
-    REQUIRE_LT(273698, 707820);
-    CHECK_GT(707820, 273698);
-    REQUIRE_GT(707820, 273698);
-    CHECK_LE(273698, 707820);
-    REQUIRE_LE(273698, 707820);
-    CHECK_LT(547248, 922371);
-    REQUIRE_LT(547248, 922371);
-    CHECK_GT(922371, 547248);
-    REQUIRE_GT(922371, 547248);
-    CHECK_LE(547248, 922371);
-    REQUIRE_LE(547248, 922371);
-    CHECK_LT(545294, 645133);
-    REQUIRE_LT(545294, 645133);
-    CHECK_GT(645133, 545294);
-    REQUIRE_GT(645133, 545294);
-    CHECK_LE(545294, 645133);
-    REQUIRE_LE(545294, 645133);
-    CHECK_GT(844926, 816678);
-    REQUIRE_GT(844926, 816678);
-    CHECK_LT(816678, 844926);
-    REQUIRE_LT(816678, 844926);
-    CHECK_GE(844926, 816678);
-    REQUIRE_GE(844926, 816678);
-    CHECK_GT(335400, 293754);
-    REQUIRE_GT(335400, 293754);
-    CHECK_LT(293754, 335400);
-    REQUIRE_LT(293754, 335400);
-    CHECK_GE(335400, 293754);
-    REQUIRE_GE(335400, 293754);
-    CHECK_LT(401231, 516543);
-    REQUIRE_LT(401231, 516543);
-    CHECK_GT(516543, 401231);
-    REQUIRE_GT(516543, 401231);
-    CHECK_LE(401231, 516543);
-    REQUIRE_LE(401231, 516543);
-    CHECK_GT(666773, 552325);
-    REQUIRE_GT(666773, 552325);
-    CHECK_LT(552325, 666773);
-    REQUIRE_LT(552325, 666773);
-    CHECK_GE(666773, 552325);
-    REQUIRE_GE(666773, 552325);
-    CHECK_GT(628789, 4766);
-    REQUIRE_GT(628789, 4766);
-    CHECK_LT(4766, 628789);
-    REQUIRE_LT(4766, 628789);
-    CHECK_GE(628789, 4766);
-    REQUIRE_GE(628789, 4766);
-    CHECK_GT(819217, 630542);
-    REQUIRE_GT(819217, 630542);
-    CHECK_LT(630542, 819217);
-    REQUIRE_LT(630542, 819217);
-    CHECK_GE(819217, 630542);
-    REQUIRE_GE(819217, 630542);
-    CHECK_GT(906354, 47182);
-    REQUIRE_GT(906354, 47182);
-    CHECK_LT(47182, 906354);
-    REQUIRE_LT(47182, 906354);
-    CHECK_GE(906354, 47182);
-    REQUIRE_GE(906354, 47182);
-    CHECK_LT(762960, 894378);
-    REQUIRE_LT(762960, 894378);
-    CHECK_GT(894378, 762960);
-    REQUIRE_GT(894378, 762960);
-    CHECK_LE(762960, 894378);
-    REQUIRE_LE(762960, 894378);
-    CHECK_LT(108039, 548672);
-    REQUIRE_LT(108039, 548672);
-    CHECK_GT(548672, 108039);
-    REQUIRE_GT(548672, 108039);
-    CHECK_LE(108039, 548672);
-    REQUIRE_LE(108039, 548672);
-    CHECK_GT(584081, 124588);
-    REQUIRE_GT(584081, 124588);
-    CHECK_LT(124588, 584081);
-    REQUIRE_LT(124588, 584081);
-    CHECK_GE(584081, 124588);
-    REQUIRE_GE(584081, 124588);
-    CHECK_GT(558413, 423035);
-    REQUIRE_GT(558413, 423035);
-    CHECK_LT(423035, 558413);
-    REQUIRE_LT(423035, 558413);
-    CHECK_GE(558413, 423035);
-    REQUIRE_GE(558413, 423035);
-    CHECK_LT(105033, 597422);
-    REQUIRE_LT(105033, 597422);
-    CHECK_GT(597422, 105033);
-    REQUIRE_GT(597422, 105033);
-    CHECK_LE(105033, 597422);
-    REQUIRE_LE(105033, 597422);
-    CHECK_LT(4765, 687165);
-    REQUIRE_LT(4765, 687165);
-    CHECK_GT(687165, 4765);
-    REQUIRE_GT(687165, 4765);
-    CHECK_LE(4765, 687165);
-    REQUIRE_LE(4765, 687165);
-    CHECK_LT(328084, 769463);
-    REQUIRE_LT(328084, 769463);
-    CHECK_GT(769463, 328084);
-    REQUIRE_GT(769463, 328084);
-    CHECK_LE(328084, 769463);
-    REQUIRE_LE(328084, 769463);
-    CHECK_GT(697608, 307939);
-    REQUIRE_GT(697608, 307939);
-    CHECK_LT(307939, 697608);
-    REQUIRE_LT(307939, 697608);
-    CHECK_GE(697608, 307939);
-    REQUIRE_GE(697608, 307939);
-    CHECK_LT(497837, 656591);
-    REQUIRE_LT(497837, 656591);
-    CHECK_GT(656591, 497837);
-    REQUIRE_GT(656591, 497837);
-    CHECK_LE(497837, 656591);
-    REQUIRE_LE(497837, 656591);
-    CHECK_GT(533050, 394224);
-    REQUIRE_GT(533050, 394224);
-    CHECK_LT(394224, 533050);
-    REQUIRE_LT(394224, 533050);
-    CHECK_GE(533050, 394224);
-    REQUIRE_GE(533050, 394224);
-    CHECK_LT(839028, 988361);
-    REQUIRE_LT(839028, 988361);
-    CHECK_GT(988361, 839028);
-    REQUIRE_GT(988361, 839028);
-    CHECK_LE(839028, 988361);
-    REQUIRE_LE(839028, 988361);
-    CHECK_LT(935064, 983308);
-    REQUIRE_LT(935064, 983308);
-    CHECK_GT(983308, 935064);
-    REQUIRE_GT(983308, 935064);
-    CHECK_LE(935064, 983308);
-    REQUIRE_LE(935064, 983308);
-    CHECK_LT(406982, 421274);
-    REQUIRE_LT(406982, 421274);
-    CHECK_GT(421274, 406982);
-    REQUIRE_GT(421274, 406982);
-    CHECK_LE(406982, 421274);
-    REQUIRE_LE(406982, 421274);
-    CHECK_GT(496306, 283318);
-    REQUIRE_GT(496306, 283318);
-    CHECK_LT(283318, 496306);
-    REQUIRE_LT(283318, 496306);
-    CHECK_GE(496306, 283318);
-    REQUIRE_GE(496306, 283318);
-    CHECK_GT(754413, 337881);
-    REQUIRE_GT(754413, 337881);
-    CHECK_LT(337881, 754413);
-    REQUIRE_LT(337881, 754413);
-    CHECK_GE(754413, 337881);
-    REQUIRE_GE(754413, 337881);
-    CHECK_LT(323393, 429782);
-    REQUIRE_LT(323393, 429782);
-    CHECK_GT(429782, 323393);
-    REQUIRE_GT(429782, 323393);
-    CHECK_LE(323393, 429782);
-    REQUIRE_LE(323393, 429782);
-    CHECK_GT(995656, 472563);
-    REQUIRE_GT(995656, 472563);
-    CHECK_LT(472563, 995656);
-    REQUIRE_LT(472563, 995656);
-    CHECK_GE(995656, 472563);
-    REQUIRE_GE(995656, 472563);
-    CHECK_LT(64010, 202298);
-    REQUIRE_LT(64010, 202298);
-    CHECK_GT(202298, 64010);
-    REQUIRE_GT(202298, 64010);
-    CHECK_LE(64010, 202298);
-    REQUIRE_LE(64010, 202298);
-    CHECK_LT(404373, 809048);
-    REQUIRE_LT(404373, 809048);
-    CHECK_GT(809048, 404373);
-    REQUIRE_GT(809048, 404373);
-    CHECK_LE(404373, 809048);
-    REQUIRE_LE(404373, 809048);
-    CHECK_GT(893299, 486608);
-    REQUIRE_GT(893299, 486608);
-    CHECK_LT(486608, 893299);
-    REQUIRE_LT(486608, 893299);
-    CHECK_GE(893299, 486608);
-    REQUIRE_GE(893299, 486608);
-    CHECK_LT(308328, 906494);
-    REQUIRE_LT(308328, 906494);
-    CHECK_GT(906494, 308328);
-    REQUIRE_GT(906494, 308328);
-    CHECK_LE(308328, 906494);
-    REQUIRE_LE(308328, 906494);
-    CHECK_LT(29621, 164390);
-    REQUIRE_LT(29621, 164390);
-    CHECK_GT(164390, 29621);
-    REQUIRE_GT(164390, 29621);
-    CHECK_LE(29621, 164390);
-    REQUIRE_LE(29621, 164390);
-    CHECK_GT(729698, 11720);
-    REQUIRE_GT(729698, 11720);
-    CHECK_LT(11720, 729698);
-    REQUIRE_LT(11720, 729698);
-    CHECK_GE(729698, 11720);
-    REQUIRE_GE(729698, 11720);
-    CHECK_GT(860357, 807550);
-    REQUIRE_GT(860357, 807550);
-    CHECK_LT(807550, 860357);
-    REQUIRE_LT(807550, 860357);
-    CHECK_GE(860357, 807550);
-    REQUIRE_GE(860357, 807550);
-    CHECK_GT(967378, 58742);
-    REQUIRE_GT(967378, 58742);
-    CHECK_LT(58742, 967378);
-    REQUIRE_LT(58742, 967378);
-    CHECK_GE(967378, 58742);
-    REQUIRE_GE(967378, 58742);
-    CHECK_LT(209807, 957005);
-    REQUIRE_LT(209807, 957005);
-    CHECK_GT(957005, 209807);
-    REQUIRE_GT(957005, 209807);
-    CHECK_LE(209807, 957005);
-    REQUIRE_LE(209807, 957005);
-    CHECK_LT(56067, 977929);
-    REQUIRE_LT(56067, 977929);
-    CHECK_GT(977929, 56067);
-    REQUIRE_GT(977929, 56067);
-    CHECK_LE(56067, 977929);
-    REQUIRE_LE(56067, 977929);
-    CHECK_LT(481411, 594755);
-    REQUIRE_LT(481411, 594755);
-    CHECK_GT(594755, 481411);
-    REQUIRE_GT(594755, 481411);
-    CHECK_LE(481411, 594755);
-    REQUIRE_LE(481411, 594755);
-    CHECK_GT(669910, 170050);
-    REQUIRE_GT(669910, 170050);
-    CHECK_LT(170050, 669910);
-    REQUIRE_LT(170050, 669910);
-    CHECK_GE(669910, 170050);
-    REQUIRE_GE(669910, 170050);
-    CHECK_LT(78766, 706457);
-    REQUIRE_LT(78766, 706457);
-    CHECK_GT(706457, 78766);
-    REQUIRE_GT(706457, 78766);
-    CHECK_LE(78766, 706457);
-    REQUIRE_LE(78766, 706457);
-    CHECK_GT(698688, 344650);
-    REQUIRE_GT(698688, 344650);
-    CHECK_LT(344650, 698688);
-    REQUIRE_LT(344650, 698688);
-    CHECK_GE(698688, 344650);
-    REQUIRE_GE(698688, 344650);
-    CHECK_GT(798556, 374278);
-    REQUIRE_GT(798556, 374278);
-    CHECK_LT(374278, 798556);
-    REQUIRE_LT(374278, 798556);
-    CHECK_GE(798556, 374278);
-    REQUIRE_GE(798556, 374278);
-    CHECK_LT(5192, 633103);
-    REQUIRE_LT(5192, 633103);
-    CHECK_GT(633103, 5192);
-    REQUIRE_GT(633103, 5192);
-    CHECK_LE(5192, 633103);
-    REQUIRE_LE(5192, 633103);
-    CHECK_LT(129031, 777112);
-    REQUIRE_LT(129031, 777112);
-    CHECK_GT(777112, 129031);
-    REQUIRE_GT(777112, 129031);
-    CHECK_LE(129031, 777112);
-    REQUIRE_LE(129031, 777112);
-    CHECK_LT(30527, 262690);
-    REQUIRE_LT(30527, 262690);
-    CHECK_GT(262690, 30527);
-    REQUIRE_GT(262690, 30527);
-    CHECK_LE(30527, 262690);
-    REQUIRE_LE(30527, 262690);
-    CHECK_LT(499158, 746182);
-    REQUIRE_LT(499158, 746182);
-    CHECK_GT(746182, 499158);
-    REQUIRE_GT(746182, 499158);
-    CHECK_LE(499158, 746182);
-    REQUIRE_LE(499158, 746182);
-    CHECK_LT(742903, 902868);
-    REQUIRE_LT(742903, 902868);
-    CHECK_GT(902868, 742903);
-    REQUIRE_GT(902868, 742903);
-    CHECK_LE(742903, 902868);
-    REQUIRE_LE(742903, 902868);
-    CHECK_LT(377873, 474544);
-    REQUIRE_LT(377873, 474544);
-    CHECK_GT(474544, 377873);
-    REQUIRE_GT(474544, 377873);
-    CHECK_LE(377873, 474544);
-    REQUIRE_LE(377873, 474544);
-    CHECK_LT(231603, 474551);
-    REQUIRE_LT(231603, 474551);
-    CHECK_GT(474551, 231603);
-    REQUIRE_GT(474551, 231603);
-    CHECK_LE(231603, 474551);
-    REQUIRE_LE(231603, 474551);
-    CHECK_GT(370921, 315278);
-    REQUIRE_GT(370921, 315278);
-    CHECK_LT(315278, 370921);
-    REQUIRE_LT(315278, 370921);
-    CHECK_GE(370921, 315278);
-    REQUIRE_GE(370921, 315278);
-    CHECK_LT(22739, 549441);
-    REQUIRE_LT(22739, 549441);
-    CHECK_GT(549441, 22739);
-    REQUIRE_GT(549441, 22739);
-    CHECK_LE(22739, 549441);
-    REQUIRE_LE(22739, 549441);
-    CHECK_LT(636152, 835749);
-    REQUIRE_LT(636152, 835749);
-    CHECK_GT(835749, 636152);
-    REQUIRE_GT(835749, 636152);
-    CHECK_LE(636152, 835749);
-    REQUIRE_LE(636152, 835749);
-    CHECK_GT(673137, 310150);
-    REQUIRE_GT(673137, 310150);
-    CHECK_LT(310150, 673137);
-    REQUIRE_LT(310150, 673137);
-    CHECK_GE(673137, 310150);
-    REQUIRE_GE(673137, 310150);
-    CHECK_GT(440872, 159216);
-    REQUIRE_GT(440872, 159216);
-    CHECK_LT(159216, 440872);
-    REQUIRE_LT(159216, 440872);
-    CHECK_GE(440872, 159216);
-    REQUIRE_GE(440872, 159216);
-    CHECK_LT(938628, 950384);
-    REQUIRE_LT(938628, 950384);
-    CHECK_GT(950384, 938628);
-    REQUIRE_GT(950384, 938628);
-    CHECK_LE(938628, 950384);
-    REQUIRE_LE(938628, 950384);
-    CHECK_LT(510173, 885404);
-    REQUIRE_LT(510173, 885404);
-    CHECK_GT(885404, 510173);
-    REQUIRE_GT(885404, 510173);
-    CHECK_LE(510173, 885404);
-    REQUIRE_LE(510173, 885404);
-    CHECK_GT(554252, 470126);
-    REQUIRE_GT(554252, 470126);
-    CHECK_LT(470126, 554252);
-    REQUIRE_LT(470126, 554252);
-    CHECK_GE(554252, 470126);
-    REQUIRE_GE(554252, 470126);
-    CHECK_LT(118696, 146567);
-    REQUIRE_LT(118696, 146567);
-    CHECK_GT(146567, 118696);
-    REQUIRE_GT(146567, 118696);
-    CHECK_LE(118696, 146567);
-    REQUIRE_LE(118696, 146567);
-    CHECK_LT(169000, 723066);
-    REQUIRE_LT(169000, 723066);
-    CHECK_GT(723066, 169000);
-    REQUIRE_GT(723066, 169000);
-    CHECK_LE(169000, 723066);
-    REQUIRE_LE(169000, 723066);
-    CHECK_LT(428910, 700374);
-    REQUIRE_LT(428910, 700374);
-    CHECK_GT(700374, 428910);
-    REQUIRE_GT(700374, 428910);
-    CHECK_LE(428910, 700374);
-    REQUIRE_LE(428910, 700374);
-    CHECK_LT(756320, 979304);
-    REQUIRE_LT(756320, 979304);
-    CHECK_GT(979304, 756320);
-    REQUIRE_GT(979304, 756320);
-    CHECK_LE(756320, 979304);
-    REQUIRE_LE(756320, 979304);
-    CHECK_LT(20743, 471039);
-    REQUIRE_LT(20743, 471039);
-    CHECK_GT(471039, 20743);
-    REQUIRE_GT(471039, 20743);
-    CHECK_LE(20743, 471039);
-    REQUIRE_LE(20743, 471039);
-    CHECK_GT(385853, 118753);
-    REQUIRE_GT(385853, 118753);
-    CHECK_LT(118753, 385853);
-    REQUIRE_LT(118753, 385853);
-    CHECK_GE(385853, 118753);
-    REQUIRE_GE(385853, 118753);
-    CHECK_GT(781271, 613821);
-    REQUIRE_GT(781271, 613821);
-    CHECK_LT(613821, 781271);
-    REQUIRE_LT(613821, 781271);
-    CHECK_GE(781271, 613821);
-    REQUIRE_GE(781271, 613821);
-    CHECK_LT(797156, 842760);
-    REQUIRE_LT(797156, 842760);
-    CHECK_GT(842760, 797156);
-    REQUIRE_GT(842760, 797156);
-    CHECK_LE(797156, 842760);
-    REQUIRE_LE(797156, 842760);
-    CHECK_GT(880767, 2896);
-    REQUIRE_GT(880767, 2896);
-    CHECK_LT(2896, 880767);
-    REQUIRE_LT(2896, 880767);
-    CHECK_GE(880767, 2896);
-    REQUIRE_GE(880767, 2896);
-    CHECK_LT(73091, 292088);
-    REQUIRE_LT(73091, 292088);
-    CHECK_GT(292088, 73091);
-    REQUIRE_GT(292088, 73091);
-    CHECK_LE(73091, 292088);
-    REQUIRE_LE(73091, 292088);
-    CHECK_LT(14659, 983122);
-    REQUIRE_LT(14659, 983122);
-    CHECK_GT(983122, 14659);
-    REQUIRE_GT(983122, 14659);
-    CHECK_LE(14659, 983122);
-    REQUIRE_LE(14659, 983122);
-    CHECK_GT(713994, 532447);
-    REQUIRE_GT(713994, 532447);
-    CHECK_LT(532447, 713994);
-    REQUIRE_LT(532447, 713994);
-    CHECK_GE(713994, 532447);
-    REQUIRE_GE(713994, 532447);
-    CHECK_LT(65481, 811117);
-    REQUIRE_LT(65481, 811117);
-    CHECK_GT(811117, 65481);
-    REQUIRE_GT(811117, 65481);
-    CHECK_LE(65481, 811117);
-    REQUIRE_LE(65481, 811117);
-    CHECK_GT(270454, 224865);
-    REQUIRE_GT(270454, 224865);
-    CHECK_LT(224865, 270454);
-    REQUIRE_LT(224865, 270454);
-    CHECK_GE(270454, 224865);
-    REQUIRE_GE(270454, 224865);
-    CHECK_LT(476568, 556449);
-    REQUIRE_LT(476568, 556449);
-    CHECK_GT(556449, 476568);
-    REQUIRE_GT(556449, 476568);
-    CHECK_LE(476568, 556449);
-    REQUIRE_LE(476568, 556449);
-    CHECK_GT(732076, 303146);
-    REQUIRE_GT(732076, 303146);
-    CHECK_LT(303146, 732076);
-    REQUIRE_LT(303146, 732076);
-    CHECK_GE(732076, 303146);
-    REQUIRE_GE(732076, 303146);
-    CHECK_LT(149780, 908466);
-    REQUIRE_LT(149780, 908466);
-    CHECK_GT(908466, 149780);
-    REQUIRE_GT(908466, 149780);
-    CHECK_LE(149780, 908466);
-    REQUIRE_LE(149780, 908466);
-    CHECK_GT(816640, 404943);
-    REQUIRE_GT(816640, 404943);
-    CHECK_LT(404943, 816640);
-    REQUIRE_LT(404943, 816640);
-    CHECK_GE(816640, 404943);
-    REQUIRE_GE(816640, 404943);
-    CHECK_GT(972931, 488701);
-    REQUIRE_GT(972931, 488701);
-    CHECK_LT(488701, 972931);
-    REQUIRE_LT(488701, 972931);
-    CHECK_GE(972931, 488701);
-    REQUIRE_GE(972931, 488701);
-    CHECK_GT(614650, 4208);
-    REQUIRE_GT(614650, 4208);
-    CHECK_LT(4208, 614650);
-    REQUIRE_LT(4208, 614650);
-    CHECK_GE(614650, 4208);
-    REQUIRE_GE(614650, 4208);
-    CHECK_GT(676500, 322014);
-    REQUIRE_GT(676500, 322014);
-    CHECK_LT(322014, 676500);
-    REQUIRE_LT(322014, 676500);
-    CHECK_GE(676500, 322014);
-    REQUIRE_GE(676500, 322014);
-    CHECK_LT(1318, 542289);
-    REQUIRE_LT(1318, 542289);
-    CHECK_GT(542289, 1318);
-    REQUIRE_GT(542289, 1318);
-    CHECK_LE(1318, 542289);
-    REQUIRE_LE(1318, 542289);
-    CHECK_LT(19216, 879881);
-    REQUIRE_LT(19216, 879881);
-    CHECK_GT(879881, 19216);
-    REQUIRE_GT(879881, 19216);
-    CHECK_LE(19216, 879881);
-    REQUIRE_LE(19216, 879881);
-    CHECK_LT(562277, 899845);
-    REQUIRE_LT(562277, 899845);
-    CHECK_GT(899845, 562277);
-    REQUIRE_GT(899845, 562277);
-    CHECK_LE(562277, 899845);
-    REQUIRE_LE(562277, 899845);
-    CHECK_LT(143266, 290492);
-    REQUIRE_LT(143266, 290492);
-    CHECK_GT(290492, 143266);
-    REQUIRE_GT(290492, 143266);
-    CHECK_LE(143266, 290492);
-    REQUIRE_LE(143266, 290492);
-    CHECK_LT(516696, 671887);
-    REQUIRE_LT(516696, 671887);
-    CHECK_GT(671887, 516696);
-    REQUIRE_GT(671887, 516696);
-    CHECK_LE(516696, 671887);
-    REQUIRE_LE(516696, 671887);
-    CHECK_GT(809095, 229634);
-    REQUIRE_GT(809095, 229634);
-    CHECK_LT(229634, 809095);
-    REQUIRE_LT(229634, 809095);
-    CHECK_GE(809095, 229634);
-    REQUIRE_GE(809095, 229634);
-    CHECK_GT(901250, 500118);
-    REQUIRE_GT(901250, 500118);
-    CHECK_LT(500118, 901250);
-    REQUIRE_LT(500118, 901250);
-    CHECK_GE(901250, 500118);
-    REQUIRE_GE(901250, 500118);
-    CHECK_GT(460566, 81168);
-    REQUIRE_GT(460566, 81168);
-    CHECK_LT(81168, 460566);
-    REQUIRE_LT(81168, 460566);
-    CHECK_GE(460566, 81168);
-    REQUIRE_GE(460566, 81168);
-    CHECK_GT(178676, 155478);
-    REQUIRE_GT(178676, 155478);
-    CHECK_LT(155478, 178676);
-    REQUIRE_LT(155478, 178676);
-    CHECK_GE(178676, 155478);
-    REQUIRE_GE(178676, 155478);
-    CHECK_GT(976248, 852871);
-    REQUIRE_GT(976248, 852871);
-    CHECK_LT(852871, 976248);
-    REQUIRE_LT(852871, 976248);
-    CHECK_GE(976248, 852871);
-    REQUIRE_GE(976248, 852871);
-    CHECK_GT(775403, 127363);
-    REQUIRE_GT(775403, 127363);
-    CHECK_LT(127363, 775403);
-    REQUIRE_LT(127363, 775403);
-    CHECK_GE(775403, 127363);
-    REQUIRE_GE(775403, 127363);
-    CHECK_LT(96228, 896277);
-    REQUIRE_LT(96228, 896277);
-    CHECK_GT(896277, 96228);
-    REQUIRE_GT(896277, 96228);
-    CHECK_LE(96228, 896277);
-    REQUIRE_LE(96228, 896277);
-    CHECK_GT(374465, 217381);
-    REQUIRE_GT(374465, 217381);
-    CHECK_LT(217381, 374465);
-    REQUIRE_LT(217381, 374465);
-    CHECK_GE(374465, 217381);
-    REQUIRE_GE(374465, 217381);
-    CHECK_LT(193583, 422140);
-    REQUIRE_LT(193583, 422140);
-    CHECK_GT(422140, 193583);
-    REQUIRE_GT(422140, 193583);
-    CHECK_LE(193583, 422140);
-    REQUIRE_LE(193583, 422140);
-    CHECK_LT(132267, 293981);
-    REQUIRE_LT(132267, 293981);
-    CHECK_GT(293981, 132267);
-    REQUIRE_GT(293981, 132267);
-    CHECK_LE(132267, 293981);
-    REQUIRE_LE(132267, 293981);
-    CHECK_GT(758541, 118487);
-    REQUIRE_GT(758541, 118487);
-    CHECK_LT(118487, 758541);
-    REQUIRE_LT(118487, 758541);
-    CHECK_GE(758541, 118487);
-    REQUIRE_GE(758541, 118487);
-    CHECK_LT(25420, 209944);
-    REQUIRE_LT(25420, 209944);
-    CHECK_GT(209944, 25420);
-    REQUIRE_GT(209944, 25420);
-    CHECK_LE(25420, 209944);
-    REQUIRE_LE(25420, 209944);
-    CHECK_LT(745031, 746065);
-    REQUIRE_LT(745031, 746065);
-    CHECK_GT(746065, 745031);
-    REQUIRE_GT(746065, 745031);
-    CHECK_LE(745031, 746065);
-    REQUIRE_LE(745031, 746065);
-    CHECK_GT(900469, 267446);
-    REQUIRE_GT(900469, 267446);
-    CHECK_LT(267446, 900469);
-    REQUIRE_LT(267446, 900469);
-    CHECK_GE(900469, 267446);
-    REQUIRE_GE(900469, 267446);
-    CHECK_GT(546046, 293724);
-    REQUIRE_GT(546046, 293724);
-    CHECK_LT(293724, 546046);
-    REQUIRE_LT(293724, 546046);
-    CHECK_GE(546046, 293724);
-    REQUIRE_GE(546046, 293724);
-    CHECK_GT(594299, 45073);
-    REQUIRE_GT(594299, 45073);
-    CHECK_LT(45073, 594299);
-    REQUIRE_LT(45073, 594299);
-    CHECK_GE(594299, 45073);
-    REQUIRE_GE(594299, 45073);
-    CHECK_GT(863327, 255337);
-    REQUIRE_GT(863327, 255337);
-    CHECK_LT(255337, 863327);
-    REQUIRE_LT(255337, 863327);
-    CHECK_GE(863327, 255337);
-    REQUIRE_GE(863327, 255337);
-    CHECK_LT(402917, 926919);
-    REQUIRE_LT(402917, 926919);
-    CHECK_GT(926919, 402917);
-    REQUIRE_GT(926919, 402917);
-    CHECK_LE(402917, 926919);
-    REQUIRE_LE(402917, 926919);
-    CHECK_GT(954628, 242802);
-    REQUIRE_GT(954628, 242802);
-    CHECK_LT(242802, 954628);
-    REQUIRE_LT(242802, 954628);
-    CHECK_GE(954628, 242802);
-    REQUIRE_GE(954628, 242802);
-    CHECK_LT(479096, 608423);
-    REQUIRE_LT(479096, 608423);
-    CHECK_GT(608423, 479096);
-    REQUIRE_GT(608423, 479096);
-    CHECK_LE(479096, 608423);
-    REQUIRE_LE(479096, 608423);
-    CHECK_GT(843028, 487955);
-    REQUIRE_GT(843028, 487955);
-    CHECK_LT(487955, 843028);
-    REQUIRE_LT(487955, 843028);
-    CHECK_GE(843028, 487955);
-    REQUIRE_GE(843028, 487955);
-    CHECK_LT(122214, 473324);
-    REQUIRE_LT(122214, 473324);
-    CHECK_GT(473324, 122214);
-    REQUIRE_GT(473324, 122214);
-    CHECK_LE(122214, 473324);
-    REQUIRE_LE(122214, 473324);
-    CHECK_GT(632612, 232871);
-    REQUIRE_GT(632612, 232871);
-    CHECK_LT(232871, 632612);
-    REQUIRE_LT(232871, 632612);
-    CHECK_GE(632612, 232871);
-    REQUIRE_GE(632612, 232871);
-    CHECK_LT(829625, 950342);
-    REQUIRE_LT(829625, 950342);
-    CHECK_GT(950342, 829625);
-    REQUIRE_GT(950342, 829625);
-    CHECK_LE(829625, 950342);
-    REQUIRE_LE(829625, 950342);
-    CHECK_GT(914710, 123330);
-    REQUIRE_GT(914710, 123330);
-    CHECK_LT(123330, 914710);
-    REQUIRE_LT(123330, 914710);
-    CHECK_GE(914710, 123330);
-    REQUIRE_GE(914710, 123330);
-    CHECK_LT(755032, 965417);
-    REQUIRE_LT(755032, 965417);
-    CHECK_GT(965417, 755032);
-    REQUIRE_GT(965417, 755032);
-    CHECK_LE(755032, 965417);
-    REQUIRE_LE(755032, 965417);
-    CHECK_LT(717881, 763750);
-    REQUIRE_LT(717881, 763750);
-    CHECK_GT(763750, 717881);
-    REQUIRE_GT(763750, 717881);
-    CHECK_LE(717881, 763750);
-    REQUIRE_LE(717881, 763750);
-    CHECK_GT(349719, 312242);
-    REQUIRE_GT(349719, 312242);
-    CHECK_LT(312242, 349719);
-    REQUIRE_LT(312242, 349719);
-    CHECK_GE(349719, 312242);
-    REQUIRE_GE(349719, 312242);
-    CHECK_GT(760731, 156966);
-    REQUIRE_GT(760731, 156966);
-    CHECK_LT(156966, 760731);
-    REQUIRE_LT(156966, 760731);
-    CHECK_GE(760731, 156966);
-    REQUIRE_GE(760731, 156966);
-    CHECK_LT(64883, 988591);
-    REQUIRE_LT(64883, 988591);
-    CHECK_GT(988591, 64883);
-    REQUIRE_GT(988591, 64883);
-    CHECK_LE(64883, 988591);
-    REQUIRE_LE(64883, 988591);
-    CHECK_LT(217972, 759940);
-    REQUIRE_LT(217972, 759940);
-    CHECK_GT(759940, 217972);
-    REQUIRE_GT(759940, 217972);
-    CHECK_LE(217972, 759940);
-    REQUIRE_LE(217972, 759940);
-    CHECK_LT(621042, 714014);
-    REQUIRE_LT(621042, 714014);
-    CHECK_GT(714014, 621042);
-    REQUIRE_GT(714014, 621042);
-    CHECK_LE(621042, 714014);
-    REQUIRE_LE(621042, 714014);
-    CHECK_GT(662762, 33806);
-    REQUIRE_GT(662762, 33806);
-    CHECK_LT(33806, 662762);
-    REQUIRE_LT(33806, 662762);
-    CHECK_GE(662762, 33806);
-    REQUIRE_GE(662762, 33806);
-    CHECK_LT(238351, 839916);
-    REQUIRE_LT(238351, 839916);
-    CHECK_GT(839916, 238351);
-    REQUIRE_GT(839916, 238351);
-    CHECK_LE(238351, 839916);
-    REQUIRE_LE(238351, 839916);
-    CHECK_GT(186154, 116249);
-    REQUIRE_GT(186154, 116249);
-    CHECK_LT(116249, 186154);
-    REQUIRE_LT(116249, 186154);
-    CHECK_GE(186154, 116249);
-    REQUIRE_GE(186154, 116249);
-    CHECK_LT(154823, 377691);
-    REQUIRE_LT(154823, 377691);
-    CHECK_GT(377691, 154823);
-    REQUIRE_GT(377691, 154823);
-    CHECK_LE(154823, 377691);
-    REQUIRE_LE(154823, 377691);
-    CHECK_LT(113607, 997998);
-    REQUIRE_LT(113607, 997998);
-    CHECK_GT(997998, 113607);
-    REQUIRE_GT(997998, 113607);
-    CHECK_LE(113607, 997998);
-    REQUIRE_LE(113607, 997998);
-    CHECK_LT(391391, 476188);
-    REQUIRE_LT(391391, 476188);
-    CHECK_GT(476188, 391391);
-    REQUIRE_GT(476188, 391391);
-    CHECK_LE(391391, 476188);
-    REQUIRE_LE(391391, 476188);
-    CHECK_GT(814634, 214250);
-    REQUIRE_GT(814634, 214250);
-    CHECK_LT(214250, 814634);
-    REQUIRE_LT(214250, 814634);
-    CHECK_GE(814634, 214250);
-    REQUIRE_GE(814634, 214250);
-    CHECK_GT(845267, 261967);
-    REQUIRE_GT(845267, 261967);
-    CHECK_LT(261967, 845267);
-    REQUIRE_LT(261967, 845267);
-    CHECK_GE(845267, 261967);
-    REQUIRE_GE(845267, 261967);
-    CHECK_LT(116919, 244903);
-    REQUIRE_LT(116919, 244903);
-    CHECK_GT(244903, 116919);
-    REQUIRE_GT(244903, 116919);
-    CHECK_LE(116919, 244903);
-    REQUIRE_LE(116919, 244903);
-    CHECK_LT(382644, 948690);
-    REQUIRE_LT(382644, 948690);
-    CHECK_GT(948690, 382644);
-    REQUIRE_GT(948690, 382644);
-    CHECK_LE(382644, 948690);
-    REQUIRE_LE(382644, 948690);
-    CHECK_LT(500611, 937663);
-    REQUIRE_LT(500611, 937663);
-    CHECK_GT(937663, 500611);
-    REQUIRE_GT(937663, 500611);
-    CHECK_LE(500611, 937663);
-    REQUIRE_LE(500611, 937663);
-    CHECK_GT(488916, 286394);
-    REQUIRE_GT(488916, 286394);
-    CHECK_LT(286394, 488916);
-    REQUIRE_LT(286394, 488916);
-    CHECK_GE(488916, 286394);
-    REQUIRE_GE(488916, 286394);
-    CHECK_LT(635242, 749205);
-    REQUIRE_LT(635242, 749205);
-    CHECK_GT(749205, 635242);
-    REQUIRE_GT(749205, 635242);
-    CHECK_LE(635242, 749205);
-    REQUIRE_LE(635242, 749205);
-    CHECK_GT(814933, 650259);
-    REQUIRE_GT(814933, 650259);
-    CHECK_LT(650259, 814933);
-    REQUIRE_LT(650259, 814933);
-    CHECK_GE(814933, 650259);
-    REQUIRE_GE(814933, 650259);
-    CHECK_LT(763538, 813651);
-    REQUIRE_LT(763538, 813651);
-    CHECK_GT(813651, 763538);
-    REQUIRE_GT(813651, 763538);
-    CHECK_LE(763538, 813651);
-    REQUIRE_LE(763538, 813651);
-    CHECK_GT(848796, 131194);
-    REQUIRE_GT(848796, 131194);
-    CHECK_LT(131194, 848796);
-    REQUIRE_LT(131194, 848796);
-    CHECK_GE(848796, 131194);
-    REQUIRE_GE(848796, 131194);
-    CHECK_LT(651245, 721336);
-    REQUIRE_LT(651245, 721336);
-    CHECK_GT(721336, 651245);
-    REQUIRE_GT(721336, 651245);
-    CHECK_LE(651245, 721336);
-    REQUIRE_LE(651245, 721336);
-    CHECK_LT(548799, 558054);
-    REQUIRE_LT(548799, 558054);
-    CHECK_GT(558054, 548799);
-    REQUIRE_GT(558054, 548799);
-    CHECK_LE(548799, 558054);
-    REQUIRE_LE(548799, 558054);
-    CHECK_LT(295703, 330093);
-    REQUIRE_LT(295703, 330093);
-    CHECK_GT(330093, 295703);
-    REQUIRE_GT(330093, 295703);
-    CHECK_LE(295703, 330093);
-    REQUIRE_LE(295703, 330093);
-    CHECK_GT(679733, 428677);
-    REQUIRE_GT(679733, 428677);
-    CHECK_LT(428677, 679733);
-    REQUIRE_LT(428677, 679733);
-    CHECK_GE(679733, 428677);
-    REQUIRE_GE(679733, 428677);
-    CHECK_LT(90522, 824715);
-    REQUIRE_LT(90522, 824715);
-    CHECK_GT(824715, 90522);
-    REQUIRE_GT(824715, 90522);
-    CHECK_LE(90522, 824715);
-    REQUIRE_LE(90522, 824715);
-    CHECK_GT(998767, 225006);
-    REQUIRE_GT(998767, 225006);
-    CHECK_LT(225006, 998767);
-    REQUIRE_LT(225006, 998767);
-    CHECK_GE(998767, 225006);
-    REQUIRE_GE(998767, 225006);
-    CHECK_LT(173929, 460749);
-    REQUIRE_LT(173929, 460749);
-    CHECK_GT(460749, 173929);
-    REQUIRE_GT(460749, 173929);
-    CHECK_LE(173929, 460749);
-    REQUIRE_LE(173929, 460749);
-    CHECK_GT(833167, 145166);
-    REQUIRE_GT(833167, 145166);
-    CHECK_LT(145166, 833167);
-    REQUIRE_LT(145166, 833167);
-    CHECK_GE(833167, 145166);
-    REQUIRE_GE(833167, 145166);
-    CHECK_LT(296980, 767274);
-    REQUIRE_LT(296980, 767274);
-    CHECK_GT(767274, 296980);
-    REQUIRE_GT(767274, 296980);
-    CHECK_LE(296980, 767274);
-    REQUIRE_LE(296980, 767274);
-    CHECK_LT(902604, 944395);
-    REQUIRE_LT(902604, 944395);
-    CHECK_GT(944395, 902604);
-    REQUIRE_GT(944395, 902604);
-    CHECK_LE(902604, 944395);
-    REQUIRE_LE(902604, 944395);
-    CHECK_LT(629598, 775548);
-    REQUIRE_LT(629598, 775548);
-    CHECK_GT(775548, 629598);
-    REQUIRE_GT(775548, 629598);
-    CHECK_LE(629598, 775548);
-    REQUIRE_LE(629598, 775548);
-    CHECK_GT(907761, 307138);
-    REQUIRE_GT(907761, 307138);
-    CHECK_LT(307138, 907761);
-    REQUIRE_LT(307138, 907761);
-    CHECK_GE(907761, 307138);
-    REQUIRE_GE(907761, 307138);
-    CHECK_GT(50053, 35920);
-    REQUIRE_GT(50053, 35920);
-    CHECK_LT(35920, 50053);
-    REQUIRE_LT(35920, 50053);
-    CHECK_GE(50053, 35920);
-    REQUIRE_GE(50053, 35920);
-    CHECK_GT(618995, 137253);
-    REQUIRE_GT(618995, 137253);
-    CHECK_LT(137253, 618995);
-    REQUIRE_LT(137253, 618995);
-    CHECK_GE(618995, 137253);
-    REQUIRE_GE(618995, 137253);
-    CHECK_GT(557186, 46212);
-    REQUIRE_GT(557186, 46212);
-    CHECK_LT(46212, 557186);
-    REQUIRE_LT(46212, 557186);
-    CHECK_GE(557186, 46212);
-    REQUIRE_GE(557186, 46212);
-    CHECK_GT(791384, 80907);
-    REQUIRE_GT(791384, 80907);
-    CHECK_LT(80907, 791384);
-    REQUIRE_LT(80907, 791384);
-    CHECK_GE(791384, 80907);
-    REQUIRE_GE(791384, 80907);
-    CHECK_GT(986857, 530182);
-    REQUIRE_GT(986857, 530182);
-    CHECK_LT(530182, 986857);
-    REQUIRE_LT(530182, 986857);
-    CHECK_GE(986857, 530182);
-    REQUIRE_GE(986857, 530182);
-    CHECK_GT(568214, 834);
-    REQUIRE_GT(568214, 834);
-    CHECK_LT(834, 568214);
-    REQUIRE_LT(834, 568214);
-    CHECK_GE(568214, 834);
-    REQUIRE_GE(568214, 834);
-    CHECK_LT(643695, 738875);
-    REQUIRE_LT(643695, 738875);
-    CHECK_GT(738875, 643695);
-    REQUIRE_GT(738875, 643695);
-    CHECK_LE(643695, 738875);
-    REQUIRE_LE(643695, 738875);
-    CHECK_LT(122754, 269548);
-    REQUIRE_LT(122754, 269548);
-    CHECK_GT(269548, 122754);
-    REQUIRE_GT(269548, 122754);
-    CHECK_LE(122754, 269548);
-    REQUIRE_LE(122754, 269548);
-    CHECK_GT(910528, 31225);
-    REQUIRE_GT(910528, 31225);
-    CHECK_LT(31225, 910528);
-    REQUIRE_LT(31225, 910528);
-    CHECK_GE(910528, 31225);
-    REQUIRE_GE(910528, 31225);
-    CHECK_LT(42717, 768759);
-    REQUIRE_LT(42717, 768759);
-    CHECK_GT(768759, 42717);
-    REQUIRE_GT(768759, 42717);
-    CHECK_LE(42717, 768759);
-    REQUIRE_LE(42717, 768759);
-    CHECK_GT(651916, 244392);
-    REQUIRE_GT(651916, 244392);
-    CHECK_LT(244392, 651916);
-    REQUIRE_LT(244392, 651916);
-    CHECK_GE(651916, 244392);
-    REQUIRE_GE(651916, 244392);
-    CHECK_LT(47040, 284552);
-    REQUIRE_LT(47040, 284552);
-    CHECK_GT(284552, 47040);
-    REQUIRE_GT(284552, 47040);
-    CHECK_LE(47040, 284552);
-    REQUIRE_LE(47040, 284552);
-    CHECK_GT(983409, 405008);
-    REQUIRE_GT(983409, 405008);
-    CHECK_LT(405008, 983409);
-    REQUIRE_LT(405008, 983409);
-    CHECK_GE(983409, 405008);
-    REQUIRE_GE(983409, 405008);
-    CHECK_GT(697295, 120759);
-    REQUIRE_GT(697295, 120759);
-    CHECK_LT(120759, 697295);
-    REQUIRE_LT(120759, 697295);
-    CHECK_GE(697295, 120759);
-    REQUIRE_GE(697295, 120759);
-    CHECK_GT(971060, 502976);
-    REQUIRE_GT(971060, 502976);
-    CHECK_LT(502976, 971060);
-    REQUIRE_LT(502976, 971060);
-    CHECK_GE(971060, 502976);
-    REQUIRE_GE(971060, 502976);
-    CHECK_GT(435169, 140755);
-    REQUIRE_GT(435169, 140755);
-    CHECK_LT(140755, 435169);
-    REQUIRE_LT(140755, 435169);
-    CHECK_GE(435169, 140755);
-    REQUIRE_GE(435169, 140755);
-    CHECK_LT(349541, 401972);
-    REQUIRE_LT(349541, 401972);
-    CHECK_GT(401972, 349541);
-    REQUIRE_GT(401972, 349541);
-    CHECK_LE(349541, 401972);
-    REQUIRE_LE(349541, 401972);
-    CHECK_GT(639412, 532443);
-    REQUIRE_GT(639412, 532443);
-    CHECK_LT(532443, 639412);
-    REQUIRE_LT(532443, 639412);
-    CHECK_GE(639412, 532443);
-    REQUIRE_GE(639412, 532443);
-    CHECK_LT(457294, 952744);
-    REQUIRE_LT(457294, 952744);
-    CHECK_GT(952744, 457294);
-    REQUIRE_GT(952744, 457294);
-    CHECK_LE(457294, 952744);
-    REQUIRE_LE(457294, 952744);
-    CHECK_LT(605673, 818357);
-    REQUIRE_LT(605673, 818357);
-    CHECK_GT(818357, 605673);
-    REQUIRE_GT(818357, 605673);
-    CHECK_LE(605673, 818357);
-    REQUIRE_LE(605673, 818357);
-    CHECK_LT(39424, 384745);
-    REQUIRE_LT(39424, 384745);
-    CHECK_GT(384745, 39424);
-    REQUIRE_GT(384745, 39424);
-    CHECK_LE(39424, 384745);
-    REQUIRE_LE(39424, 384745);
-    CHECK_GT(411768, 9691);
-    REQUIRE_GT(411768, 9691);
-    CHECK_LT(9691, 411768);
-    REQUIRE_LT(9691, 411768);
-    CHECK_GE(411768, 9691);
-    REQUIRE_GE(411768, 9691);
-    CHECK_LT(583612, 800305);
-    REQUIRE_LT(583612, 800305);
-    CHECK_GT(800305, 583612);
-    REQUIRE_GT(800305, 583612);
-    CHECK_LE(583612, 800305);
-    REQUIRE_LE(583612, 800305);
-    CHECK_LT(175488, 488440);
-    REQUIRE_LT(175488, 488440);
-    CHECK_GT(488440, 175488);
-    REQUIRE_GT(488440, 175488);
-    CHECK_LE(175488, 488440);
-    REQUIRE_LE(175488, 488440);
-    CHECK_GT(528321, 197449);
-    REQUIRE_GT(528321, 197449);
-    CHECK_LT(197449, 528321);
-    REQUIRE_LT(197449, 528321);
-    CHECK_GE(528321, 197449);
-    REQUIRE_GE(528321, 197449);
-    CHECK_GT(534084, 338786);
-    REQUIRE_GT(534084, 338786);
-    CHECK_LT(338786, 534084);
-    REQUIRE_LT(338786, 534084);
-    CHECK_GE(534084, 338786);
-    REQUIRE_GE(534084, 338786);
-    CHECK_GT(994688, 179033);
-    REQUIRE_GT(994688, 179033);
-    CHECK_LT(179033, 994688);
-    REQUIRE_LT(179033, 994688);
-    CHECK_GE(994688, 179033);
-    REQUIRE_GE(994688, 179033);
-    CHECK_LT(505097, 649780);
-    REQUIRE_LT(505097, 649780);
-    CHECK_GT(649780, 505097);
-    REQUIRE_GT(649780, 505097);
-    CHECK_LE(505097, 649780);
-    REQUIRE_LE(505097, 649780);
-    CHECK_GT(630917, 28095);
-    REQUIRE_GT(630917, 28095);
-    CHECK_LT(28095, 630917);
-    REQUIRE_LT(28095, 630917);
-    CHECK_GE(630917, 28095);
-    REQUIRE_GE(630917, 28095);
-    CHECK_LT(508944, 644772);
-    REQUIRE_LT(508944, 644772);
-    CHECK_GT(644772, 508944);
-    REQUIRE_GT(644772, 508944);
-    CHECK_LE(508944, 644772);
-    REQUIRE_LE(508944, 644772);
-    CHECK_LT(3729, 567323);
-    REQUIRE_LT(3729, 567323);
-    CHECK_GT(567323, 3729);
-    REQUIRE_GT(567323, 3729);
-    CHECK_LE(3729, 567323);
-    REQUIRE_LE(3729, 567323);
-    CHECK_LT(208236, 828756);
-    REQUIRE_LT(208236, 828756);
-    CHECK_GT(828756, 208236);
-    REQUIRE_GT(828756, 208236);
-    CHECK_LE(208236, 828756);
-    REQUIRE_LE(208236, 828756);
-    CHECK_LT(463656, 590610);
-    REQUIRE_LT(463656, 590610);
-    CHECK_GT(590610, 463656);
-    REQUIRE_GT(590610, 463656);
-    CHECK_LE(463656, 590610);
-    REQUIRE_LE(463656, 590610);
-    CHECK_LT(15373, 150527);
-    REQUIRE_LT(15373, 150527);
-    CHECK_GT(150527, 15373);
-    REQUIRE_GT(150527, 15373);
-    CHECK_LE(15373, 150527);
-    REQUIRE_LE(15373, 150527);
-    CHECK_LT(558637, 789817);
-    REQUIRE_LT(558637, 789817);
-    CHECK_GT(789817, 558637);
-    REQUIRE_GT(789817, 558637);
-    CHECK_LE(558637, 789817);
-    REQUIRE_LE(558637, 789817);
-    CHECK_LT(144846, 680695);
-    REQUIRE_LT(144846, 680695);
-    CHECK_GT(680695, 144846);
-    REQUIRE_GT(680695, 144846);
-    CHECK_LE(144846, 680695);
-    REQUIRE_LE(144846, 680695);
-    CHECK_GT(867277, 701994);
-    REQUIRE_GT(867277, 701994);
-    CHECK_LT(701994, 867277);
-    REQUIRE_LT(701994, 867277);
-    CHECK_GE(867277, 701994);
-    REQUIRE_GE(867277, 701994);
-    CHECK_GT(690276, 109668);
-    REQUIRE_GT(690276, 109668);
-    CHECK_LT(109668, 690276);
-    REQUIRE_LT(109668, 690276);
-    CHECK_GE(690276, 109668);
-    REQUIRE_GE(690276, 109668);
-    CHECK_LT(308589, 517632);
-    REQUIRE_LT(308589, 517632);
-    CHECK_GT(517632, 308589);
-    REQUIRE_GT(517632, 308589);
-    CHECK_LE(308589, 517632);
-    REQUIRE_LE(308589, 517632);
-    CHECK_GT(753250, 558271);
-    REQUIRE_GT(753250, 558271);
-    CHECK_LT(558271, 753250);
-    REQUIRE_LT(558271, 753250);
-    CHECK_GE(753250, 558271);
-    REQUIRE_GE(753250, 558271);
-    CHECK_LT(188762, 571394);
-    REQUIRE_LT(188762, 571394);
-    CHECK_GT(571394, 188762);
-    REQUIRE_GT(571394, 188762);
-    CHECK_LE(188762, 571394);
-    REQUIRE_LE(188762, 571394);
-    CHECK_LT(4142, 716262);
-    REQUIRE_LT(4142, 716262);
-    CHECK_GT(716262, 4142);
-    REQUIRE_GT(716262, 4142);
-    CHECK_LE(4142, 716262);
-    REQUIRE_LE(4142, 716262);
-    CHECK_LT(867309, 882256);
-    REQUIRE_LT(867309, 882256);
-    CHECK_GT(882256, 867309);
-    REQUIRE_GT(882256, 867309);
-    CHECK_LE(867309, 882256);
-    REQUIRE_LE(867309, 882256);
-    CHECK_GT(978140, 365932);
-    REQUIRE_GT(978140, 365932);
-    CHECK_LT(365932, 978140);
-    REQUIRE_LT(365932, 978140);
-    CHECK_GE(978140, 365932);
-    REQUIRE_GE(978140, 365932);
-    CHECK_GT(788657, 718865);
-    REQUIRE_GT(788657, 718865);
-    CHECK_LT(718865, 788657);
-    REQUIRE_LT(718865, 788657);
-    CHECK_GE(788657, 718865);
-    REQUIRE_GE(788657, 718865);
-    CHECK_LT(158448, 681754);
-    REQUIRE_LT(158448, 681754);
-    CHECK_GT(681754, 158448);
-    REQUIRE_GT(681754, 158448);
-    CHECK_LE(158448, 681754);
-    REQUIRE_LE(158448, 681754);
-    CHECK_GT(953476, 404041);
-    REQUIRE_GT(953476, 404041);
-    CHECK_LT(404041, 953476);
-    REQUIRE_LT(404041, 953476);
-    CHECK_GE(953476, 404041);
-    REQUIRE_GE(953476, 404041);
-    CHECK_LT(692357, 741975);
-    REQUIRE_LT(692357, 741975);
-    CHECK_GT(741975, 692357);
-    REQUIRE_GT(741975, 692357);
-    CHECK_LE(692357, 741975);
-    REQUIRE_LE(692357, 741975);
-    CHECK_GT(440717, 296861);
-    REQUIRE_GT(440717, 296861);
-    CHECK_LT(296861, 440717);
-    REQUIRE_LT(296861, 440717);
-    CHECK_GE(440717, 296861);
-    REQUIRE_GE(440717, 296861);
-    CHECK_GT(777244, 285900);
-    REQUIRE_GT(777244, 285900);
-    CHECK_LT(285900, 777244);
-    REQUIRE_LT(285900, 777244);
-    CHECK_GE(777244, 285900);
-    REQUIRE_GE(777244, 285900);
-    CHECK_GT(108268, 78093);
-    REQUIRE_GT(108268, 78093);
-    CHECK_LT(78093, 108268);
-    REQUIRE_LT(78093, 108268);
-    CHECK_GE(108268, 78093);
-    REQUIRE_GE(108268, 78093);
-    CHECK_LT(16346, 494090);
-    REQUIRE_LT(16346, 494090);
-    CHECK_GT(494090, 16346);
-    REQUIRE_GT(494090, 16346);
-    CHECK_LE(16346, 494090);
-    REQUIRE_LE(16346, 494090);
-    CHECK_GT(194603, 43097);
-    REQUIRE_GT(194603, 43097);
-    CHECK_LT(43097, 194603);
-    REQUIRE_LT(43097, 194603);
-    CHECK_GE(194603, 43097);
-    REQUIRE_GE(194603, 43097);
-    CHECK_GT(604096, 480038);
-    REQUIRE_GT(604096, 480038);
-    CHECK_LT(480038, 604096);
-    REQUIRE_LT(480038, 604096);
-    CHECK_GE(604096, 480038);
-    REQUIRE_GE(604096, 480038);
-    CHECK_GT(956185, 475146);
-    REQUIRE_GT(956185, 475146);
-    CHECK_LT(475146, 956185);
-    REQUIRE_LT(475146, 956185);
-    CHECK_GE(956185, 475146);
-    REQUIRE_GE(956185, 475146);
-    CHECK_GT(545319, 416087);
-    REQUIRE_GT(545319, 416087);
-    CHECK_LT(416087, 545319);
-    REQUIRE_LT(416087, 545319);
-    CHECK_GE(545319, 416087);
-    REQUIRE_GE(545319, 416087);
-    CHECK_GT(716563, 426135);
-    REQUIRE_GT(716563, 426135);
-    CHECK_LT(426135, 716563);
-    REQUIRE_LT(426135, 716563);
-    CHECK_GE(716563, 426135);
-    REQUIRE_GE(716563, 426135);
-    CHECK_GT(815688, 297282);
-    REQUIRE_GT(815688, 297282);
-    CHECK_LT(297282, 815688);
-    REQUIRE_LT(297282, 815688);
-    CHECK_GE(815688, 297282);
-    REQUIRE_GE(815688, 297282);
-    CHECK_LT(169673, 868502);
-    REQUIRE_LT(169673, 868502);
-    CHECK_GT(868502, 169673);
-    REQUIRE_GT(868502, 169673);
-    CHECK_LE(169673, 868502);
-    REQUIRE_LE(169673, 868502);
-    CHECK_LT(200228, 562916);
-    REQUIRE_LT(200228, 562916);
-    CHECK_GT(562916, 200228);
-    REQUIRE_GT(562916, 200228);
-    CHECK_LE(200228, 562916);
-    REQUIRE_LE(200228, 562916);
-    CHECK_LT(515803, 976758);
-    REQUIRE_LT(515803, 976758);
-    CHECK_GT(976758, 515803);
-    REQUIRE_GT(976758, 515803);
-    CHECK_LE(515803, 976758);
-    REQUIRE_LE(515803, 976758);
-    CHECK_GT(823661, 705579);
-    REQUIRE_GT(823661, 705579);
-    CHECK_LT(705579, 823661);
-    REQUIRE_LT(705579, 823661);
-    CHECK_GE(823661, 705579);
-    REQUIRE_GE(823661, 705579);
-    CHECK_LT(540024, 813862);
-    REQUIRE_LT(540024, 813862);
-    CHECK_GT(813862, 540024);
-    REQUIRE_GT(813862, 540024);
-    CHECK_LE(540024, 813862);
-    REQUIRE_LE(540024, 813862);
-    CHECK_GT(966654, 289412);
-    REQUIRE_GT(966654, 289412);
-    CHECK_LT(289412, 966654);
-    REQUIRE_LT(289412, 966654);
-    CHECK_GE(966654, 289412);
-    REQUIRE_GE(966654, 289412);
-    CHECK_LT(717061, 998615);
-    REQUIRE_LT(717061, 998615);
-    CHECK_GT(998615, 717061);
-    REQUIRE_GT(998615, 717061);
-    CHECK_LE(717061, 998615);
-    REQUIRE_LE(717061, 998615);
-    CHECK_LT(291808, 736570);
-    REQUIRE_LT(291808, 736570);
-    CHECK_GT(736570, 291808);
-    REQUIRE_GT(736570, 291808);
-    CHECK_LE(291808, 736570);
-    REQUIRE_LE(291808, 736570);
-    CHECK_GT(657833, 32713);
-    REQUIRE_GT(657833, 32713);
-    CHECK_LT(32713, 657833);
-    REQUIRE_LT(32713, 657833);
-    CHECK_GE(657833, 32713);
-    REQUIRE_GE(657833, 32713);
-    CHECK_GT(743102, 115143);
-    REQUIRE_GT(743102, 115143);
-    CHECK_LT(115143, 743102);
-    REQUIRE_LT(115143, 743102);
-    CHECK_GE(743102, 115143);
-    REQUIRE_GE(743102, 115143);
-    CHECK_GT(919484, 423558);
-    REQUIRE_GT(919484, 423558);
-    CHECK_LT(423558, 919484);
-    REQUIRE_LT(423558, 919484);
-    CHECK_GE(919484, 423558);
-    REQUIRE_GE(919484, 423558);
-    CHECK_GT(20401, 10175);
-    REQUIRE_GT(20401, 10175);
-    CHECK_LT(10175, 20401);
-    REQUIRE_LT(10175, 20401);
-    CHECK_GE(20401, 10175);
-    REQUIRE_GE(20401, 10175);
-    CHECK_GT(325347, 207037);
-    REQUIRE_GT(325347, 207037);
-    CHECK_LT(207037, 325347);
-    REQUIRE_LT(207037, 325347);
-    CHECK_GE(325347, 207037);
-    REQUIRE_GE(325347, 207037);
-    CHECK_LT(555506, 624545);
-    REQUIRE_LT(555506, 624545);
-    CHECK_GT(624545, 555506);
-    REQUIRE_GT(624545, 555506);
-    CHECK_LE(555506, 624545);
-    REQUIRE_LE(555506, 624545);
-    CHECK_LT(472766, 955634);
-    REQUIRE_LT(472766, 955634);
-    CHECK_GT(955634, 472766);
-    REQUIRE_GT(955634, 472766);
-    CHECK_LE(472766, 955634);
-    REQUIRE_LE(472766, 955634);
-    CHECK_GT(419547, 350042);
-    REQUIRE_GT(419547, 350042);
-    CHECK_LT(350042, 419547);
-    REQUIRE_LT(350042, 419547);
-    CHECK_GE(419547, 350042);
-    REQUIRE_GE(419547, 350042);
-    CHECK_GT(462672, 94415);
-    REQUIRE_GT(462672, 94415);
-    CHECK_LT(94415, 462672);
-    REQUIRE_LT(94415, 462672);
-    CHECK_GE(462672, 94415);
-    REQUIRE_GE(462672, 94415);
-    CHECK_GT(866908, 598542);
-    REQUIRE_GT(866908, 598542);
-    CHECK_LT(598542, 866908);
-    REQUIRE_LT(598542, 866908);
-    CHECK_GE(866908, 598542);
-    REQUIRE_GE(866908, 598542);
-    CHECK_GT(972424, 197009);
-    REQUIRE_GT(972424, 197009);
-    CHECK_LT(197009, 972424);
-    REQUIRE_LT(197009, 972424);
-    CHECK_GE(972424, 197009);
-    REQUIRE_GE(972424, 197009);
-    CHECK_LT(479730, 483707);
-    REQUIRE_LT(479730, 483707);
-    CHECK_GT(483707, 479730);
-    REQUIRE_GT(483707, 479730);
-    CHECK_LE(479730, 483707);
-    REQUIRE_LE(479730, 483707);
-    CHECK_LT(575165, 709284);
-    REQUIRE_LT(575165, 709284);
-    CHECK_GT(709284, 575165);
-    REQUIRE_GT(709284, 575165);
-    CHECK_LE(575165, 709284);
-    REQUIRE_LE(575165, 709284);
-    CHECK_LT(599103, 892257);
-    REQUIRE_LT(599103, 892257);
-    CHECK_GT(892257, 599103);
-    REQUIRE_GT(892257, 599103);
-    CHECK_LE(599103, 892257);
-    REQUIRE_LE(599103, 892257);
-    CHECK_GT(89538, 30336);
-    REQUIRE_GT(89538, 30336);
-    CHECK_LT(30336, 89538);
-    REQUIRE_LT(30336, 89538);
-    CHECK_GE(89538, 30336);
-    REQUIRE_GE(89538, 30336);
-    CHECK_LT(430715, 973483);
-    REQUIRE_LT(430715, 973483);
-    CHECK_GT(973483, 430715);
-    REQUIRE_GT(973483, 430715);
-    CHECK_LE(430715, 973483);
-    REQUIRE_LE(430715, 973483);
-    CHECK_GT(749820, 1766);
-    REQUIRE_GT(749820, 1766);
-    CHECK_LT(1766, 749820);
-    REQUIRE_LT(1766, 749820);
-    CHECK_GE(749820, 1766);
-    REQUIRE_GE(749820, 1766);
-    CHECK_GT(651476, 594712);
-    REQUIRE_GT(651476, 594712);
-    CHECK_LT(594712, 651476);
-    REQUIRE_LT(594712, 651476);
-    CHECK_GE(651476, 594712);
-    REQUIRE_GE(651476, 594712);
-    CHECK_GT(798833, 695936);
-    REQUIRE_GT(798833, 695936);
-    CHECK_LT(695936, 798833);
-    REQUIRE_LT(695936, 798833);
-    CHECK_GE(798833, 695936);
-    REQUIRE_GE(798833, 695936);
-    CHECK_GT(579843, 286443);
-    REQUIRE_GT(579843, 286443);
-    CHECK_LT(286443, 579843);
-    REQUIRE_LT(286443, 579843);
-    CHECK_GE(579843, 286443);
-    REQUIRE_GE(579843, 286443);
-    CHECK_GT(494733, 257611);
-    REQUIRE_GT(494733, 257611);
-    CHECK_LT(257611, 494733);
-    REQUIRE_LT(257611, 494733);
-    CHECK_GE(494733, 257611);
-    REQUIRE_GE(494733, 257611);
-    CHECK_LT(754485, 889411);
-    REQUIRE_LT(754485, 889411);
-    CHECK_GT(889411, 754485);
-    REQUIRE_GT(889411, 754485);
-    CHECK_LE(754485, 889411);
-    REQUIRE_LE(754485, 889411);
-    CHECK_LT(29182, 591142);
-    REQUIRE_LT(29182, 591142);
-    CHECK_GT(591142, 29182);
-    REQUIRE_GT(591142, 29182);
-    CHECK_LE(29182, 591142);
-    REQUIRE_LE(29182, 591142);
-    CHECK_LT(392017, 470401);
-    REQUIRE_LT(392017, 470401);
-    CHECK_GT(470401, 392017);
-    REQUIRE_GT(470401, 392017);
-    CHECK_LE(392017, 470401);
-    REQUIRE_LE(392017, 470401);
-    CHECK_LT(192510, 894637);
-    REQUIRE_LT(192510, 894637);
-    CHECK_GT(894637, 192510);
-    REQUIRE_GT(894637, 192510);
-    CHECK_LE(192510, 894637);
-    REQUIRE_LE(192510, 894637);
-    CHECK_LT(151868, 640160);
-    REQUIRE_LT(151868, 640160);
-    CHECK_GT(640160, 151868);
-    REQUIRE_GT(640160, 151868);
-    CHECK_LE(151868, 640160);
-    REQUIRE_LE(151868, 640160);
-    CHECK_GT(79589, 5366);
-    REQUIRE_GT(79589, 5366);
-    CHECK_LT(5366, 79589);
-    REQUIRE_LT(5366, 79589);
-    CHECK_GE(79589, 5366);
-    REQUIRE_GE(79589, 5366);
-    CHECK_GT(704209, 563739);
-    REQUIRE_GT(704209, 563739);
-    CHECK_LT(563739, 704209);
-    REQUIRE_LT(563739, 704209);
-    CHECK_GE(704209, 563739);
-    REQUIRE_GE(704209, 563739);
-    CHECK_GT(845163, 644159);
-    REQUIRE_GT(845163, 644159);
-    CHECK_LT(644159, 845163);
-    REQUIRE_LT(644159, 845163);
-    CHECK_GE(845163, 644159);
-    REQUIRE_GE(845163, 644159);
-    CHECK_GT(865307, 655164);
-    REQUIRE_GT(865307, 655164);
-    CHECK_LT(655164, 865307);
-    REQUIRE_LT(655164, 865307);
-    CHECK_GE(865307, 655164);
-    REQUIRE_GE(865307, 655164);
-    CHECK_LT(202088, 948077);
-    REQUIRE_LT(202088, 948077);
-    CHECK_GT(948077, 202088);
-    REQUIRE_GT(948077, 202088);
-    CHECK_LE(202088, 948077);
-    REQUIRE_LE(202088, 948077);
-    CHECK_LT(626659, 667379);
-    REQUIRE_LT(626659, 667379);
-    CHECK_GT(667379, 626659);
-    REQUIRE_GT(667379, 626659);
-    CHECK_LE(626659, 667379);
-    REQUIRE_LE(626659, 667379);
-    CHECK_LT(310480, 864754);
-    REQUIRE_LT(310480, 864754);
-    CHECK_GT(864754, 310480);
-    REQUIRE_GT(864754, 310480);
-    CHECK_LE(310480, 864754);
-    REQUIRE_LE(310480, 864754);
-    CHECK_LT(192897, 661567);
-    REQUIRE_LT(192897, 661567);
-    CHECK_GT(661567, 192897);
-    REQUIRE_GT(661567, 192897);
-    CHECK_LE(192897, 661567);
-    REQUIRE_LE(192897, 661567);
-    CHECK_LT(307117, 630015);
-    REQUIRE_LT(307117, 630015);
-    CHECK_GT(630015, 307117);
-    REQUIRE_GT(630015, 307117);
-    CHECK_LE(307117, 630015);
-    REQUIRE_LE(307117, 630015);
-    CHECK_GT(960798, 433353);
-    REQUIRE_GT(960798, 433353);
-    CHECK_LT(433353, 960798);
-    REQUIRE_LT(433353, 960798);
-    CHECK_GE(960798, 433353);
-    REQUIRE_GE(960798, 433353);
-    CHECK_LT(447435, 723259);
-    REQUIRE_LT(447435, 723259);
-    CHECK_GT(723259, 447435);
-    REQUIRE_GT(723259, 447435);
-    CHECK_LE(447435, 723259);
-    REQUIRE_LE(447435, 723259);
-    CHECK_LT(245177, 759092);
-    REQUIRE_LT(245177, 759092);
-    CHECK_GT(759092, 245177);
-    REQUIRE_GT(759092, 245177);
-    CHECK_LE(245177, 759092);
-    REQUIRE_LE(245177, 759092);
-    CHECK_GT(513741, 494871);
-    REQUIRE_GT(513741, 494871);
-    CHECK_LT(494871, 513741);
-    REQUIRE_LT(494871, 513741);
-    CHECK_GE(513741, 494871);
-    REQUIRE_GE(513741, 494871);
-    CHECK_LT(588310, 877434);
-    REQUIRE_LT(588310, 877434);
-    CHECK_GT(877434, 588310);
-    REQUIRE_GT(877434, 588310);
-    CHECK_LE(588310, 877434);
-    REQUIRE_LE(588310, 877434);
-    CHECK_LT(673449, 847325);
-    REQUIRE_LT(673449, 847325);
-    CHECK_GT(847325, 673449);
-    REQUIRE_GT(847325, 673449);
-    CHECK_LE(673449, 847325);
-    REQUIRE_LE(673449, 847325);
-    CHECK_GT(847357, 349475);
-    REQUIRE_GT(847357, 349475);
-    CHECK_LT(349475, 847357);
-    REQUIRE_LT(349475, 847357);
-    CHECK_GE(847357, 349475);
-    REQUIRE_GE(847357, 349475);
-    CHECK_LT(108121, 524383);
-    REQUIRE_LT(108121, 524383);
-    CHECK_GT(524383, 108121);
-    REQUIRE_GT(524383, 108121);
-    CHECK_LE(108121, 524383);
-    REQUIRE_LE(108121, 524383);
-    CHECK_LT(365536, 632740);
-    REQUIRE_LT(365536, 632740);
-    CHECK_GT(632740, 365536);
-    REQUIRE_GT(632740, 365536);
-    CHECK_LE(365536, 632740);
-    REQUIRE_LE(365536, 632740);
-    CHECK_GT(212787, 35466);
-    REQUIRE_GT(212787, 35466);
-    CHECK_LT(35466, 212787);
-    REQUIRE_LT(35466, 212787);
-    CHECK_GE(212787, 35466);
-    REQUIRE_GE(212787, 35466);
-    CHECK_GT(639636, 633916);
-    REQUIRE_GT(639636, 633916);
-    CHECK_LT(633916, 639636);
-    REQUIRE_LT(633916, 639636);
-    CHECK_GE(639636, 633916);
-    REQUIRE_GE(639636, 633916);
-    CHECK_GT(868298, 385751);
-    REQUIRE_GT(868298, 385751);
-    CHECK_LT(385751, 868298);
-    REQUIRE_LT(385751, 868298);
-    CHECK_GE(868298, 385751);
-    REQUIRE_GE(868298, 385751);
-    CHECK_LT(166704, 629235);
-    REQUIRE_LT(166704, 629235);
-    CHECK_GT(629235, 166704);
-    REQUIRE_GT(629235, 166704);
-    CHECK_LE(166704, 629235);
-    REQUIRE_LE(166704, 629235);
-    CHECK_GT(577014, 83356);
-    REQUIRE_GT(577014, 83356);
-    CHECK_LT(83356, 577014);
-    REQUIRE_LT(83356, 577014);
-    CHECK_GE(577014, 83356);
-    REQUIRE_GE(577014, 83356);
-    CHECK_GT(622571, 111035);
-    REQUIRE_GT(622571, 111035);
-    CHECK_LT(111035, 622571);
-    REQUIRE_LT(111035, 622571);
-    CHECK_GE(622571, 111035);
-    REQUIRE_GE(622571, 111035);
-    CHECK_LT(163075, 752958);
-    REQUIRE_LT(163075, 752958);
-    CHECK_GT(752958, 163075);
-    REQUIRE_GT(752958, 163075);
-    CHECK_LE(163075, 752958);
-    REQUIRE_LE(163075, 752958);
-    CHECK_LT(19010, 849090);
-    REQUIRE_LT(19010, 849090);
-    CHECK_GT(849090, 19010);
-    REQUIRE_GT(849090, 19010);
-    CHECK_LE(19010, 849090);
-    REQUIRE_LE(19010, 849090);
-    CHECK_GT(32177, 1280);
-    REQUIRE_GT(32177, 1280);
-    CHECK_LT(1280, 32177);
-    REQUIRE_LT(1280, 32177);
-    CHECK_GE(32177, 1280);
-    REQUIRE_GE(32177, 1280);
-    CHECK_GT(869363, 787457);
-    REQUIRE_GT(869363, 787457);
-    CHECK_LT(787457, 869363);
-    REQUIRE_LT(787457, 869363);
-    CHECK_GE(869363, 787457);
-    REQUIRE_GE(869363, 787457);
-    CHECK_GT(374801, 289868);
-    REQUIRE_GT(374801, 289868);
-    CHECK_LT(289868, 374801);
-    REQUIRE_LT(289868, 374801);
-    CHECK_GE(374801, 289868);
-    REQUIRE_GE(374801, 289868);
-    CHECK_LT(588274, 688914);
-    REQUIRE_LT(588274, 688914);
-    CHECK_GT(688914, 588274);
-    REQUIRE_GT(688914, 588274);
-    CHECK_LE(588274, 688914);
-    REQUIRE_LE(588274, 688914);
-    CHECK_LT(251651, 315475);
-    REQUIRE_LT(251651, 315475);
-    CHECK_GT(315475, 251651);
-    REQUIRE_GT(315475, 251651);
-    CHECK_LE(251651, 315475);
-    REQUIRE_LE(251651, 315475);
-    CHECK_GT(615338, 576562);
-    REQUIRE_GT(615338, 576562);
-    CHECK_LT(576562, 615338);
-    REQUIRE_LT(576562, 615338);
-    CHECK_GE(615338, 576562);
-    REQUIRE_GE(615338, 576562);
-}
-
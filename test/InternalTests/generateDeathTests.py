@@ -121,85 +121,12 @@ def test_string_macros(lang: str, filename: str ='DeathTests/test_string_macros'
     finally:
         a.close()
 
-# Because of the huge size of the resulting `.c` or `.cpp` file (~7k lines) when this script runs (MSVC 2017 runs out of 
-# heap space because of this), we split the files into 2 seperate source files
-def test_assertion_macros(lang: str, filename: str ='DeathTests/test_assertion_macros'):
-    filename1 = filename + '_1'
-    filename2 = filename + '_2'
-    
-    # Add the language extension
-    filename1 = filename1 + '.' + lang
-    filename2 = filename2 + '.' + lang
-    print(f'[INFO] Writing {filename1} and {filename2}')
-
-    ASSERTION_MACROS_TEXT = """    %(macro)s(%(num1)s, %(num2)s);\n"""
-    ASSERTION_MACROS = [
-        'CHECK_EQ', 'CHECK_NE', 'CHECK_LT', 'CHECK_LE', 'CHECK_GT', 'CHECK_GE', 
-        'REQUIRE_EQ', 'REQUIRE_NE', 'REQUIRE_LT', 'REQUIRE_LE', 'REQUIRE_GT', 'REQUIRE_GE'
-    ]
-
-    # Open a file to write
-    f1 = open(filename1, 'w')
-    f2 = open(filename2, 'w')
-
-    # Initially, set f to f1
-    f = f1 
-
-    intdata = open('DeathTests/random_integers.txt', 'r').readlines()
-    count = 0
-
-    try:
-        f1.write(INCLUDE_THIS_BEFORE_EACH_FILE)
-        f1.write(TEST_SUITE_BEGIN % {'lang': lang, 'macro' : 'ASSERTION_MACROS_1'})
-        f2.write(INCLUDE_THIS_BEFORE_EACH_FILE)
-        f2.write(TEST_SUITE_BEGIN % {'lang': lang, 'macro' : 'ASSERTION_MACROS_2'})
-
-        for line in intdata:
-            line = line.strip().strip('\n').split(',')
-            line[1] = line[1].strip()
-            count += 1
-            # Half of the 1500 lines in `random_integers.txt`
-            if count == 750:
-                f = f2
-
-            num1 = int(line[0])
-            num2 = int(line[1])
-
-            if num1 < num2:
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'CHECK_LT','num1': str(num1),'num2': str(num2)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'REQUIRE_LT','num1': str(num1),'num2': str(num2)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'CHECK_GT','num1': str(num2),'num2': str(num1)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'REQUIRE_GT','num1': str(num2),'num2': str(num1)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'CHECK_LE','num1': str(num1),'num2': str(num2)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'REQUIRE_LE','num1': str(num1),'num2': str(num2)})
-
-            elif num1 > num2:
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'CHECK_GT','num1': str(num1),'num2': str(num2)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'REQUIRE_GT','num1': str(num1),'num2': str(num2)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'CHECK_LT','num1': str(num2),'num2': str(num1)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'REQUIRE_LT','num1': str(num2),'num2': str(num1)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'CHECK_GE','num1': str(num1),'num2': str(num2)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'REQUIRE_GE','num1': str(num1),'num2': str(num2)})
-
-            elif num1 == num2:
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'CHECK_EQ','num1': str(num1),'num2': str(num2),})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'REQUIRE_EQ','num1': str(num1),'num2': str(num2)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'CHECK_GE','num1': str(num1),'num2': str(num2)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'REQUIRE_GE','num1': str(num1),'num2': str(num2)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'CHECK_LE','num1': str(num1),'num2': str(num2)})
-                f.write(ASSERTION_MACROS_TEXT % {'macro': 'REQUIRE_LE','num1': str(num1),'num2': str(num2)})
-
-        f1.write(TEST_SUITE_END)
-        f2.write(TEST_SUITE_END)
-    finally:
-        f1.close()
-        f2.close()
-    
+# The assertion macros are checked against `random_integers.txt` by the `TEST_P`s in
+# `DeathTests/test_assertion_macros.c(pp)`, which read it at run time instead of having it compiled in.
 
 if __name__ == '__main__':
     languages = ['c', 'cpp']
     # generated_random_string_data()
 
     for i in languages:
-        test_string_macros(str(i))
-        test_assertion_macros(str(i))
\ No newline at end of file
+        test_string_macros(str(i))
\ No newline at end of file
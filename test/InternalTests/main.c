@@ -1,2 +1,3 @@
+#define PSI_TRACK_ALLOCS
 #include <psi/psi.h>
 PSI_MAIN()
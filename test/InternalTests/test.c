@@ -109,6 +109,17 @@ TEST(c, CHECK_SUBSTRNE) {
     CHECK_SUBSTRNE("foo", "barfoo", strlen("foo")); 
 }
 
+TEST(c, CHECK_MAX_ALLOCS) {
+    CHECK_NO_ALLOC {
+        CHECK_EQ(1, 1);
+    }
+    CHECK_MAX_ALLOCS(1) {
+        char* const str = PSI_PTRCAST(char*, malloc(16));
+        psiDoNotOptimize(str);
+        free(str);
+    }
+}
+
 TEST(c11, REQUIRE_EQ) { 
     REQUIRE_EQ(1, 1); 
 }
@@ -207,6 +218,275 @@ TEST(c11, REQUIRE_BUF_NE) {
 	REQUIRE_BUF_NE(buf, ref, sizeof(ref));
 }
 
+TEST(c11, CHECK_ARRAY_NEAR) {
+	double buf[] = {1.0, 2.0, 3.0000001, -4.0, 5.0};
+	double ref[] = {1.0, 2.0, 3.0, -4.0000001, 5.0};
+	CHECK_ARRAY_NEAR(buf, ref, 5, 1e-6, 0.0);
+	CHECK_ARRAY_NEAR(buf, ref, 5, 0.0, 1e-7);
+}
+
+TEST(c11, CHECK_ARRAY_ULP) {
+	float buf[] = {1.0f, 0.0f, -2.5f, 1e30f, 3.0f};
+	float ref[] = {1.0f, -0.0f, -2.5f, 1e30f, 3.0f};
+	buf[4] = nextafterf(ref[4], 4.0f);
+	CHECK_ARRAY_ULP(buf, ref, 5, 1);
+}
+
+TEST(c11, REQUIRE_ARRAY_NEAR) {
+	float buf[] = {0.5f, 0.25f, 0.125f};
+	float ref[] = {0.5f, 0.25f, 0.1251f};
+	REQUIRE_ARRAY_NEAR(buf, ref, 3, 1e-3, 0.0);
+}
+
+TEST(c11, REQUIRE_ARRAY_ULP) {
+	double buf[] = {1.0, 2.0, 3.0};
+	double ref[] = {1.0, 2.0, 3.0};
+	buf[1] = nextafter(nextafter(ref[1], 0.0), 0.0);
+	REQUIRE_ARRAY_ULP(buf, ref, 3, 2);
+}
+
+// The diff Psi prints of `actual` against `expected`, into `text` (with its colours taken out) instead of stdout
+static void captureDiff(char* const text, const psi_ull size, const char* const actual, const char* const expected) {
+    psiBufferStruct* const capture = psiThreadContext.capture;
+    psiBufferStruct* const captureReport = psiThreadContext.captureReport;
+    psiBufferStruct out = {PSI_NULL, 0, 0};
+    psi_ull n = 0;
+    const int isTracking = psiPauseAllocTracking_();
+
+    psiThreadContext.capture = &out;
+    psiThreadContext.captureReport = PSI_NULL;
+    psiPrintStrDiff_(actual, strlen(actual), expected, strlen(expected), "actual", "expected", "actual");
+    psiThreadContext.capture = capture;
+    psiThreadContext.captureReport = captureReport;
+    for(psi_ull i = 0; i < out.size && n + 1 < size; i++) {
+        if(out.data[i] == '\033') {
+            while(out.data[i] != 'm')
+                i++;
+        } else {
+            text[n++] = out.data[i];
+        }
+    }
+    text[n] = '\0';
+    free(out.data);
+    psiResumeAllocTracking_(isTracking);
+}
+
+TEST(c11, psiSchedulerNext) {
+    // Worker 0 gets positions 0 and 4, the others one each
+    const psi_ull byDuration[5] = {0, 1, 2, 3, 4};
+    psi_ull schedule[5], position;
+    psi_u64 ranges[4];
+    psiSchedulerStruct scheduler;
+    psiSchedulerInit(&scheduler, schedule, ranges, byDuration, 5, 4);
+
+    REQUIRE(psiSchedulerNext(&scheduler, 1, &position));
+    CHECK_EQ(position, 1);
+    // Its own range is empty: it steals the back half of the fullest one (worker 0's)
+    REQUIRE(psiSchedulerNext(&scheduler, 1, &position));
+    CHECK_EQ(position, 4);
+    // A range of one test is stolen whole: worker 0 is left with nothing, and steals in turn
+    REQUIRE(psiSchedulerNext(&scheduler, 1, &position));
+    CHECK_EQ(position, 0);
+    REQUIRE(psiSchedulerNext(&scheduler, 2, &position));
+    CHECK_EQ(position, 2);
+    REQUIRE(psiSchedulerNext(&scheduler, 0, &position));
+    CHECK_EQ(position, 3);
+    for(psi_ull w = 0; w < 4; w++)
+        CHECK_FALSE(psiSchedulerNext(&scheduler, w, &position));
+    CHECK_FALSE(psiSchedulerHasWork(&scheduler));
+}
+
+#ifdef PSI_HAS_THREADS_
+#define NUM_SCHEDULED_TESTS     20000
+#define NUM_SCHEDULER_WORKERS   8
+
+typedef struct SchedulerWorker {
+    psiSchedulerStruct* scheduler;
+    psi_ull worker;
+    psi_u64* timesRun;
+} SchedulerWorker;
+
+PSI_THREAD_FUNC(schedulerWorkerMain, arg) {
+    SchedulerWorker* const worker = PSI_PTRCAST(SchedulerWorker*, arg);
+    psi_ull position;
+    // Workers take turns being slow, so that everybody ends up stealing from everybody
+    while(psiSchedulerNext(worker->scheduler, worker->worker, &position)) {
+        PSI_ATOMIC_FETCH_ADD(&worker->timesRun[position], 1);
+        if(position % NUM_SCHEDULER_WORKERS == worker->worker) {
+            for(volatile int i = 0; i < 100; i++) {}
+        }
+    }
+    PSI_THREAD_RETURN;
+}
+
+TEST(c11, psiSchedulerNext_Threads) {
+    psi_ull* const byDuration = PSI_PTRCAST(psi_ull*, malloc(NUM_SCHEDULED_TESTS * sizeof(psi_ull)));
+    psi_ull* const schedule = PSI_PTRCAST(psi_ull*, malloc(NUM_SCHEDULED_TESTS * sizeof(psi_ull)));
+    psi_u64* const timesRun = PSI_PTRCAST(psi_u64*, calloc(NUM_SCHEDULED_TESTS, sizeof(psi_u64)));
+    psi_u64 ranges[NUM_SCHEDULER_WORKERS];
+    psi_thread_t threads[NUM_SCHEDULER_WORKERS];
+    SchedulerWorker workers[NUM_SCHEDULER_WORKERS];
+    psiSchedulerStruct scheduler;
+    psi_ull numThreads = 0;
+
+    REQUIRE(byDuration != PSI_NULL && schedule != PSI_NULL && timesRun != PSI_NULL);
+    for(psi_ull i = 0; i < NUM_SCHEDULED_TESTS; i++)
+        byDuration[i] = NUM_SCHEDULED_TESTS - 1 - i;
+    psiSchedulerInit(&scheduler, schedule, ranges, byDuration, NUM_SCHEDULED_TESTS, NUM_SCHEDULER_WORKERS);
+    for(psi_ull w = 0; w < NUM_SCHEDULER_WORKERS; w++) {
+        workers[w].scheduler = &scheduler;
+        workers[w].worker = w;
+        workers[w].timesRun = timesRun;
+        if(psiThreadCreate(&threads[numThreads], schedulerWorkerMain, &workers[w]))
+            numThreads++;
+    }
+    // Whatever the threads that couldn't be started would have run is stolen by the others (or by this one)
+    if(numThreads == 0)
+        schedulerWorkerMain(&workers[0]);
+    for(psi_ull t = 0; t < numThreads; t++)
+        psiThreadJoin(threads[t]);
+
+    for(psi_ull i = 0; i < NUM_SCHEDULED_TESTS; i++)
+        REQUIRE_EQ(timesRun[i], 1);
+    free(byDuration);
+    free(schedule);
+    free(timesRun);
+}
+#endif // PSI_HAS_THREADS_
+
+#define NUM_SHARDED_TESTS   200
+#define NUM_SHARDS          7
+
+// Which shard each of `tests` is in, checking that it's in exactly one
+static void shardOf(const psiTestSuiteStruct* const tests, const psi_ull numTests, const double* const durations,
+                    psi_ull* const shards) {
+    char isInShard[NUM_SHARDED_TESTS + 1];
+    for(psi_ull i = 0; i < numTests; i++)
+        shards[i] = NUM_SHARDS;
+    for(psi_ull s = 0; s < NUM_SHARDS; s++) {
+        psiShardTests_(tests, numTests, durations, NUM_SHARDS, s, isInShard);
+        for(psi_ull i = 0; i < numTests; i++) {
+            if(isInShard[i]) {
+                CHECK(shards[i] == NUM_SHARDS, "A test is in more than one shard");
+                shards[i] = s;
+            }
+        }
+    }
+    for(psi_ull i = 0; i < numTests; i++)
+        CHECK(shards[i] < NUM_SHARDS, "A test isn't in any shard");
+}
+
+TEST(c11, psiShardTests_) {
+    psiTestSuiteStruct tests[NUM_SHARDED_TESTS + 1];
+    char names[NUM_SHARDED_TESTS + 1][32];
+    double durations[NUM_SHARDED_TESTS];
+    psi_ull shards[NUM_SHARDED_TESTS + 1], shardsAfter[NUM_SHARDED_TESTS + 1];
+
+    memset(tests, 0, sizeof(tests));
+    for(psi_ull i = 0; i <= NUM_SHARDED_TESTS; i++) {
+        PSI_SNPRINTF(names[i], sizeof(names[i]), "suite.test%d", PSI_CAST(int, i));
+        tests[i].name = names[i];
+    }
+    for(psi_ull i = 0; i < NUM_SHARDED_TESTS; i++)
+        durations[i] = i % 5 == 0 ? -1 : PSI_CAST(double, ((i * 7919) % 1000));
+
+    // By hash, and balanced by duration: every test is in exactly one shard either way
+    shardOf(tests + 1, NUM_SHARDED_TESTS, PSI_NULL, shards);
+    shardOf(tests + 1, NUM_SHARDED_TESTS, durations, shardsAfter);
+
+    // By hash, a test that's added doesn't move any of the others
+    shardOf(tests, NUM_SHARDED_TESTS + 1, PSI_NULL, shardsAfter);
+    for(psi_ull i = 0; i < NUM_SHARDED_TESTS; i++)
+        CHECK_EQ(shardsAfter[i + 1], shards[i]);
+}
+
+TEST(c11, psiMannWhitneyU) {
+    double slower[10], faster[10];
+    for(int i = 0; i < 10; i++) {
+        faster[i] = 100 + i;
+        slower[i] = 200 + i;
+    }
+    // U = 0: z = (50 - 0.5) / sqrt(175), p = erfc(z / sqrt(2)) - as scipy's `mannwhitneyu(method="asymptotic")`
+    CHECK_LT(fabs(psiMannWhitneyU(faster, 10, slower, 10) - 1.826718e-4), 1e-9);
+    CHECK_LT(fabs(psiMannWhitneyU(slower, 10, faster, 10) - 1.826718e-4), 1e-9);
+
+    // The same samples, or nothing but ties, can't tell anything apart
+    CHECK_EQ(psiMannWhitneyU(faster, 10, faster, 10), 1.0);
+    for(int i = 0; i < 10; i++)
+        slower[i] = faster[0];
+    CHECK_EQ(psiMannWhitneyU(slower, 10, slower, 10), 1.0);
+}
+
+TEST(c11, psiFindByte_) {
+    psi_u8 a[128], b[128];
+    psiRngStruct rng;
+    psiRngSeed(&rng, 1);
+    for(int round = 0; round < 4000; round++) {
+        // Lengths on either side of every vector width, and runs of equal or different bytes of any length
+        const psi_ull size = psiRngNext(&rng) % 100;
+        const psi_ull from = psiRngNext(&rng) % (size + 1);
+        const psi_u64 alphabet = round % 3 == 0 ? 2 : 256;
+        const psi_u64 runs = 1 + psiRngNext(&rng) % 40;
+        for(psi_ull i = 0; i < size; i++) {
+            a[i] = PSI_CAST(psi_u8, psiRngNext(&rng) % alphabet);
+            b[i] = psiRngNext(&rng) % runs == 0 ? PSI_CAST(psi_u8, psiRngNext(&rng) % alphabet) : a[i];
+        }
+        for(int findEqual = 0; findEqual <= 1; findEqual++) {
+            psi_ull expected = from;
+            while(expected < size && (a[expected] == b[expected]) != findEqual)
+                expected++;
+            REQUIRE_EQ(psiFindByte_(a, b, from, size, findEqual), expected);
+        }
+    }
+}
+
+TEST(c11, psiCommonSuffix_) {
+    psi_u8 a[100], b[100];
+    psiRngStruct rng;
+    psiRngSeed(&rng, 1);
+    for(int round = 0; round < 2000; round++) {
+        const psi_ull size = psiRngNext(&rng) % 100;
+        const psi_ull from = size > 0 ? psiRngNext(&rng) % size : 0;
+        psi_ull expected = 0;
+        for(psi_ull i = 0; i < size; i++)
+            a[i] = b[i] = PSI_CAST(psi_u8, psiRngNext(&rng) % 4);
+        // Some bytes differ at or before `from`, or none do
+        for(psi_ull i = 0; i <= from && i < size && round % 4 != 0; i++)
+            b[i] = PSI_CAST(psi_u8, psiRngNext(&rng) % 4);
+        while(expected < size && a[size - 1 - expected] == b[size - 1 - expected])
+            expected++;
+        REQUIRE_EQ(psiCommonSuffix_(a + size, b + size, size), expected);
+    }
+}
+
+TEST(c11, psiPrintStrDiff_) {
+    char diff[1024];
+    captureDiff(diff, sizeof(diff), "a\nb\nX\nc\n", "a\nb\nc\n");
+    CHECK_NE(strstr(diff, "@@ -1,3 +1,4 @@\n              a\n              b\n"
+                          "             +X\n              c\n"), PSI_NULL);
+    captureDiff(diff, sizeof(diff), "a\nc\n", "a\nb\nc\n");
+    CHECK_NE(strstr(diff, "@@ -1,3 +1,2 @@\n              a\n             -b\n              c\n"), PSI_NULL);
+
+    // A side without any lines is numbered 0, as in unified diffs
+    captureDiff(diff, sizeof(diff), "", "a\nb\n");
+    CHECK_NE(strstr(diff, "@@ -1,2 +0,0 @@\n             -a\n             -b\n"), PSI_NULL);
+    captureDiff(diff, sizeof(diff), "a\nb\n", "");
+    CHECK_NE(strstr(diff, "@@ -0,0 +1,2 @@\n             +a\n             +b\n"), PSI_NULL);
+}
+
+TEST(c11, psiPrintStrDiff_MaxBytes) {
+    char expected[4001], actual[4001], diff[4 * PSI_DIFF_MAX_BYTES_];
+    // Every line changes, which takes far more than the most the diff may print
+    for(int i = 0; i < 500; i++) {
+        memcpy(expected + i * 8, "line  0\n", 8);
+        memcpy(actual + i * 8, "LINE  1\n", 8);
+    }
+    expected[4000] = actual[4000] = '\0';
+    captureDiff(diff, sizeof(diff), actual, expected);
+    CHECK_NE(strstr(diff, "... (the diff goes on, see --diff-max-bytes)\n"), PSI_NULL);
+    CHECK_LT(strlen(diff), PSI_DIFF_MAX_BYTES_ + 512);
+}
+
 struct MyTestF {
   int foo;
 };
@@ -229,3 +509,129 @@ TEST_F(MyTestF, c2) {
     REQUIRE_EQ(42, psi->foo);
     psi->foo = 13;
 }
+
+BENCHMARK(c11, strlen) {
+    char str[64] = "The quick brown fox jumps over the lazy dog";
+    BENCHMARK_LOOP {
+        // Otherwise the compiler knows the length of `str` up front
+        psiDoNotOptimize(&str[0]);
+        psiDoNotOptimize(strlen(str));
+    }
+}
+
+BENCHMARK_RANGE(c11, memset, 1024, 262144, 4) {
+    unsigned char* const buffer = PSI_PTRCAST(unsigned char*, malloc(n));
+    REQUIRE(buffer != PSI_NULL);
+    BENCHMARK_LOOP {
+        memset(buffer, 0x5A, n);
+        psiDoNotOptimize(&buffer[0]);
+        psiClobberMemory();
+    }
+    CHECK_EQ(buffer[n - 1], 0x5A);
+    free(buffer);
+}
+
+static void dynamicTest(void* const ctx) {
+    CHECK_EQ(*PSI_PTRCAST(int*, ctx), 42);
+}
+
+PSI_TEST_INITIALIZER(registerDynamicTests) {
+    static int answer = 42;
+    psiRegisterTest("c.psiRegisterTest", dynamicTest, &answer);
+}
+
+PROPERTY(c11, psiGenString) {
+    char str[33];
+    const psi_i64 minLength = psiGenInt(0, 16);
+    const psi_ull length = psiGenString(str, PSI_CAST(psi_ull, minLength), 32);
+    CHECK_GE(length, PSI_CAST(psi_ull, minLength));
+    CHECK_LE(length, 32);
+    CHECK_EQ(strlen(str), length);
+}
+
+// The sum the last run of `sumIsSmall` drew, on the thread that ran it
+static PSI_THREAD_LOCAL psi_i64 drawnSum;
+
+// Fails once `a + b` reaches 1000: the simplest counterexample adds up to exactly that
+static void sumIsSmall(void) {
+    const psi_i64 a = psiGenInt(-1000000, 1000000);
+    const psi_i64 b = psiGenInt(-1000000, 1000000);
+    drawnSum = a + b;
+    if(drawnSum >= 1000)
+        psiThreadContext.hasCurrentTestFailed = 1;
+}
+
+TEST(c11, psiPropertyShrink_) {
+    psiBufferStruct* const capture = psiThreadContext.capture;
+    psiBufferStruct* const captureReport = psiThreadContext.captureReport;
+    psiBufferStruct out = {PSI_NULL, 0, 0};
+    const int isTracking = psiPauseAllocTracking_();
+    int hasFailed;
+
+    // The failing property's report is thrown away, and so is its failure once it's been checked
+    psiThreadContext.capture = &out;
+    psiThreadContext.captureReport = PSI_NULL;
+    psiRunProperty_(sumIsSmall);
+    hasFailed = psiThreadContext.hasCurrentTestFailed;
+    psiThreadContext.hasCurrentTestFailed = 0;
+    psiThreadContext.capture = capture;
+    psiThreadContext.captureReport = captureReport;
+    free(out.data);
+    psiResumeAllocTracking_(isTracking);
+
+    REQUIRE(hasFailed);
+    // The counterexample shown last is the one it shrank to
+    CHECK_EQ(drawnSum, 1000);
+}
+
+#ifdef PSI_UNIX_
+TEST(c11, psiFuzzCrashHandler_) {
+    static const psi_u8 input[] = "crashing input";
+    char dir[] = "/tmp/psiFuzzCrashXXXXXX";
+    char path[64], saved[sizeof(input)];
+    FILE* file;
+    pid_t pid;
+    int status = 0;
+
+    REQUIRE(mkdtemp(dir) != PSI_NULL);
+    psiFlushOutput();
+    pid = fork();
+    REQUIRE_GE(pid, 0);
+    if(pid == 0) {
+        // Crash the way a fuzz target would, with the message going nowhere
+        const int devNull = open("/dev/null", O_WRONLY);
+        if(chdir(dir) != 0 || devNull < 0 || dup2(devNull, STDERR_FILENO) < 0)
+            _exit(1);
+        psiFuzzSetHandlers_(psi_true);
+        psiFuzzInput_ = input;
+        psiFuzzInputSize_ = sizeof(input);
+        raise(SIGSEGV);
+        _exit(0);
+    }
+    REQUIRE_EQ(waitpid(pid, &status, 0), pid);
+    CHECK(WIFSIGNALED(status) && WTERMSIG(status) == SIGSEGV);
+
+    // Saved as `crash-<hash>`, exactly
+    PSI_SNPRINTF(path, sizeof(path), "%s/crash-", dir);
+    psiFuzzInputName_(input, sizeof(input), path + strlen(path));
+    file = fopen(path, "rb");
+    REQUIRE(file != PSI_NULL, "The crashing input wasn't saved under its name");
+    CHECK_EQ(fread(saved, 1, sizeof(saved), file), sizeof(input));
+    CHECK_BUF_EQ(saved, input, sizeof(input));
+    fclose(file);
+    remove(path);
+    CHECK(rmdir(dir) == 0, "Something else was saved next to it");
+}
+#endif // PSI_UNIX_
+
+PSI_FUZZ(c11, psiNextRow)(const psi_u8* data, size_t size) {
+    const char* const text = PSI_PTRCAST(const char*, data);
+    psiFieldStruct row;
+    psi_ull offset = 0;
+    psi_ull lineNumber = 0;
+    while(psiNextRow(text, size, &offset, &row, &lineNumber)) {
+        REQUIRE(row.data >= text && row.data + row.size <= text + size);
+        CHECK(memchr(row.data, '\n', row.size) == PSI_NULL);
+        CHECK_LE(offset, size);
+    }
+}
@@ -1,4 +1,5 @@
 #include <psi/psi.h>
+#include <vector>
 // Only MSVC seems to complain about this
 // Most likely because we're trying to cross-compile with `main.c` and `test.cpp`
 #ifdef _MSC_VER
@@ -359,6 +360,17 @@ TEST(cpp11, Array) {
     CHECK_NE(cpp11, cpp11 + 1); 
 }
 
+TEST(cpp, REQUIRE_NO_ALLOC) {
+    std::vector<int> values(64);
+    REQUIRE_NO_ALLOC {
+        values.assign(32, 1);
+    }
+    REQUIRE_MAX_ALLOCS(1) {
+        values.resize(128);
+    }
+    CHECK_EQ(values[31], 1);
+}
+
 TEST(cpp, Section) {
     SECTION("#1") {
         CHECK_NE(1, 2);
@@ -394,3 +406,14 @@ TEST_F(Stack, TestStackDetails) {
     REQUIRE_STREQ(psi->name, "Hello");
     REQUIRE_EQ(psi->pop(), 123);
 }
+
+BENCHMARK(cpp, fill) {
+    int values[64];
+    psiDoNotOptimize(&values[0]);
+    BENCHMARK_LOOP {
+        for(int i = 0; i < 64; i++)
+            values[i] = i;
+        psiClobberMemory();
+    }
+    CHECK_EQ(values[63], 63);
+}
@@ -0,0 +1,82 @@
+"""
+Merges the XUnit files written by each shard of a sharded run (`--shard-index=I --shard-count=N --output=<FILE>`)
+into a single report.
+
+Usage:
+    python3 tools/mergeShards.py --output=merged.xml shard0.xml shard1.xml ...
+
+Prints the combined totals, and exits with a non-zero status if any test failed or if a test was run by more
+than one shard (which means the shards were not run with the same `--shard-count`/timing cache).
+"""
+
+import re
+import sys
+
+TESTCASE = re.compile(r'<testcase name="([^"]*)">(.*?)</testcase>', re.DOTALL)
+
+
+def read_shard(filename):
+    with open(filename, 'r', encoding='utf-8', errors='replace') as f:
+        text = f.read()
+
+    if '</testsuites>' not in text:
+        print(f'[WARNING] {filename} is incomplete - did that shard crash?')
+    return TESTCASE.findall(text)
+
+
+def write_report(filename, testcases, num_failed):
+    with open(filename, 'w', encoding='utf-8') as f:
+        f.write('<?xml version="1.0" encoding="UTF-8"?>\n')
+        f.write(f'<testsuites tests="{len(testcases)}" failures="{num_failed}" name="All">\n')
+        f.write(f'<testsuite name="Tests" tests="{len(testcases)}" failures="{num_failed}">\n')
+        for name, body in testcases:
+            f.write(f'<testcase name="{name}">{body}</testcase>\n')
+        f.write('</testsuite>\n</testsuites>\n')
+
+
+def main(argv):
+    output = None
+    shards = []
+    for arg in argv:
+        if arg.startswith('--output='):
+            output = arg[len('--output='):]
+        elif arg.startswith('-'):
+            print(f'[ERROR] Unknown option {arg}')
+            print(__doc__)
+            return 2
+        else:
+            shards.append(arg)
+
+    if not shards:
+        print(__doc__)
+        return 2
+
+    testcases = []
+    seen = {}
+    duplicates = []
+    for shard in shards:
+        for name, body in read_shard(shard):
+            if name in seen:
+                duplicates.append((name, seen[name], shard))
+                continue
+            seen[name] = shard
+            testcases.append((name, body))
+
+    failed = [name for name, body in testcases if '<failure' in body]
+
+    if output is not None:
+        write_report(output, testcases, len(failed))
+
+    print(f'{len(shards)} shards, {len(testcases)} test suites ran')
+    print(f'    Passed: {len(testcases) - len(failed)}')
+    print(f'    Failed: {len(failed)}')
+    for name in failed:
+        print(f'  [ FAILED ] {name}')
+    for name, first, second in duplicates:
+        print(f'[WARNING] {name} ran in both {first} and {second}')
+
+    return 1 if failed or duplicates else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))